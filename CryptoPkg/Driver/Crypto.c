@@ -3135,6 +3135,45 @@ CryptoServicePkcs7Verify (
   return CALL_BASECRYPTLIB (Pkcs.Services.Pkcs7Verify, Pkcs7Verify, (P7Data, P7Length, TrustedCert, CertLength, InData, DataLength), FALSE);
 }
 
+/**
+  Verifies the validity of a PKCS#7 signed data as described in "PKCS #7:
+  Cryptographic Message Syntax Standard", against a trusted certificate that
+  has already been parsed with X509ConstructCertificate(). The input signed
+  data could be wrapped in a ContentInfo structure.
+
+  This is Pkcs7Verify() without the parsing of the trusted certificate, for
+  callers that verify many signed data against the same certificates.
+
+  If P7Data, TrustedX509Cert or InData is NULL, then return FALSE.
+  If P7Length or DataLength overflow, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]  P7Data           Pointer to the PKCS#7 message to verify.
+  @param[in]  P7Length         Length of the PKCS#7 message in bytes.
+  @param[in]  TrustedX509Cert  Pointer to the X509 object of a trusted/root
+                               certificate, which is used for certificate chain
+                               verification.
+  @param[in]  InData           Pointer to the content to be verified.
+  @param[in]  DataLength       Length of InData in bytes.
+
+  @retval  TRUE  The specified PKCS#7 signed data is valid.
+  @retval  FALSE Invalid PKCS#7 signed data.
+  @retval  FALSE This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+CryptoServicePkcs7VerifyWithX509 (
+  IN  CONST UINT8  *P7Data,
+  IN  UINTN        P7Length,
+  IN  VOID         *TrustedX509Cert,
+  IN  CONST UINT8  *InData,
+  IN  UINTN        DataLength
+  )
+{
+  return CALL_BASECRYPTLIB (Pkcs.Services.Pkcs7VerifyWithX509, Pkcs7VerifyWithX509, (P7Data, P7Length, TrustedX509Cert, InData, DataLength), FALSE);
+}
+
 /**
   This function receives a PKCS7 formatted signature, and then verifies that
   the specified Enhanced or Extended Key Usages (EKU's) are present in the end-entity
@@ -4470,6 +4509,456 @@ CryptoServiceTlsGetCertRevocationList (
   return CALL_BASECRYPTLIB (TlsGet.Services.CertRevocationList, TlsGetCertRevocationList, (Data, DataSize), EFI_UNSUPPORTED);
 }
 
+/**
+  Carries out the RSA-SSA signature generation with EMSA-PSS encoding scheme.
+
+  This function carries out the RSA-SSA signature generation with EMSA-PSS encoding scheme defined in
+  RFC 8017.
+  Mask generation function is the same as the message digest algorithm.
+  If the Signature buffer is too small to hold the contents of signature, FALSE
+  is returned and SigSize is set to the required buffer size to obtain the signature.
+
+  If RsaContext is NULL, then return FALSE.
+  If Message is NULL, then return FALSE.
+  If MsgSize is zero or > INT_MAX, then return FALSE.
+  If DigestLen is NOT 32, 48 or 64, return FALSE.
+  If SaltLen is not equal to DigestLen, then return FALSE.
+  If SigSize is large enough but Signature is NULL, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]      RsaContext   Pointer to RSA context for signature generation.
+  @param[in]      Message      Pointer to octet message to be signed.
+  @param[in]      MsgSize      Size of the message in bytes.
+  @param[in]      DigestLen    Length of the digest in bytes to be used for RSA signature operation.
+  @param[in]      SaltLen      Length of the salt in bytes to be used for PSS encoding.
+  @param[out]     Signature    Pointer to buffer to receive RSA PSS signature.
+  @param[in, out] SigSize      On input, the size of Signature buffer in bytes.
+                               On output, the size of data returned in Signature buffer in bytes.
+
+  @retval  TRUE   Signature successfully generated in RSASSA-PSS.
+  @retval  FALSE  Signature generation failed.
+  @retval  FALSE  SigSize is too small.
+  @retval  FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+CryptoServiceRsaPssSign (
+  IN      VOID         *RsaContext,
+  IN      CONST UINT8  *Message,
+  IN      UINTN        MsgSize,
+  IN      UINT16       DigestLen,
+  IN      UINT16       SaltLen,
+  OUT     UINT8        *Signature,
+  IN OUT  UINTN        *SigSize
+  )
+{
+  return CALL_BASECRYPTLIB (Rsa.Services.PssSign, RsaPssSign, (RsaContext, Message, MsgSize, DigestLen, SaltLen, Signature, SigSize), FALSE);
+}
+
+/**
+  Verifies the RSA signature with RSASSA-PSS signature scheme defined in RFC 8017.
+  Implementation determines salt length automatically from the signature encoding.
+  Mask generation function is the same as the message digest algorithm.
+  Salt length should be equal to digest length.
+
+  @param[in]  RsaContext      Pointer to RSA context for signature verification.
+  @param[in]  Message         Pointer to octet message to be verified.
+  @param[in]  MsgSize         Size of the message in bytes.
+  @param[in]  Signature       Pointer to RSASSA-PSS signature to be verified.
+  @param[in]  SigSize         Size of signature in bytes.
+  @param[in]  DigestLen       Length of digest for RSA operation.
+  @param[in]  SaltLen         Salt length for PSS encoding.
+
+  @retval  TRUE   Valid signature encoded in RSASSA-PSS.
+  @retval  FALSE  Invalid signature or invalid RSA context.
+
+**/
+BOOLEAN
+EFIAPI
+CryptoServiceRsaPssVerify (
+  IN  VOID         *RsaContext,
+  IN  CONST UINT8  *Message,
+  IN  UINTN        MsgSize,
+  IN  CONST UINT8  *Signature,
+  IN  UINTN        SigSize,
+  IN  UINT16       DigestLen,
+  IN  UINT16       SaltLen
+  )
+{
+  return CALL_BASECRYPTLIB (Rsa.Services.PssVerify, RsaPssVerify, (RsaContext, Message, MsgSize, Signature, SigSize, DigestLen, SaltLen), FALSE);
+}
+
+/**
+  Sets a session saved from an earlier connection to the same server with
+  TlsGetResumableSession(), to be resumed by the TLS/SSL connect.
+
+  Resumption skips the certificate exchange and the key exchange of a full
+  handshake. If the server declines to resume the session, a full handshake
+  is performed and TlsIsSessionResumed() returns FALSE.
+
+  @param[in]  Tls           Pointer to the TLS object.
+  @param[in]  Data          Pointer to the session data returned by
+                            TlsGetResumableSession().
+  @param[in]  DataSize      The size of data buffer in bytes.
+
+  @retval  EFI_SUCCESS             The session was set successfully.
+  @retval  EFI_INVALID_PARAMETER   The parameter is invalid.
+  @retval  EFI_ABORTED             Invalid session data.
+
+**/
+EFI_STATUS
+EFIAPI
+CryptoServiceTlsSetResumableSession (
+  IN     VOID   *Tls,
+  IN     VOID   *Data,
+  IN     UINTN  DataSize
+  )
+{
+  return CALL_BASECRYPTLIB (TlsSet.Services.ResumableSession, TlsSetResumableSession, (Tls, Data, DataSize), EFI_UNSUPPORTED);
+}
+
+/**
+  Gets the session of the specified TLS connection in the form accepted by
+  TlsSetResumableSession().
+
+  The session carries the session ID and master secret, or the session ticket
+  issued by the server, so that the next connection to the same server can be
+  resumed with an abbreviated handshake.
+
+  @param[in]      Tls         Pointer to the TLS object.
+  @param[out]     Data        Pointer to the data buffer to receive the session
+                              data.
+  @param[in,out]  DataSize    The size of data buffer in bytes.
+
+  @retval  EFI_SUCCESS             The session data was returned successfully.
+  @retval  EFI_INVALID_PARAMETER   The parameter is invalid.
+  @retval  EFI_NOT_FOUND           The connection has no resumable session.
+  @retval  EFI_BUFFER_TOO_SMALL    The Data is too small to hold the data.
+
+**/
+EFI_STATUS
+EFIAPI
+CryptoServiceTlsGetResumableSession (
+  IN     VOID   *Tls,
+  OUT    VOID   *Data,
+  IN OUT UINTN  *DataSize
+  )
+{
+  return CALL_BASECRYPTLIB (TlsGet.Services.ResumableSession, TlsGetResumableSession, (Tls, Data, DataSize), EFI_UNSUPPORTED);
+}
+
+/**
+  Checks if the handshake of the specified TLS connection resumed the session
+  set with TlsSetResumableSession().
+
+  @param[in]  Tls    Pointer to the TLS object.
+
+  @retval  TRUE     The session was resumed.
+  @retval  FALSE    A full handshake was performed, or the handshake has not
+                    completed.
+
+**/
+BOOLEAN
+EFIAPI
+CryptoServiceTlsIsSessionResumed (
+  IN     VOID  *Tls
+  )
+{
+  return CALL_BASECRYPTLIB (TlsGet.Services.SessionResumed, TlsIsSessionResumed, (Tls), FALSE);
+}
+
+/**
+  Allocates and Initializes one Elliptic Curve Context for subsequent use
+  with the NID.
+
+  @param[in]  Nid   Identifying number for the elliptic curve, one of
+                    CRYPTO_NID_SECP256R1, CRYPTO_NID_SECP384R1 and
+                    CRYPTO_NID_SECP521R1.
+
+  @return     Pointer to the Elliptic Curve Context that has been initialized.
+              If the allocations fails, EcNewByNid() returns NULL.
+              If the curve is not supported, EcNewByNid() returns NULL.
+              If the interface is not supported, EcNewByNid() returns NULL.
+
+**/
+VOID *
+EFIAPI
+CryptoServiceEcNewByNid (
+  IN UINTN  Nid
+  )
+{
+  return CALL_BASECRYPTLIB (Ec.Services.NewByNid, EcNewByNid, (Nid), NULL);
+}
+
+/**
+  Release the specified EC context.
+
+  If the interface is not supported, then ASSERT().
+
+  @param[in]  EcContext  Pointer to the EC context to be released.
+
+**/
+VOID
+EFIAPI
+CryptoServiceEcFree (
+  IN  VOID  *EcContext
+  )
+{
+  CALL_VOID_BASECRYPTLIB (Ec.Services.Free, EcFree, (EcContext));
+}
+
+/**
+  Sets the public key component into the established EC context.
+
+  The public key is the uncompressed point, without the leading 0x04 octet:
+  the X coordinate followed by the Y coordinate, each as a big-endian number
+  of the size of the curve.
+
+  @param[in, out]  EcContext      Pointer to EC context being set.
+  @param[in]       PublicKey      Pointer to the buffer holding the public key.
+  @param[in]       PublicKeySize  Size of the public key buffer in bytes.
+
+  @retval  TRUE   EC public key component was set successfully.
+  @retval  FALSE  Invalid EC public key component.
+  @retval  FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+CryptoServiceEcSetPubKey (
+  IN OUT  VOID   *EcContext,
+  IN      UINT8  *PublicKey,
+  IN      UINTN  PublicKeySize
+  )
+{
+  return CALL_BASECRYPTLIB (Ec.Services.SetPubKey, EcSetPubKey, (EcContext, PublicKey, PublicKeySize), FALSE);
+}
+
+/**
+  Verifies the EC-DSA signature.
+
+  The signature is the concatenation of the big-endian r and s values, each of
+  the size of the curve. The message hash is verified as is.
+
+  @param[in]  EcContext    Pointer to EC context for signature verification.
+  @param[in]  HashNid      Hash NID, one of CRYPTO_NID_SHA256,
+                           CRYPTO_NID_SHA384 and CRYPTO_NID_SHA512.
+  @param[in]  MessageHash  Pointer to octet message hash to be checked.
+  @param[in]  HashSize     Size of the message hash in bytes.
+  @param[in]  Signature    Pointer to EC-DSA signature to be verified.
+  @param[in]  SigSize      Size of signature in bytes.
+
+  @retval  TRUE   Valid signature encoded in EC-DSA.
+  @retval  FALSE  Invalid signature or invalid EC context.
+  @retval  FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+CryptoServiceEcDsaVerify (
+  IN  VOID         *EcContext,
+  IN  UINTN        HashNid,
+  IN  CONST UINT8  *MessageHash,
+  IN  UINTN        HashSize,
+  IN  CONST UINT8  *Signature,
+  IN  UINTN        SigSize
+  )
+{
+  return CALL_BASECRYPTLIB (Ec.Services.DsaVerify, EcDsaVerify, (EcContext, HashNid, MessageHash, HashSize, Signature, SigSize), FALSE);
+}
+
+/**
+  Performs AEAD AES-GCM authenticated encryption on a data buffer and additional authenticated data (AAD).
+
+  IvSize must be 12, otherwise FALSE is returned.
+  KeySize must be 16, 24 or 32, otherwise FALSE is returned.
+  TagSize must be 12, 13, 14, 15, 16, otherwise FALSE is returned.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]       Key          Pointer to the encryption key.
+  @param[in]       KeySize      Size of the encryption key in bytes.
+  @param[in]       Iv           Pointer to the IV value.
+  @param[in]       IvSize       Size of the IV value in bytes.
+  @param[in]       AData        Pointer to the additional authenticated data (AAD).
+  @param[in]       ADataSize    Size of the additional authenticated data (AAD) in bytes.
+  @param[in]       DataIn       Pointer to the input data buffer to be encrypted.
+  @param[in]       DataInSize   Size of the input data buffer in bytes.
+  @param[out]      TagOut       Pointer to a buffer that receives the authentication tag output.
+  @param[in]       TagSize      Size of the authentication tag in bytes.
+  @param[out]      DataOut      Pointer to a buffer that receives the encryption output.
+  @param[in, out]  DataOutSize  On input, size of the output buffer in bytes.
+                                On output, size of the encrypted data in bytes.
+
+  @retval TRUE   AEAD AES-GCM authenticated encryption succeeded.
+  @retval FALSE  AEAD AES-GCM authenticated encryption failed.
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+CryptoServiceAeadAesGcmEncrypt (
+  IN     CONST UINT8  *Key,
+  IN     UINTN        KeySize,
+  IN     CONST UINT8  *Iv,
+  IN     UINTN        IvSize,
+  IN     CONST UINT8  *AData,
+  IN     UINTN        ADataSize,
+  IN     CONST UINT8  *DataIn,
+  IN     UINTN        DataInSize,
+  OUT    UINT8        *TagOut,
+  IN     UINTN        TagSize,
+  OUT    UINT8        *DataOut,
+  IN OUT UINTN        *DataOutSize
+  )
+{
+  return CALL_BASECRYPTLIB (AeadAesGcm.Services.Encrypt, AeadAesGcmEncrypt, (Key, KeySize, Iv, IvSize, AData, ADataSize, DataIn, DataInSize, TagOut, TagSize, DataOut, DataOutSize), FALSE);
+}
+
+/**
+  Performs AEAD AES-GCM authenticated decryption on a data buffer and additional authenticated data (AAD).
+
+  IvSize must be 12, otherwise FALSE is returned.
+  KeySize must be 16, 24 or 32, otherwise FALSE is returned.
+  TagSize must be 12, 13, 14, 15, 16, otherwise FALSE is returned.
+  If authentication fails, FALSE is returned and the output buffer is cleared.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]       Key          Pointer to the encryption key.
+  @param[in]       KeySize      Size of the encryption key in bytes.
+  @param[in]       Iv           Pointer to the IV value.
+  @param[in]       IvSize       Size of the IV value in bytes.
+  @param[in]       AData        Pointer to the additional authenticated data (AAD).
+  @param[in]       ADataSize    Size of the additional authenticated data (AAD) in bytes.
+  @param[in]       DataIn       Pointer to the input data buffer to be decrypted.
+  @param[in]       DataInSize   Size of the input data buffer in bytes.
+  @param[in]       Tag          Pointer to a buffer that contains the authentication tag.
+  @param[in]       TagSize      Size of the authentication tag in bytes.
+  @param[out]      DataOut      Pointer to a buffer that receives the decryption output.
+  @param[in, out]  DataOutSize  On input, size of the output buffer in bytes.
+                                On output, size of the decrypted data in bytes.
+
+  @retval TRUE   AEAD AES-GCM authenticated decryption succeeded.
+  @retval FALSE  AEAD AES-GCM authenticated decryption failed.
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+CryptoServiceAeadAesGcmDecrypt (
+  IN     CONST UINT8  *Key,
+  IN     UINTN        KeySize,
+  IN     CONST UINT8  *Iv,
+  IN     UINTN        IvSize,
+  IN     CONST UINT8  *AData,
+  IN     UINTN        ADataSize,
+  IN     CONST UINT8  *DataIn,
+  IN     UINTN        DataInSize,
+  IN     CONST UINT8  *Tag,
+  IN     UINTN        TagSize,
+  OUT    UINT8        *DataOut,
+  IN OUT UINTN        *DataOutSize
+  )
+{
+  return CALL_BASECRYPTLIB (AeadAesGcm.Services.Decrypt, AeadAesGcmDecrypt, (Key, KeySize, Iv, IvSize, AData, ADataSize, DataIn, DataInSize, Tag, TagSize, DataOut, DataOutSize), FALSE);
+}
+
+/**
+  Performs AES-XTS encryption on consecutive data units.
+
+  The tweak of each data unit is the 128-bit little-endian encoding of its
+  data unit number, as in IEEE Std 1619-2007. The first data unit of Input
+  has the number DataUnitNumber, the next one DataUnitNumber + 1, and so on,
+  so a run of disk sectors is encrypted with one call.
+  DataUnitSize need not be a multiple of the block size (16 bytes): the last
+  partial block of each data unit uses ciphertext stealing.
+
+  If Key is NULL, then return FALSE.
+  If KeySize is not 32 (AES-128) or 64 (AES-256), then return FALSE.
+  If the two halves of Key are equal, then return FALSE.
+  If DataUnitSize is smaller than 16 or larger than 2^20 blocks, then return FALSE.
+  If InputSize is 0 or not a multiple of DataUnitSize, then return FALSE.
+  If Input or Output is NULL, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]   Key             Pointer to the key, the data key followed by
+                               the tweak key.
+  @param[in]   KeySize         Size of the key in bytes.
+  @param[in]   DataUnitNumber  Data unit number of the first data unit.
+  @param[in]   DataUnitSize    Size of a data unit in bytes.
+  @param[in]   Input           Pointer to the buffer containing the data to be encrypted.
+  @param[in]   InputSize       Size of the Input buffer in bytes.
+  @param[out]  Output          Pointer to a buffer of InputSize bytes that
+                               receives the AES-XTS encryption output.
+
+  @retval TRUE   AES-XTS encryption succeeded.
+  @retval FALSE  AES-XTS encryption failed.
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+CryptoServiceAesXtsEncrypt (
+  IN   CONST UINT8  *Key,
+  IN   UINTN        KeySize,
+  IN   UINT64       DataUnitNumber,
+  IN   UINTN        DataUnitSize,
+  IN   CONST UINT8  *Input,
+  IN   UINTN        InputSize,
+  OUT  UINT8        *Output
+  )
+{
+  return CALL_BASECRYPTLIB (AesXts.Services.Encrypt, AesXtsEncrypt, (Key, KeySize, DataUnitNumber, DataUnitSize, Input, InputSize, Output), FALSE);
+}
+
+/**
+  Performs AES-XTS decryption on consecutive data units.
+
+  The tweak of each data unit is the 128-bit little-endian encoding of its
+  data unit number, as in IEEE Std 1619-2007. The first data unit of Input
+  has the number DataUnitNumber, the next one DataUnitNumber + 1, and so on,
+  so a run of disk sectors is decrypted with one call.
+  DataUnitSize need not be a multiple of the block size (16 bytes): the last
+  partial block of each data unit uses ciphertext stealing.
+
+  If Key is NULL, then return FALSE.
+  If KeySize is not 32 (AES-128) or 64 (AES-256), then return FALSE.
+  If the two halves of Key are equal, then return FALSE.
+  If DataUnitSize is smaller than 16 or larger than 2^20 blocks, then return FALSE.
+  If InputSize is 0 or not a multiple of DataUnitSize, then return FALSE.
+  If Input or Output is NULL, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]   Key             Pointer to the key, the data key followed by
+                               the tweak key.
+  @param[in]   KeySize         Size of the key in bytes.
+  @param[in]   DataUnitNumber  Data unit number of the first data unit.
+  @param[in]   DataUnitSize    Size of a data unit in bytes.
+  @param[in]   Input           Pointer to the buffer containing the data to be decrypted.
+  @param[in]   InputSize       Size of the Input buffer in bytes.
+  @param[out]  Output          Pointer to a buffer of InputSize bytes that
+                               receives the AES-XTS decryption output.
+
+  @retval TRUE   AES-XTS decryption succeeded.
+  @retval FALSE  AES-XTS decryption failed.
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+CryptoServiceAesXtsDecrypt (
+  IN   CONST UINT8  *Key,
+  IN   UINTN        KeySize,
+  IN   UINT64       DataUnitNumber,
+  IN   UINTN        DataUnitSize,
+  IN   CONST UINT8  *Input,
+  IN   UINTN        InputSize,
+  OUT  UINT8        *Output
+  )
+{
+  return CALL_BASECRYPTLIB (AesXts.Services.Decrypt, AesXtsDecrypt, (Key, KeySize, DataUnitNumber, DataUnitSize, Input, InputSize, Output), FALSE);
+}
+
 const EDKII_CRYPTO_PROTOCOL  mEdkiiCrypto = {
   /// Version
   CryptoServiceGetCryptoVersion,
@@ -4670,5 +5159,25 @@ const EDKII_CRYPTO_PROTOCOL  mEdkiiCrypto = {
   CryptoServiceTlsGetCaCertificate,
   CryptoServiceTlsGetHostPublicCert,
   CryptoServiceTlsGetHostPrivateKey,
-  CryptoServiceTlsGetCertRevocationList
+  CryptoServiceTlsGetCertRevocationList,
+  /// RSA PSS
+  CryptoServiceRsaPssSign,
+  CryptoServiceRsaPssVerify,
+  /// TLS (Continued)
+  CryptoServiceTlsSetResumableSession,
+  CryptoServiceTlsGetResumableSession,
+  CryptoServiceTlsIsSessionResumed,
+  /// EC
+  CryptoServiceEcNewByNid,
+  CryptoServiceEcFree,
+  CryptoServiceEcSetPubKey,
+  CryptoServiceEcDsaVerify,
+  /// AEAD AES-GCM
+  CryptoServiceAeadAesGcmEncrypt,
+  CryptoServiceAeadAesGcmDecrypt,
+  /// AES-XTS
+  CryptoServiceAesXtsEncrypt,
+  CryptoServiceAesXtsDecrypt,
+  /// PKCS7 (Continued)
+  CryptoServicePkcs7VerifyWithX509
 };
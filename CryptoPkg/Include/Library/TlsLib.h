@@ -439,6 +439,32 @@ TlsSetSessionId (
   IN     UINT16  SessionIdLen
   );
 
+/**
+  Sets a session saved from an earlier connection to the same server with
+  TlsGetResumableSession(), to be resumed by the TLS/SSL connect.
+
+  Resumption skips the certificate exchange and the key exchange of a full
+  handshake. If the server declines to resume the session, a full handshake
+  is performed and TlsIsSessionResumed() returns FALSE.
+
+  @param[in]  Tls           Pointer to the TLS object.
+  @param[in]  Data          Pointer to the session data returned by
+                            TlsGetResumableSession().
+  @param[in]  DataSize      The size of data buffer in bytes.
+
+  @retval  EFI_SUCCESS             The session was set successfully.
+  @retval  EFI_INVALID_PARAMETER   The parameter is invalid.
+  @retval  EFI_ABORTED             Invalid session data.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsSetResumableSession (
+  IN     VOID   *Tls,
+  IN     VOID   *Data,
+  IN     UINTN  DataSize
+  );
+
 /**
   Adds the CA to the cert store when requesting Server or Client authentication.
 
@@ -658,6 +684,50 @@ TlsGetSessionId (
   IN OUT UINT16  *SessionIdLen
   );
 
+/**
+  Gets the session of the specified TLS connection in the form accepted by
+  TlsSetResumableSession().
+
+  The session carries the session ID and master secret, or the session ticket
+  issued by the server, so that the next connection to the same server can be
+  resumed with an abbreviated handshake.
+
+  @param[in]      Tls         Pointer to the TLS object.
+  @param[out]     Data        Pointer to the data buffer to receive the session
+                              data.
+  @param[in,out]  DataSize    The size of data buffer in bytes.
+
+  @retval  EFI_SUCCESS             The session data was returned successfully.
+  @retval  EFI_INVALID_PARAMETER   The parameter is invalid.
+  @retval  EFI_NOT_FOUND           The connection has no resumable session.
+  @retval  EFI_BUFFER_TOO_SMALL    The Data is too small to hold the data.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsGetResumableSession (
+  IN     VOID   *Tls,
+  OUT    VOID   *Data,
+  IN OUT UINTN  *DataSize
+  );
+
+/**
+  Checks if the handshake of the specified TLS connection resumed the session
+  set with TlsSetResumableSession().
+
+  @param[in]  Tls    Pointer to the TLS object.
+
+  @retval  TRUE     The session was resumed.
+  @retval  FALSE    A full handshake was performed, or the handshake has not
+                    completed.
+
+**/
+BOOLEAN
+EFIAPI
+TlsIsSessionResumed (
+  IN     VOID  *Tls
+  );
+
 /**
   Gets the client random data used in the specified TLS connection.
 
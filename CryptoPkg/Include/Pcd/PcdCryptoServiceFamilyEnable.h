@@ -91,6 +91,7 @@ typedef struct {
       UINT8    Pkcs7GetCertificatesList   : 1;
       UINT8    AuthenticodeVerify         : 1;
       UINT8    ImageTimestampVerify       : 1;
+      UINT8    Pkcs7VerifyWithX509        : 1;
     } Services;
     UINT32    Family;
   } Pkcs;
@@ -125,6 +126,8 @@ typedef struct {
       UINT8    Pkcs1Verify          : 1;
       UINT8    GetPrivateKeyFromPem : 1;
       UINT8    GetPublicKeyFromX509 : 1;
+      UINT8    PssSign              : 1;
+      UINT8    PssVerify            : 1;
     } Services;
     UINT32    Family;
   } Rsa;
@@ -267,6 +270,7 @@ typedef struct {
       UINT8    HostPublicCert     : 1;
       UINT8    HostPrivateKey     : 1;
       UINT8    CertRevocationList : 1;
+      UINT8    ResumableSession   : 1;
     } Services;
     UINT32    Family;
   } TlsSet;
@@ -285,9 +289,34 @@ typedef struct {
       UINT8    HostPublicCert       : 1;
       UINT8    HostPrivateKey       : 1;
       UINT8    CertRevocationList   : 1;
+      UINT8    ResumableSession     : 1;
+      UINT8    SessionResumed       : 1;
     } Services;
     UINT32    Family;
   } TlsGet;
+  union {
+    struct {
+      UINT8    NewByNid  : 1;
+      UINT8    Free      : 1;
+      UINT8    SetPubKey : 1;
+      UINT8    DsaVerify : 1;
+    } Services;
+    UINT32    Family;
+  } Ec;
+  union {
+    struct {
+      UINT8    Encrypt : 1;
+      UINT8    Decrypt : 1;
+    } Services;
+    UINT32    Family;
+  } AeadAesGcm;
+  union {
+    struct {
+      UINT8    Encrypt : 1;
+      UINT8    Decrypt : 1;
+    } Services;
+    UINT32    Family;
+  } AesXts;
 } PCD_CRYPTO_SERVICE_FAMILY_ENABLE;
 
 #endif
@@ -0,0 +1,321 @@
+/** @file
+  AEAD (AES-GCM) Wrapper Implementation over OpenSSL.
+
+  OpenSSL selects the AES-NI and carry-less multiplication code paths at run
+  time when the processor supports them and the OpensslLib instance includes
+  the assembly, and falls back to the portable C code otherwise.
+
+  RFC 5116 - An Interface and Algorithms for Authenticated Encryption
+  NIST SP 800-38d - Cipher Modes of Operation: Galois / Counter Mode(GCM) and GMAC
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "InternalCryptLib.h"
+#include <openssl/aes.h>
+#include <openssl/evp.h>
+
+/**
+  Select the EVP cipher of AES-GCM for a key size.
+
+  @param[in]  KeySize  Size of the key in bytes.
+
+  @return The cipher, or NULL if KeySize is not 16, 24 or 32.
+
+**/
+STATIC
+CONST EVP_CIPHER *
+AeadAesGcmGetCipher (
+  IN UINTN  KeySize
+  )
+{
+  switch (KeySize) {
+    case 16:
+      return EVP_aes_128_gcm ();
+    case 24:
+      return EVP_aes_192_gcm ();
+    case 32:
+      return EVP_aes_256_gcm ();
+    default:
+      return NULL;
+  }
+}
+
+/**
+  Check the parameters common to AES-GCM encryption and decryption.
+
+  @param[in]  Key          Pointer to the encryption key.
+  @param[in]  KeySize      Size of the encryption key in bytes.
+  @param[in]  Iv           Pointer to the IV value.
+  @param[in]  IvSize       Size of the IV value in bytes.
+  @param[in]  AData        Pointer to the additional authenticated data (AAD).
+  @param[in]  ADataSize    Size of the additional authenticated data (AAD) in bytes.
+  @param[in]  DataIn       Pointer to the input data buffer.
+  @param[in]  DataInSize   Size of the input data buffer in bytes.
+  @param[in]  Tag          Pointer to the authentication tag.
+  @param[in]  TagSize      Size of the authentication tag in bytes.
+  @param[in]  DataOut      Pointer to the output data buffer.
+  @param[in]  DataOutSize  Size of the output data buffer in bytes.
+
+  @retval TRUE   The parameters are valid.
+  @retval FALSE  At least one parameter is invalid.
+
+**/
+STATIC
+BOOLEAN
+AeadAesGcmCheckParameters (
+  IN CONST UINT8  *Key,
+  IN UINTN        KeySize,
+  IN CONST UINT8  *Iv,
+  IN UINTN        IvSize,
+  IN CONST UINT8  *AData,
+  IN UINTN        ADataSize,
+  IN CONST UINT8  *DataIn,
+  IN UINTN        DataInSize,
+  IN CONST UINT8  *Tag,
+  IN UINTN        TagSize,
+  IN CONST UINT8  *DataOut,
+  IN UINTN        *DataOutSize
+  )
+{
+  if ((Key == NULL) || (Iv == NULL) || (Tag == NULL) || (DataOutSize == NULL)) {
+    return FALSE;
+  }
+
+  if ((AeadAesGcmGetCipher (KeySize) == NULL) || (IvSize != 12)) {
+    return FALSE;
+  }
+
+  if ((TagSize < 12) || (TagSize > 16)) {
+    return FALSE;
+  }
+
+  if ((ADataSize > INT_MAX) || ((AData == NULL) && (ADataSize != 0))) {
+    return FALSE;
+  }
+
+  if ((DataInSize > INT_MAX) || ((DataIn == NULL) && (DataInSize != 0))) {
+    return FALSE;
+  }
+
+  if ((*DataOutSize < DataInSize) || ((DataOut == NULL) && (DataInSize != 0))) {
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+  Performs AEAD AES-GCM authenticated encryption on a data buffer and additional authenticated data (AAD).
+
+  IvSize must be 12, otherwise FALSE is returned.
+  KeySize must be 16, 24 or 32, otherwise FALSE is returned.
+  TagSize must be 12, 13, 14, 15, 16, otherwise FALSE is returned.
+
+  @param[in]       Key          Pointer to the encryption key.
+  @param[in]       KeySize      Size of the encryption key in bytes.
+  @param[in]       Iv           Pointer to the IV value.
+  @param[in]       IvSize       Size of the IV value in bytes.
+  @param[in]       AData        Pointer to the additional authenticated data (AAD).
+  @param[in]       ADataSize    Size of the additional authenticated data (AAD) in bytes.
+  @param[in]       DataIn       Pointer to the input data buffer to be encrypted.
+  @param[in]       DataInSize   Size of the input data buffer in bytes.
+  @param[out]      TagOut       Pointer to a buffer that receives the authentication tag output.
+  @param[in]       TagSize      Size of the authentication tag in bytes.
+  @param[out]      DataOut      Pointer to a buffer that receives the encryption output.
+  @param[in, out]  DataOutSize  On input, size of the output buffer in bytes.
+                                On output, size of the encrypted data in bytes.
+
+  @retval TRUE   AEAD AES-GCM authenticated encryption succeeded.
+  @retval FALSE  AEAD AES-GCM authenticated encryption failed.
+
+**/
+BOOLEAN
+EFIAPI
+AeadAesGcmEncrypt (
+  IN     CONST UINT8  *Key,
+  IN     UINTN        KeySize,
+  IN     CONST UINT8  *Iv,
+  IN     UINTN        IvSize,
+  IN     CONST UINT8  *AData,
+  IN     UINTN        ADataSize,
+  IN     CONST UINT8  *DataIn,
+  IN     UINTN        DataInSize,
+  OUT    UINT8        *TagOut,
+  IN     UINTN        TagSize,
+  OUT    UINT8        *DataOut,
+  IN OUT UINTN        *DataOutSize
+  )
+{
+  EVP_CIPHER_CTX  *Ctx;
+  INT32           TempOutSize;
+  BOOLEAN         RetValue;
+
+  if (!AeadAesGcmCheckParameters (Key, KeySize, Iv, IvSize, AData, ADataSize, DataIn, DataInSize, TagOut, TagSize, DataOut, DataOutSize)) {
+    return FALSE;
+  }
+
+  Ctx = EVP_CIPHER_CTX_new ();
+  if (Ctx == NULL) {
+    return FALSE;
+  }
+
+  RetValue = (BOOLEAN)EVP_EncryptInit_ex (Ctx, AeadAesGcmGetCipher (KeySize), NULL, NULL, NULL);
+  if (!RetValue) {
+    goto Done;
+  }
+
+  RetValue = (BOOLEAN)EVP_CIPHER_CTX_ctrl (Ctx, EVP_CTRL_GCM_SET_IVLEN, (INT32)IvSize, NULL);
+  if (!RetValue) {
+    goto Done;
+  }
+
+  RetValue = (BOOLEAN)EVP_EncryptInit_ex (Ctx, NULL, NULL, Key, Iv);
+  if (!RetValue) {
+    goto Done;
+  }
+
+  //
+  // An empty update would be taken by OpenSSL as the end of the message, so
+  // empty AAD and data are skipped.
+  //
+  if (ADataSize != 0) {
+    RetValue = (BOOLEAN)EVP_EncryptUpdate (Ctx, NULL, &TempOutSize, AData, (INT32)ADataSize);
+    if (!RetValue) {
+      goto Done;
+    }
+  }
+
+  if (DataInSize != 0) {
+    RetValue = (BOOLEAN)EVP_EncryptUpdate (Ctx, DataOut, &TempOutSize, DataIn, (INT32)DataInSize);
+    if (!RetValue) {
+      goto Done;
+    }
+  }
+
+  RetValue = (BOOLEAN)EVP_EncryptFinal_ex (Ctx, DataOut, &TempOutSize);
+  if (!RetValue) {
+    goto Done;
+  }
+
+  RetValue = (BOOLEAN)EVP_CIPHER_CTX_ctrl (Ctx, EVP_CTRL_GCM_GET_TAG, (INT32)TagSize, (VOID *)TagOut);
+
+Done:
+  EVP_CIPHER_CTX_free (Ctx);
+  if (!RetValue) {
+    return RetValue;
+  }
+
+  *DataOutSize = DataInSize;
+
+  return RetValue;
+}
+
+/**
+  Performs AEAD AES-GCM authenticated decryption on a data buffer and additional authenticated data (AAD).
+
+  IvSize must be 12, otherwise FALSE is returned.
+  KeySize must be 16, 24 or 32, otherwise FALSE is returned.
+  TagSize must be 12, 13, 14, 15, 16, otherwise FALSE is returned.
+  If authentication fails, FALSE is returned and the output buffer is
+  cleared, so that no unauthenticated plaintext is released.
+
+  @param[in]       Key          Pointer to the encryption key.
+  @param[in]       KeySize      Size of the encryption key in bytes.
+  @param[in]       Iv           Pointer to the IV value.
+  @param[in]       IvSize       Size of the IV value in bytes.
+  @param[in]       AData        Pointer to the additional authenticated data (AAD).
+  @param[in]       ADataSize    Size of the additional authenticated data (AAD) in bytes.
+  @param[in]       DataIn       Pointer to the input data buffer to be decrypted.
+  @param[in]       DataInSize   Size of the input data buffer in bytes.
+  @param[in]       Tag          Pointer to a buffer that contains the authentication tag.
+  @param[in]       TagSize      Size of the authentication tag in bytes.
+  @param[out]      DataOut      Pointer to a buffer that receives the decryption output.
+  @param[in, out]  DataOutSize  On input, size of the output buffer in bytes.
+                                On output, size of the decrypted data in bytes.
+
+  @retval TRUE   AEAD AES-GCM authenticated decryption succeeded.
+  @retval FALSE  AEAD AES-GCM authenticated decryption failed.
+
+**/
+BOOLEAN
+EFIAPI
+AeadAesGcmDecrypt (
+  IN     CONST UINT8  *Key,
+  IN     UINTN        KeySize,
+  IN     CONST UINT8  *Iv,
+  IN     UINTN        IvSize,
+  IN     CONST UINT8  *AData,
+  IN     UINTN        ADataSize,
+  IN     CONST UINT8  *DataIn,
+  IN     UINTN        DataInSize,
+  IN     CONST UINT8  *Tag,
+  IN     UINTN        TagSize,
+  OUT    UINT8        *DataOut,
+  IN OUT UINTN        *DataOutSize
+  )
+{
+  EVP_CIPHER_CTX  *Ctx;
+  INT32           TempOutSize;
+  BOOLEAN         RetValue;
+
+  if (!AeadAesGcmCheckParameters (Key, KeySize, Iv, IvSize, AData, ADataSize, DataIn, DataInSize, Tag, TagSize, DataOut, DataOutSize)) {
+    return FALSE;
+  }
+
+  Ctx = EVP_CIPHER_CTX_new ();
+  if (Ctx == NULL) {
+    return FALSE;
+  }
+
+  RetValue = (BOOLEAN)EVP_DecryptInit_ex (Ctx, AeadAesGcmGetCipher (KeySize), NULL, NULL, NULL);
+  if (!RetValue) {
+    goto Done;
+  }
+
+  RetValue = (BOOLEAN)EVP_CIPHER_CTX_ctrl (Ctx, EVP_CTRL_GCM_SET_IVLEN, (INT32)IvSize, NULL);
+  if (!RetValue) {
+    goto Done;
+  }
+
+  RetValue = (BOOLEAN)EVP_DecryptInit_ex (Ctx, NULL, NULL, Key, Iv);
+  if (!RetValue) {
+    goto Done;
+  }
+
+  if (ADataSize != 0) {
+    RetValue = (BOOLEAN)EVP_DecryptUpdate (Ctx, NULL, &TempOutSize, AData, (INT32)ADataSize);
+    if (!RetValue) {
+      goto Done;
+    }
+  }
+
+  if (DataInSize != 0) {
+    RetValue = (BOOLEAN)EVP_DecryptUpdate (Ctx, DataOut, &TempOutSize, DataIn, (INT32)DataInSize);
+    if (!RetValue) {
+      goto Done;
+    }
+  }
+
+  RetValue = (BOOLEAN)EVP_CIPHER_CTX_ctrl (Ctx, EVP_CTRL_GCM_SET_TAG, (INT32)TagSize, (VOID *)Tag);
+  if (!RetValue) {
+    goto Done;
+  }
+
+  RetValue = (BOOLEAN)(EVP_DecryptFinal_ex (Ctx, DataOut, &TempOutSize) > 0);
+
+Done:
+  EVP_CIPHER_CTX_free (Ctx);
+  if (!RetValue) {
+    if (DataInSize != 0) {
+      ZeroMem (DataOut, DataInSize);
+    }
+
+    return RetValue;
+  }
+
+  *DataOutSize = DataInSize;
+
+  return RetValue;
+}
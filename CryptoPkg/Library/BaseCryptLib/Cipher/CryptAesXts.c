@@ -0,0 +1,224 @@
+/** @file
+  AES-XTS Wrapper Implementation over OpenSSL.
+
+  OpenSSL selects the AES-NI code path at run time when the processor
+  supports it and the OpensslLib instance includes the assembly, and falls
+  back to the portable C code otherwise.
+
+  IEEE Std 1619-2007 - Cryptographic Protection of Data on Block-Oriented Storage Devices
+  NIST SP 800-38e - Recommendation for Block Cipher Modes of Operation: The XTS-AES Mode
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "InternalCryptLib.h"
+#include <openssl/aes.h>
+#include <openssl/evp.h>
+
+//
+// IEEE Std 1619-2007 limits a data unit to 2^20 blocks.
+//
+#define AES_XTS_MAX_DATA_UNIT_SIZE  (SIZE_1MB * AES_BLOCK_SIZE)
+
+/**
+  Performs AES-XTS encryption or decryption on consecutive data units.
+
+  The key schedule is computed once, then each data unit is processed with
+  its own tweak: the little-endian encoding of its data unit number.
+
+  @param[in]   Key             Pointer to the key, the data key followed by
+                               the tweak key.
+  @param[in]   KeySize         Size of the key in bytes, 32 or 64.
+  @param[in]   DataUnitNumber  Data unit number of the first data unit.
+  @param[in]   DataUnitSize    Size of a data unit in bytes.
+  @param[in]   Input           Pointer to the input data.
+  @param[in]   InputSize       Size of the input data, a multiple of
+                               DataUnitSize.
+  @param[out]  Output          Pointer to a buffer of InputSize bytes that
+                               receives the output.
+  @param[in]   Encrypt         1 to encrypt, 0 to decrypt.
+
+  @retval TRUE   The operation succeeded.
+  @retval FALSE  The operation failed.
+
+**/
+STATIC
+BOOLEAN
+AesXtsCipher (
+  IN   CONST UINT8  *Key,
+  IN   UINTN        KeySize,
+  IN   UINT64       DataUnitNumber,
+  IN   UINTN        DataUnitSize,
+  IN   CONST UINT8  *Input,
+  IN   UINTN        InputSize,
+  OUT  UINT8        *Output,
+  IN   INT32        Encrypt
+  )
+{
+  CONST EVP_CIPHER  *Cipher;
+  EVP_CIPHER_CTX    *Ctx;
+  UINT8             Tweak[AES_BLOCK_SIZE];
+  UINTN             Offset;
+  INT32             TempOutSize;
+  BOOLEAN           RetValue;
+
+  if ((Key == NULL) || (Input == NULL) || (Output == NULL)) {
+    return FALSE;
+  }
+
+  switch (KeySize) {
+    case 32:
+      Cipher = EVP_aes_128_xts ();
+      break;
+    case 64:
+      Cipher = EVP_aes_256_xts ();
+      break;
+    default:
+      return FALSE;
+  }
+
+  //
+  // The data key and the tweak key must differ.
+  //
+  if (CompareMem (Key, Key + KeySize / 2, KeySize / 2) == 0) {
+    return FALSE;
+  }
+
+  if ((DataUnitSize < AES_BLOCK_SIZE) || (DataUnitSize > AES_XTS_MAX_DATA_UNIT_SIZE)) {
+    return FALSE;
+  }
+
+  if ((InputSize == 0) || ((InputSize % DataUnitSize) != 0)) {
+    return FALSE;
+  }
+
+  Ctx = EVP_CIPHER_CTX_new ();
+  if (Ctx == NULL) {
+    return FALSE;
+  }
+
+  RetValue = (BOOLEAN)EVP_CipherInit_ex (Ctx, Cipher, NULL, Key, NULL, Encrypt);
+  if (!RetValue) {
+    goto Done;
+  }
+
+  ZeroMem (Tweak, sizeof (Tweak));
+  for (Offset = 0; Offset < InputSize; Offset += DataUnitSize) {
+    WriteUnaligned64 ((UINT64 *)Tweak, DataUnitNumber);
+    DataUnitNumber++;
+
+    //
+    // Only the tweak changes between data units, the key schedule is kept.
+    //
+    RetValue = (BOOLEAN)EVP_CipherInit_ex (Ctx, NULL, NULL, NULL, Tweak, -1);
+    if (!RetValue) {
+      goto Done;
+    }
+
+    RetValue = (BOOLEAN)EVP_CipherUpdate (Ctx, Output + Offset, &TempOutSize, Input + Offset, (INT32)DataUnitSize);
+    if (!RetValue) {
+      goto Done;
+    }
+  }
+
+Done:
+  EVP_CIPHER_CTX_free (Ctx);
+  if (!RetValue) {
+    ZeroMem (Output, InputSize);
+  }
+
+  return RetValue;
+}
+
+/**
+  Performs AES-XTS encryption on consecutive data units.
+
+  The tweak of each data unit is the 128-bit little-endian encoding of its
+  data unit number, as in IEEE Std 1619-2007. The first data unit of Input
+  has the number DataUnitNumber, the next one DataUnitNumber + 1, and so on,
+  so a run of disk sectors is encrypted with one call.
+  DataUnitSize need not be a multiple of the block size (16 bytes): the last
+  partial block of each data unit uses ciphertext stealing.
+
+  If Key is NULL, then return FALSE.
+  If KeySize is not 32 (AES-128) or 64 (AES-256), then return FALSE.
+  If the two halves of Key are equal, then return FALSE.
+  If DataUnitSize is smaller than 16 or larger than 2^20 blocks, then return FALSE.
+  If InputSize is 0 or not a multiple of DataUnitSize, then return FALSE.
+  If Input or Output is NULL, then return FALSE.
+
+  @param[in]   Key             Pointer to the key, the data key followed by
+                               the tweak key.
+  @param[in]   KeySize         Size of the key in bytes.
+  @param[in]   DataUnitNumber  Data unit number of the first data unit.
+  @param[in]   DataUnitSize    Size of a data unit in bytes.
+  @param[in]   Input           Pointer to the buffer containing the data to be encrypted.
+  @param[in]   InputSize       Size of the Input buffer in bytes.
+  @param[out]  Output          Pointer to a buffer of InputSize bytes that
+                               receives the AES-XTS encryption output.
+
+  @retval TRUE   AES-XTS encryption succeeded.
+  @retval FALSE  AES-XTS encryption failed.
+
+**/
+BOOLEAN
+EFIAPI
+AesXtsEncrypt (
+  IN   CONST UINT8  *Key,
+  IN   UINTN        KeySize,
+  IN   UINT64       DataUnitNumber,
+  IN   UINTN        DataUnitSize,
+  IN   CONST UINT8  *Input,
+  IN   UINTN        InputSize,
+  OUT  UINT8        *Output
+  )
+{
+  return AesXtsCipher (Key, KeySize, DataUnitNumber, DataUnitSize, Input, InputSize, Output, 1);
+}
+
+/**
+  Performs AES-XTS decryption on consecutive data units.
+
+  The tweak of each data unit is the 128-bit little-endian encoding of its
+  data unit number, as in IEEE Std 1619-2007. The first data unit of Input
+  has the number DataUnitNumber, the next one DataUnitNumber + 1, and so on,
+  so a run of disk sectors is decrypted with one call.
+  DataUnitSize need not be a multiple of the block size (16 bytes): the last
+  partial block of each data unit uses ciphertext stealing.
+
+  If Key is NULL, then return FALSE.
+  If KeySize is not 32 (AES-128) or 64 (AES-256), then return FALSE.
+  If the two halves of Key are equal, then return FALSE.
+  If DataUnitSize is smaller than 16 or larger than 2^20 blocks, then return FALSE.
+  If InputSize is 0 or not a multiple of DataUnitSize, then return FALSE.
+  If Input or Output is NULL, then return FALSE.
+
+  @param[in]   Key             Pointer to the key, the data key followed by
+                               the tweak key.
+  @param[in]   KeySize         Size of the key in bytes.
+  @param[in]   DataUnitNumber  Data unit number of the first data unit.
+  @param[in]   DataUnitSize    Size of a data unit in bytes.
+  @param[in]   Input           Pointer to the buffer containing the data to be decrypted.
+  @param[in]   InputSize       Size of the Input buffer in bytes.
+  @param[out]  Output          Pointer to a buffer of InputSize bytes that
+                               receives the AES-XTS decryption output.
+
+  @retval TRUE   AES-XTS decryption succeeded.
+  @retval FALSE  AES-XTS decryption failed.
+
+**/
+BOOLEAN
+EFIAPI
+AesXtsDecrypt (
+  IN   CONST UINT8  *Key,
+  IN   UINTN        KeySize,
+  IN   UINT64       DataUnitNumber,
+  IN   UINTN        DataUnitSize,
+  IN   CONST UINT8  *Input,
+  IN   UINTN        InputSize,
+  OUT  UINT8        *Output
+  )
+{
+  return AesXtsCipher (Key, KeySize, DataUnitNumber, DataUnitSize, Input, InputSize, Output, 0);
+}
@@ -0,0 +1,279 @@
+/** @file
+  Elliptic Curve Wrapper Implementation over OpenSSL.
+
+  The signatures are handled as the raw (r, s) pair and the public keys as the
+  raw point, so that verification needs no ASN.1 parsing.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "InternalCryptLib.h"
+#include <openssl/objects.h>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+
+/**
+  Return the OpenSSL NID of an elliptic curve.
+
+  @param[in]  CryptoNid   Identifying number of the curve, CRYPTO_NID_SECPxxxR1.
+
+  @return  The OpenSSL NID of the curve, or -1 if the curve is not supported.
+
+**/
+STATIC
+INT32
+CryptoNidToOpensslNid (
+  IN UINTN  CryptoNid
+  )
+{
+  switch (CryptoNid) {
+    case CRYPTO_NID_SECP256R1:
+      return NID_X9_62_prime256v1;
+    case CRYPTO_NID_SECP384R1:
+      return NID_secp384r1;
+    case CRYPTO_NID_SECP521R1:
+      return NID_secp521r1;
+    default:
+      return -1;
+  }
+}
+
+/**
+  Return the size of a coordinate of the curve of an EC context.
+
+  @param[in]  EcKey   EC context.
+
+  @return  The size in bytes of the coordinates of the points of the curve,
+           which is also the size of each of the r and s values of a signature.
+
+**/
+STATIC
+UINTN
+EcGetCoordinateSize (
+  IN CONST EC_KEY  *EcKey
+  )
+{
+  return (EC_GROUP_get_degree (EC_KEY_get0_group (EcKey)) + 7) / 8;
+}
+
+/**
+  Allocates and Initializes one Elliptic Curve Context for subsequent use
+  with the NID.
+
+  @param[in]  Nid   Identifying number for the elliptic curve, one of
+                    CRYPTO_NID_SECP256R1, CRYPTO_NID_SECP384R1 and
+                    CRYPTO_NID_SECP521R1.
+
+  @return     Pointer to the Elliptic Curve Context that has been initialized.
+              If the allocations fails, EcNewByNid() returns NULL.
+              If the curve is not supported, EcNewByNid() returns NULL.
+
+**/
+VOID *
+EFIAPI
+EcNewByNid (
+  IN UINTN  Nid
+  )
+{
+  INT32  OpenSslNid;
+
+  OpenSslNid = CryptoNidToOpensslNid (Nid);
+  if (OpenSslNid < 0) {
+    return NULL;
+  }
+
+  return (VOID *)EC_KEY_new_by_curve_name (OpenSslNid);
+}
+
+/**
+  Release the specified EC context.
+
+  @param[in]  EcContext  Pointer to the EC context to be released.
+
+**/
+VOID
+EFIAPI
+EcFree (
+  IN  VOID  *EcContext
+  )
+{
+  EC_KEY_free ((EC_KEY *)EcContext);
+}
+
+/**
+  Sets the public key component into the established EC context.
+
+  The public key is the uncompressed point, without the leading 0x04 octet:
+  the X coordinate followed by the Y coordinate, each as a big-endian number
+  of the size of the curve (32 bytes for P-256, 48 for P-384 and 66 for
+  P-521). The point must be on the curve of the context.
+
+  If EcContext is NULL, then return FALSE.
+  If PublicKey is NULL, then return FALSE.
+  If PublicKeySize is not twice the size of the curve, then return FALSE.
+
+  @param[in, out]  EcContext      Pointer to EC context being set.
+  @param[in]       PublicKey      Pointer to the buffer holding the public key.
+  @param[in]       PublicKeySize  Size of the public key buffer in bytes.
+
+  @retval  TRUE   EC public key component was set successfully.
+  @retval  FALSE  Invalid EC public key component.
+
+**/
+BOOLEAN
+EFIAPI
+EcSetPubKey (
+  IN OUT  VOID   *EcContext,
+  IN      UINT8  *PublicKey,
+  IN      UINTN  PublicKeySize
+  )
+{
+  EC_KEY          *EcKey;
+  CONST EC_GROUP  *Group;
+  BIGNUM          *BnX;
+  BIGNUM          *BnY;
+  EC_POINT        *Point;
+  UINTN           HalfSize;
+  BOOLEAN         RetVal;
+
+  if ((EcContext == NULL) || (PublicKey == NULL)) {
+    return FALSE;
+  }
+
+  EcKey    = (EC_KEY *)EcContext;
+  Group    = EC_KEY_get0_group (EcKey);
+  HalfSize = EcGetCoordinateSize (EcKey);
+  if (PublicKeySize != HalfSize * 2) {
+    return FALSE;
+  }
+
+  RetVal = FALSE;
+  Point  = NULL;
+  BnX    = BN_bin2bn (PublicKey, (UINT32)HalfSize, NULL);
+  BnY    = BN_bin2bn (PublicKey + HalfSize, (UINT32)HalfSize, NULL);
+  if ((BnX == NULL) || (BnY == NULL)) {
+    goto Done;
+  }
+
+  Point = EC_POINT_new (Group);
+  if (Point == NULL) {
+    goto Done;
+  }
+
+  //
+  // Setting the coordinates fails if the point is not on the curve.
+  //
+  if (EC_POINT_set_affine_coordinates (Group, Point, BnX, BnY, NULL) != 1) {
+    goto Done;
+  }
+
+  RetVal = (BOOLEAN)(EC_KEY_set_public_key (EcKey, Point) == 1);
+
+Done:
+  BN_free (BnX);
+  BN_free (BnY);
+  EC_POINT_free (Point);
+  return RetVal;
+}
+
+/**
+  Verifies the EC-DSA signature.
+
+  The signature is the pair (r, s), given as the concatenation of the two
+  big-endian numbers, each of the size of the curve (64 bytes in total for
+  P-256, 96 for P-384 and 132 for P-521), rather than as a DER encoded
+  ECDSA-Sig-Value. The message hash is verified as is; it is not hashed again.
+
+  If EcContext is NULL, then return FALSE.
+  If MessageHash is NULL, then return FALSE.
+  If Signature is NULL, then return FALSE.
+  If HashSize does not match the hash algorithm of HashNid, then return FALSE.
+  If SigSize is not twice the size of the curve, then return FALSE.
+
+  @param[in]  EcContext    Pointer to EC context for signature verification.
+  @param[in]  HashNid      Hash NID, one of CRYPTO_NID_SHA256,
+                           CRYPTO_NID_SHA384 and CRYPTO_NID_SHA512.
+  @param[in]  MessageHash  Pointer to octet message hash to be checked.
+  @param[in]  HashSize     Size of the message hash in bytes.
+  @param[in]  Signature    Pointer to EC-DSA signature to be verified.
+  @param[in]  SigSize      Size of signature in bytes.
+
+  @retval  TRUE   Valid signature encoded in EC-DSA.
+  @retval  FALSE  Invalid signature or invalid EC context.
+
+**/
+BOOLEAN
+EFIAPI
+EcDsaVerify (
+  IN  VOID         *EcContext,
+  IN  UINTN        HashNid,
+  IN  CONST UINT8  *MessageHash,
+  IN  UINTN        HashSize,
+  IN  CONST UINT8  *Signature,
+  IN  UINTN        SigSize
+  )
+{
+  EC_KEY     *EcKey;
+  ECDSA_SIG  *EcdsaSig;
+  BIGNUM     *R;
+  BIGNUM     *S;
+  UINTN      HalfSize;
+  INT32      Result;
+
+  if ((EcContext == NULL) || (MessageHash == NULL) || (Signature == NULL)) {
+    return FALSE;
+  }
+
+  switch (HashNid) {
+    case CRYPTO_NID_SHA256:
+      if (HashSize != SHA256_DIGEST_SIZE) {
+        return FALSE;
+      }
+
+      break;
+    case CRYPTO_NID_SHA384:
+      if (HashSize != SHA384_DIGEST_SIZE) {
+        return FALSE;
+      }
+
+      break;
+    case CRYPTO_NID_SHA512:
+      if (HashSize != SHA512_DIGEST_SIZE) {
+        return FALSE;
+      }
+
+      break;
+    default:
+      return FALSE;
+  }
+
+  EcKey    = (EC_KEY *)EcContext;
+  HalfSize = EcGetCoordinateSize (EcKey);
+  if (SigSize != HalfSize * 2) {
+    return FALSE;
+  }
+
+  EcdsaSig = ECDSA_SIG_new ();
+  if (EcdsaSig == NULL) {
+    return FALSE;
+  }
+
+  R = BN_bin2bn (Signature, (UINT32)HalfSize, NULL);
+  S = BN_bin2bn (Signature + HalfSize, (UINT32)HalfSize, NULL);
+  if ((R == NULL) || (S == NULL) || (ECDSA_SIG_set0 (EcdsaSig, R, S) != 1)) {
+    BN_free (R);
+    BN_free (S);
+    ECDSA_SIG_free (EcdsaSig);
+    return FALSE;
+  }
+
+  //
+  // R and S are now owned by EcdsaSig.
+  //
+  Result = ECDSA_do_verify (MessageHash, (UINT32)HashSize, EcdsaSig, EcKey);
+
+  ECDSA_SIG_free (EcdsaSig);
+
+  return (BOOLEAN)(Result == 1);
+}
@@ -750,23 +750,27 @@ _Error:
 
 /**
   Verifies the validity of a PKCS#7 signed data as described in "PKCS #7:
-  Cryptographic Message Syntax Standard". The input signed data could be wrapped
-  in a ContentInfo structure.
+  Cryptographic Message Syntax Standard", against a trusted certificate that
+  has already been parsed with X509ConstructCertificate(). The input signed
+  data could be wrapped in a ContentInfo structure.
 
-  If P7Data, TrustedCert or InData is NULL, then return FALSE.
-  If P7Length, CertLength or DataLength overflow, then return FALSE.
+  This is Pkcs7Verify() without the parsing of the trusted certificate, for
+  callers that verify many signed data against the same certificates.
+
+  If P7Data, TrustedX509Cert or InData is NULL, then return FALSE.
+  If P7Length or DataLength overflow, then return FALSE.
 
   Caution: This function may receive untrusted input.
   UEFI Authenticated Variable is external input, so this function will do basic
   check for PKCS#7 data structure.
 
-  @param[in]  P7Data       Pointer to the PKCS#7 message to verify.
-  @param[in]  P7Length     Length of the PKCS#7 message in bytes.
-  @param[in]  TrustedCert  Pointer to a trusted/root certificate encoded in DER, which
-                           is used for certificate chain verification.
-  @param[in]  CertLength   Length of the trusted certificate in bytes.
-  @param[in]  InData       Pointer to the content to be verified.
-  @param[in]  DataLength   Length of InData in bytes.
+  @param[in]  P7Data           Pointer to the PKCS#7 message to verify.
+  @param[in]  P7Length         Length of the PKCS#7 message in bytes.
+  @param[in]  TrustedX509Cert  Pointer to the X509 object of a trusted/root
+                               certificate, which is used for certificate chain
+                               verification.
+  @param[in]  InData           Pointer to the content to be verified.
+  @param[in]  DataLength       Length of InData in bytes.
 
   @retval  TRUE  The specified PKCS#7 signed data is valid.
   @retval  FALSE Invalid PKCS#7 signed data.
@@ -774,11 +778,10 @@ _Error:
 **/
 BOOLEAN
 EFIAPI
-Pkcs7Verify (
+Pkcs7VerifyWithX509 (
   IN  CONST UINT8  *P7Data,
   IN  UINTN        P7Length,
-  IN  CONST UINT8  *TrustedCert,
-  IN  UINTN        CertLength,
+  IN  VOID         *TrustedX509Cert,
   IN  CONST UINT8  *InData,
   IN  UINTN        DataLength
   )
@@ -786,7 +789,6 @@ Pkcs7Verify (
   PKCS7        *Pkcs7;
   BIO          *DataBio;
   BOOLEAN      Status;
-  X509         *Cert;
   X509_STORE   *CertStore;
   UINT8        *SignedData;
   CONST UINT8  *Temp;
@@ -796,15 +798,14 @@ Pkcs7Verify (
   //
   // Check input parameters.
   //
-  if ((P7Data == NULL) || (TrustedCert == NULL) || (InData == NULL) ||
-      (P7Length > INT_MAX) || (CertLength > INT_MAX) || (DataLength > INT_MAX))
+  if ((P7Data == NULL) || (TrustedX509Cert == NULL) || (InData == NULL) ||
+      (P7Length > INT_MAX) || (DataLength > INT_MAX))
   {
     return FALSE;
   }
 
   Pkcs7     = NULL;
   DataBio   = NULL;
-  Cert      = NULL;
   CertStore = NULL;
 
   //
@@ -862,23 +863,15 @@ Pkcs7Verify (
   }
 
   //
-  // Read DER-encoded root certificate and Construct X509 Certificate
-  //
-  Temp = TrustedCert;
-  Cert = d2i_X509 (NULL, &Temp, (long)CertLength);
-  if (Cert == NULL) {
-    goto _Exit;
-  }
-
-  //
-  // Setup X509 Store for trusted certificate
+  // Setup X509 Store for trusted certificate. The store takes its own
+  // reference to the certificate.
   //
   CertStore = X509_STORE_new ();
   if (CertStore == NULL) {
     goto _Exit;
   }
 
-  if (!(X509_STORE_add_cert (CertStore, Cert))) {
+  if (!(X509_STORE_add_cert (CertStore, (X509 *)TrustedX509Cert))) {
     goto _Exit;
   }
 
@@ -917,7 +910,6 @@ _Exit:
   // Release Resources
   //
   BIO_free (DataBio);
-  X509_free (Cert);
   X509_STORE_free (CertStore);
   PKCS7_free (Pkcs7);
 
@@ -927,3 +919,66 @@ _Exit:
 
   return Status;
 }
+
+/**
+  Verifies the validity of a PKCS#7 signed data as described in "PKCS #7:
+  Cryptographic Message Syntax Standard". The input signed data could be wrapped
+  in a ContentInfo structure.
+
+  If P7Data, TrustedCert or InData is NULL, then return FALSE.
+  If P7Length, CertLength or DataLength overflow, then return FALSE.
+
+  Caution: This function may receive untrusted input.
+  UEFI Authenticated Variable is external input, so this function will do basic
+  check for PKCS#7 data structure.
+
+  @param[in]  P7Data       Pointer to the PKCS#7 message to verify.
+  @param[in]  P7Length     Length of the PKCS#7 message in bytes.
+  @param[in]  TrustedCert  Pointer to a trusted/root certificate encoded in DER, which
+                           is used for certificate chain verification.
+  @param[in]  CertLength   Length of the trusted certificate in bytes.
+  @param[in]  InData       Pointer to the content to be verified.
+  @param[in]  DataLength   Length of InData in bytes.
+
+  @retval  TRUE  The specified PKCS#7 signed data is valid.
+  @retval  FALSE Invalid PKCS#7 signed data.
+
+**/
+BOOLEAN
+EFIAPI
+Pkcs7Verify (
+  IN  CONST UINT8  *P7Data,
+  IN  UINTN        P7Length,
+  IN  CONST UINT8  *TrustedCert,
+  IN  UINTN        CertLength,
+  IN  CONST UINT8  *InData,
+  IN  UINTN        DataLength
+  )
+{
+  BOOLEAN      Status;
+  X509         *Cert;
+  CONST UINT8  *Temp;
+
+  //
+  // Check input parameters.
+  //
+  if ((P7Data == NULL) || (TrustedCert == NULL) || (InData == NULL) ||
+      (P7Length > INT_MAX) || (CertLength > INT_MAX) || (DataLength > INT_MAX))
+  {
+    return FALSE;
+  }
+
+  //
+  // Read DER-encoded root certificate and Construct X509 Certificate
+  //
+  Temp = TrustedCert;
+  Cert = d2i_X509 (NULL, &Temp, (long)CertLength);
+  if (Cert == NULL) {
+    return FALSE;
+  }
+
+  Status = Pkcs7VerifyWithX509 (P7Data, P7Length, Cert, InData, DataLength);
+
+  X509_free (Cert);
+  return Status;
+}
@@ -0,0 +1,76 @@
+/** @file
+  AES-XTS Wrapper Implementation which does not provide real capabilities.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "InternalCryptLib.h"
+
+/**
+  Performs AES-XTS encryption on consecutive data units.
+
+  Return FALSE to indicate this interface is not supported.
+
+  @param[in]   Key             Pointer to the key, the data key followed by
+                               the tweak key.
+  @param[in]   KeySize         Size of the key in bytes.
+  @param[in]   DataUnitNumber  Data unit number of the first data unit.
+  @param[in]   DataUnitSize    Size of a data unit in bytes.
+  @param[in]   Input           Pointer to the buffer containing the data to be encrypted.
+  @param[in]   InputSize       Size of the Input buffer in bytes.
+  @param[out]  Output          Pointer to a buffer of InputSize bytes that
+                               receives the AES-XTS encryption output.
+
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+AesXtsEncrypt (
+  IN   CONST UINT8  *Key,
+  IN   UINTN        KeySize,
+  IN   UINT64       DataUnitNumber,
+  IN   UINTN        DataUnitSize,
+  IN   CONST UINT8  *Input,
+  IN   UINTN        InputSize,
+  OUT  UINT8        *Output
+  )
+{
+  ASSERT (FALSE);
+  return FALSE;
+}
+
+/**
+  Performs AES-XTS decryption on consecutive data units.
+
+  Return FALSE to indicate this interface is not supported.
+
+  @param[in]   Key             Pointer to the key, the data key followed by
+                               the tweak key.
+  @param[in]   KeySize         Size of the key in bytes.
+  @param[in]   DataUnitNumber  Data unit number of the first data unit.
+  @param[in]   DataUnitSize    Size of a data unit in bytes.
+  @param[in]   Input           Pointer to the buffer containing the data to be decrypted.
+  @param[in]   InputSize       Size of the Input buffer in bytes.
+  @param[out]  Output          Pointer to a buffer of InputSize bytes that
+                               receives the AES-XTS decryption output.
+
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+AesXtsDecrypt (
+  IN   CONST UINT8  *Key,
+  IN   UINTN        KeySize,
+  IN   UINT64       DataUnitNumber,
+  IN   UINTN        DataUnitSize,
+  IN   CONST UINT8  *Input,
+  IN   UINTN        InputSize,
+  OUT  UINT8        *Output
+  )
+{
+  ASSERT (FALSE);
+  return FALSE;
+}
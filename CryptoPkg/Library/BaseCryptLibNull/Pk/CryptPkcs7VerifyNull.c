@@ -133,6 +133,39 @@ Pkcs7Verify (
   return FALSE;
 }
 
+/**
+  Verifies the validity of a PKCS#7 signed data as described in "PKCS #7:
+  Cryptographic Message Syntax Standard", against a trusted certificate that
+  has already been parsed with X509ConstructCertificate(). The input signed
+  data could be wrapped in a ContentInfo structure.
+
+  Return FALSE to indicate this interface is not supported.
+
+  @param[in]  P7Data           Pointer to the PKCS#7 message to verify.
+  @param[in]  P7Length         Length of the PKCS#7 message in bytes.
+  @param[in]  TrustedX509Cert  Pointer to the X509 object of a trusted/root
+                               certificate, which is used for certificate chain
+                               verification.
+  @param[in]  InData           Pointer to the content to be verified.
+  @param[in]  DataLength       Length of InData in bytes.
+
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+Pkcs7VerifyWithX509 (
+  IN  CONST UINT8  *P7Data,
+  IN  UINTN        P7Length,
+  IN  VOID         *TrustedX509Cert,
+  IN  CONST UINT8  *InData,
+  IN  UINTN        DataLength
+  )
+{
+  ASSERT (FALSE);
+  return FALSE;
+}
+
 /**
   Extracts the attached content from a PKCS#7 signed data if existed. The input signed
   data could be wrapped in a ContentInfo structure.
@@ -2246,6 +2246,45 @@ Pkcs7Verify (
   CALL_CRYPTO_SERVICE (Pkcs7Verify, (P7Data, P7Length, TrustedCert, CertLength, InData, DataLength), FALSE);
 }
 
+/**
+  Verifies the validity of a PKCS#7 signed data as described in "PKCS #7:
+  Cryptographic Message Syntax Standard", against a trusted certificate that
+  has already been parsed with X509ConstructCertificate(). The input signed
+  data could be wrapped in a ContentInfo structure.
+
+  This is Pkcs7Verify() without the parsing of the trusted certificate, for
+  callers that verify many signed data against the same certificates.
+
+  If P7Data, TrustedX509Cert or InData is NULL, then return FALSE.
+  If P7Length or DataLength overflow, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]  P7Data           Pointer to the PKCS#7 message to verify.
+  @param[in]  P7Length         Length of the PKCS#7 message in bytes.
+  @param[in]  TrustedX509Cert  Pointer to the X509 object of a trusted/root
+                               certificate, which is used for certificate chain
+                               verification.
+  @param[in]  InData           Pointer to the content to be verified.
+  @param[in]  DataLength       Length of InData in bytes.
+
+  @retval  TRUE  The specified PKCS#7 signed data is valid.
+  @retval  FALSE Invalid PKCS#7 signed data.
+  @retval  FALSE This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+Pkcs7VerifyWithX509 (
+  IN  CONST UINT8  *P7Data,
+  IN  UINTN        P7Length,
+  IN  VOID         *TrustedX509Cert,
+  IN  CONST UINT8  *InData,
+  IN  UINTN        DataLength
+  )
+{
+  CALL_CRYPTO_SERVICE (Pkcs7VerifyWithX509, (P7Data, P7Length, TrustedX509Cert, InData, DataLength), FALSE);
+}
+
 /**
   This function receives a PKCS7 formatted signature, and then verifies that
   the specified Enhanced or Extended Key Usages (EKU's) are present in the end-entity
@@ -3580,3 +3619,373 @@ TlsGetCertRevocationList (
 {
   CALL_CRYPTO_SERVICE (TlsGetCertRevocationList, (Data, DataSize), EFI_UNSUPPORTED);
 }
+
+/**
+  Sets a session saved from an earlier connection to the same server with
+  TlsGetResumableSession(), to be resumed by the TLS/SSL connect.
+
+  Resumption skips the certificate exchange and the key exchange of a full
+  handshake. If the server declines to resume the session, a full handshake
+  is performed and TlsIsSessionResumed() returns FALSE.
+
+  @param[in]  Tls           Pointer to the TLS object.
+  @param[in]  Data          Pointer to the session data returned by
+                            TlsGetResumableSession().
+  @param[in]  DataSize      The size of data buffer in bytes.
+
+  @retval  EFI_SUCCESS             The session was set successfully.
+  @retval  EFI_INVALID_PARAMETER   The parameter is invalid.
+  @retval  EFI_ABORTED             Invalid session data.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsSetResumableSession (
+  IN     VOID   *Tls,
+  IN     VOID   *Data,
+  IN     UINTN  DataSize
+  )
+{
+  CALL_CRYPTO_SERVICE (TlsSetResumableSession, (Tls, Data, DataSize), EFI_UNSUPPORTED);
+}
+
+/**
+  Gets the session of the specified TLS connection in the form accepted by
+  TlsSetResumableSession().
+
+  The session carries the session ID and master secret, or the session ticket
+  issued by the server, so that the next connection to the same server can be
+  resumed with an abbreviated handshake.
+
+  @param[in]      Tls         Pointer to the TLS object.
+  @param[out]     Data        Pointer to the data buffer to receive the session
+                              data.
+  @param[in,out]  DataSize    The size of data buffer in bytes.
+
+  @retval  EFI_SUCCESS             The session data was returned successfully.
+  @retval  EFI_INVALID_PARAMETER   The parameter is invalid.
+  @retval  EFI_NOT_FOUND           The connection has no resumable session.
+  @retval  EFI_BUFFER_TOO_SMALL    The Data is too small to hold the data.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsGetResumableSession (
+  IN     VOID   *Tls,
+  OUT    VOID   *Data,
+  IN OUT UINTN  *DataSize
+  )
+{
+  CALL_CRYPTO_SERVICE (TlsGetResumableSession, (Tls, Data, DataSize), EFI_UNSUPPORTED);
+}
+
+/**
+  Checks if the handshake of the specified TLS connection resumed the session
+  set with TlsSetResumableSession().
+
+  @param[in]  Tls    Pointer to the TLS object.
+
+  @retval  TRUE     The session was resumed.
+  @retval  FALSE    A full handshake was performed, or the handshake has not
+                    completed.
+
+**/
+BOOLEAN
+EFIAPI
+TlsIsSessionResumed (
+  IN     VOID  *Tls
+  )
+{
+  CALL_CRYPTO_SERVICE (TlsIsSessionResumed, (Tls), FALSE);
+}
+
+/**
+  Allocates and Initializes one Elliptic Curve Context for subsequent use
+  with the NID.
+
+  @param[in]  Nid   Identifying number for the elliptic curve, one of
+                    CRYPTO_NID_SECP256R1, CRYPTO_NID_SECP384R1 and
+                    CRYPTO_NID_SECP521R1.
+
+  @return     Pointer to the Elliptic Curve Context that has been initialized.
+              If the allocations fails, EcNewByNid() returns NULL.
+              If the curve is not supported, EcNewByNid() returns NULL.
+              If the interface is not supported, EcNewByNid() returns NULL.
+
+**/
+VOID *
+EFIAPI
+EcNewByNid (
+  IN UINTN  Nid
+  )
+{
+  CALL_CRYPTO_SERVICE (EcNewByNid, (Nid), NULL);
+}
+
+/**
+  Release the specified EC context.
+
+  If the interface is not supported, then ASSERT().
+
+  @param[in]  EcContext  Pointer to the EC context to be released.
+
+**/
+VOID
+EFIAPI
+EcFree (
+  IN  VOID  *EcContext
+  )
+{
+  CALL_VOID_CRYPTO_SERVICE (EcFree, (EcContext));
+}
+
+/**
+  Sets the public key component into the established EC context.
+
+  The public key is the uncompressed point, without the leading 0x04 octet:
+  the X coordinate followed by the Y coordinate, each as a big-endian number
+  of the size of the curve.
+
+  @param[in, out]  EcContext      Pointer to EC context being set.
+  @param[in]       PublicKey      Pointer to the buffer holding the public key.
+  @param[in]       PublicKeySize  Size of the public key buffer in bytes.
+
+  @retval  TRUE   EC public key component was set successfully.
+  @retval  FALSE  Invalid EC public key component.
+  @retval  FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+EcSetPubKey (
+  IN OUT  VOID   *EcContext,
+  IN      UINT8  *PublicKey,
+  IN      UINTN  PublicKeySize
+  )
+{
+  CALL_CRYPTO_SERVICE (EcSetPubKey, (EcContext, PublicKey, PublicKeySize), FALSE);
+}
+
+/**
+  Verifies the EC-DSA signature.
+
+  The signature is the concatenation of the big-endian r and s values, each of
+  the size of the curve. The message hash is verified as is.
+
+  @param[in]  EcContext    Pointer to EC context for signature verification.
+  @param[in]  HashNid      Hash NID, one of CRYPTO_NID_SHA256,
+                           CRYPTO_NID_SHA384 and CRYPTO_NID_SHA512.
+  @param[in]  MessageHash  Pointer to octet message hash to be checked.
+  @param[in]  HashSize     Size of the message hash in bytes.
+  @param[in]  Signature    Pointer to EC-DSA signature to be verified.
+  @param[in]  SigSize      Size of signature in bytes.
+
+  @retval  TRUE   Valid signature encoded in EC-DSA.
+  @retval  FALSE  Invalid signature or invalid EC context.
+  @retval  FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+EcDsaVerify (
+  IN  VOID         *EcContext,
+  IN  UINTN        HashNid,
+  IN  CONST UINT8  *MessageHash,
+  IN  UINTN        HashSize,
+  IN  CONST UINT8  *Signature,
+  IN  UINTN        SigSize
+  )
+{
+  CALL_CRYPTO_SERVICE (EcDsaVerify, (EcContext, HashNid, MessageHash, HashSize, Signature, SigSize), FALSE);
+}
+
+/**
+  Performs AEAD AES-GCM authenticated encryption on a data buffer and additional authenticated data (AAD).
+
+  IvSize must be 12, otherwise FALSE is returned.
+  KeySize must be 16, 24 or 32, otherwise FALSE is returned.
+  TagSize must be 12, 13, 14, 15, 16, otherwise FALSE is returned.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]       Key          Pointer to the encryption key.
+  @param[in]       KeySize      Size of the encryption key in bytes.
+  @param[in]       Iv           Pointer to the IV value.
+  @param[in]       IvSize       Size of the IV value in bytes.
+  @param[in]       AData        Pointer to the additional authenticated data (AAD).
+  @param[in]       ADataSize    Size of the additional authenticated data (AAD) in bytes.
+  @param[in]       DataIn       Pointer to the input data buffer to be encrypted.
+  @param[in]       DataInSize   Size of the input data buffer in bytes.
+  @param[out]      TagOut       Pointer to a buffer that receives the authentication tag output.
+  @param[in]       TagSize      Size of the authentication tag in bytes.
+  @param[out]      DataOut      Pointer to a buffer that receives the encryption output.
+  @param[in, out]  DataOutSize  On input, size of the output buffer in bytes.
+                                On output, size of the encrypted data in bytes.
+
+  @retval TRUE   AEAD AES-GCM authenticated encryption succeeded.
+  @retval FALSE  AEAD AES-GCM authenticated encryption failed.
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+AeadAesGcmEncrypt (
+  IN     CONST UINT8  *Key,
+  IN     UINTN        KeySize,
+  IN     CONST UINT8  *Iv,
+  IN     UINTN        IvSize,
+  IN     CONST UINT8  *AData,
+  IN     UINTN        ADataSize,
+  IN     CONST UINT8  *DataIn,
+  IN     UINTN        DataInSize,
+  OUT    UINT8        *TagOut,
+  IN     UINTN        TagSize,
+  OUT    UINT8        *DataOut,
+  IN OUT UINTN        *DataOutSize
+  )
+{
+  CALL_CRYPTO_SERVICE (AeadAesGcmEncrypt, (Key, KeySize, Iv, IvSize, AData, ADataSize, DataIn, DataInSize, TagOut, TagSize, DataOut, DataOutSize), FALSE);
+}
+
+/**
+  Performs AEAD AES-GCM authenticated decryption on a data buffer and additional authenticated data (AAD).
+
+  IvSize must be 12, otherwise FALSE is returned.
+  KeySize must be 16, 24 or 32, otherwise FALSE is returned.
+  TagSize must be 12, 13, 14, 15, 16, otherwise FALSE is returned.
+  If authentication fails, FALSE is returned and the output buffer is cleared.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]       Key          Pointer to the encryption key.
+  @param[in]       KeySize      Size of the encryption key in bytes.
+  @param[in]       Iv           Pointer to the IV value.
+  @param[in]       IvSize       Size of the IV value in bytes.
+  @param[in]       AData        Pointer to the additional authenticated data (AAD).
+  @param[in]       ADataSize    Size of the additional authenticated data (AAD) in bytes.
+  @param[in]       DataIn       Pointer to the input data buffer to be decrypted.
+  @param[in]       DataInSize   Size of the input data buffer in bytes.
+  @param[in]       Tag          Pointer to a buffer that contains the authentication tag.
+  @param[in]       TagSize      Size of the authentication tag in bytes.
+  @param[out]      DataOut      Pointer to a buffer that receives the decryption output.
+  @param[in, out]  DataOutSize  On input, size of the output buffer in bytes.
+                                On output, size of the decrypted data in bytes.
+
+  @retval TRUE   AEAD AES-GCM authenticated decryption succeeded.
+  @retval FALSE  AEAD AES-GCM authenticated decryption failed.
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+AeadAesGcmDecrypt (
+  IN     CONST UINT8  *Key,
+  IN     UINTN        KeySize,
+  IN     CONST UINT8  *Iv,
+  IN     UINTN        IvSize,
+  IN     CONST UINT8  *AData,
+  IN     UINTN        ADataSize,
+  IN     CONST UINT8  *DataIn,
+  IN     UINTN        DataInSize,
+  IN     CONST UINT8  *Tag,
+  IN     UINTN        TagSize,
+  OUT    UINT8        *DataOut,
+  IN OUT UINTN        *DataOutSize
+  )
+{
+  CALL_CRYPTO_SERVICE (AeadAesGcmDecrypt, (Key, KeySize, Iv, IvSize, AData, ADataSize, DataIn, DataInSize, Tag, TagSize, DataOut, DataOutSize), FALSE);
+}
+
+/**
+  Performs AES-XTS encryption on consecutive data units.
+
+  The tweak of each data unit is the 128-bit little-endian encoding of its
+  data unit number, as in IEEE Std 1619-2007. The first data unit of Input
+  has the number DataUnitNumber, the next one DataUnitNumber + 1, and so on,
+  so a run of disk sectors is encrypted with one call.
+  DataUnitSize need not be a multiple of the block size (16 bytes): the last
+  partial block of each data unit uses ciphertext stealing.
+
+  If Key is NULL, then return FALSE.
+  If KeySize is not 32 (AES-128) or 64 (AES-256), then return FALSE.
+  If the two halves of Key are equal, then return FALSE.
+  If DataUnitSize is smaller than 16 or larger than 2^20 blocks, then return FALSE.
+  If InputSize is 0 or not a multiple of DataUnitSize, then return FALSE.
+  If Input or Output is NULL, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]   Key             Pointer to the key, the data key followed by
+                               the tweak key.
+  @param[in]   KeySize         Size of the key in bytes.
+  @param[in]   DataUnitNumber  Data unit number of the first data unit.
+  @param[in]   DataUnitSize    Size of a data unit in bytes.
+  @param[in]   Input           Pointer to the buffer containing the data to be encrypted.
+  @param[in]   InputSize       Size of the Input buffer in bytes.
+  @param[out]  Output          Pointer to a buffer of InputSize bytes that
+                               receives the AES-XTS encryption output.
+
+  @retval TRUE   AES-XTS encryption succeeded.
+  @retval FALSE  AES-XTS encryption failed.
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+AesXtsEncrypt (
+  IN   CONST UINT8  *Key,
+  IN   UINTN        KeySize,
+  IN   UINT64       DataUnitNumber,
+  IN   UINTN        DataUnitSize,
+  IN   CONST UINT8  *Input,
+  IN   UINTN        InputSize,
+  OUT  UINT8        *Output
+  )
+{
+  CALL_CRYPTO_SERVICE (AesXtsEncrypt, (Key, KeySize, DataUnitNumber, DataUnitSize, Input, InputSize, Output), FALSE);
+}
+
+/**
+  Performs AES-XTS decryption on consecutive data units.
+
+  The tweak of each data unit is the 128-bit little-endian encoding of its
+  data unit number, as in IEEE Std 1619-2007. The first data unit of Input
+  has the number DataUnitNumber, the next one DataUnitNumber + 1, and so on,
+  so a run of disk sectors is decrypted with one call.
+  DataUnitSize need not be a multiple of the block size (16 bytes): the last
+  partial block of each data unit uses ciphertext stealing.
+
+  If Key is NULL, then return FALSE.
+  If KeySize is not 32 (AES-128) or 64 (AES-256), then return FALSE.
+  If the two halves of Key are equal, then return FALSE.
+  If DataUnitSize is smaller than 16 or larger than 2^20 blocks, then return FALSE.
+  If InputSize is 0 or not a multiple of DataUnitSize, then return FALSE.
+  If Input or Output is NULL, then return FALSE.
+  If this interface is not supported, then return FALSE.
+
+  @param[in]   Key             Pointer to the key, the data key followed by
+                               the tweak key.
+  @param[in]   KeySize         Size of the key in bytes.
+  @param[in]   DataUnitNumber  Data unit number of the first data unit.
+  @param[in]   DataUnitSize    Size of a data unit in bytes.
+  @param[in]   Input           Pointer to the buffer containing the data to be decrypted.
+  @param[in]   InputSize       Size of the Input buffer in bytes.
+  @param[out]  Output          Pointer to a buffer of InputSize bytes that
+                               receives the AES-XTS decryption output.
+
+  @retval TRUE   AES-XTS decryption succeeded.
+  @retval FALSE  AES-XTS decryption failed.
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+EFIAPI
+AesXtsDecrypt (
+  IN   CONST UINT8  *Key,
+  IN   UINTN        KeySize,
+  IN   UINT64       DataUnitNumber,
+  IN   UINTN        DataUnitSize,
+  IN   CONST UINT8  *Input,
+  IN   UINTN        InputSize,
+  OUT  UINT8        *Output
+  )
+{
+  CALL_CRYPTO_SERVICE (AesXtsDecrypt, (Key, KeySize, DataUnitNumber, DataUnitSize, Input, InputSize, Output), FALSE);
+}
@@ -28,6 +28,21 @@ extern "C" {
 #define OPENSSL_SYS_UEFI  1
 #endif
 #define OPENSSL_MIN_API  0x10100000L
+/*
+ * EC is built into OpensslLibFull only. The other OpensslLib instances are
+ * built with EDK2_OPENSSL_NOEC and see the same configuration as no-ec.
+ */
+#ifdef EDK2_OPENSSL_NOEC
+#ifndef OPENSSL_NO_EC
+#define OPENSSL_NO_EC
+#endif
+#ifndef OPENSSL_NO_ECDH
+#define OPENSSL_NO_ECDH
+#endif
+#ifndef OPENSSL_NO_ECDSA
+#define OPENSSL_NO_ECDSA
+#endif
+#endif
 #ifndef OPENSSL_NO_BF
 #define OPENSSL_NO_BF
 #endif
@@ -55,9 +70,6 @@ extern "C" {
 #ifndef OPENSSL_NO_DSA
 #define OPENSSL_NO_DSA
 #endif
-#ifndef OPENSSL_NO_EC
-#define OPENSSL_NO_EC
-#endif
 #ifndef OPENSSL_NO_IDEA
 #define OPENSSL_NO_IDEA
 #endif
@@ -154,12 +166,6 @@ extern "C" {
 #ifndef OPENSSL_NO_EC_NISTP_64_GCC_128
 #define OPENSSL_NO_EC_NISTP_64_GCC_128
 #endif
-#ifndef OPENSSL_NO_ECDH
-#define OPENSSL_NO_ECDH
-#endif
-#ifndef OPENSSL_NO_ECDSA
-#define OPENSSL_NO_ECDSA
-#endif
 #ifndef OPENSSL_NO_EGD
 #define OPENSSL_NO_EGD
 #endif
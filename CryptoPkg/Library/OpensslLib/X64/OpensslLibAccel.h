@@ -0,0 +1,59 @@
+/** @file
+  Internal definitions of the CPU feature dispatch of the accelerated OpenSSL
+  Library instances.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef OPENSSL_LIB_ACCEL_H_
+#define OPENSSL_LIB_ACCEL_H_
+
+#include <Uefi.h>
+
+//
+// Masks applied by the OpenSSL CPUID probe to the second and third words of
+// OPENSSL_ia32cap_P when the AVX state is not enabled in XCR0. They clear the
+// features executed with VEX-encoded instructions: AVX, FMA and XOP in the
+// second word, AVX2 and the AVX-512 features in the third word.
+//
+#define OPENSSL_IA32CAP_P1_NO_VEX  0xEFFFE7FF
+#define OPENSSL_IA32CAP_P2_NO_VEX  0x3FDEFFDF
+
+/**
+  The hardware capability vector of the OpenSSL assembly, defined by the
+  OpenSSL CPUID probe.
+
+**/
+extern UINT32  OPENSSL_ia32cap_P[4];
+
+/**
+  An internal OpenSSL function which fetches a local copy of the hardware
+  capability flags.
+
+**/
+extern
+VOID
+OPENSSL_cpuid_setup (
+  VOID
+  );
+
+/**
+  Fill the hardware capability vector of the OpenSSL assembly.
+
+  The vector is filled once from CPUID, then restricted by
+  PcdOpensslLibAccelerationDisable and by the constraints of the environment.
+  Calling this function writes global data, so it must not be called from a
+  module running in place from flash.
+
+  @param[in]  AllowVex    FALSE to hide the features executed with VEX-encoded
+                          instructions, which modify register state that the
+                          environment does not preserve.
+
+**/
+VOID
+OpensslLibAccelSetup (
+  IN BOOLEAN  AllowVex
+  );
+
+#endif
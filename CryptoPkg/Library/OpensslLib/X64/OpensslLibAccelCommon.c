@@ -0,0 +1,56 @@
+/** @file
+  CPU feature dispatch of the accelerated OpenSSL Library instances.
+
+  The OpenSSL assembly selects, on each call, the fastest implementation the
+  processor supports from the hardware capability vector OPENSSL_ia32cap_P.
+  An all-zero vector selects the generic x86-64 implementations, which only
+  use general purpose registers.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Library/PcdLib.h>
+
+#include "OpensslLibAccel.h"
+
+/**
+  Fill the hardware capability vector of the OpenSSL assembly.
+
+  The vector is filled once from CPUID, then restricted by
+  PcdOpensslLibAccelerationDisable and by the constraints of the environment.
+  Calling this function writes global data, so it must not be called from a
+  module running in place from flash.
+
+  @param[in]  AllowVex    FALSE to hide the features executed with VEX-encoded
+                          instructions, which modify register state that the
+                          environment does not preserve.
+
+**/
+VOID
+OpensslLibAccelSetup (
+  IN BOOLEAN  AllowVex
+  )
+{
+  //
+  // The probe only runs once, so the vector is not filled again, with the
+  // restrictions below lost, when OpenSSL initializes itself later.
+  //
+  OPENSSL_cpuid_setup ();
+
+  if (PcdGetBool (PcdOpensslLibAccelerationDisable)) {
+    //
+    // Keep the first word, the basic features of the processor, and hide all
+    // the extensions: SSSE3, AES-NI, PCLMULQDQ, AVX, SHA and their kin.
+    //
+    OPENSSL_ia32cap_P[1] = 0;
+    OPENSSL_ia32cap_P[2] = 0;
+    OPENSSL_ia32cap_P[3] = 0;
+    return;
+  }
+
+  if (!AllowVex) {
+    OPENSSL_ia32cap_P[1] &= OPENSSL_IA32CAP_P1_NO_VEX;
+    OPENSSL_ia32cap_P[2] &= OPENSSL_IA32CAP_P2_NO_VEX;
+  }
+}
@@ -0,0 +1,88 @@
+/** @file
+  Constructor of the accelerated OpenSSL Library instance for PEI and DXE.
+
+  A PEIM running in place from flash cannot write its global data, and on some
+  platforms writing to the flash even changes its mode. The hardware
+  capability vector is then left zero, which selects the generic
+  implementations of the OpenSSL assembly; the PEIMs shadowed to permanent
+  memory get the accelerated ones.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Pi/PiHob.h>
+#include <Library/HobLib.h>
+
+#include "OpensslLibAccel.h"
+
+/**
+  Check whether the global data of the library is in memory.
+
+  @retval TRUE   The global data is in system memory, or in the memory
+                 described by the PHIT HOB, and can be written.
+  @retval FALSE  The global data is elsewhere, in flash.
+
+**/
+STATIC
+BOOLEAN
+OpensslLibAccelIsDataInMemory (
+  VOID
+  )
+{
+  EFI_PEI_HOB_POINTERS  Hob;
+  EFI_PHYSICAL_ADDRESS  Address;
+
+  Address = (EFI_PHYSICAL_ADDRESS)(UINTN)OPENSSL_ia32cap_P;
+
+  Hob.Raw = GetHobList ();
+  if (Hob.Raw == NULL) {
+    return FALSE;
+  }
+
+  //
+  // Before permanent memory is installed the PHIT HOB describes the temporary
+  // RAM, afterwards the permanent memory of PEI.
+  //
+  if ((Address >= Hob.HandoffInformationTable->EfiMemoryBottom) &&
+      (Address < Hob.HandoffInformationTable->EfiMemoryTop))
+  {
+    return TRUE;
+  }
+
+  for (Hob.Raw = GetFirstHob (EFI_HOB_TYPE_RESOURCE_DESCRIPTOR);
+       Hob.Raw != NULL;
+       Hob.Raw = GetNextHob (EFI_HOB_TYPE_RESOURCE_DESCRIPTOR, GET_NEXT_HOB (Hob)))
+  {
+    if ((Hob.ResourceDescriptor->ResourceType == EFI_RESOURCE_SYSTEM_MEMORY) &&
+        (Address >= Hob.ResourceDescriptor->PhysicalStart) &&
+        (Address - Hob.ResourceDescriptor->PhysicalStart < Hob.ResourceDescriptor->ResourceLength))
+    {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Constructor routine for OpensslLib.
+
+  The constructor fills the hardware capability vector used to enable native
+  crypto instructions, unless the library runs in place from flash.
+
+  @retval EFI_SUCCESS         The construction succeeded.
+
+**/
+EFI_STATUS
+EFIAPI
+OpensslLibAccelConstructor (
+  VOID
+  )
+{
+  if (OpensslLibAccelIsDataInMemory ()) {
+    OpensslLibAccelSetup (TRUE);
+  }
+
+  return EFI_SUCCESS;
+}
@@ -0,0 +1,35 @@
+/** @file
+  Constructor of the accelerated OpenSSL Library instance for SMM and
+  Standalone MM.
+
+  The SMI entry only saves the legacy SSE state of the interrupted context
+  with FXSAVE. Instructions using the SSE registers, such as AES-NI, SHA and
+  PCLMULQDQ, are safe, but VEX-encoded instructions modify the upper halves of
+  the AVX registers, which are not restored on RSM. The features executed with
+  them are hidden from the OpenSSL assembly.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "OpensslLibAccel.h"
+
+/**
+  Constructor routine for OpensslLib.
+
+  The constructor fills the hardware capability vector used to enable native
+  crypto instructions, without the VEX-encoded ones.
+
+  @retval EFI_SUCCESS         The construction succeeded.
+
+**/
+EFI_STATUS
+EFIAPI
+OpensslLibAccelMmConstructor (
+  VOID
+  )
+{
+  OpensslLibAccelSetup (FALSE);
+
+  return EFI_SUCCESS;
+}
@@ -169,7 +169,6 @@ BEGIN {
                 "no-dgram",
                 "no-dsa",
                 "no-dynamic-engine",
-                "no-ec",
                 "no-ec2m",
                 "no-engine",
                 "no-err",
@@ -245,6 +244,7 @@ foreach my $f (@{$config{lib_defines}}) {
 
 my @cryptofilelist = ();
 my @sslfilelist = ();
+my @ecfilelist = ();
 my @asmfilelist = ();
 my @asmbuild = ();
 foreach my $product ((@{$unified_info{libraries}},
@@ -279,6 +279,10 @@ foreach my $product ((@{$unified_info{libraries}},
                 }
                 next;
             }
+            if ($s =~ "crypto/ec/") {
+                push @ecfilelist, '  $(OPENSSL_PATH)/' . $s . "\r\n";
+                next;
+            }
             if ($product =~ "libssl") {
                 push @sslfilelist, '  $(OPENSSL_PATH)/' . $s . "\r\n";
                 next;
@@ -308,6 +312,10 @@ foreach(@dir_list){
 chdir ($dir);
 
 foreach (@headers){
+  if(/^crypto\/ec\//){
+    push @ecfilelist, '  $(OPENSSL_PATH)/' . $_ . "\r\n";
+    next;
+  }
   if(/ssl/){
     push @sslfilelist, '  $(OPENSSL_PATH)/' . $_ . "\r\n";
     next;
@@ -408,17 +416,150 @@ if (!defined $arch) {
     rename( $new_inf_file, $inf_file ) ||
         die "rename $inf_file";
     print "Done!";
+
+    #
+    # Update OpensslLibFull.inf with auto-generated file list, including EC
+    #
+    $inf_file = "OpensslLibFull.inf";
+
+    # Read the contents of the inf file
+    @inf = ();
+    @new_inf = ();
+    open( FD, "<" . $inf_file ) ||
+        die "Cannot open \"" . $inf_file . "\"!";
+    @inf = (<FD>);
+    close(FD) ||
+        die "Cannot close \"" . $inf_file . "\"!";
+
+    $subbing = 0;
+    print "\n--> Updating OpensslLibFull.inf ... ";
+    foreach (@inf) {
+        if ( $_ =~ "# Autogenerated files list starts here" ) {
+            push @new_inf, $_, @cryptofilelist, @sslfilelist;
+            $subbing = 1;
+            next;
+        }
+        if ( $_ =~ "# Autogenerated EC files list starts here" ) {
+            push @new_inf, $_, @ecfilelist;
+            $subbing = 1;
+            next;
+        }
+        if ( $_ =~ "# Autogenerated .*files list ends here" ) {
+            push @new_inf, $_;
+            $subbing = 0;
+            next;
+        }
+
+        push @new_inf, $_
+            unless ($subbing);
+    }
+
+    $new_inf_file = $inf_file . ".new";
+    open( FD, ">" . $new_inf_file ) ||
+        die $new_inf_file;
+    print( FD @new_inf ) ||
+        die $new_inf_file;
+    close(FD) ||
+        die $new_inf_file;
+    rename( $new_inf_file, $inf_file ) ||
+        die "rename $inf_file";
+    print "Done!";
+} else {
+    #
+    # Update the accelerated OpensslLibAccel[Mm].inf (no libssl), which carry
+    # the assembly files of both X64 and X64Gcc, each restricted to its tool
+    # chain family, and the X64 C file list
+    #
+    my $family = ($arch eq "X64") ? "MSFT" : "GCC";
+    my @accelasmfilelist = map { my $f = $_; $f =~ s/\r\n$/ | $family\r\n/; $f } @asmfilelist;
+
+    foreach my $accel_inf_file ("OpensslLibAccel.inf", "OpensslLibAccelMm.inf") {
+        @inf = ();
+        @new_inf = ();
+        open( FD, "<" . $accel_inf_file ) ||
+            die "Cannot open \"" . $accel_inf_file . "\"!";
+        @inf = (<FD>);
+        close(FD) ||
+            die "Cannot close \"" . $accel_inf_file . "\"!";
+
+        $subbing = 0;
+        print "\n--> Updating $accel_inf_file ... ";
+        foreach (@inf) {
+            if ( $_ =~ "# Autogenerated $arch files list starts here" ) {
+                push @new_inf, $_, @accelasmfilelist;
+                $subbing = 1;
+                next;
+            }
+            if ( $arch eq "X64" && $_ =~ "# Autogenerated files list starts here" ) {
+                push @new_inf, $_, @cryptofilelist;
+                $subbing = 1;
+                next;
+            }
+            if ( $_ =~ "# Autogenerated .*files list ends here" ) {
+                push @new_inf, $_;
+                $subbing = 0;
+                next;
+            }
+
+            push @new_inf, $_
+                unless ($subbing);
+        }
+
+        $new_inf_file = $accel_inf_file . ".new";
+        open( FD, ">" . $new_inf_file ) ||
+            die $new_inf_file;
+        print( FD @new_inf ) ||
+            die $new_inf_file;
+        close(FD) ||
+            die $new_inf_file;
+        rename( $new_inf_file, $accel_inf_file ) ||
+            die "rename $accel_inf_file";
+        print "Done!";
+    }
 }
 
 #
-# Copy opensslconf.h and dso_conf.h generated from OpenSSL Configuration
+# Copy opensslconf.h and dso_conf.h generated from OpenSSL Configuration.
+# EC is configured in for OpensslLibFull; the other instances are built with
+# EDK2_OPENSSL_NOEC, which restores the no-ec definitions of opensslconf.h.
 #
 print "\n--> Duplicating opensslconf.h into Include/openssl ... ";
-system(
-    "perl -pe 's/\\n/\\r\\n/' " .
-    "< " . $OPENSSL_PATH . "/include/openssl/opensslconf.h " .
-    "> " . $OPENSSL_PATH . "/../../Include/openssl/opensslconf.h"
-    ) == 0 ||
+my @conf = ();
+my @new_conf = ();
+my $noec_done = 0;
+open( FD, "<" . $OPENSSL_PATH . "/include/openssl/opensslconf.h" ) ||
+    die "Cannot open opensslconf.h!";
+@conf = (<FD>);
+close(FD) ||
+    die "Cannot close opensslconf.h!";
+foreach (@conf) {
+    s/\r?\n$/\r\n/;
+    push @new_conf, $_;
+    if (!$noec_done && $_ =~ /^#\s*define\s+OPENSSL_MIN_API/) {
+        push @new_conf,
+            "/*\r\n",
+            " * EC is built into OpensslLibFull only. The other OpensslLib instances are\r\n",
+            " * built with EDK2_OPENSSL_NOEC and see the same configuration as no-ec.\r\n",
+            " */\r\n",
+            "#ifdef EDK2_OPENSSL_NOEC\r\n",
+            "#ifndef OPENSSL_NO_EC\r\n",
+            "#define OPENSSL_NO_EC\r\n",
+            "#endif\r\n",
+            "#ifndef OPENSSL_NO_ECDH\r\n",
+            "#define OPENSSL_NO_ECDH\r\n",
+            "#endif\r\n",
+            "#ifndef OPENSSL_NO_ECDSA\r\n",
+            "#define OPENSSL_NO_ECDSA\r\n",
+            "#endif\r\n",
+            "#endif\r\n";
+        $noec_done = 1;
+    }
+}
+open( FD, ">" . $OPENSSL_PATH . "/../../Include/openssl/opensslconf.h" ) ||
+    die "Cannot copy opensslconf.h!";
+print( FD @new_conf ) ||
+    die "Cannot copy opensslconf.h!";
+close(FD) ||
     die "Cannot copy opensslconf.h!";
 print "Done!";
 
@@ -637,6 +637,62 @@ TlsSetSessionId (
   return EFI_SUCCESS;
 }
 
+/**
+  Sets a session saved from an earlier connection to the same server with
+  TlsGetResumableSession(), to be resumed by the TLS/SSL connect.
+
+  Resumption skips the certificate exchange and the key exchange of a full
+  handshake. If the server declines to resume the session, a full handshake
+  is performed and TlsIsSessionResumed() returns FALSE.
+
+  @param[in]  Tls           Pointer to the TLS object.
+  @param[in]  Data          Pointer to the session data returned by
+                            TlsGetResumableSession().
+  @param[in]  DataSize      The size of data buffer in bytes.
+
+  @retval  EFI_SUCCESS             The session was set successfully.
+  @retval  EFI_INVALID_PARAMETER   The parameter is invalid.
+  @retval  EFI_ABORTED             Invalid session data.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsSetResumableSession (
+  IN     VOID   *Tls,
+  IN     VOID   *Data,
+  IN     UINTN  DataSize
+  )
+{
+  TLS_CONNECTION  *TlsConn;
+  SSL_SESSION     *Session;
+  CONST UINT8     *Ptr;
+  EFI_STATUS      Status;
+
+  TlsConn = (TLS_CONNECTION *)Tls;
+
+  if ((TlsConn == NULL) || (TlsConn->Ssl == NULL) || (Data == NULL) || (DataSize == 0) || (DataSize > MAX_INT32)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Ptr     = (CONST UINT8 *)Data;
+  Session = d2i_SSL_SESSION (NULL, &Ptr, (long)DataSize);
+  if (Session == NULL) {
+    return EFI_ABORTED;
+  }
+
+  Status = EFI_SUCCESS;
+  if (SSL_set_session (TlsConn->Ssl, Session) != 1) {
+    Status = EFI_ABORTED;
+  }
+
+  //
+  // SSL_set_session() takes its own reference to the session.
+  //
+  SSL_SESSION_free (Session);
+
+  return Status;
+}
+
 /**
   Adds the CA to the cert store when requesting Server or Client authentication.
 
@@ -1075,6 +1131,93 @@ TlsGetSessionId (
   return EFI_SUCCESS;
 }
 
+/**
+  Gets the session of the specified TLS connection in the form accepted by
+  TlsSetResumableSession().
+
+  The session carries the session ID and master secret, or the session ticket
+  issued by the server, so that the next connection to the same server can be
+  resumed with an abbreviated handshake.
+
+  @param[in]      Tls         Pointer to the TLS object.
+  @param[out]     Data        Pointer to the data buffer to receive the session
+                              data.
+  @param[in,out]  DataSize    The size of data buffer in bytes.
+
+  @retval  EFI_SUCCESS             The session data was returned successfully.
+  @retval  EFI_INVALID_PARAMETER   The parameter is invalid.
+  @retval  EFI_NOT_FOUND           The connection has no resumable session.
+  @retval  EFI_BUFFER_TOO_SMALL    The Data is too small to hold the data.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsGetResumableSession (
+  IN     VOID   *Tls,
+  OUT    VOID   *Data,
+  IN OUT UINTN  *DataSize
+  )
+{
+  TLS_CONNECTION  *TlsConn;
+  SSL_SESSION     *Session;
+  INTN            Length;
+  UINT8           *Ptr;
+
+  TlsConn = (TLS_CONNECTION *)Tls;
+
+  if ((TlsConn == NULL) || (TlsConn->Ssl == NULL) || (DataSize == NULL) || ((Data == NULL) && (*DataSize != 0))) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Session = SSL_get_session (TlsConn->Ssl);
+  if ((Session == NULL) || (SSL_SESSION_is_resumable (Session) == 0)) {
+    return EFI_NOT_FOUND;
+  }
+
+  Length = i2d_SSL_SESSION (Session, NULL);
+  if (Length <= 0) {
+    return EFI_NOT_FOUND;
+  }
+
+  if (*DataSize < (UINTN)Length) {
+    *DataSize = (UINTN)Length;
+    return EFI_BUFFER_TOO_SMALL;
+  }
+
+  Ptr       = (UINT8 *)Data;
+  *DataSize = (UINTN)i2d_SSL_SESSION (Session, &Ptr);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Checks if the handshake of the specified TLS connection resumed the session
+  set with TlsSetResumableSession().
+
+  @param[in]  Tls    Pointer to the TLS object.
+
+  @retval  TRUE     The session was resumed.
+  @retval  FALSE    A full handshake was performed, or the handshake has not
+                    completed.
+
+**/
+BOOLEAN
+EFIAPI
+TlsIsSessionResumed (
+  IN     VOID  *Tls
+  )
+{
+  TLS_CONNECTION  *TlsConn;
+
+  TlsConn = (TLS_CONNECTION *)Tls;
+
+  if ((TlsConn == NULL) || (TlsConn->Ssl == NULL)) {
+    return FALSE;
+  }
+
+  return (BOOLEAN)(SSL_session_reused (TlsConn->Ssl) == 1);
+}
+
 /**
   Gets the client random data used in the specified TLS connection.
 
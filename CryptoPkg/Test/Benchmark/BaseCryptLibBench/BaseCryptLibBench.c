@@ -0,0 +1,1380 @@
+/** @file
+  Benchmarks of the BaseCryptLib hashes, HMAC, block ciphers and signature
+  verifications.
+
+  Every benchmark runs its operation in a loop, doubling the iteration count
+  until the loop lasts at least BENCH_MIN_TIME_NS, and reports the rate of the
+  last loop. The output is comma separated so that runs can be compared by
+  regression tracking scripts.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "BaseCryptLibBench.h"
+
+//
+// Test vectors of the BaseCryptLib unit tests.
+//
+#include "../../UnitTest/Library/BaseCryptLib/RsaPkcs7TestData.h"
+#include "../../UnitTest/Library/BaseCryptLib/AuthenticodeTestData.h"
+#ifdef TEST_BASE_CRYPT_LIB_EC
+  #include "../../UnitTest/Library/BaseCryptLib/EcTestData.h"
+#endif
+
+#define BENCH_MIN_TIME_NS     100000000ULL
+#define BENCH_MAX_ITERATIONS  SIZE_16MB
+#define BENCH_MAX_DATA_SIZE   SIZE_256KB
+#define BENCH_MAX_SIG_SIZE    512
+
+//
+// Size of the data units of the AES-XTS benchmarks, a disk sector.
+//
+#define BENCH_XTS_DATA_UNIT_SIZE  512
+
+typedef struct _BENCH_ENTRY BENCH_ENTRY;
+
+/**
+  Prepare the state of a benchmark.
+
+  @param[in]   Entry    The benchmark.
+  @param[out]  State    The state passed to the operation.
+  @param[out]  OpSize   Number of bytes processed by one operation, for the
+                        benchmarks that do not run on the data buffer.
+
+  @retval TRUE   The state is ready.
+  @retval FALSE  The state could not be set up.
+
+**/
+typedef
+BOOLEAN
+(*BENCH_SETUP)(
+  IN  CONST BENCH_ENTRY  *Entry,
+  OUT VOID               **State,
+  OUT UINTN              *OpSize
+  );
+
+/**
+  Run one operation of a benchmark.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The state prepared by the setup function.
+  @param[in]  Data      Data buffer of the throughput benchmarks.
+  @param[in]  DataSize  Size of the data, in bytes.
+
+  @retval TRUE   The operation succeeded.
+  @retval FALSE  The operation failed.
+
+**/
+typedef
+BOOLEAN
+(*BENCH_OPERATION)(
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  );
+
+/**
+  Release the state of a benchmark.
+
+  @param[in]  State     The state prepared by the setup function.
+
+**/
+typedef
+VOID
+(*BENCH_TEARDOWN)(
+  IN VOID  *State
+  );
+
+struct _BENCH_ENTRY {
+  CONST CHAR8        *Name;
+  //
+  // TRUE to run the operation on each size of mBenchDataSize and report MB/s,
+  // FALSE to run it on its own input and report operations per second.
+  //
+  BOOLEAN            Throughput;
+  BENCH_SETUP        Setup;
+  BENCH_OPERATION    Operation;
+  BENCH_TEARDOWN     Teardown;
+  CONST VOID         *Param;
+};
+
+typedef struct {
+  UINTN      (EFIAPI *GetContextSize)(VOID);
+  BOOLEAN    (EFIAPI *Init)(OUT VOID *HashContext);
+  BOOLEAN    (EFIAPI *Update)(IN OUT VOID *HashContext, IN CONST VOID *Data, IN UINTN DataSize);
+  BOOLEAN    (EFIAPI *Final)(IN OUT VOID *HashContext, OUT UINT8 *HashValue);
+} BENCH_HASH_ALGO;
+
+typedef struct {
+  UINTN      KeyLength;
+  BOOLEAN    Encrypt;
+} BENCH_AES_MODE;
+
+typedef struct {
+  VOID     *Context;
+  UINT8    Digest[SHA512_DIGEST_SIZE];
+} BENCH_HASH_STATE;
+
+typedef struct {
+  VOID     *Context;
+  UINT8    *Output;
+  UINT8    Tag[16];
+} BENCH_AES_STATE;
+
+typedef struct {
+  VOID     *PrivateKey;
+  VOID     *PublicKey;
+  UINT8    Digest[SHA256_DIGEST_SIZE];
+  UINT8    Pkcs1Signature[BENCH_MAX_SIG_SIZE];
+  UINTN    Pkcs1SignatureSize;
+  UINT8    PssSignature[BENCH_MAX_SIG_SIZE];
+  UINTN    PssSignatureSize;
+  UINT8    Signature[BENCH_MAX_SIG_SIZE];
+} BENCH_RSA_STATE;
+
+typedef struct {
+  UINT8    *SignedData;
+  UINTN    SignedDataSize;
+  UINT8    *CACert;
+} BENCH_PKCS7_STATE;
+
+#ifdef TEST_BASE_CRYPT_LIB_EC
+typedef struct {
+  UINTN          CurveNid;
+  UINTN          HashNid;
+  BOOLEAN        (EFIAPI *HashAll)(IN CONST VOID *Data, IN UINTN DataSize, OUT UINT8 *HashValue);
+  UINTN          HashSize;
+  CONST UINT8    *PublicKey;
+  UINTN          PublicKeySize;
+  CONST UINT8    *Signature;
+  UINTN          SignatureSize;
+} BENCH_EC_CURVE;
+
+typedef struct {
+  VOID     *Context;
+  UINT8    Digest[SHA384_DIGEST_SIZE];
+} BENCH_EC_STATE;
+#endif
+
+CONST BENCH_HASH_ALGO  mBenchSha1   = { Sha1GetContextSize, Sha1Init, Sha1Update, Sha1Final };
+CONST BENCH_HASH_ALGO  mBenchSha256 = { Sha256GetContextSize, Sha256Init, Sha256Update, Sha256Final };
+CONST BENCH_HASH_ALGO  mBenchSha384 = { Sha384GetContextSize, Sha384Init, Sha384Update, Sha384Final };
+CONST BENCH_HASH_ALGO  mBenchSha512 = { Sha512GetContextSize, Sha512Init, Sha512Update, Sha512Final };
+CONST BENCH_HASH_ALGO  mBenchSm3    = { Sm3GetContextSize, Sm3Init, Sm3Update, Sm3Final };
+
+CONST BENCH_AES_MODE  mBenchAes128CbcEncrypt = { 128, TRUE };
+CONST BENCH_AES_MODE  mBenchAes128CbcDecrypt = { 128, FALSE };
+CONST BENCH_AES_MODE  mBenchAes256CbcEncrypt = { 256, TRUE };
+CONST BENCH_AES_MODE  mBenchAes256CbcDecrypt = { 256, FALSE };
+CONST BENCH_AES_MODE  mBenchAes128Encrypt    = { 128, TRUE };
+CONST BENCH_AES_MODE  mBenchAes256Encrypt    = { 256, TRUE };
+CONST BENCH_AES_MODE  mBenchAes256Decrypt    = { 256, FALSE };
+
+#ifdef TEST_BASE_CRYPT_LIB_EC
+CONST BENCH_EC_CURVE  mBenchEcP256 = {
+  CRYPTO_NID_SECP256R1, CRYPTO_NID_SHA256, Sha256HashAll, SHA256_DIGEST_SIZE,
+  EcP256PublicKey,      sizeof (EcP256PublicKey),
+  EcP256Signature,      sizeof (EcP256Signature)
+};
+CONST BENCH_EC_CURVE  mBenchEcP384 = {
+  CRYPTO_NID_SECP384R1, CRYPTO_NID_SHA384, Sha384HashAll, SHA384_DIGEST_SIZE,
+  EcP384PublicKey,      sizeof (EcP384PublicKey),
+  EcP384Signature,      sizeof (EcP384Signature)
+};
+#endif
+
+CONST UINT8  mBenchKey[32] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+  0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+
+//
+// The data key followed by the tweak key of AES-XTS. AES-128 uses the first
+// 32 bytes.
+//
+CONST UINT8  mBenchXtsKey[64] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+  0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+  0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f
+};
+
+CONST UINT8  mBenchIvec[16] = {
+  0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x78, 0x69, 0x5a, 0x4b, 0x3c, 0x2d, 0x1e, 0x0f
+};
+
+CONST CHAR8  mBenchPayload[] = "Payload Data for PKCS#7 Signing";
+
+//
+// Data sizes of the throughput benchmarks, 0 terminated. All of them are a
+// multiple of the AES block size.
+//
+CONST UINTN  mBenchDataSize[] = { 64, SIZE_1KB, SIZE_16KB, BENCH_MAX_DATA_SIZE, 0 };
+
+/**
+  Write a formatted line of results.
+
+  @param[in]  Format    ASCII format string.
+  @param[in]  ...       Arguments of the format string.
+
+**/
+STATIC
+VOID
+EFIAPI
+BenchPrint (
+  IN CONST CHAR8  *Format,
+  ...
+  )
+{
+  VA_LIST  Marker;
+  CHAR8    Line[BENCH_LINE_SIZE];
+
+  VA_START (Marker, Format);
+  AsciiVSPrint (Line, sizeof (Line), Format, Marker);
+  VA_END (Marker);
+
+  BenchWriteLine (Line);
+}
+
+/**
+  Allocate the context of a hash benchmark.
+
+  @param[in]   Entry    The benchmark.
+  @param[out]  State    The BENCH_HASH_STATE of the benchmark.
+  @param[out]  OpSize   Unused.
+
+  @retval TRUE   The state is ready.
+  @retval FALSE  Out of resources.
+
+**/
+STATIC
+BOOLEAN
+BenchHashSetup (
+  IN  CONST BENCH_ENTRY  *Entry,
+  OUT VOID               **State,
+  OUT UINTN              *OpSize
+  )
+{
+  CONST BENCH_HASH_ALGO  *Algo;
+  BENCH_HASH_STATE       *HashState;
+
+  Algo      = Entry->Param;
+  HashState = AllocateZeroPool (sizeof (*HashState));
+  if (HashState == NULL) {
+    return FALSE;
+  }
+
+  HashState->Context = AllocatePool (Algo->GetContextSize ());
+  if (HashState->Context == NULL) {
+    FreePool (HashState);
+    return FALSE;
+  }
+
+  *State = HashState;
+  return TRUE;
+}
+
+/**
+  Hash the data.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The BENCH_HASH_STATE of the benchmark.
+  @param[in]  Data      Data to hash.
+  @param[in]  DataSize  Size of the data, in bytes.
+
+  @retval TRUE   The data was hashed.
+  @retval FALSE  A hash function failed.
+
+**/
+STATIC
+BOOLEAN
+BenchHash (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  CONST BENCH_HASH_ALGO  *Algo;
+  BENCH_HASH_STATE       *HashState;
+
+  Algo      = Entry->Param;
+  HashState = State;
+
+  return Algo->Init (HashState->Context) &&
+         Algo->Update (HashState->Context, Data, DataSize) &&
+         Algo->Final (HashState->Context, HashState->Digest);
+}
+
+/**
+  Release the state of a hash benchmark.
+
+  @param[in]  State     The BENCH_HASH_STATE of the benchmark.
+
+**/
+STATIC
+VOID
+BenchHashTeardown (
+  IN VOID  *State
+  )
+{
+  BENCH_HASH_STATE  *HashState;
+
+  HashState = State;
+  FreePool (HashState->Context);
+  FreePool (HashState);
+}
+
+/**
+  Allocate the context of the HMAC-SHA256 benchmark.
+
+  @param[in]   Entry    The benchmark.
+  @param[out]  State    The BENCH_HASH_STATE of the benchmark.
+  @param[out]  OpSize   Unused.
+
+  @retval TRUE   The state is ready.
+  @retval FALSE  Out of resources.
+
+**/
+STATIC
+BOOLEAN
+BenchHmacSha256Setup (
+  IN  CONST BENCH_ENTRY  *Entry,
+  OUT VOID               **State,
+  OUT UINTN              *OpSize
+  )
+{
+  BENCH_HASH_STATE  *HashState;
+
+  HashState = AllocateZeroPool (sizeof (*HashState));
+  if (HashState == NULL) {
+    return FALSE;
+  }
+
+  HashState->Context = HmacSha256New ();
+  if (HashState->Context == NULL) {
+    FreePool (HashState);
+    return FALSE;
+  }
+
+  *State = HashState;
+  return TRUE;
+}
+
+/**
+  Compute the HMAC-SHA256 of the data, including setting the key.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The BENCH_HASH_STATE of the benchmark.
+  @param[in]  Data      Data to authenticate.
+  @param[in]  DataSize  Size of the data, in bytes.
+
+  @retval TRUE   The HMAC was computed.
+  @retval FALSE  An HMAC function failed.
+
+**/
+STATIC
+BOOLEAN
+BenchHmacSha256 (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  BENCH_HASH_STATE  *HashState;
+
+  HashState = State;
+
+  return HmacSha256SetKey (HashState->Context, mBenchKey, sizeof (mBenchKey)) &&
+         HmacSha256Update (HashState->Context, Data, DataSize) &&
+         HmacSha256Final (HashState->Context, HashState->Digest);
+}
+
+/**
+  Release the state of the HMAC-SHA256 benchmark.
+
+  @param[in]  State     The BENCH_HASH_STATE of the benchmark.
+
+**/
+STATIC
+VOID
+BenchHmacSha256Teardown (
+  IN VOID  *State
+  )
+{
+  BENCH_HASH_STATE  *HashState;
+
+  HashState = State;
+  HmacSha256Free (HashState->Context);
+  FreePool (HashState);
+}
+
+/**
+  Initialize the AES context and the output buffer of an AES benchmark.
+
+  @param[in]   Entry    The benchmark.
+  @param[out]  State    The BENCH_AES_STATE of the benchmark.
+  @param[out]  OpSize   Unused.
+
+  @retval TRUE   The state is ready.
+  @retval FALSE  Out of resources, or the key could not be set.
+
+**/
+STATIC
+BOOLEAN
+BenchAesSetup (
+  IN  CONST BENCH_ENTRY  *Entry,
+  OUT VOID               **State,
+  OUT UINTN              *OpSize
+  )
+{
+  CONST BENCH_AES_MODE  *Mode;
+  BENCH_AES_STATE       *AesState;
+
+  Mode     = Entry->Param;
+  AesState = AllocateZeroPool (sizeof (*AesState));
+  if (AesState == NULL) {
+    return FALSE;
+  }
+
+  AesState->Context = AllocatePool (AesGetContextSize ());
+  AesState->Output  = AllocatePool (BENCH_MAX_DATA_SIZE);
+  if ((AesState->Context == NULL) || (AesState->Output == NULL) ||
+      !AesInit (AesState->Context, mBenchKey, Mode->KeyLength))
+  {
+    if (AesState->Context != NULL) {
+      FreePool (AesState->Context);
+    }
+
+    if (AesState->Output != NULL) {
+      FreePool (AesState->Output);
+    }
+
+    FreePool (AesState);
+    return FALSE;
+  }
+
+  *State = AesState;
+  return TRUE;
+}
+
+/**
+  Encrypt or decrypt the data in CBC mode.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The BENCH_AES_STATE of the benchmark.
+  @param[in]  Data      Data to process.
+  @param[in]  DataSize  Size of the data, a multiple of the AES block size.
+
+  @retval TRUE   The data was processed.
+  @retval FALSE  The AES function failed.
+
+**/
+STATIC
+BOOLEAN
+BenchAesCbc (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  CONST BENCH_AES_MODE  *Mode;
+  BENCH_AES_STATE       *AesState;
+
+  Mode     = Entry->Param;
+  AesState = State;
+
+  if (Mode->Encrypt) {
+    return AesCbcEncrypt (AesState->Context, Data, DataSize, mBenchIvec, AesState->Output);
+  }
+
+  return AesCbcDecrypt (AesState->Context, Data, DataSize, mBenchIvec, AesState->Output);
+}
+
+/**
+  Prepare the output buffer of an AES-GCM or AES-XTS benchmark. These modes
+  take the key on each call, so there is no context to initialize.
+
+  @param[in]   Entry    The benchmark, with a BENCH_AES_MODE parameter.
+  @param[out]  State    Receives the BENCH_AES_STATE of the benchmark.
+  @param[out]  OpSize   Unused.
+
+  @retval TRUE   The state is ready.
+  @retval FALSE  Out of resources.
+
+**/
+STATIC
+BOOLEAN
+BenchAesModeSetup (
+  IN  CONST BENCH_ENTRY  *Entry,
+  OUT VOID               **State,
+  OUT UINTN              *OpSize
+  )
+{
+  BENCH_AES_STATE  *AesState;
+
+  AesState = AllocateZeroPool (sizeof (*AesState));
+  if (AesState == NULL) {
+    return FALSE;
+  }
+
+  AesState->Output = AllocatePool (BENCH_MAX_DATA_SIZE);
+  if (AesState->Output == NULL) {
+    FreePool (AesState);
+    return FALSE;
+  }
+
+  *State = AesState;
+  return TRUE;
+}
+
+/**
+  Encrypt the data in GCM mode, with a 12-byte IV and a 16-byte tag.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The BENCH_AES_STATE of the benchmark.
+  @param[in]  Data      Data to process.
+  @param[in]  DataSize  Size of the data.
+
+  @retval TRUE   The data was processed.
+  @retval FALSE  The AES function failed.
+
+**/
+STATIC
+BOOLEAN
+BenchAesGcm (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  CONST BENCH_AES_MODE  *Mode;
+  BENCH_AES_STATE       *AesState;
+  UINTN                 OutSize;
+
+  Mode     = Entry->Param;
+  AesState = State;
+  OutSize  = BENCH_MAX_DATA_SIZE;
+
+  return AeadAesGcmEncrypt (
+           mBenchKey,
+           Mode->KeyLength / 8,
+           mBenchIvec,
+           12,
+           NULL,
+           0,
+           Data,
+           DataSize,
+           AesState->Tag,
+           sizeof (AesState->Tag),
+           AesState->Output,
+           &OutSize
+           );
+}
+
+/**
+  Encrypt or decrypt the data in XTS mode, as consecutive data units of
+  BENCH_XTS_DATA_UNIT_SIZE bytes, or as one data unit if it is smaller.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The BENCH_AES_STATE of the benchmark.
+  @param[in]  Data      Data to process.
+  @param[in]  DataSize  Size of the data, a multiple of the AES block size.
+
+  @retval TRUE   The data was processed.
+  @retval FALSE  The AES function failed.
+
+**/
+STATIC
+BOOLEAN
+BenchAesXts (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  CONST BENCH_AES_MODE  *Mode;
+  BENCH_AES_STATE       *AesState;
+  UINTN                 DataUnitSize;
+
+  Mode         = Entry->Param;
+  AesState     = State;
+  DataUnitSize = MIN (DataSize, BENCH_XTS_DATA_UNIT_SIZE);
+
+  if (Mode->Encrypt) {
+    return AesXtsEncrypt (mBenchXtsKey, Mode->KeyLength / 4, 0, DataUnitSize, Data, DataSize, AesState->Output);
+  }
+
+  return AesXtsDecrypt (mBenchXtsKey, Mode->KeyLength / 4, 0, DataUnitSize, Data, DataSize, AesState->Output);
+}
+
+/**
+  Release the state of an AES benchmark.
+
+  @param[in]  State     The BENCH_AES_STATE of the benchmark.
+
+**/
+STATIC
+VOID
+BenchAesTeardown (
+  IN VOID  *State
+  )
+{
+  BENCH_AES_STATE  *AesState;
+
+  AesState = State;
+  if (AesState->Context != NULL) {
+    FreePool (AesState->Context);
+  }
+
+  FreePool (AesState->Output);
+  FreePool (AesState);
+}
+
+/**
+  Load the RSA key pair of the test vectors and sign a digest with both
+  padding schemes.
+
+  @param[in]   Entry    The benchmark.
+  @param[out]  State    The BENCH_RSA_STATE of the benchmark.
+  @param[out]  OpSize   Size of the signature, in bytes.
+
+  @retval TRUE   The state is ready.
+  @retval FALSE  Out of resources, or the keys or signatures could not be
+                 produced.
+
+**/
+STATIC
+BOOLEAN
+BenchRsaSetup (
+  IN  CONST BENCH_ENTRY  *Entry,
+  OUT VOID               **State,
+  OUT UINTN              *OpSize
+  )
+{
+  BENCH_RSA_STATE  *RsaState;
+
+  RsaState = AllocateZeroPool (sizeof (*RsaState));
+  if (RsaState == NULL) {
+    return FALSE;
+  }
+
+  *State = RsaState;
+
+  if (!RsaGetPrivateKeyFromPem (TestKeyPem, sizeof (TestKeyPem), PemPass, &RsaState->PrivateKey) ||
+      !RsaGetPublicKeyFromX509 (TestCert, sizeof (TestCert), &RsaState->PublicKey) ||
+      !Sha256HashAll (mBenchPayload, sizeof (mBenchPayload) - 1, RsaState->Digest))
+  {
+    return FALSE;
+  }
+
+  RsaState->Pkcs1SignatureSize = sizeof (RsaState->Pkcs1Signature);
+  if (!RsaPkcs1Sign (
+         RsaState->PrivateKey,
+         RsaState->Digest,
+         sizeof (RsaState->Digest),
+         RsaState->Pkcs1Signature,
+         &RsaState->Pkcs1SignatureSize
+         ))
+  {
+    return FALSE;
+  }
+
+  RsaState->PssSignatureSize = sizeof (RsaState->PssSignature);
+  if (!RsaPssSign (
+         RsaState->PrivateKey,
+         (CONST UINT8 *)mBenchPayload,
+         sizeof (mBenchPayload) - 1,
+         SHA256_DIGEST_SIZE,
+         SHA256_DIGEST_SIZE,
+         RsaState->PssSignature,
+         &RsaState->PssSignatureSize
+         ))
+  {
+    return FALSE;
+  }
+
+  *OpSize = RsaState->Pkcs1SignatureSize;
+  return TRUE;
+}
+
+/**
+  Sign the digest with RSASSA-PKCS1-v1_5.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The BENCH_RSA_STATE of the benchmark.
+  @param[in]  Data      Unused.
+  @param[in]  DataSize  Unused.
+
+  @retval TRUE   The signature matches the one computed by the setup.
+  @retval FALSE  The signature failed or differs.
+
+**/
+STATIC
+BOOLEAN
+BenchRsaPkcs1Sign (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  BENCH_RSA_STATE  *RsaState;
+  UINTN            SigSize;
+
+  RsaState = State;
+  SigSize  = sizeof (RsaState->Signature);
+
+  return RsaPkcs1Sign (RsaState->PrivateKey, RsaState->Digest, sizeof (RsaState->Digest), RsaState->Signature, &SigSize) &&
+         (SigSize == RsaState->Pkcs1SignatureSize) &&
+         (CompareMem (RsaState->Signature, RsaState->Pkcs1Signature, SigSize) == 0);
+}
+
+/**
+  Verify the RSASSA-PKCS1-v1_5 signature of the digest.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The BENCH_RSA_STATE of the benchmark.
+  @param[in]  Data      Unused.
+  @param[in]  DataSize  Unused.
+
+  @retval TRUE   The signature is valid.
+  @retval FALSE  The verification failed.
+
+**/
+STATIC
+BOOLEAN
+BenchRsaPkcs1Verify (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  BENCH_RSA_STATE  *RsaState;
+
+  RsaState = State;
+
+  return RsaPkcs1Verify (
+           RsaState->PublicKey,
+           RsaState->Digest,
+           sizeof (RsaState->Digest),
+           RsaState->Pkcs1Signature,
+           RsaState->Pkcs1SignatureSize
+           );
+}
+
+/**
+  Verify the RSASSA-PSS signature of the payload.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The BENCH_RSA_STATE of the benchmark.
+  @param[in]  Data      Unused.
+  @param[in]  DataSize  Unused.
+
+  @retval TRUE   The signature is valid.
+  @retval FALSE  The verification failed.
+
+**/
+STATIC
+BOOLEAN
+BenchRsaPssVerify (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  BENCH_RSA_STATE  *RsaState;
+
+  RsaState = State;
+
+  return RsaPssVerify (
+           RsaState->PublicKey,
+           (CONST UINT8 *)mBenchPayload,
+           sizeof (mBenchPayload) - 1,
+           RsaState->PssSignature,
+           RsaState->PssSignatureSize,
+           SHA256_DIGEST_SIZE,
+           SHA256_DIGEST_SIZE
+           );
+}
+
+/**
+  Release the state of an RSA benchmark.
+
+  @param[in]  State     The BENCH_RSA_STATE of the benchmark.
+
+**/
+STATIC
+VOID
+BenchRsaTeardown (
+  IN VOID  *State
+  )
+{
+  BENCH_RSA_STATE  *RsaState;
+
+  RsaState = State;
+  if (RsaState->PrivateKey != NULL) {
+    RsaFree (RsaState->PrivateKey);
+  }
+
+  if (RsaState->PublicKey != NULL) {
+    RsaFree (RsaState->PublicKey);
+  }
+
+  FreePool (RsaState);
+}
+
+/**
+  Report the size of the certificate verified by the X.509 benchmark.
+
+  @param[in]   Entry    The benchmark.
+  @param[out]  State    Unused.
+  @param[out]  OpSize   Size of the certificate, in bytes.
+
+  @retval TRUE   Always.
+
+**/
+STATIC
+BOOLEAN
+BenchX509Setup (
+  IN  CONST BENCH_ENTRY  *Entry,
+  OUT VOID               **State,
+  OUT UINTN              *OpSize
+  )
+{
+  *OpSize = sizeof (TestCert);
+  return TRUE;
+}
+
+/**
+  Verify the test certificate against the test CA.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     Unused.
+  @param[in]  Data      Unused.
+  @param[in]  DataSize  Unused.
+
+  @retval TRUE   The certificate is valid.
+  @retval FALSE  The verification failed.
+
+**/
+STATIC
+BOOLEAN
+BenchX509Verify (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  return X509VerifyCert (TestCert, sizeof (TestCert), TestCACert, sizeof (TestCACert));
+}
+
+/**
+  Sign the payload into a PKCS#7 SignedData with the test key.
+
+  @param[in]   Entry    The benchmark.
+  @param[out]  State    The BENCH_PKCS7_STATE of the benchmark.
+  @param[out]  OpSize   Size of the SignedData, in bytes.
+
+  @retval TRUE   The state is ready.
+  @retval FALSE  Out of resources, or the signing failed.
+
+**/
+STATIC
+BOOLEAN
+BenchPkcs7Setup (
+  IN  CONST BENCH_ENTRY  *Entry,
+  OUT VOID               **State,
+  OUT UINTN              *OpSize
+  )
+{
+  BENCH_PKCS7_STATE  *Pkcs7State;
+  UINT8              *SignCert;
+  BOOLEAN            Result;
+
+  Pkcs7State = AllocateZeroPool (sizeof (*Pkcs7State));
+  if (Pkcs7State == NULL) {
+    return FALSE;
+  }
+
+  *State = Pkcs7State;
+
+  if (!X509ConstructCertificate (TestCACert, sizeof (TestCACert), &Pkcs7State->CACert)) {
+    return FALSE;
+  }
+
+  SignCert = NULL;
+  if (!X509ConstructCertificate (TestCert, sizeof (TestCert), &SignCert)) {
+    return FALSE;
+  }
+
+  Result = Pkcs7Sign (
+             TestKeyPem,
+             sizeof (TestKeyPem),
+             (CONST UINT8 *)PemPass,
+             (UINT8 *)mBenchPayload,
+             sizeof (mBenchPayload) - 1,
+             SignCert,
+             NULL,
+             &Pkcs7State->SignedData,
+             &Pkcs7State->SignedDataSize
+             );
+  X509Free (SignCert);
+
+  *OpSize = Pkcs7State->SignedDataSize;
+  return Result;
+}
+
+/**
+  Verify the PKCS#7 SignedData of the payload against the test CA.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The BENCH_PKCS7_STATE of the benchmark.
+  @param[in]  Data      Unused.
+  @param[in]  DataSize  Unused.
+
+  @retval TRUE   The signature is valid.
+  @retval FALSE  The verification failed.
+
+**/
+STATIC
+BOOLEAN
+BenchPkcs7Verify (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  BENCH_PKCS7_STATE  *Pkcs7State;
+
+  Pkcs7State = State;
+
+  return Pkcs7Verify (
+           Pkcs7State->SignedData,
+           Pkcs7State->SignedDataSize,
+           TestCACert,
+           sizeof (TestCACert),
+           (CONST UINT8 *)mBenchPayload,
+           sizeof (mBenchPayload) - 1
+           );
+}
+
+/**
+  Verify the PKCS#7 SignedData of the payload against the test CA, parsed
+  once by the setup, as a cache of trust anchors does.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The BENCH_PKCS7_STATE of the benchmark.
+  @param[in]  Data      Unused.
+  @param[in]  DataSize  Unused.
+
+  @retval TRUE   The signature is valid.
+  @retval FALSE  The verification failed.
+
+**/
+STATIC
+BOOLEAN
+BenchPkcs7VerifyWithX509 (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  BENCH_PKCS7_STATE  *Pkcs7State;
+
+  Pkcs7State = State;
+
+  return Pkcs7VerifyWithX509 (
+           Pkcs7State->SignedData,
+           Pkcs7State->SignedDataSize,
+           Pkcs7State->CACert,
+           (CONST UINT8 *)mBenchPayload,
+           sizeof (mBenchPayload) - 1
+           );
+}
+
+/**
+  Release the state of the PKCS#7 benchmark.
+
+  @param[in]  State     The BENCH_PKCS7_STATE of the benchmark.
+
+**/
+STATIC
+VOID
+BenchPkcs7Teardown (
+  IN VOID  *State
+  )
+{
+  BENCH_PKCS7_STATE  *Pkcs7State;
+
+  Pkcs7State = State;
+  if (Pkcs7State->SignedData != NULL) {
+    FreePool (Pkcs7State->SignedData);
+  }
+
+  if (Pkcs7State->CACert != NULL) {
+    X509Free (Pkcs7State->CACert);
+  }
+
+  FreePool (Pkcs7State);
+}
+
+/**
+  Report the size of the signature verified by the Authenticode benchmark.
+
+  @param[in]   Entry    The benchmark.
+  @param[out]  State    Unused.
+  @param[out]  OpSize   Size of the Authenticode signature, in bytes.
+
+  @retval TRUE   Always.
+
+**/
+STATIC
+BOOLEAN
+BenchAuthenticodeSetup (
+  IN  CONST BENCH_ENTRY  *Entry,
+  OUT VOID               **State,
+  OUT UINTN              *OpSize
+  )
+{
+  *OpSize = sizeof (AuthenticodeWithSha256);
+  return TRUE;
+}
+
+/**
+  Verify the sample Authenticode signature of a SHA-256 image hash.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     Unused.
+  @param[in]  Data      Unused.
+  @param[in]  DataSize  Unused.
+
+  @retval TRUE   The signature is valid.
+  @retval FALSE  The verification failed.
+
+**/
+STATIC
+BOOLEAN
+BenchAuthenticodeVerify (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  return AuthenticodeVerify (
+           AuthenticodeWithSha256,
+           sizeof (AuthenticodeWithSha256),
+           TestRootCert2,
+           sizeof (TestRootCert2),
+           PeSha256Hash,
+           SHA256_DIGEST_SIZE
+           );
+}
+
+#ifdef TEST_BASE_CRYPT_LIB_EC
+
+/**
+  Load the public key of the test vectors of a curve and hash the signed
+  message.
+
+  @param[in]   Entry    The benchmark, with a BENCH_EC_CURVE parameter.
+  @param[out]  State    The BENCH_EC_STATE of the benchmark.
+  @param[out]  OpSize   Size of the signature, in bytes.
+
+  @retval TRUE   The state is ready.
+  @retval FALSE  Out of resources, or the key or digest could not be set up.
+
+**/
+STATIC
+BOOLEAN
+BenchEcDsaSetup (
+  IN  CONST BENCH_ENTRY  *Entry,
+  OUT VOID               **State,
+  OUT UINTN              *OpSize
+  )
+{
+  CONST BENCH_EC_CURVE  *Curve;
+  BENCH_EC_STATE        *EcState;
+
+  Curve   = Entry->Param;
+  EcState = AllocateZeroPool (sizeof (*EcState));
+  if (EcState == NULL) {
+    return FALSE;
+  }
+
+  *State = EcState;
+
+  EcState->Context = EcNewByNid (Curve->CurveNid);
+  if ((EcState->Context == NULL) ||
+      !EcSetPubKey (EcState->Context, (UINT8 *)Curve->PublicKey, Curve->PublicKeySize) ||
+      !Curve->HashAll (EcMessage, AsciiStrLen (EcMessage), EcState->Digest))
+  {
+    return FALSE;
+  }
+
+  *OpSize = Curve->SignatureSize;
+  return TRUE;
+}
+
+/**
+  Verify the ECDSA signature of the message digest.
+
+  @param[in]  Entry     The benchmark, with a BENCH_EC_CURVE parameter.
+  @param[in]  State     The BENCH_EC_STATE of the benchmark.
+  @param[in]  Data      Unused.
+  @param[in]  DataSize  Unused.
+
+  @retval TRUE   The signature is valid.
+  @retval FALSE  The verification failed.
+
+**/
+STATIC
+BOOLEAN
+BenchEcDsaVerify (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  CONST BENCH_EC_CURVE  *Curve;
+  BENCH_EC_STATE        *EcState;
+
+  Curve   = Entry->Param;
+  EcState = State;
+
+  return EcDsaVerify (
+           EcState->Context,
+           Curve->HashNid,
+           EcState->Digest,
+           Curve->HashSize,
+           Curve->Signature,
+           Curve->SignatureSize
+           );
+}
+
+/**
+  Release the EC context of the ECDSA benchmarks.
+
+  @param[in]  State     The BENCH_EC_STATE of the benchmark.
+
+**/
+STATIC
+VOID
+BenchEcDsaTeardown (
+  IN VOID  *State
+  )
+{
+  BENCH_EC_STATE  *EcState;
+
+  EcState = State;
+  if (EcState->Context != NULL) {
+    EcFree (EcState->Context);
+  }
+
+  FreePool (EcState);
+}
+
+#endif
+
+CONST BENCH_ENTRY  mBenchEntries[] = {
+  { "SHA1",                    TRUE,  BenchHashSetup,         BenchHash,                BenchHashTeardown,       &mBenchSha1             },
+  { "SHA256",                  TRUE,  BenchHashSetup,         BenchHash,                BenchHashTeardown,       &mBenchSha256           },
+  { "SHA384",                  TRUE,  BenchHashSetup,         BenchHash,                BenchHashTeardown,       &mBenchSha384           },
+  { "SHA512",                  TRUE,  BenchHashSetup,         BenchHash,                BenchHashTeardown,       &mBenchSha512           },
+  { "SM3",                     TRUE,  BenchHashSetup,         BenchHash,                BenchHashTeardown,       &mBenchSm3              },
+  { "HMAC-SHA256",             TRUE,  BenchHmacSha256Setup,   BenchHmacSha256,          BenchHmacSha256Teardown, NULL                    },
+  { "AES128-CBC-encrypt",      TRUE,  BenchAesSetup,          BenchAesCbc,              BenchAesTeardown,        &mBenchAes128CbcEncrypt },
+  { "AES128-CBC-decrypt",      TRUE,  BenchAesSetup,          BenchAesCbc,              BenchAesTeardown,        &mBenchAes128CbcDecrypt },
+  { "AES256-CBC-encrypt",      TRUE,  BenchAesSetup,          BenchAesCbc,              BenchAesTeardown,        &mBenchAes256CbcEncrypt },
+  { "AES256-CBC-decrypt",      TRUE,  BenchAesSetup,          BenchAesCbc,              BenchAesTeardown,        &mBenchAes256CbcDecrypt },
+  { "AES128-GCM-encrypt",      TRUE,  BenchAesModeSetup,      BenchAesGcm,              BenchAesTeardown,        &mBenchAes128Encrypt    },
+  { "AES256-GCM-encrypt",      TRUE,  BenchAesModeSetup,      BenchAesGcm,              BenchAesTeardown,        &mBenchAes256Encrypt    },
+  { "AES128-XTS-encrypt",      TRUE,  BenchAesModeSetup,      BenchAesXts,              BenchAesTeardown,        &mBenchAes128Encrypt    },
+  { "AES256-XTS-encrypt",      TRUE,  BenchAesModeSetup,      BenchAesXts,              BenchAesTeardown,        &mBenchAes256Encrypt    },
+  { "AES256-XTS-decrypt",      TRUE,  BenchAesModeSetup,      BenchAesXts,              BenchAesTeardown,        &mBenchAes256Decrypt    },
+  { "RSA-PKCS1-SHA256-sign",   FALSE, BenchRsaSetup,          BenchRsaPkcs1Sign,        BenchRsaTeardown,        NULL                    },
+  { "RSA-PKCS1-SHA256-verify", FALSE, BenchRsaSetup,          BenchRsaPkcs1Verify,      BenchRsaTeardown,        NULL                    },
+  { "RSA-PSS-SHA256-verify",   FALSE, BenchRsaSetup,          BenchRsaPssVerify,        BenchRsaTeardown,        NULL                    },
+  { "X509-verify",             FALSE, BenchX509Setup,         BenchX509Verify,          NULL,                    NULL                    },
+  { "PKCS7-verify",            FALSE, BenchPkcs7Setup,        BenchPkcs7Verify,         BenchPkcs7Teardown,      NULL                    },
+  { "PKCS7-verify-parsed-CA",  FALSE, BenchPkcs7Setup,        BenchPkcs7VerifyWithX509, BenchPkcs7Teardown,      NULL                    },
+  { "Authenticode-verify",     FALSE, BenchAuthenticodeSetup, BenchAuthenticodeVerify,  NULL,                    NULL                    },
+  #ifdef TEST_BASE_CRYPT_LIB_EC
+  { "ECDSA-P256-verify",       FALSE, BenchEcDsaSetup,        BenchEcDsaVerify,         BenchEcDsaTeardown,      &mBenchEcP256           },
+  { "ECDSA-P384-verify",       FALSE, BenchEcDsaSetup,        BenchEcDsaVerify,         BenchEcDsaTeardown,      &mBenchEcP384           },
+  #endif
+};
+
+/**
+  Time one benchmark on one data size and write its result line.
+
+  @param[in]  Entry     The benchmark.
+  @param[in]  State     The state prepared by the setup function.
+  @param[in]  Data      Data buffer.
+  @param[in]  DataSize  Size of the data processed by one operation.
+
+  @retval TRUE   The operations succeeded.
+  @retval FALSE  An operation failed; a FAIL line was written.
+
+**/
+STATIC
+BOOLEAN
+BenchMeasure (
+  IN CONST BENCH_ENTRY  *Entry,
+  IN VOID               *State,
+  IN CONST UINT8        *Data,
+  IN UINTN              DataSize
+  )
+{
+  UINT64  Iterations;
+  UINT64  Index;
+  UINT64  Start;
+  UINT64  Elapsed;
+  UINT64  Work;
+  UINT64  Rate;
+
+  //
+  // The first operation warms up the caches and checks the result.
+  //
+  if (!Entry->Operation (Entry, State, Data, DataSize)) {
+    BenchPrint ("%a,%ld,0,0,FAIL,\n", Entry->Name, (UINT64)DataSize);
+    return FALSE;
+  }
+
+  Iterations = 1;
+  for ( ; ;) {
+    Start = BenchGetTimeNs ();
+    for (Index = 0; Index < Iterations; Index++) {
+      Entry->Operation (Entry, State, Data, DataSize);
+    }
+
+    Elapsed = BenchGetTimeNs () - Start;
+
+    //
+    // Without a time source the loop would never reach the minimum time.
+    //
+    if ((Start == 0) || (Elapsed >= BENCH_MIN_TIME_NS) || (Iterations >= BENCH_MAX_ITERATIONS)) {
+      break;
+    }
+
+    Iterations *= 2;
+  }
+
+  if (Elapsed == 0) {
+    BenchPrint ("%a,%ld,%ld,0,0.00,%a\n", Entry->Name, (UINT64)DataSize, Iterations, Entry->Throughput ? "MB/s" : "op/s");
+    return TRUE;
+  }
+
+  //
+  // The rates are computed in hundredths: bytes per nanosecond times 10^5
+  // give hundredths of MB/s, operations per nanosecond times 10^11 give
+  // hundredths of operations per second.
+  //
+  if (Entry->Throughput) {
+    Work = MultU64x64 (MultU64x64 (Iterations, DataSize), 100000);
+  } else {
+    Work = MultU64x64 (Iterations, 100000000000ULL);
+  }
+
+  Rate = DivU64x64Remainder (Work, Elapsed, NULL);
+  BenchPrint (
+    "%a,%ld,%ld,%ld,%ld.%02ld,%a\n",
+    Entry->Name,
+    (UINT64)DataSize,
+    Iterations,
+    Elapsed,
+    DivU64x32 (Rate, 100),
+    ModU64x32 (Rate, 100),
+    Entry->Throughput ? "MB/s" : "op/s"
+    );
+  return TRUE;
+}
+
+/**
+  Run all the benchmarks and write their results as comma separated values.
+
+  Each result line has the form
+
+    benchmark,size,iterations,elapsed_ns,rate,unit
+
+  where size is the number of bytes processed by one iteration and rate is
+  either the throughput in MB/s or the number of operations per second, with
+  two decimals. Lines starting with '#' are comments.
+
+  @param[in]  Filter    Optional ASCII prefix; only the benchmarks whose name
+                        starts with it are run.
+
+  @retval EFI_SUCCESS           All the selected benchmarks ran.
+  @retval EFI_OUT_OF_RESOURCES  The data buffer could not be allocated.
+  @retval EFI_ABORTED           At least one benchmark could not be set up or
+                                one of its operations failed.
+
+**/
+EFI_STATUS
+BaseCryptLibBenchRun (
+  IN CONST CHAR8  *Filter OPTIONAL
+  )
+{
+  EFI_STATUS         Status;
+  CONST BENCH_ENTRY  *Entry;
+  UINT8              *Data;
+  VOID               *State;
+  UINTN              OpSize;
+  UINTN              Index;
+  UINTN              SizeIndex;
+
+  Data = AllocatePool (BENCH_MAX_DATA_SIZE);
+  if (Data == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < BENCH_MAX_DATA_SIZE; Index++) {
+    Data[Index] = (UINT8)(Index * 31 + (Index >> 11));
+  }
+
+  BenchPrint ("# %a v%a\n", BENCH_NAME, BENCH_VERSION);
+  BenchPrint ("benchmark,size,iterations,elapsed_ns,rate,unit\n");
+
+  Status = EFI_SUCCESS;
+  for (Index = 0; Index < ARRAY_SIZE (mBenchEntries); Index++) {
+    Entry = &mBenchEntries[Index];
+    if ((Filter != NULL) && (AsciiStrnCmp (Entry->Name, Filter, AsciiStrLen (Filter)) != 0)) {
+      continue;
+    }
+
+    State  = NULL;
+    OpSize = 0;
+    if (!Entry->Setup (Entry, &State, &OpSize)) {
+      BenchPrint ("%a,0,0,0,FAIL,\n", Entry->Name);
+      Status = EFI_ABORTED;
+    } else if (Entry->Throughput) {
+      for (SizeIndex = 0; mBenchDataSize[SizeIndex] != 0; SizeIndex++) {
+        if (!BenchMeasure (Entry, State, Data, mBenchDataSize[SizeIndex])) {
+          Status = EFI_ABORTED;
+        }
+      }
+    } else if (!BenchMeasure (Entry, State, NULL, OpSize)) {
+      Status = EFI_ABORTED;
+    }
+
+    if ((State != NULL) && (Entry->Teardown != NULL)) {
+      Entry->Teardown (State);
+    }
+  }
+
+  FreePool (Data);
+  return Status;
+}
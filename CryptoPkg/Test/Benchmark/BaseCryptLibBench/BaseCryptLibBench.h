@@ -0,0 +1,78 @@
+/** @file
+  Internal definitions of the BaseCryptLib benchmark.
+
+  The benchmarks themselves are environment independent. The UEFI shell and
+  the host builds of the application each provide the time source, the output
+  and the entry point.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef BASE_CRYPT_LIB_BENCH_H_
+#define BASE_CRYPT_LIB_BENCH_H_
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PrintLib.h>
+#include <Library/BaseCryptLib.h>
+
+#define BENCH_NAME     "BaseCryptLibBench"
+#define BENCH_VERSION  "1"
+
+//
+// Size of the buffer of a result line, including the null terminator.
+//
+#define BENCH_LINE_SIZE  160
+
+/**
+  Return a monotonic time stamp.
+
+  @return The time stamp in nanoseconds, or 0 if the environment has no
+          usable time source.
+
+**/
+UINT64
+BenchGetTimeNs (
+  VOID
+  );
+
+/**
+  Write a line of results.
+
+  @param[in]  Line      Null-terminated ASCII string, ending with a newline.
+
+**/
+VOID
+BenchWriteLine (
+  IN CONST CHAR8  *Line
+  );
+
+/**
+  Run all the benchmarks and write their results as comma separated values.
+
+  Each result line has the form
+
+    benchmark,size,iterations,elapsed_ns,rate,unit
+
+  where size is the number of bytes processed by one iteration and rate is
+  either the throughput in MB/s or the number of operations per second, with
+  two decimals. Lines starting with '#' are comments.
+
+  @param[in]  Filter    Optional ASCII prefix; only the benchmarks whose name
+                        starts with it are run.
+
+  @retval EFI_SUCCESS           All the selected benchmarks ran.
+  @retval EFI_OUT_OF_RESOURCES  The data buffer could not be allocated.
+  @retval EFI_ABORTED           At least one benchmark could not be set up or
+                                one of its operations failed.
+
+**/
+EFI_STATUS
+BaseCryptLibBenchRun (
+  IN CONST CHAR8  *Filter OPTIONAL
+  );
+
+#endif
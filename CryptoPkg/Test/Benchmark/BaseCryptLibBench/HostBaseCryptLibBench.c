@@ -0,0 +1,76 @@
+/** @file
+  Host front end of the BaseCryptLib benchmark.
+
+  The time source is the POSIX monotonic clock, or the C library processor
+  clock with the Microsoft C library, where it counts the elapsed time from
+  the performance counter. The results are written to the standard output. An optional argument selects the benchmarks whose name
+  starts with it:
+
+    BaseCryptLibBenchHost [prefix]
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <time.h>
+
+#include "BaseCryptLibBench.h"
+
+/**
+  Return a monotonic time stamp.
+
+  @return The time stamp in nanoseconds, or 0 if the clock cannot be read.
+
+**/
+UINT64
+BenchGetTimeNs (
+  VOID
+  )
+{
+ #if defined (_MSC_VER)
+  return (UINT64)clock () * 1000000000ULL / CLOCKS_PER_SEC;
+ #else
+  struct timespec  Now;
+
+  if (clock_gettime (CLOCK_MONOTONIC, &Now) != 0) {
+    return 0;
+  }
+
+  return (UINT64)Now.tv_sec * 1000000000ULL + (UINT64)Now.tv_nsec;
+ #endif
+}
+
+/**
+  Write a line of results to the standard output.
+
+  @param[in]  Line      Null-terminated ASCII string, ending with a newline.
+
+**/
+VOID
+BenchWriteLine (
+  IN CONST CHAR8  *Line
+  )
+{
+  fputs (Line, stdout);
+  fflush (stdout);
+}
+
+/**
+  Standard POSIX C entry point of the host build of the benchmark.
+
+  @param[in]  argc  Number of arguments.
+  @param[in]  argv  Arguments; argv[1] optionally selects the benchmarks.
+
+  @retval 0  All the selected benchmarks ran.
+  @retval 1  At least one benchmark failed.
+
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return EFI_ERROR (BaseCryptLibBenchRun ((argc > 1) ? argv[1] : NULL)) ? 1 : 0;
+}
@@ -0,0 +1,136 @@
+/** @file
+  UEFI shell front end of the BaseCryptLib benchmark.
+
+  The time source is TimerLib and the results are written to the console.
+  An optional argument selects the benchmarks whose name starts with it:
+
+    BaseCryptLibBench.efi [prefix]
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "BaseCryptLibBench.h"
+
+#include <Library/TimerLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/LoadedImage.h>
+
+#define BENCH_FILTER_SIZE  32
+
+/**
+  Return a monotonic time stamp.
+
+  @return The time stamp in nanoseconds, or 0 if the environment has no
+          usable time source.
+
+**/
+UINT64
+BenchGetTimeNs (
+  VOID
+  )
+{
+  return GetTimeInNanoSecond (GetPerformanceCounter ());
+}
+
+/**
+  Write a line of results to the console.
+
+  @param[in]  Line      Null-terminated ASCII string, ending with a newline.
+
+**/
+VOID
+BenchWriteLine (
+  IN CONST CHAR8  *Line
+  )
+{
+  CHAR16  Buffer[BENCH_LINE_SIZE * 2];
+  UINTN   Index;
+
+  for (Index = 0; (*Line != '\0') && (Index < ARRAY_SIZE (Buffer) - 2); Line++) {
+    if (*Line == '\n') {
+      Buffer[Index++] = L'\r';
+    }
+
+    Buffer[Index++] = (CHAR16)*Line;
+  }
+
+  Buffer[Index] = L'\0';
+  gST->ConOut->OutputString (gST->ConOut, Buffer);
+}
+
+/**
+  Extract the first argument of the command line of the application.
+
+  @param[in]   ImageHandle  The image handle of the application.
+  @param[out]  Filter       Buffer receiving the argument in ASCII.
+
+  @retval TRUE   The argument was found.
+  @retval FALSE  The application has no argument.
+
+**/
+STATIC
+BOOLEAN
+BenchGetFilter (
+  IN  EFI_HANDLE  ImageHandle,
+  OUT CHAR8       Filter[BENCH_FILTER_SIZE]
+  )
+{
+  EFI_STATUS                 Status;
+  EFI_LOADED_IMAGE_PROTOCOL  *LoadedImage;
+  CONST CHAR16               *Options;
+  UINTN                      Length;
+  UINTN                      Index;
+  UINTN                      Count;
+
+  Status = gBS->HandleProtocol (ImageHandle, &gEfiLoadedImageProtocolGuid, (VOID **)&LoadedImage);
+  if (EFI_ERROR (Status) || (LoadedImage->LoadOptions == NULL)) {
+    return FALSE;
+  }
+
+  //
+  // The shell passes the whole command line, starting with the name of the
+  // application, as load options.
+  //
+  Options = LoadedImage->LoadOptions;
+  Length  = LoadedImage->LoadOptionsSize / sizeof (CHAR16);
+  for (Index = 0; (Index < Length) && (Options[Index] > L' '); Index++) {
+  }
+
+  for ( ; (Index < Length) && (Options[Index] == L' '); Index++) {
+  }
+
+  for (Count = 0; (Index < Length) && (Count < BENCH_FILTER_SIZE - 1); Index++, Count++) {
+    if ((Options[Index] <= L' ') || (Options[Index] >= 0x7F)) {
+      break;
+    }
+
+    Filter[Count] = (CHAR8)Options[Index];
+  }
+
+  Filter[Count] = '\0';
+  return (BOOLEAN)(Count != 0);
+}
+
+/**
+  Entry point of the BaseCryptLib benchmark.
+
+  @param[in]  ImageHandle  The image handle of the application.
+  @param[in]  SystemTable  The EFI System Table.
+
+  @retval EFI_SUCCESS           All the selected benchmarks ran.
+  @retval EFI_OUT_OF_RESOURCES  The data buffer could not be allocated.
+  @retval EFI_ABORTED           At least one benchmark failed.
+
+**/
+EFI_STATUS
+EFIAPI
+BaseCryptLibBenchMain (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  CHAR8  Filter[BENCH_FILTER_SIZE];
+
+  return BaseCryptLibBenchRun (BenchGetFilter (ImageHandle, Filter) ? Filter : NULL);
+}
@@ -0,0 +1,295 @@
+/** @file
+  Shell application comparing the throughput of multi-algorithm hashing done
+  one algorithm at a time with hashing interleaved block by block.
+
+  Measuring an image into several PCR banks hashes the same buffer with every
+  bank algorithm. Hashing the whole buffer with one algorithm before starting
+  the next streams the buffer from memory once per algorithm, whereas feeding
+  each cache-sized block to all the algorithms in turn streams it once. The
+  application reports the MB/s of both ways, for several block sizes, and
+  checks that they produce the same digests.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/PrintLib.h>
+#include <Library/TimerLib.h>
+#include <Library/BaseCryptLib.h>
+
+#define BENCH_BUFFER_SIZE      SIZE_64MB
+#define BENCH_MIN_BUFFER_SIZE  SIZE_1MB
+#define BENCH_MAX_DIGEST_SIZE  SHA512_DIGEST_SIZE
+
+typedef
+UINTN
+(EFIAPI *BENCH_HASH_GET_CONTEXT_SIZE)(
+  VOID
+  );
+
+typedef
+BOOLEAN
+(EFIAPI *BENCH_HASH_INIT)(
+  OUT  VOID  *HashContext
+  );
+
+typedef
+BOOLEAN
+(EFIAPI *BENCH_HASH_UPDATE)(
+  IN OUT  VOID        *HashContext,
+  IN      CONST VOID  *Data,
+  IN      UINTN       DataSize
+  );
+
+typedef
+BOOLEAN
+(EFIAPI *BENCH_HASH_FINAL)(
+  IN OUT  VOID   *HashContext,
+  OUT     UINT8  *HashValue
+  );
+
+typedef struct {
+  CONST CHAR16                   *Name;
+  UINTN                          DigestSize;
+  BENCH_HASH_GET_CONTEXT_SIZE    GetContextSize;
+  BENCH_HASH_INIT                HashInit;
+  BENCH_HASH_UPDATE              HashUpdate;
+  BENCH_HASH_FINAL               HashFinal;
+  VOID                           *HashCtx;
+  UINT8                          Digest[BENCH_MAX_DIGEST_SIZE];
+} BENCH_HASH;
+
+BENCH_HASH  mBenchHash[] = {
+  { L"SHA1",   SHA1_DIGEST_SIZE,   Sha1GetContextSize,   Sha1Init,   Sha1Update,   Sha1Final   },
+  { L"SHA256", SHA256_DIGEST_SIZE, Sha256GetContextSize, Sha256Init, Sha256Update, Sha256Final },
+  { L"SHA384", SHA384_DIGEST_SIZE, Sha384GetContextSize, Sha384Init, Sha384Update, Sha384Final },
+  { L"SHA512", SHA512_DIGEST_SIZE, Sha512GetContextSize, Sha512Init, Sha512Update, Sha512Final },
+  { L"SM3",    SM3_256_DIGEST_SIZE, Sm3GetContextSize,   Sm3Init,    Sm3Update,    Sm3Final    },
+};
+
+//
+// Block sizes of the interleaved runs, 0 terminated.
+//
+UINTN  mBenchBlockSize[] = { SIZE_4KB, SIZE_16KB, SIZE_64KB, SIZE_256KB, 0 };
+
+/**
+  Print a formatted string to the console.
+
+  @param[in]  Format    Format string.
+  @param[in]  ...       Arguments of the format string.
+
+**/
+STATIC
+VOID
+EFIAPI
+BenchPrint (
+  IN CONST CHAR16  *Format,
+  ...
+  )
+{
+  VA_LIST  Marker;
+  CHAR16   Buffer[160];
+
+  VA_START (Marker, Format);
+  UnicodeVSPrint (Buffer, sizeof (Buffer), Format, Marker);
+  VA_END (Marker);
+
+  gST->ConOut->OutputString (gST->ConOut, Buffer);
+}
+
+/**
+  Print the throughput of a run.
+
+  @param[in]  Label     Name of the run.
+  @param[in]  Bytes     Number of bytes of the buffer hashed.
+  @param[in]  ElapsedNs Duration of the run in nanoseconds.
+
+**/
+STATIC
+VOID
+BenchPrintResult (
+  IN CONST CHAR16  *Label,
+  IN UINT64        Bytes,
+  IN UINT64        ElapsedNs
+  )
+{
+  if (ElapsedNs == 0) {
+    BenchPrint (L"  %-28s no timer\r\n", Label);
+    return;
+  }
+
+  BenchPrint (
+    L"  %-28s %6ld MB/s\r\n",
+    Label,
+    DivU64x64Remainder (MultU64x32 (Bytes, 1000), ElapsedNs, NULL)
+    );
+}
+
+/**
+  Hash a buffer with the selected algorithms.
+
+  @param[in]  Buffer     Buffer to hash.
+  @param[in]  Size       Size of the buffer.
+  @param[in]  First      Index of the first algorithm in mBenchHash.
+  @param[in]  Count      Number of algorithms, starting at First.
+  @param[in]  BlockSize  Size of the blocks fed to all the algorithms in turn,
+                         0 to hash the whole buffer with one algorithm before
+                         starting the next one.
+
+  @return The duration in nanoseconds.
+
+**/
+STATIC
+UINT64
+BenchRun (
+  IN UINT8  *Buffer,
+  IN UINTN  Size,
+  IN UINTN  First,
+  IN UINTN  Count,
+  IN UINTN  BlockSize
+  )
+{
+  UINT64  Start;
+  UINTN   Index;
+  UINTN   Offset;
+  UINTN   Length;
+
+  Start = GetPerformanceCounter ();
+
+  for (Index = First; Index < First + Count; Index++) {
+    mBenchHash[Index].HashInit (mBenchHash[Index].HashCtx);
+  }
+
+  if (BlockSize == 0) {
+    for (Index = First; Index < First + Count; Index++) {
+      mBenchHash[Index].HashUpdate (mBenchHash[Index].HashCtx, Buffer, Size);
+    }
+  } else {
+    for (Offset = 0; Offset < Size; Offset += Length) {
+      Length = MIN (Size - Offset, BlockSize);
+      for (Index = First; Index < First + Count; Index++) {
+        mBenchHash[Index].HashUpdate (mBenchHash[Index].HashCtx, Buffer + Offset, Length);
+      }
+    }
+  }
+
+  for (Index = First; Index < First + Count; Index++) {
+    mBenchHash[Index].HashFinal (mBenchHash[Index].HashCtx, mBenchHash[Index].Digest);
+  }
+
+  return GetTimeInNanoSecond (GetPerformanceCounter () - Start);
+}
+
+/**
+  Entry point of the multi-algorithm hashing benchmark.
+
+  @param[in]  ImageHandle  The image handle of the application.
+  @param[in]  SystemTable  The EFI System Table.
+
+  @retval EFI_SUCCESS           The benchmark ran and the digests matched.
+  @retval EFI_OUT_OF_RESOURCES  The buffer or the hash contexts could not be
+                                allocated.
+  @retval EFI_ABORTED           The interleaved digests did not match.
+
+**/
+EFI_STATUS
+EFIAPI
+MultiHashBenchMain (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Buffer;
+  UINTN       Size;
+  UINTN       Index;
+  UINTN       BlockIndex;
+  UINTN       Count;
+  UINT8       (*Reference)[BENCH_MAX_DIGEST_SIZE];
+  CHAR16      Label[32];
+
+  Count     = ARRAY_SIZE (mBenchHash);
+  Reference = NULL;
+  Buffer    = NULL;
+  Status    = EFI_SUCCESS;
+
+  for (Size = BENCH_BUFFER_SIZE; Size >= BENCH_MIN_BUFFER_SIZE; Size /= 2) {
+    Buffer = AllocatePool (Size);
+    if (Buffer != NULL) {
+      break;
+    }
+  }
+
+  Reference = AllocatePool (Count * BENCH_MAX_DIGEST_SIZE);
+  if ((Buffer == NULL) || (Reference == NULL)) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ON_EXIT;
+  }
+
+  for (Index = 0; Index < Count; Index++) {
+    mBenchHash[Index].HashCtx = AllocatePool (mBenchHash[Index].GetContextSize ());
+    if (mBenchHash[Index].HashCtx == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto ON_EXIT;
+    }
+  }
+
+  //
+  // Fill the buffer with a non-trivial pattern, and touch it once so that the
+  // first run does not pay for the page faults.
+  //
+  for (Index = 0; Index < Size; Index++) {
+    Buffer[Index] = (UINT8)(Index * 31 + (Index >> 11));
+  }
+
+  BenchPrint (L"Multi-algorithm hashing of a %Lu MB buffer\r\n", (UINT64)(Size / SIZE_1MB));
+
+  BenchPrint (L"Single algorithm:\r\n");
+  for (Index = 0; Index < Count; Index++) {
+    BenchPrintResult (mBenchHash[Index].Name, Size, BenchRun (Buffer, Size, Index, 1, 0));
+  }
+
+  BenchPrint (L"All %Lu algorithms:\r\n", (UINT64)Count);
+  BenchPrintResult (L"one algorithm at a time", Size, BenchRun (Buffer, Size, 0, Count, 0));
+  for (Index = 0; Index < Count; Index++) {
+    CopyMem (Reference[Index], mBenchHash[Index].Digest, mBenchHash[Index].DigestSize);
+  }
+
+  for (BlockIndex = 0; mBenchBlockSize[BlockIndex] != 0; BlockIndex++) {
+    UnicodeSPrint (Label, sizeof (Label), L"interleaved, %Lu KB blocks", (UINT64)(mBenchBlockSize[BlockIndex] / SIZE_1KB));
+    BenchPrintResult (Label, Size, BenchRun (Buffer, Size, 0, Count, mBenchBlockSize[BlockIndex]));
+
+    for (Index = 0; Index < Count; Index++) {
+      if (CompareMem (Reference[Index], mBenchHash[Index].Digest, mBenchHash[Index].DigestSize) != 0) {
+        BenchPrint (L"  %s digest mismatch!\r\n", mBenchHash[Index].Name);
+        Status = EFI_ABORTED;
+      }
+    }
+  }
+
+ON_EXIT:
+  if (EFI_ERROR (Status)) {
+    BenchPrint (L"MultiHashBench: %r\r\n", Status);
+  }
+
+  for (Index = 0; Index < Count; Index++) {
+    if (mBenchHash[Index].HashCtx != NULL) {
+      FreePool (mBenchHash[Index].HashCtx);
+    }
+  }
+
+  if (Reference != NULL) {
+    FreePool (Reference);
+  }
+
+  if (Buffer != NULL) {
+    FreePool (Buffer);
+  }
+
+  return Status;
+}
@@ -109,6 +109,73 @@ GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  Aes128CbcCipher[] = {
   0x75, 0x86, 0x60, 0x2d, 0x25, 0x3c, 0xff, 0xf9, 0x1b, 0x82, 0x66, 0xbe, 0xa6, 0xd6, 0x1a, 0xb1
 };
 
+//
+// AES-GCM Test Vector from Test Case 4 of "The Galois/Counter Mode of Operation (GCM)",
+// D. McGrew and J. Viega, with additional authenticated data.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesGcmKey[] = {
+  0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesGcmIv[] = {
+  0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesGcmAData[] = {
+  0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+  0xab, 0xad, 0xda, 0xd2
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesGcmData[] = {
+  0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+  0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+  0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+  0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesGcmCipher[] = {
+  0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+  0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0, 0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+  0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+  0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesGcmTag[] = {
+  0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a, 0xe7, 0x12, 0x1a, 0x47
+};
+
+//
+// AES-XTS Test Vectors 2, 4 and 5 from Annex B of IEEE Std 1619-2007.
+// Vector 2 is one 32-byte data unit numbered 0x3333333333 with Key1 = 11..11,
+// Key2 = 22..22 and a plaintext of 44..44. Vectors 4 and 5 encrypt the same
+// 512-byte data unit 00 01 .. ff 00 01 .. ff as data units 0 and 1; only the
+// first 32 bytes of their ciphertexts are kept here.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesXtsKey[] = {
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesXtsCipher[] = {
+  0xc4, 0x54, 0x18, 0x5e, 0x6a, 0x16, 0x93, 0x6e, 0x39, 0x33, 0x40, 0x38, 0xac, 0xef, 0x83, 0x8b,
+  0xfb, 0x18, 0x6f, 0xff, 0x74, 0x80, 0xad, 0xc4, 0x28, 0x93, 0x82, 0xec, 0xd6, 0xd3, 0x94, 0xf0
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesXtsUnitKey[] = {
+  0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45, 0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26,
+  0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93, 0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesXtsUnit0Cipher[] = {
+  0x27, 0xa7, 0x47, 0x9b, 0xef, 0xa1, 0xd4, 0x76, 0x48, 0x9f, 0x30, 0x8c, 0xd4, 0xcf, 0xa6, 0xe2,
+  0xa9, 0x6e, 0x4b, 0xbe, 0x32, 0x08, 0xff, 0x25, 0x28, 0x7d, 0xd3, 0x81, 0x96, 0x16, 0xe8, 0x9c
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  AesXtsUnit1Cipher[] = {
+  0xbb, 0xf9, 0xd6, 0xa7, 0x4a, 0x74, 0x65, 0xfe, 0xe2, 0x0f, 0x42, 0xad, 0xf9, 0xa6, 0x23, 0xfc,
+  0x95, 0x4f, 0x3b, 0x55, 0x58, 0x7e, 0x8e, 0x42, 0x9e, 0xec, 0x6f, 0x71, 0xe7, 0x38, 0xa3, 0x90
+};
+
 //
 // ARC4 Test Vector defined in "Appendix A.1 Test Vectors from [CRYPTLIB]" of
 // IETF Draft draft-kaukonen-cipher-arcfour-03 ("A Stream Cipher Encryption Algorithm 'Arcfour'").
@@ -273,11 +340,180 @@ TestVerifyBLockCiper (
   return UNIT_TEST_PASSED;
 }
 
+UNIT_TEST_STATUS
+EFIAPI
+TestVerifyAeadAesGcm (
+  UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8    Encrypt[sizeof (AesGcmData)];
+  UINT8    Decrypt[sizeof (AesGcmData)];
+  UINT8    Tag[sizeof (AesGcmTag)];
+  UINTN    OutSize;
+  BOOLEAN  Status;
+
+  OutSize = sizeof (Encrypt);
+  Status  = AeadAesGcmEncrypt (
+              AesGcmKey,
+              sizeof (AesGcmKey),
+              AesGcmIv,
+              sizeof (AesGcmIv),
+              AesGcmAData,
+              sizeof (AesGcmAData),
+              AesGcmData,
+              sizeof (AesGcmData),
+              Tag,
+              sizeof (Tag),
+              Encrypt,
+              &OutSize
+              );
+  UT_ASSERT_TRUE (Status);
+  UT_ASSERT_EQUAL (OutSize, sizeof (AesGcmData));
+  UT_ASSERT_MEM_EQUAL (Encrypt, AesGcmCipher, sizeof (AesGcmCipher));
+  UT_ASSERT_MEM_EQUAL (Tag, AesGcmTag, sizeof (AesGcmTag));
+
+  OutSize = sizeof (Decrypt);
+  Status  = AeadAesGcmDecrypt (
+              AesGcmKey,
+              sizeof (AesGcmKey),
+              AesGcmIv,
+              sizeof (AesGcmIv),
+              AesGcmAData,
+              sizeof (AesGcmAData),
+              AesGcmCipher,
+              sizeof (AesGcmCipher),
+              AesGcmTag,
+              sizeof (AesGcmTag),
+              Decrypt,
+              &OutSize
+              );
+  UT_ASSERT_TRUE (Status);
+  UT_ASSERT_EQUAL (OutSize, sizeof (AesGcmData));
+  UT_ASSERT_MEM_EQUAL (Decrypt, AesGcmData, sizeof (AesGcmData));
+
+  //
+  // A modified tag must be rejected, and the output cleared.
+  //
+  CopyMem (Tag, AesGcmTag, sizeof (Tag));
+  Tag[0] ^= 0x01;
+  OutSize = sizeof (Decrypt);
+  Status  = AeadAesGcmDecrypt (
+              AesGcmKey,
+              sizeof (AesGcmKey),
+              AesGcmIv,
+              sizeof (AesGcmIv),
+              AesGcmAData,
+              sizeof (AesGcmAData),
+              AesGcmCipher,
+              sizeof (AesGcmCipher),
+              Tag,
+              sizeof (Tag),
+              Decrypt,
+              &OutSize
+              );
+  UT_ASSERT_FALSE (Status);
+  UT_ASSERT_TRUE (IsZeroBuffer (Decrypt, sizeof (Decrypt)));
+
+  //
+  // A too small output buffer must be rejected.
+  //
+  OutSize = sizeof (Encrypt) - 1;
+  Status  = AeadAesGcmEncrypt (
+              AesGcmKey,
+              sizeof (AesGcmKey),
+              AesGcmIv,
+              sizeof (AesGcmIv),
+              AesGcmAData,
+              sizeof (AesGcmAData),
+              AesGcmData,
+              sizeof (AesGcmData),
+              Tag,
+              sizeof (Tag),
+              Encrypt,
+              &OutSize
+              );
+  UT_ASSERT_FALSE (Status);
+
+  return UNIT_TEST_PASSED;
+}
+
+UNIT_TEST_STATUS
+EFIAPI
+TestVerifyAesXts (
+  UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8    Data[1024];
+  UINT8    Encrypt[1024];
+  UINT8    Single[512];
+  UINT8    Decrypt[1024];
+  UINT8    Key[sizeof (AesXtsKey)];
+  UINTN    Index;
+  BOOLEAN  Status;
+
+  //
+  // One data unit.
+  //
+  SetMem (Data, 32, 0x44);
+  Status = AesXtsEncrypt (AesXtsKey, sizeof (AesXtsKey), 0x3333333333ULL, 32, Data, 32, Encrypt);
+  UT_ASSERT_TRUE (Status);
+  UT_ASSERT_MEM_EQUAL (Encrypt, AesXtsCipher, sizeof (AesXtsCipher));
+
+  Status = AesXtsDecrypt (AesXtsKey, sizeof (AesXtsKey), 0x3333333333ULL, 32, AesXtsCipher, sizeof (AesXtsCipher), Decrypt);
+  UT_ASSERT_TRUE (Status);
+  UT_ASSERT_MEM_EQUAL (Decrypt, Data, 32);
+
+  //
+  // Two consecutive data units in one call give the same result as one call
+  // per data unit.
+  //
+  for (Index = 0; Index < sizeof (Data); Index++) {
+    Data[Index] = (UINT8)Index;
+  }
+
+  Status = AesXtsEncrypt (AesXtsUnitKey, sizeof (AesXtsUnitKey), 0, 512, Data, sizeof (Data), Encrypt);
+  UT_ASSERT_TRUE (Status);
+  UT_ASSERT_MEM_EQUAL (Encrypt, AesXtsUnit0Cipher, sizeof (AesXtsUnit0Cipher));
+  UT_ASSERT_MEM_EQUAL (Encrypt + 512, AesXtsUnit1Cipher, sizeof (AesXtsUnit1Cipher));
+
+  Status = AesXtsEncrypt (AesXtsUnitKey, sizeof (AesXtsUnitKey), 1, 512, Data + 512, 512, Single);
+  UT_ASSERT_TRUE (Status);
+  UT_ASSERT_MEM_EQUAL (Single, Encrypt + 512, sizeof (Single));
+
+  Status = AesXtsDecrypt (AesXtsUnitKey, sizeof (AesXtsUnitKey), 0, 512, Encrypt, sizeof (Encrypt), Decrypt);
+  UT_ASSERT_TRUE (Status);
+  UT_ASSERT_MEM_EQUAL (Decrypt, Data, sizeof (Data));
+
+  //
+  // Data units that are not a multiple of the block size use ciphertext stealing.
+  //
+  Status = AesXtsEncrypt (AesXtsUnitKey, sizeof (AesXtsUnitKey), 7, 17, Data, 34, Encrypt);
+  UT_ASSERT_TRUE (Status);
+  Status = AesXtsDecrypt (AesXtsUnitKey, sizeof (AesXtsUnitKey), 7, 17, Encrypt, 34, Decrypt);
+  UT_ASSERT_TRUE (Status);
+  UT_ASSERT_MEM_EQUAL (Decrypt, Data, 34);
+
+  //
+  // Invalid sizes and a key whose two halves are equal must be rejected.
+  //
+  Status = AesXtsEncrypt (AesXtsUnitKey, sizeof (AesXtsUnitKey), 0, 512, Data, 1000, Encrypt);
+  UT_ASSERT_FALSE (Status);
+  Status = AesXtsEncrypt (AesXtsUnitKey, 48, 0, 512, Data, 512, Encrypt);
+  UT_ASSERT_FALSE (Status);
+  SetMem (Key, sizeof (Key), 0x11);
+  Status = AesXtsEncrypt (Key, sizeof (Key), 0, 32, Data, 32, Encrypt);
+  UT_ASSERT_FALSE (Status);
+
+  return UNIT_TEST_PASSED;
+}
+
 TEST_DESC  mBlockCipherTest[] = {
   //
   // -----Description-------------------------Class-------------------------Function---------------Pre---------------------------Post------------------Context
   //
   { "TestVerifyAes128Cbc()", "CryptoPkg.BaseCryptLib.BlockCipher", TestVerifyBLockCiper, TestVerifyBLockCiperPreReq, TestVerifyBLockCiperCleanUp, &mAes128CbcTestCtx },
+  { "TestVerifyAeadAesGcm()", "CryptoPkg.BaseCryptLib.BlockCipher", TestVerifyAeadAesGcm, NULL, NULL, NULL },
+  { "TestVerifyAesXts()", "CryptoPkg.BaseCryptLib.BlockCipher", TestVerifyAesXts, NULL, NULL, NULL },
   // These are commented out as these functions have been deprecated, but they have been left in for future reference
   // {"TestVerifyTdesEcb()",    "CryptoPkg.BaseCryptLib.BlockCipher",   TestVerifyBLockCiper, TestVerifyBLockCiperPreReq, TestVerifyBLockCiperCleanUp, &mTdesEcbTestCtx},
   // {"TestVerifyTdesCbc()",    "CryptoPkg.BaseCryptLib.BlockCipher",   TestVerifyBLockCiper, TestVerifyBLockCiperPreReq, TestVerifyBLockCiperCleanUp, &mTdesCbcTestCtx},
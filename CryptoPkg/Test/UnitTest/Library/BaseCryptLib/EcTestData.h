@@ -0,0 +1,48 @@
+/** @file
+  ECDSA keys and signatures shared by the Elliptic Curve tests and the
+  BaseCryptLib benchmark.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef EC_TEST_DATA_H_
+#define EC_TEST_DATA_H_
+
+//
+// Message signed with the keys below, with SHA-256 for P-256 and SHA-384 for
+// P-384. The public keys are the X and Y coordinates and the signatures the
+// r and s values, generated with "openssl dgst -sign".
+//
+GLOBAL_REMOVE_IF_UNREFERENCED CONST CHAR8  EcMessage[] = "EDK II ECDSA verification test message";
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  EcP256PublicKey[] = {
+  0x86, 0x2e, 0x5b, 0xf6, 0x7b, 0x7e, 0xe4, 0xb5, 0x4b, 0xc4, 0xe3, 0x2c, 0xf8, 0xed, 0xca, 0x12,
+  0x13, 0xd6, 0x23, 0x24, 0xa3, 0x15, 0xdb, 0x5b, 0x8b, 0xa9, 0x2f, 0xcd, 0xe8, 0x0f, 0x9c, 0x20,
+  0x72, 0x5d, 0xf3, 0xca, 0xde, 0xfd, 0x7d, 0xe3, 0x48, 0xad, 0xfa, 0xf1, 0x39, 0x07, 0xc5, 0x16,
+  0xa5, 0x50, 0xa3, 0x8c, 0xba, 0xee, 0x47, 0x3b, 0x25, 0xcc, 0x7a, 0xcd, 0xcc, 0x2c, 0x70, 0x18
+};
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  EcP256Signature[] = {
+  0xa7, 0xf6, 0x0c, 0xa5, 0x42, 0x2e, 0x78, 0x48, 0xa5, 0x36, 0x13, 0x8a, 0x0b, 0xe8, 0xc6, 0x6d,
+  0x50, 0xf8, 0x89, 0xbb, 0x0d, 0x56, 0xd3, 0xf7, 0x11, 0x4e, 0x8c, 0x51, 0x83, 0x10, 0x7a, 0xaf,
+  0xe5, 0x37, 0x57, 0x0a, 0xd0, 0x23, 0xbf, 0xcf, 0xc4, 0x5a, 0x44, 0x72, 0xf2, 0x91, 0x28, 0x88,
+  0x66, 0x4c, 0x2c, 0x02, 0x2b, 0xa7, 0x11, 0xbb, 0x96, 0x22, 0xbd, 0x22, 0xc9, 0x58, 0x1a, 0x0f
+};
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  EcP384PublicKey[] = {
+  0x34, 0x0c, 0x5e, 0x11, 0x70, 0xd9, 0x28, 0xa4, 0xe2, 0x66, 0x54, 0x48, 0x58, 0x7d, 0x0f, 0x23,
+  0x59, 0x7b, 0xd8, 0xaa, 0x0c, 0xcf, 0x66, 0x5a, 0xc4, 0x5c, 0x8c, 0x69, 0xf0, 0x0a, 0xcb, 0xe7,
+  0x9d, 0xd9, 0x5c, 0x7e, 0x1c, 0x7e, 0xeb, 0x1b, 0xc6, 0x5a, 0x55, 0xc5, 0xe5, 0xce, 0x04, 0x85,
+  0xd2, 0xb1, 0x8c, 0x2a, 0x93, 0x06, 0xa1, 0x28, 0xf6, 0x28, 0x8d, 0x56, 0x77, 0x49, 0x0d, 0x8d,
+  0xc3, 0x3f, 0x54, 0x2a, 0xc5, 0x2c, 0xf0, 0x4e, 0xfe, 0xf2, 0x90, 0x5e, 0x31, 0xc4, 0xa8, 0x5e,
+  0xca, 0x5b, 0xf0, 0x3f, 0xa5, 0x00, 0x0e, 0xba, 0x44, 0xc4, 0xb5, 0x11, 0xa3, 0xad, 0x65, 0x95
+};
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  EcP384Signature[] = {
+  0x06, 0x7c, 0x00, 0x71, 0x9d, 0xf5, 0x10, 0x98, 0x93, 0x1a, 0xbe, 0x82, 0x35, 0x14, 0x92, 0xb3,
+  0x73, 0x89, 0x9a, 0xdf, 0x49, 0xb8, 0xd6, 0xb9, 0xff, 0x54, 0xe8, 0x7c, 0x02, 0x14, 0x84, 0x51,
+  0x2c, 0xc5, 0xe2, 0xd5, 0x4a, 0x28, 0xcc, 0x08, 0x50, 0x32, 0xd6, 0x5b, 0x91, 0xf0, 0x58, 0x49,
+  0xbc, 0x78, 0x28, 0x32, 0xcd, 0xab, 0x09, 0x67, 0xca, 0xa6, 0xbe, 0xb1, 0xde, 0xce, 0x8f, 0x61,
+  0x41, 0xfe, 0x15, 0x90, 0xd7, 0x26, 0xf6, 0xfa, 0x85, 0xed, 0x30, 0x19, 0x5e, 0xf3, 0xfc, 0x0f,
+  0xdf, 0x24, 0xb7, 0xec, 0xad, 0x5a, 0x54, 0x68, 0x66, 0x2a, 0x4f, 0x95, 0x1b, 0x16, 0x24, 0xc7
+};
+
+#endif
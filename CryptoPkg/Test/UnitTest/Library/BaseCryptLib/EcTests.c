@@ -0,0 +1,156 @@
+/** @file
+  Application for Elliptic Curve Primitives Validation.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "TestBaseCryptLib.h"
+#include "EcTestData.h"
+
+STATIC VOID  *mEc;
+
+UNIT_TEST_STATUS
+EFIAPI
+TestVerifyEcPreReq (
+  UNIT_TEST_CONTEXT  Context
+  )
+{
+  mEc = EcNewByNid ((UINTN)Context);
+
+  if (mEc == NULL) {
+    return UNIT_TEST_ERROR_TEST_FAILED;
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+VOID
+EFIAPI
+TestVerifyEcCleanUp (
+  UNIT_TEST_CONTEXT  Context
+  )
+{
+  if (mEc != NULL) {
+    EcFree (mEc);
+    mEc = NULL;
+  }
+}
+
+UNIT_TEST_STATUS
+EFIAPI
+TestVerifyEcNewByNid (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  VOID  *Ec;
+
+  Ec = EcNewByNid (CRYPTO_NID_SECP521R1);
+  UT_ASSERT_NOT_NULL (Ec);
+  EcFree (Ec);
+
+  Ec = EcNewByNid (CRYPTO_NID_NULL);
+  UT_ASSERT_TRUE (Ec == NULL);
+
+  Ec = EcNewByNid (CRYPTO_NID_SHA256);
+  UT_ASSERT_TRUE (Ec == NULL);
+
+  return UNIT_TEST_PASSED;
+}
+
+UNIT_TEST_STATUS
+EFIAPI
+TestVerifyEcDsaP256Verify (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8    Digest[SHA256_DIGEST_SIZE];
+  UINT8    Signature[sizeof (EcP256Signature)];
+  UINT8    PublicKey[sizeof (EcP256PublicKey)];
+  BOOLEAN  Status;
+
+  Status = Sha256HashAll (EcMessage, AsciiStrLen (EcMessage), Digest);
+  UT_ASSERT_TRUE (Status);
+
+  //
+  // A point off the curve is rejected.
+  //
+  CopyMem (PublicKey, EcP256PublicKey, sizeof (PublicKey));
+  PublicKey[sizeof (PublicKey) - 1] ^= 0x01;
+  Status = EcSetPubKey (mEc, PublicKey, sizeof (PublicKey));
+  UT_ASSERT_FALSE (Status);
+
+  Status = EcSetPubKey (mEc, (UINT8 *)EcP256PublicKey, sizeof (EcP256PublicKey) - 1);
+  UT_ASSERT_FALSE (Status);
+
+  Status = EcSetPubKey (mEc, (UINT8 *)EcP256PublicKey, sizeof (EcP256PublicKey));
+  UT_ASSERT_TRUE (Status);
+
+  Status = EcDsaVerify (mEc, CRYPTO_NID_SHA256, Digest, sizeof (Digest), EcP256Signature, sizeof (EcP256Signature));
+  UT_ASSERT_TRUE (Status);
+
+  //
+  // Mismatched hash size, signature size, and altered signature and hash.
+  //
+  Status = EcDsaVerify (mEc, CRYPTO_NID_SHA384, Digest, sizeof (Digest), EcP256Signature, sizeof (EcP256Signature));
+  UT_ASSERT_FALSE (Status);
+
+  Status = EcDsaVerify (mEc, CRYPTO_NID_SHA256, Digest, sizeof (Digest), EcP256Signature, sizeof (EcP256Signature) - 1);
+  UT_ASSERT_FALSE (Status);
+
+  CopyMem (Signature, EcP256Signature, sizeof (Signature));
+  Signature[sizeof (Signature) - 1] ^= 0x01;
+  Status = EcDsaVerify (mEc, CRYPTO_NID_SHA256, Digest, sizeof (Digest), Signature, sizeof (Signature));
+  UT_ASSERT_FALSE (Status);
+
+  Digest[0] ^= 0x01;
+  Status     = EcDsaVerify (mEc, CRYPTO_NID_SHA256, Digest, sizeof (Digest), EcP256Signature, sizeof (EcP256Signature));
+  UT_ASSERT_FALSE (Status);
+
+  return UNIT_TEST_PASSED;
+}
+
+UNIT_TEST_STATUS
+EFIAPI
+TestVerifyEcDsaP384Verify (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8    Digest[SHA384_DIGEST_SIZE];
+  BOOLEAN  Status;
+
+  Status = Sha384HashAll (EcMessage, AsciiStrLen (EcMessage), Digest);
+  UT_ASSERT_TRUE (Status);
+
+  //
+  // A P-256 key does not fit a P-384 context.
+  //
+  Status = EcSetPubKey (mEc, (UINT8 *)EcP256PublicKey, sizeof (EcP256PublicKey));
+  UT_ASSERT_FALSE (Status);
+
+  Status = EcSetPubKey (mEc, (UINT8 *)EcP384PublicKey, sizeof (EcP384PublicKey));
+  UT_ASSERT_TRUE (Status);
+
+  Status = EcDsaVerify (mEc, CRYPTO_NID_SHA384, Digest, sizeof (Digest), EcP384Signature, sizeof (EcP384Signature));
+  UT_ASSERT_TRUE (Status);
+
+  Status = EcDsaVerify (mEc, CRYPTO_NID_SHA384, Digest, sizeof (Digest), EcP256Signature, sizeof (EcP256Signature));
+  UT_ASSERT_FALSE (Status);
+
+  Digest[SHA384_DIGEST_SIZE - 1] ^= 0x80;
+  Status                          = EcDsaVerify (mEc, CRYPTO_NID_SHA384, Digest, sizeof (Digest), EcP384Signature, sizeof (EcP384Signature));
+  UT_ASSERT_FALSE (Status);
+
+  return UNIT_TEST_PASSED;
+}
+
+TEST_DESC  mEcTest[] = {
+  //
+  // -----Description--------------------------------Class---------------------------Function---------------------Pre-----------------Post-----------------Context
+  //
+  { "TestVerifyEcNewByNid()",      "CryptoPkg.BaseCryptLib.Ec", TestVerifyEcNewByNid,      NULL,               NULL,                NULL                                },
+  { "TestVerifyEcDsaP256Verify()", "CryptoPkg.BaseCryptLib.Ec", TestVerifyEcDsaP256Verify, TestVerifyEcPreReq, TestVerifyEcCleanUp, (UNIT_TEST_CONTEXT)CRYPTO_NID_SECP256R1 },
+  { "TestVerifyEcDsaP384Verify()", "CryptoPkg.BaseCryptLib.Ec", TestVerifyEcDsaP384Verify, TestVerifyEcPreReq, TestVerifyEcCleanUp, (UNIT_TEST_CONTEXT)CRYPTO_NID_SECP384R1 },
+};
+
+UINTN  mEcTestNum = ARRAY_SIZE (mEcTest);
@@ -19,24 +19,11 @@ NONTESTED_MEMORY_RANGE  *mCurrentRange;
 UINT64                  mTestedSystemMemory;
 UINT64                  mNonTestedSystemMemory;
 
-UINT32  GenericMemoryTestMonoPattern[GENERIC_CACHELINE_SIZE / 4] = {
-  0x5a5a5a5a,
-  0xa5a5a5a5,
-  0x5a5a5a5a,
-  0xa5a5a5a5,
-  0x5a5a5a5a,
-  0xa5a5a5a5,
-  0x5a5a5a5a,
-  0xa5a5a5a5,
-  0x5a5a5a5a,
-  0xa5a5a5a5,
-  0x5a5a5a5a,
-  0xa5a5a5a5,
-  0x5a5a5a5a,
-  0xa5a5a5a5,
-  0x5a5a5a5a,
-  0xa5a5a5a5
-};
+//
+// The memory test pattern, filled with PcdGenericMemoryTestPattern by the
+// entry point. It repeats every 64 bits.
+//
+UINT64  GenericMemoryTestMonoPattern[GENERIC_CACHELINE_SIZE / sizeof (UINT64)];
 
 /**
   Compares the contents of two buffers.
@@ -315,6 +302,182 @@ ConstructNonTestedMemoryRange (
   return EFI_SUCCESS;
 }
 
+/**
+  Write the memory test pattern into a range of physical memory, without
+  flushing the data cache.
+
+  This function may run on the APs.
+
+  @param[in] Private  Point to generic memory test driver's private data.
+  @param[in] Start    The memory range's start address.
+  @param[in] Size     The memory range's size.
+
+**/
+VOID
+WritePattern (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private,
+  IN  EFI_PHYSICAL_ADDRESS         Start,
+  IN  UINT64                       Size
+  )
+{
+  EFI_PHYSICAL_ADDRESS  Address;
+
+  //
+  // When the pattern covers the whole range, it is written by SetMem64(),
+  // which uses streaming stores in the BaseMemoryLib instances that have them
+  // (BaseMemoryLibSse2). The pattern is not read back before the cache is
+  // flushed, so there is no point in filling the cache with it.
+  //
+  if ((Private->CoverageSpan == Private->MonoTestSize) &&
+      (((Start | Size) & (sizeof (UINT64) - 1)) == 0))
+  {
+    SetMem64 ((VOID *)(UINTN)Start, (UINTN)Size, ReadUnaligned64 (Private->MonoPattern));
+    return;
+  }
+
+  for (Address = Start; Address < Start + Size; Address += Private->CoverageSpan) {
+    CopyMem ((VOID *)(UINTN)Address, Private->MonoPattern, Private->MonoTestSize);
+  }
+}
+
+/**
+  Look for the first mis-compare in a range of physical memory covered by the
+  memory test pattern.
+
+  This function may run on the APs.
+
+  @param[in]  Private       Point to generic memory test driver's private data.
+  @param[in]  Start         The memory range's start address.
+  @param[in]  Size          The memory range's size.
+  @param[out] ErrorAddress  The address of the pattern which mis-compares.
+
+  @retval TRUE   A mis-compare was found.
+  @retval FALSE  The range of memory matches the pattern.
+
+**/
+BOOLEAN
+FindPatternMiscompare (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private,
+  IN  EFI_PHYSICAL_ADDRESS         Start,
+  IN  UINT64                       Size,
+  OUT EFI_PHYSICAL_ADDRESS         *ErrorAddress
+  )
+{
+  EFI_PHYSICAL_ADDRESS  Address;
+  UINT64                Pattern;
+
+  //
+  // When the pattern covers the whole range, compare it 64 bits at a time,
+  // as it was written by WritePattern().
+  //
+  if ((Private->CoverageSpan == Private->MonoTestSize) &&
+      (((Start | Size) & (sizeof (UINT64) - 1)) == 0))
+  {
+    Pattern = ReadUnaligned64 (Private->MonoPattern);
+    for (Address = Start; Address < Start + Size; Address += sizeof (UINT64)) {
+      if (*(UINT64 *)(UINTN)Address != Pattern) {
+        *ErrorAddress = Address - ((Address - Start) % Private->MonoTestSize);
+        return TRUE;
+      }
+    }
+
+    return FALSE;
+  }
+
+  for (Address = Start; Address < Start + Size; Address += Private->CoverageSpan) {
+    if (CompareMemWithoutCheckArgument ((VOID *)(UINTN)Address, Private->MonoPattern, Private->MonoTestSize) != 0) {
+      *ErrorAddress = Address;
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Report an uncorrectable memory error.
+
+  @param[in] Address  The address of the pattern which mis-compares.
+
+  @retval EFI_DEVICE_ERROR      The error was reported.
+  @retval EFI_OUT_OF_RESOURCES  The error data could not be allocated.
+
+**/
+EFI_STATUS
+ReportMemoryError (
+  IN  EFI_PHYSICAL_ADDRESS  Address
+  )
+{
+  EFI_MEMORY_EXTENDED_ERROR_DATA  *ExtendedErrorData;
+
+  //
+  // Report uncorrectable errors
+  //
+  ExtendedErrorData = AllocateZeroPool (sizeof (EFI_MEMORY_EXTENDED_ERROR_DATA));
+  if (ExtendedErrorData == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  ExtendedErrorData->DataHeader.HeaderSize = (UINT16)sizeof (EFI_STATUS_CODE_DATA);
+  ExtendedErrorData->DataHeader.Size       = (UINT16)(sizeof (EFI_MEMORY_EXTENDED_ERROR_DATA) - sizeof (EFI_STATUS_CODE_DATA));
+  ExtendedErrorData->Granularity           = EFI_MEMORY_ERROR_DEVICE;
+  ExtendedErrorData->Operation             = EFI_MEMORY_OPERATION_READ;
+  ExtendedErrorData->Syndrome              = 0x0;
+  ExtendedErrorData->Address               = Address;
+  ExtendedErrorData->Resolution            = 0x40;
+
+  REPORT_STATUS_CODE_EX (
+    EFI_ERROR_CODE,
+    EFI_COMPUTING_UNIT_MEMORY | EFI_CU_MEMORY_EC_UNCORRECTABLE,
+    0,
+    &gEfiGenericMemTestProtocolGuid,
+    NULL,
+    (UINT8 *)ExtendedErrorData + sizeof (EFI_STATUS_CODE_DATA),
+    ExtendedErrorData->DataHeader.Size
+    );
+
+  FreePool (ExtendedErrorData);
+  return EFI_DEVICE_ERROR;
+}
+
+/**
+  Add a range of memory which passed the R/W/V memory test to the statistics
+  of the result summary.
+
+  @param[in] Private     Point to generic memory test driver's private data.
+  @param[in] Size        The size of the tested memory.
+  @param[in] BeginTicks  The performance counter when the test began.
+
+**/
+VOID
+AccountMemoryTest (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private,
+  IN  UINT64                       Size,
+  IN  UINT64                       BeginTicks
+  )
+{
+  UINT64  Ticks;
+  UINT64  StartValue;
+  UINT64  EndValue;
+
+  Ticks = GetPerformanceCounter ();
+  GetPerformanceCounterProperties (&StartValue, &EndValue);
+  Private->TestTicks += (StartValue < EndValue) ? Ticks - BeginTicks : BeginTicks - Ticks;
+
+  //
+  // Every pattern is written once and read once.
+  //
+  Private->TestedBytes += Size;
+  if (Private->CoverageSpan == Private->MonoTestSize) {
+    Private->AccessedBytes += MultU64x32 (Size, 2);
+  } else {
+    Private->AccessedBytes += MultU64x64 (
+                                DivU64x64Remainder (Size + Private->CoverageSpan - 1, Private->CoverageSpan, NULL),
+                                2 * Private->MonoTestSize
+                                );
+  }
+}
+
 /**
   Write the memory test pattern into a range of physical memory.
 
@@ -333,10 +496,6 @@ WriteMemory (
   IN  UINT64                       Size
   )
 {
-  EFI_PHYSICAL_ADDRESS  Address;
-
-  Address = Start;
-
   //
   // Add 4G memory address check for IA32 platform
   // NOTE: Without page table, there is no way to use memory above 4G.
@@ -345,10 +504,7 @@ WriteMemory (
     return EFI_SUCCESS;
   }
 
-  while (Address < (Start + Size)) {
-    CopyMem ((VOID *)(UINTN)Address, Private->MonoPattern, Private->MonoTestSize);
-    Address += Private->CoverageSpan;
-  }
+  WritePattern (Private, Start, Size);
 
   //
   // bug bug: we may need GCD service to make the code cache and data uncache,
@@ -382,12 +538,7 @@ VerifyMemory (
   IN  UINT64                       Size
   )
 {
-  EFI_PHYSICAL_ADDRESS            Address;
-  INTN                            ErrorFound;
-  EFI_MEMORY_EXTENDED_ERROR_DATA  *ExtendedErrorData;
-
-  Address           = Start;
-  ExtendedErrorData = NULL;
+  EFI_PHYSICAL_ADDRESS  ErrorAddress;
 
   //
   // Add 4G memory address check for IA32 platform
@@ -402,43 +553,8 @@ VerifyMemory (
   // error here. If there is miscompare error here then check if generic
   // memory test driver can disable the bad DIMM.
   //
-  while (Address < (Start + Size)) {
-    ErrorFound = CompareMemWithoutCheckArgument (
-                   (VOID *)(UINTN)(Address),
-                   Private->MonoPattern,
-                   Private->MonoTestSize
-                   );
-    if (ErrorFound != 0) {
-      //
-      // Report uncorrectable errors
-      //
-      ExtendedErrorData = AllocateZeroPool (sizeof (EFI_MEMORY_EXTENDED_ERROR_DATA));
-      if (ExtendedErrorData == NULL) {
-        return EFI_OUT_OF_RESOURCES;
-      }
-
-      ExtendedErrorData->DataHeader.HeaderSize = (UINT16)sizeof (EFI_STATUS_CODE_DATA);
-      ExtendedErrorData->DataHeader.Size       = (UINT16)(sizeof (EFI_MEMORY_EXTENDED_ERROR_DATA) - sizeof (EFI_STATUS_CODE_DATA));
-      ExtendedErrorData->Granularity           = EFI_MEMORY_ERROR_DEVICE;
-      ExtendedErrorData->Operation             = EFI_MEMORY_OPERATION_READ;
-      ExtendedErrorData->Syndrome              = 0x0;
-      ExtendedErrorData->Address               = Address;
-      ExtendedErrorData->Resolution            = 0x40;
-
-      REPORT_STATUS_CODE_EX (
-        EFI_ERROR_CODE,
-        EFI_COMPUTING_UNIT_MEMORY | EFI_CU_MEMORY_EC_UNCORRECTABLE,
-        0,
-        &gEfiGenericMemTestProtocolGuid,
-        NULL,
-        (UINT8 *)ExtendedErrorData + sizeof (EFI_STATUS_CODE_DATA),
-        ExtendedErrorData->DataHeader.Size
-        );
-
-      return EFI_DEVICE_ERROR;
-    }
-
-    Address += Private->CoverageSpan;
+  if (FindPatternMiscompare (Private, Start, Size, &ErrorAddress)) {
+    return ReportMemoryError (ErrorAddress);
   }
 
   return EFI_SUCCESS;
@@ -532,6 +648,18 @@ InitializeMemoryTest (
     return EFI_NO_MEDIA;
   }
 
+  Private->TestedBytes   = 0;
+  Private->AccessedBytes = 0;
+  Private->TestTicks     = 0;
+
+  //
+  // Test the memory on all the processors if the platform asks for it
+  //
+  FreeParallelMemoryTest (Private);
+  if (PcdGetBool (PcdGenericMemoryTestUseAps) && (Private->CoverLevel != IGNORE)) {
+    InitializeParallelMemoryTest (Private);
+  }
+
   //
   // ready to perform the R/W/V memory test
   //
@@ -572,12 +700,17 @@ GenPerformMemoryTest (
   GENERIC_MEMORY_TEST_PRIVATE     *Private;
   EFI_MEMORY_RANGE_EXTENDED_DATA  *RangeData;
   UINT64                          BlockBoundary;
+  UINT64                          BeginTicks;
 
   Private       = GENERIC_MEMORY_TEST_PRIVATE_FROM_THIS (This);
   *ErrorOut     = FALSE;
   RangeData     = NULL;
   BlockBoundary = 0;
 
+  if ((Private->Parallel != NULL) && !TestAbort) {
+    return ParallelPerformMemoryTest (Private, TestedMemorySize, TotalMemorySize, ErrorOut);
+  }
+
   //
   // In extensive mode the boundary of "mCurrentRange->Length" may will lost
   // some range that is not Private->BdsBlockSize size boundary, so need
@@ -621,6 +754,7 @@ GenPerformMemoryTest (
       // The software memory test (R/W/V) perform here. It will detect the
       // memory mis-compare error.
       //
+      BeginTicks = GetPerformanceCounter ();
       WriteMemory (Private, mCurrentAddress, BlockBoundary);
 
       Status = VerifyMemory (Private, mCurrentAddress, BlockBoundary);
@@ -632,6 +766,8 @@ GenPerformMemoryTest (
         *ErrorOut = TRUE;
         return EFI_DEVICE_ERROR;
       }
+
+      AccountMemoryTest (Private, BlockBoundary, BeginTicks);
     }
 
     mTestedSystemMemory += BlockBoundary;
@@ -670,6 +806,59 @@ GenPerformMemoryTest (
   }
 }
 
+/**
+  Show the result summary of the R/W/V memory test.
+
+  The tested rate counts the memory covered by the test, the accessed rate
+  counts the bytes of pattern written and read back, which are fewer unless
+  the coverage level is EXTENSIVE.
+
+  @param[in] Private  Point to generic memory test driver's private data.
+
+**/
+STATIC
+VOID
+ShowMemoryTestSummary (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private
+  )
+{
+  UINT64  Nanoseconds;
+  UINT64  TestedRate;
+  UINT64  AccessedRate;
+
+  if (Private->TestedBytes == 0) {
+    return;
+  }
+
+  //
+  // A byte per nanosecond is a GB/s, the rates are in hundredths of GB/s.
+  //
+  Nanoseconds  = GetTimeInNanoSecond (Private->TestTicks);
+  TestedRate   = 0;
+  AccessedRate = 0;
+  if (Nanoseconds != 0) {
+    TestedRate   = DivU64x64Remainder (MultU64x32 (Private->TestedBytes, 100), Nanoseconds, NULL);
+    AccessedRate = DivU64x64Remainder (MultU64x32 (Private->AccessedBytes, 100), Nanoseconds, NULL);
+  }
+
+  DEBUG ((
+    DEBUG_INFO,
+    "GenericMemoryTest: Tested %ld MB (%ld MB accessed) on %d processor(s) in %ld ms\n",
+    RShiftU64 (Private->TestedBytes, 20),
+    RShiftU64 (Private->AccessedBytes, 20),
+    (Private->Parallel != NULL) ? Private->Parallel->ProcessorCount : 1,
+    DivU64x32 (Nanoseconds, 1000000)
+    ));
+  DEBUG ((
+    DEBUG_INFO,
+    "GenericMemoryTest: %ld.%02ld GB/s tested, %ld.%02ld GB/s accessed\n",
+    DivU64x32 (TestedRate, 100),
+    ModU64x32 (TestedRate, 100),
+    DivU64x32 (AccessedRate, 100),
+    ModU64x32 (AccessedRate, 100)
+    ));
+}
+
 /**
   Finish the memory test.
 
@@ -697,6 +886,9 @@ GenMemoryTestFinished (
     ASSERT_EFI_ERROR (Status);
   }
 
+  ShowMemoryTestSummary (Private);
+  FreeParallelMemoryTest (Private);
+
   //
   // Add the non tested memory range to system memory map through GCD service
   //
@@ -868,7 +1060,11 @@ GENERIC_MEMORY_TEST_PRIVATE  mGenericMemoryTestPrivate = {
   {
     NULL,
     NULL
-  }
+  },
+  NULL,
+  0,
+  0,
+  0
 };
 
 /**
@@ -899,6 +1095,11 @@ GenericMemoryTestEntryPoint (
   //
   // Use the generic pattern to test compatible memory range
   //
+  SetMem64 (
+    GenericMemoryTestMonoPattern,
+    sizeof (GenericMemoryTestMonoPattern),
+    PcdGet64 (PcdGenericMemoryTestPattern)
+    );
   mGenericMemoryTestPrivate.MonoPattern  = GenericMemoryTestMonoPattern;
   mGenericMemoryTestPrivate.MonoTestSize = GENERIC_CACHELINE_SIZE;
 
@@ -13,6 +13,8 @@
 #include <Guid/StatusCodeDataTypeId.h>
 #include <Protocol/GenericMemoryTest.h>
 #include <Protocol/Cpu.h>
+#include <Protocol/MpService.h>
+#include <IndustryStandard/Acpi.h>
 
 #include <Library/DebugLib.h>
 #include <Library/UefiDriverEntryPoint.h>
@@ -23,6 +25,11 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiLib.h>
+#include <Library/PcdLib.h>
+#include <Library/TimerLib.h>
+#include <Library/CacheMaintenanceLib.h>
+#include <Library/SynchronizationLib.h>
 
 //
 // Some global define
@@ -43,6 +50,73 @@
 #define QUICK_SPAN_SIZE   (TEST_BLOCK_SIZE >> 2)
 #define SPARSE_SPAN_SIZE  (TEST_BLOCK_SIZE >> 4)
 
+//
+// Size of the pieces of memory that the processors take in turn when the
+// memory is tested on all the processors. It is raised to the coverage span
+// when the span is larger.
+//
+#define PARALLEL_TEST_CHUNK_SIZE  SIZE_2MB
+
+//
+// A piece of memory tested by one processor.
+//
+typedef struct {
+  EFI_PHYSICAL_ADDRESS    Start;
+  UINT64                  Length;
+  UINT32                  Domain;
+} MEMORY_TEST_CHUNK;
+
+//
+// The chunks of a proximity domain are consecutive in the chunk array, and
+// are taken in turn through Next.
+//
+typedef struct {
+  UINT32             First;
+  UINT32             Count;
+  volatile UINT32    Next;
+} MEMORY_TEST_DOMAIN;
+
+//
+// A range of memory of a proximity domain, from the SRAT.
+//
+typedef struct {
+  EFI_PHYSICAL_ADDRESS    Start;
+  UINT64                  Length;
+  UINT32                  Domain;
+} MEMORY_TEST_AFFINITY;
+
+//
+// State of the test on all the processors, set up by InitializeMemoryTest()
+// when PcdGenericMemoryTestUseAps is TRUE and there are enabled APs.
+//
+typedef struct {
+  EFI_MP_SERVICES_PROTOCOL    *MpServices;
+  UINTN                       ProcessorCount;
+  //
+  // Proximity domain index of each processor, DomainCount - 1 when unknown.
+  //
+  UINT32                      *ProcessorDomain;
+  //
+  // Memory ranges of the proximity domains. Memory out of these ranges is in
+  // the last domain.
+  //
+  MEMORY_TEST_AFFINITY        *Affinity;
+  UINTN                       AffinityCount;
+  UINT32                      DomainCount;
+  MEMORY_TEST_DOMAIN          *Domains;
+  //
+  // Chunks of the current batch, sorted by domain, and the batch being built.
+  //
+  MEMORY_TEST_CHUNK           *Chunks;
+  MEMORY_TEST_CHUNK           *NewChunks;
+  UINT32                      ChunkCapacity;
+  UINT64                      ChunkSize;
+  //
+  // Address of the first mis-compare found, MAX_UINT64 if none.
+  //
+  volatile UINT64             ErrorAddress;
+} PARALLEL_MEMORY_TEST;
+
 //
 // This structure records every nontested memory range parsed through GCD
 // service.
@@ -108,6 +182,18 @@ typedef struct {
   // memory range list
   //
   LIST_ENTRY                          NonTestedMemRanList;
+
+  //
+  // test on all the processors, NULL when the test runs on the BSP only
+  //
+  PARALLEL_MEMORY_TEST                *Parallel;
+
+  //
+  // statistics of the R/W/V memory test, for the result summary
+  //
+  UINT64                              TestedBytes;
+  UINT64                              AccessedBytes;
+  UINT64                              TestTicks;
 } GENERIC_MEMORY_TEST_PRIVATE;
 
 #define GENERIC_MEMORY_TEST_PRIVATE_FROM_THIS(a) \
@@ -118,6 +204,15 @@ typedef struct {
   EFI_GENERIC_MEMORY_TEST_PRIVATE_SIGNATURE \
   )
 
+//
+// Test cursor, shared by the test on the BSP and the test on all the processors
+//
+extern EFI_PHYSICAL_ADDRESS    mCurrentAddress;
+extern LIST_ENTRY              *mCurrentLink;
+extern NONTESTED_MEMORY_RANGE  *mCurrentRange;
+extern UINT64                  mTestedSystemMemory;
+extern UINT64                  mNonTestedSystemMemory;
+
 //
 // Function Prototypes
 //
@@ -211,6 +306,77 @@ WriteMemory (
   IN  UINT64                       Size
   );
 
+/**
+  Write the memory test pattern into a range of physical memory, without
+  flushing the data cache.
+
+  This function may run on the APs.
+
+  @param[in] Private  Point to generic memory test driver's private data.
+  @param[in] Start    The memory range's start address.
+  @param[in] Size     The memory range's size.
+
+**/
+VOID
+WritePattern (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private,
+  IN  EFI_PHYSICAL_ADDRESS         Start,
+  IN  UINT64                       Size
+  );
+
+/**
+  Look for the first mis-compare in a range of physical memory covered by the
+  memory test pattern.
+
+  This function may run on the APs.
+
+  @param[in]  Private       Point to generic memory test driver's private data.
+  @param[in]  Start         The memory range's start address.
+  @param[in]  Size          The memory range's size.
+  @param[out] ErrorAddress  The address of the pattern which mis-compares.
+
+  @retval TRUE   A mis-compare was found.
+  @retval FALSE  The range of memory matches the pattern.
+
+**/
+BOOLEAN
+FindPatternMiscompare (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private,
+  IN  EFI_PHYSICAL_ADDRESS         Start,
+  IN  UINT64                       Size,
+  OUT EFI_PHYSICAL_ADDRESS         *ErrorAddress
+  );
+
+/**
+  Add a range of memory which passed the R/W/V memory test to the statistics
+  of the result summary.
+
+  @param[in] Private     Point to generic memory test driver's private data.
+  @param[in] Size        The size of the tested memory.
+  @param[in] BeginTicks  The performance counter when the test began.
+
+**/
+VOID
+AccountMemoryTest (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private,
+  IN  UINT64                       Size,
+  IN  UINT64                       BeginTicks
+  );
+
+/**
+  Report an uncorrectable memory error.
+
+  @param[in] Address  The address of the pattern which mis-compares.
+
+  @retval EFI_DEVICE_ERROR      The error was reported.
+  @retval EFI_OUT_OF_RESOURCES  The error data could not be allocated.
+
+**/
+EFI_STATUS
+ReportMemoryError (
+  IN  EFI_PHYSICAL_ADDRESS  Address
+  );
+
 /**
   Verify the range of physical memory which covered by memory test pattern.
 
@@ -252,6 +418,55 @@ DirectRangeTest (
   IN  UINT64                       Capabilities
   );
 
+/**
+  Prepare the memory test on all the processors.
+
+  Nothing is done, and the test runs on the BSP only, when the MP services
+  are not available or there is no enabled AP.
+
+  @param[in] Private  Point to generic memory test driver's private data.
+
+**/
+VOID
+InitializeParallelMemoryTest (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private
+  );
+
+/**
+  Free the resources of the memory test on all the processors.
+
+  @param[in] Private  Point to generic memory test driver's private data.
+
+**/
+VOID
+FreeParallelMemoryTest (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private
+  );
+
+/**
+  Perform the memory test of the next batch of memory on all the processors.
+
+  The batch is made of the next blocks of non-tested memory, one per enabled
+  processor.
+
+  @param[in]  Private           Point to generic memory test driver's private data.
+  @param[out] TestedMemorySize  Return the tested extended memory size.
+  @param[out] TotalMemorySize   Return the whole system physical memory size.
+  @param[out] ErrorOut          TRUE if the memory error occurred.
+
+  @retval EFI_SUCCESS         One batch of memory passed the test.
+  @retval EFI_NOT_FOUND       All memory blocks have already been tested.
+  @retval EFI_DEVICE_ERROR    Memory device error occurred, and no agent can handle it.
+
+**/
+EFI_STATUS
+ParallelPerformMemoryTest (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private,
+  OUT UINT64                       *TestedMemorySize,
+  OUT UINT64                       *TotalMemorySize,
+  OUT BOOLEAN                      *ErrorOut
+  );
+
 /**
   Initialize the generic memory test.
 
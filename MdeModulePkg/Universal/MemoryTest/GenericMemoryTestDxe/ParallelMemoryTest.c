@@ -0,0 +1,664 @@
+/** @file
+  R/W/V memory test on all the processors.
+
+  The non-tested memory is tested in batches of one BDS block per enabled
+  processor. A batch is split into chunks, which are grouped by proximity
+  domain when the ACPI SRAT describes the domains of the memory and of the
+  processors. Every processor takes the chunks of its own domain first, and
+  then helps with the chunks left in the other domains.
+
+  The APs are started through the MP services protocol in blocking mode, then
+  the BSP tests the chunks left, if any, so the batch is tested even if the
+  APs could not be started. The APs only write, flush and compare memory, the
+  status codes are reported by the BSP.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "LightMemoryTest.h"
+
+typedef union {
+  UINT8                                                         *Raw;
+  EFI_ACPI_6_0_PROCESSOR_LOCAL_APIC_SAPIC_AFFINITY_STRUCTURE    *Apic;
+  EFI_ACPI_6_0_MEMORY_AFFINITY_STRUCTURE                        *Memory;
+  EFI_ACPI_6_0_PROCESSOR_LOCAL_X2APIC_AFFINITY_STRUCTURE        *X2Apic;
+} SRAT_STRUCTURE_POINTER;
+
+/**
+  Return the index of a proximity domain, adding it to the list of the
+  domains when it is not there yet.
+
+  @param[in, out]  DomainIds        The proximity domains found so far.
+  @param[in, out]  DomainCount      Number of proximity domains found so far.
+  @param[in]       ProximityDomain  The proximity domain.
+
+  @return The index of the proximity domain in DomainIds.
+
+**/
+STATIC
+UINT32
+GetDomainIndex (
+  IN OUT UINT32  *DomainIds,
+  IN OUT UINT32  *DomainCount,
+  IN     UINT32  ProximityDomain
+  )
+{
+  UINT32  Index;
+
+  for (Index = 0; Index < *DomainCount; Index++) {
+    if (DomainIds[Index] == ProximityDomain) {
+      return Index;
+    }
+  }
+
+  DomainIds[Index] = ProximityDomain;
+  (*DomainCount)++;
+  return Index;
+}
+
+/**
+  Set the proximity domain of the processors which have a processor ID.
+
+  @param[in, out]  Parallel            The test on all the processors.
+  @param[in]       ProcessorIds        The processor ID of every processor.
+  @param[in]       NumberOfProcessors  Number of processors.
+  @param[in]       ProcessorId         The processor ID, from the SRAT.
+  @param[in]       Domain              The index of the proximity domain.
+
+**/
+STATIC
+VOID
+SetProcessorDomain (
+  IN OUT PARALLEL_MEMORY_TEST  *Parallel,
+  IN     UINT64                *ProcessorIds,
+  IN     UINTN                 NumberOfProcessors,
+  IN     UINT64                ProcessorId,
+  IN     UINT32                Domain
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < NumberOfProcessors; Index++) {
+    if (ProcessorIds[Index] == ProcessorId) {
+      Parallel->ProcessorDomain[Index] = Domain;
+    }
+  }
+}
+
+/**
+  Build the proximity domains of the memory and of the processors.
+
+  Without SRAT, all the memory and all the processors are in a single domain.
+  Otherwise, there is a domain per proximity domain of the SRAT, plus a last
+  domain for the memory and the processors that the SRAT does not describe.
+
+  @param[in, out]  Parallel            The test on all the processors.
+  @param[in]       Srat                The SRAT, or NULL if there is none.
+  @param[in]       ProcessorIds        The processor ID of every processor.
+  @param[in]       NumberOfProcessors  Number of processors.
+
+  @retval EFI_SUCCESS           The domains were built.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory to build the domains.
+
+**/
+STATIC
+EFI_STATUS
+BuildProximityDomains (
+  IN OUT PARALLEL_MEMORY_TEST                                *Parallel,
+  IN     EFI_ACPI_6_0_SYSTEM_RESOURCE_AFFINITY_TABLE_HEADER  *Srat OPTIONAL,
+  IN     UINT64                                              *ProcessorIds,
+  IN     UINTN                                               NumberOfProcessors
+  )
+{
+  SRAT_STRUCTURE_POINTER  Entry;
+  UINT8                   *Start;
+  UINT8                   *End;
+  UINT8                   *TableEnd;
+  UINT32                  *DomainIds;
+  UINT32                  DomainCount;
+  UINTN                   Capacity;
+  UINTN                   Index;
+  UINT32                  ProximityDomain;
+
+  //
+  // Only the well formed structures at the beginning of the SRAT are used.
+  //
+  Start    = NULL;
+  End      = NULL;
+  Capacity = 0;
+  if ((Srat != NULL) && (Srat->Header.Length > sizeof (EFI_ACPI_6_0_SYSTEM_RESOURCE_AFFINITY_TABLE_HEADER))) {
+    Start    = (UINT8 *)(Srat + 1);
+    TableEnd = (UINT8 *)Srat + Srat->Header.Length;
+    for (End = Start; (End + 2 <= TableEnd) && (End[1] >= 2) && (End + End[1] <= TableEnd); End += End[1]) {
+      Capacity++;
+    }
+  }
+
+  //
+  // Every structure of the SRAT gives at most one proximity domain.
+  //
+  DomainIds                 = AllocatePool ((Capacity + 1) * sizeof (UINT32));
+  Parallel->Affinity        = AllocatePool ((Capacity + 1) * sizeof (MEMORY_TEST_AFFINITY));
+  Parallel->ProcessorDomain = AllocatePool (NumberOfProcessors * sizeof (UINT32));
+  if ((DomainIds == NULL) || (Parallel->Affinity == NULL) || (Parallel->ProcessorDomain == NULL)) {
+    if (DomainIds != NULL) {
+      FreePool (DomainIds);
+    }
+
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  SetMem32 (Parallel->ProcessorDomain, NumberOfProcessors * sizeof (UINT32), MAX_UINT32);
+  DomainCount = 0;
+
+  for (Entry.Raw = Start; Entry.Raw < End; Entry.Raw += Entry.Raw[1]) {
+    switch (Entry.Raw[0]) {
+      case EFI_ACPI_6_0_MEMORY_AFFINITY:
+        if ((Entry.Memory->Length < sizeof (EFI_ACPI_6_0_MEMORY_AFFINITY_STRUCTURE)) ||
+            ((Entry.Memory->Flags & EFI_ACPI_6_0_MEMORY_ENABLED) == 0))
+        {
+          break;
+        }
+
+        Parallel->Affinity[Parallel->AffinityCount].Start  = LShiftU64 (Entry.Memory->AddressBaseHigh, 32) | Entry.Memory->AddressBaseLow;
+        Parallel->Affinity[Parallel->AffinityCount].Length = LShiftU64 (Entry.Memory->LengthHigh, 32) | Entry.Memory->LengthLow;
+        Parallel->Affinity[Parallel->AffinityCount].Domain = GetDomainIndex (DomainIds, &DomainCount, Entry.Memory->ProximityDomain);
+        Parallel->AffinityCount++;
+        break;
+
+      case EFI_ACPI_6_0_PROCESSOR_LOCAL_APIC_SAPIC_AFFINITY:
+        if ((Entry.Apic->Length < sizeof (EFI_ACPI_6_0_PROCESSOR_LOCAL_APIC_SAPIC_AFFINITY_STRUCTURE)) ||
+            ((Entry.Apic->Flags & EFI_ACPI_6_0_PROCESSOR_LOCAL_APIC_SAPIC_ENABLED) == 0))
+        {
+          break;
+        }
+
+        ProximityDomain = Entry.Apic->ProximityDomain7To0 |
+                          (Entry.Apic->ProximityDomain31To8[0] << 8) |
+                          (Entry.Apic->ProximityDomain31To8[1] << 16) |
+                          ((UINT32)Entry.Apic->ProximityDomain31To8[2] << 24);
+        SetProcessorDomain (
+          Parallel,
+          ProcessorIds,
+          NumberOfProcessors,
+          Entry.Apic->ApicId,
+          GetDomainIndex (DomainIds, &DomainCount, ProximityDomain)
+          );
+        break;
+
+      case EFI_ACPI_6_0_PROCESSOR_LOCAL_X2APIC_AFFINITY:
+        if ((Entry.X2Apic->Length < sizeof (EFI_ACPI_6_0_PROCESSOR_LOCAL_X2APIC_AFFINITY_STRUCTURE)) ||
+            ((Entry.X2Apic->Flags & EFI_ACPI_6_0_PROCESSOR_LOCAL_APIC_SAPIC_ENABLED) == 0))
+        {
+          break;
+        }
+
+        SetProcessorDomain (
+          Parallel,
+          ProcessorIds,
+          NumberOfProcessors,
+          Entry.X2Apic->X2ApicId,
+          GetDomainIndex (DomainIds, &DomainCount, Entry.X2Apic->ProximityDomain)
+          );
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  FreePool (DomainIds);
+
+  //
+  // The last domain holds what the SRAT does not describe.
+  //
+  Parallel->DomainCount = DomainCount + 1;
+  for (Index = 0; Index < NumberOfProcessors; Index++) {
+    if (Parallel->ProcessorDomain[Index] == MAX_UINT32) {
+      Parallel->ProcessorDomain[Index] = DomainCount;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Return the proximity domain of an address.
+
+  @param[in]  Parallel  The test on all the processors.
+  @param[in]  Address   The address.
+
+  @return The index of the proximity domain of the address.
+
+**/
+STATIC
+UINT32
+GetAddressDomain (
+  IN PARALLEL_MEMORY_TEST  *Parallel,
+  IN EFI_PHYSICAL_ADDRESS  Address
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Parallel->AffinityCount; Index++) {
+    if ((Address >= Parallel->Affinity[Index].Start) &&
+        (Address - Parallel->Affinity[Index].Start < Parallel->Affinity[Index].Length))
+    {
+      return Parallel->Affinity[Index].Domain;
+    }
+  }
+
+  return Parallel->DomainCount - 1;
+}
+
+/**
+  Prepare the memory test on all the processors.
+
+  Nothing is done, and the test runs on the BSP only, when the MP services
+  are not available or there is no enabled AP.
+
+  @param[in] Private  Point to generic memory test driver's private data.
+
+**/
+VOID
+InitializeParallelMemoryTest (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private
+  )
+{
+  EFI_STATUS                                          Status;
+  EFI_MP_SERVICES_PROTOCOL                            *MpServices;
+  PARALLEL_MEMORY_TEST                                *Parallel;
+  UINTN                                               NumberOfProcessors;
+  UINTN                                               NumberOfEnabledProcessors;
+  UINT64                                              *ProcessorIds;
+  EFI_PROCESSOR_INFORMATION                           ProcessorInfo;
+  EFI_ACPI_6_0_SYSTEM_RESOURCE_AFFINITY_TABLE_HEADER  *Srat;
+  UINTN                                               Index;
+
+  Status = gBS->LocateProtocol (&gEfiMpServiceProtocolGuid, NULL, (VOID **)&MpServices);
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  Status = MpServices->GetNumberOfProcessors (MpServices, &NumberOfProcessors, &NumberOfEnabledProcessors);
+  if (EFI_ERROR (Status) || (NumberOfEnabledProcessors < 2)) {
+    return;
+  }
+
+  Parallel = AllocateZeroPool (sizeof (PARALLEL_MEMORY_TEST));
+  if (Parallel == NULL) {
+    return;
+  }
+
+  Private->Parallel        = Parallel;
+  Parallel->MpServices     = MpServices;
+  Parallel->ProcessorCount = NumberOfEnabledProcessors;
+
+  ProcessorIds = AllocatePool (NumberOfProcessors * sizeof (UINT64));
+  if (ProcessorIds == NULL) {
+    goto Error;
+  }
+
+  for (Index = 0; Index < NumberOfProcessors; Index++) {
+    Status = MpServices->GetProcessorInfo (MpServices, Index, &ProcessorInfo);
+    ProcessorIds[Index] = EFI_ERROR (Status) ? MAX_UINT64 : ProcessorInfo.ProcessorId;
+  }
+
+  Srat   = (EFI_ACPI_6_0_SYSTEM_RESOURCE_AFFINITY_TABLE_HEADER *)EfiLocateFirstAcpiTable (EFI_ACPI_6_0_SYSTEM_RESOURCE_AFFINITY_TABLE_SIGNATURE);
+  Status = BuildProximityDomains (Parallel, Srat, ProcessorIds, NumberOfProcessors);
+  FreePool (ProcessorIds);
+  if (EFI_ERROR (Status)) {
+    goto Error;
+  }
+
+  //
+  // A chunk holds a whole number of coverage spans, so the patterns are at
+  // the same addresses as when the test runs on the BSP only.
+  //
+  Parallel->ChunkSize     = MAX (PARALLEL_TEST_CHUNK_SIZE, Private->CoverageSpan);
+  Parallel->ChunkCapacity = (UINT32)DivU64x64Remainder (
+                                      MultU64x64 (Private->BdsBlockSize, NumberOfEnabledProcessors),
+                                      Parallel->ChunkSize,
+                                      NULL
+                                      );
+  Parallel->Chunks  = AllocatePool (2 * Parallel->ChunkCapacity * sizeof (MEMORY_TEST_CHUNK));
+  Parallel->Domains = AllocatePool (Parallel->DomainCount * sizeof (MEMORY_TEST_DOMAIN));
+  if ((Parallel->Chunks == NULL) || (Parallel->Domains == NULL)) {
+    goto Error;
+  }
+
+  Parallel->NewChunks = Parallel->Chunks + Parallel->ChunkCapacity;
+
+  DEBUG ((
+    DEBUG_INFO,
+    "GenericMemoryTest: Testing on %Lu processors, %d proximity domain(s)\n",
+    (UINT64)NumberOfEnabledProcessors,
+    Parallel->DomainCount - 1
+    ));
+  return;
+
+Error:
+  FreeParallelMemoryTest (Private);
+}
+
+/**
+  Free the resources of the memory test on all the processors.
+
+  @param[in] Private  Point to generic memory test driver's private data.
+
+**/
+VOID
+FreeParallelMemoryTest (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private
+  )
+{
+  PARALLEL_MEMORY_TEST  *Parallel;
+
+  Parallel = Private->Parallel;
+  if (Parallel == NULL) {
+    return;
+  }
+
+  if (Parallel->ProcessorDomain != NULL) {
+    FreePool (Parallel->ProcessorDomain);
+  }
+
+  if (Parallel->Affinity != NULL) {
+    FreePool (Parallel->Affinity);
+  }
+
+  if (Parallel->Domains != NULL) {
+    FreePool (Parallel->Domains);
+  }
+
+  if (Parallel->Chunks != NULL) {
+    FreePool (Parallel->Chunks);
+  }
+
+  FreePool (Parallel);
+  Private->Parallel = NULL;
+}
+
+/**
+  Test a chunk of memory.
+
+  The data cache is flushed between the write and the compare, so that the
+  pattern is read back from the memory. Only the cache lines of the calling
+  processor hold the pattern, as every chunk is tested by a single processor.
+
+  @param[in]  Private  Point to generic memory test driver's private data.
+  @param[in]  Chunk    The chunk of memory.
+
+**/
+STATIC
+VOID
+TestChunk (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private,
+  IN  MEMORY_TEST_CHUNK            *Chunk
+  )
+{
+  EFI_PHYSICAL_ADDRESS  Address;
+  EFI_PHYSICAL_ADDRESS  ErrorAddress;
+
+  WritePattern (Private, Chunk->Start, Chunk->Length);
+
+  if (Private->CoverageSpan == Private->MonoTestSize) {
+    WriteBackInvalidateDataCacheRange ((VOID *)(UINTN)Chunk->Start, (UINTN)Chunk->Length);
+  } else {
+    for (Address = Chunk->Start; Address < Chunk->Start + Chunk->Length; Address += Private->CoverageSpan) {
+      WriteBackInvalidateDataCacheRange ((VOID *)(UINTN)Address, Private->MonoTestSize);
+    }
+  }
+
+  if (FindPatternMiscompare (Private, Chunk->Start, Chunk->Length, &ErrorAddress)) {
+    InterlockedCompareExchange64 (&Private->Parallel->ErrorAddress, MAX_UINT64, ErrorAddress);
+  }
+}
+
+/**
+  Test the chunks of the current batch until none is left.
+
+  This function runs on every processor. The processors take the chunks of
+  their own proximity domain first, then the chunks of the next domains.
+  They stop as soon as a mis-compare is found.
+
+  @param[in, out]  Buffer  Point to generic memory test driver's private data.
+
+**/
+STATIC
+VOID
+EFIAPI
+ParallelMemoryTestWorker (
+  IN OUT VOID  *Buffer
+  )
+{
+  GENERIC_MEMORY_TEST_PRIVATE  *Private;
+  PARALLEL_MEMORY_TEST         *Parallel;
+  MEMORY_TEST_DOMAIN           *Domain;
+  UINTN                        ProcessorNumber;
+  UINT32                       Home;
+  UINT32                       Index;
+  UINT32                       Chunk;
+
+  Private  = (GENERIC_MEMORY_TEST_PRIVATE *)Buffer;
+  Parallel = Private->Parallel;
+
+  Home = Parallel->DomainCount - 1;
+  if (!EFI_ERROR (Parallel->MpServices->WhoAmI (Parallel->MpServices, &ProcessorNumber))) {
+    Home = Parallel->ProcessorDomain[ProcessorNumber];
+  }
+
+  for (Index = 0; Index < Parallel->DomainCount; Index++) {
+    Domain = &Parallel->Domains[(Home + Index) % Parallel->DomainCount];
+    while (Parallel->ErrorAddress == MAX_UINT64) {
+      Chunk = InterlockedIncrement (&Domain->Next) - 1;
+      if (Chunk >= Domain->Count) {
+        break;
+      }
+
+      TestChunk (Private, &Parallel->Chunks[Domain->First + Chunk]);
+    }
+  }
+}
+
+/**
+  Report the progress status code of a range of memory being tested.
+
+  @param[in]  Start   The start address of the range.
+  @param[in]  Length  The length of the range.
+
+**/
+STATIC
+VOID
+ReportTestRange (
+  IN  EFI_PHYSICAL_ADDRESS  Start,
+  IN  UINT64                Length
+  )
+{
+  EFI_MEMORY_RANGE_EXTENDED_DATA  RangeData;
+
+  ZeroMem (&RangeData, sizeof (RangeData));
+  RangeData.DataHeader.HeaderSize = (UINT16)sizeof (EFI_STATUS_CODE_DATA);
+  RangeData.DataHeader.Size       = (UINT16)(sizeof (EFI_MEMORY_RANGE_EXTENDED_DATA) - sizeof (EFI_STATUS_CODE_DATA));
+  RangeData.Start                 = Start;
+  RangeData.Length                = Length;
+
+  REPORT_STATUS_CODE_EX (
+    EFI_PROGRESS_CODE,
+    EFI_COMPUTING_UNIT_MEMORY | EFI_CU_MEMORY_PC_TEST,
+    0,
+    &gEfiGenericMemTestProtocolGuid,
+    NULL,
+    (UINT8 *)&RangeData + sizeof (EFI_STATUS_CODE_DATA),
+    RangeData.DataHeader.Size
+    );
+}
+
+/**
+  Perform the memory test of the next batch of memory on all the processors.
+
+  The batch is made of the next blocks of non-tested memory, one per enabled
+  processor.
+
+  @param[in]  Private           Point to generic memory test driver's private data.
+  @param[out] TestedMemorySize  Return the tested extended memory size.
+  @param[out] TotalMemorySize   Return the whole system physical memory size.
+  @param[out] ErrorOut          TRUE if the memory error occurred.
+
+  @retval EFI_SUCCESS         One batch of memory passed the test.
+  @retval EFI_NOT_FOUND       All memory blocks have already been tested.
+  @retval EFI_DEVICE_ERROR    Memory device error occurred, and no agent can handle it.
+
+**/
+EFI_STATUS
+ParallelPerformMemoryTest (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private,
+  OUT UINT64                       *TestedMemorySize,
+  OUT UINT64                       *TotalMemorySize,
+  OUT BOOLEAN                      *ErrorOut
+  )
+{
+  EFI_STATUS            Status;
+  PARALLEL_MEMORY_TEST  *Parallel;
+  MEMORY_TEST_CHUNK     *Chunk;
+  UINT64                BatchSize;
+  UINT64                BatchBytes;
+  UINT64                ChunkBytes;
+  UINT64                Length;
+  UINT64                RangeEnd;
+  UINT32                Count;
+  UINT32                Index;
+  UINT32                First;
+  EFI_PHYSICAL_ADDRESS  SpanStart;
+  UINT64                SpanLength;
+  UINT64                BeginTicks;
+
+  Parallel   = Private->Parallel;
+  BatchSize  = MultU64x64 (Private->BdsBlockSize, Parallel->ProcessorCount);
+  BatchBytes = 0;
+  ChunkBytes = 0;
+  Count      = 0;
+  ZeroMem (Parallel->Domains, Parallel->DomainCount * sizeof (MEMORY_TEST_DOMAIN));
+
+  //
+  // Take the chunks of the batch from the current test address, moving to the
+  // next non tested memory ranges as needed.
+  //
+  while ((BatchBytes < BatchSize) && (Count < Parallel->ChunkCapacity) &&
+         (mCurrentLink != &Private->NonTestedMemRanList))
+  {
+    RangeEnd = mCurrentRange->StartAddress + mCurrentRange->Length;
+    if (mCurrentAddress >= RangeEnd) {
+      mCurrentLink = mCurrentLink->ForwardLink;
+      if (mCurrentLink != &Private->NonTestedMemRanList) {
+        mCurrentRange   = NONTESTED_MEMORY_RANGE_FROM_LINK (mCurrentLink);
+        mCurrentAddress = mCurrentRange->StartAddress;
+      }
+
+      continue;
+    }
+
+    Length = MIN (Parallel->ChunkSize, RangeEnd - mCurrentAddress);
+
+    //
+    // Add 4G memory address check for IA32 platform
+    // NOTE: Without page table, there is no way to use memory above 4G.
+    //
+    if (mCurrentAddress + Length <= MAX_ADDRESS) {
+      Chunk         = &Parallel->NewChunks[Count++];
+      Chunk->Start  = mCurrentAddress;
+      Chunk->Length = Length;
+      Chunk->Domain = GetAddressDomain (Parallel, mCurrentAddress);
+      Parallel->Domains[Chunk->Domain].Count++;
+      ChunkBytes += Length;
+    }
+
+    BatchBytes      += Length;
+    mCurrentAddress += Length;
+  }
+
+  *TotalMemorySize = Private->BaseMemorySize + mNonTestedSystemMemory;
+  if (BatchBytes == 0) {
+    //
+    // Here means all the memory test have finished
+    //
+    *TestedMemorySize = mTestedSystemMemory;
+    return EFI_NOT_FOUND;
+  }
+
+  //
+  // Report status code of every run of contiguous memory of the batch
+  //
+  for (Index = 0; Index < Count; Index++) {
+    SpanStart  = Parallel->NewChunks[Index].Start;
+    SpanLength = Parallel->NewChunks[Index].Length;
+    while ((Index + 1 < Count) && (Parallel->NewChunks[Index + 1].Start == SpanStart + SpanLength)) {
+      SpanLength += Parallel->NewChunks[++Index].Length;
+    }
+
+    ReportTestRange (SpanStart, SpanLength);
+  }
+
+  //
+  // Sort the chunks by proximity domain. Next counts the chunks placed in
+  // each domain, and is reset before the chunks are taken.
+  //
+  First = 0;
+  for (Index = 0; Index < Parallel->DomainCount; Index++) {
+    Parallel->Domains[Index].First = First;
+    First                         += Parallel->Domains[Index].Count;
+  }
+
+  for (Index = 0; Index < Count; Index++) {
+    Chunk = &Parallel->NewChunks[Index];
+    CopyMem (
+      &Parallel->Chunks[Parallel->Domains[Chunk->Domain].First + Parallel->Domains[Chunk->Domain].Next++],
+      Chunk,
+      sizeof (MEMORY_TEST_CHUNK)
+      );
+  }
+
+  for (Index = 0; Index < Parallel->DomainCount; Index++) {
+    Parallel->Domains[Index].Next = 0;
+  }
+
+  //
+  // The software memory test (R/W/V) perform here. It will detect the
+  // memory mis-compare error.
+  //
+  Parallel->ErrorAddress = MAX_UINT64;
+  BeginTicks             = GetPerformanceCounter ();
+
+  Status = Parallel->MpServices->StartupAllAPs (
+                                   Parallel->MpServices,
+                                   ParallelMemoryTestWorker,
+                                   FALSE,
+                                   NULL,
+                                   0,
+                                   Private,
+                                   NULL
+                                   );
+  if (EFI_ERROR (Status) && (Status != EFI_NOT_STARTED)) {
+    DEBUG ((DEBUG_WARN, "GenericMemoryTest: StartupAllAPs - %r\n", Status));
+  }
+
+  ParallelMemoryTestWorker (Private);
+
+  if (Parallel->ErrorAddress != MAX_UINT64) {
+    //
+    // If perform here, means there is mis-compare error, and no agent can
+    // handle it, so we return to BDS EFI_DEVICE_ERROR.
+    //
+    ReportMemoryError (Parallel->ErrorAddress);
+    *ErrorOut = TRUE;
+    return EFI_DEVICE_ERROR;
+  }
+
+  AccountMemoryTest (Private, ChunkBytes, BeginTicks);
+
+  mTestedSystemMemory += BatchBytes;
+  *TestedMemorySize    = mTestedSystemMemory;
+
+  return EFI_SUCCESS;
+}
@@ -75,6 +75,13 @@
 ///
 #define HTTP_HEADER_ACCEPT_RANGES  "Accept-Ranges"
 
+///
+/// Range Request Header
+/// The Range request-header field restricts the response to one or more
+/// sub-ranges of the selected representation, e.g. "bytes=0-499".
+///
+#define HTTP_HEADER_RANGE  "Range"
+
 ///
 /// Accept-Encoding Request Header
 /// The Accept-Encoding request-header field is similar to Accept,
@@ -219,6 +226,44 @@
 ///
 #define HTTP_HEADER_ETAG  "ETag"
 
+///
+/// Last-Modified Response Header
+/// The Last-Modified response-header field indicates the date and time at
+/// which the origin server believes the variant was last modified.
+///
+#define HTTP_HEADER_LAST_MODIFIED  "Last-Modified"
+
+///
+/// If-Range Request Header
+/// The If-Range request-header field makes a Range request conditional: the
+/// server sends the requested range only if the entity tag or the date given
+/// still matches the selected representation, and the whole entity otherwise.
+///
+#define HTTP_HEADER_IF_RANGE  "If-Range"
+
+///
+/// Content-Range Response Header
+/// The Content-Range response-header field is sent with a partial entity-body
+/// to specify where in the full entity-body the partial body should be applied.
+///
+#define HTTP_HEADER_CONTENT_RANGE  "Content-Range"
+
+///
+/// Connection General Header
+/// The Connection general-header field allows the sender to specify options
+/// that are desired for that particular connection. A value of "close"
+/// signals that the connection will be closed after the response.
+///
+#define HTTP_HEADER_CONNECTION  "Connection"
+
+///
+/// Keep-Alive General Header
+/// The Keep-Alive general-header field allows the sender to hint how long an
+/// idle persistent connection is kept open (timeout, in seconds) and how many
+/// further requests it accepts (max).
+///
+#define HTTP_HEADER_KEEP_ALIVE  "Keep-Alive"
+
 ///
 /// Custom header field checked by the iLO web server to
 /// specify a client session key.
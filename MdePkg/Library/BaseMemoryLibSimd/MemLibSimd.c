@@ -0,0 +1,477 @@
+/** @file
+  Kernel selection of the SIMD Base Memory Library.
+
+  The kernels are selected on the first call to the library. The copies and
+  fills of at least the non-temporal threshold, three quarters of the last
+  level cache by default, use non-temporal stores so that they do not evict
+  the whole cache. Below it, the processors with enhanced REP MOVSB/STOSB copy
+  and fill the buffers of more than a few KB with REP MOVSB and REP STOSB, and
+  the SSE2 kernels handle the smaller buffers.
+
+  Only the SSE2 registers are used. The AVX2 and AVX-512 registers are left
+  alone because the interrupt handlers save the interrupted context with
+  FXSAVE, which does not cover them, so a memory function called from an
+  interrupt or notify context would corrupt them.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "MemLibSimd.h"
+
+#include <Library/PcdLib.h>
+#include <Register/Intel/Cpuid.h>
+
+//
+// CPUID.(EAX=07H, ECX=0):EDX[4], fast short REP MOV.
+//
+#define MEM_LIB_CPUID_FSRM  BIT4
+
+typedef struct {
+  UINTN    NonTemporalThreshold;
+  UINTN    RepMovsbThreshold;
+  UINTN    RepStosbThreshold;
+} MEM_LIB_CONFIG;
+
+//
+// mMemLib is set once mMemLibConfig is filled. Processors making their first
+// call at the same time all fill mMemLibConfig with the same values.
+//
+STATIC MEM_LIB_CONFIG             mMemLibConfig;
+STATIC MEM_LIB_CONFIG *volatile  mMemLib = NULL;
+
+/**
+  Return the size of the largest data or unified cache.
+
+  @param  MaxLeaf   The largest standard CPUID leaf.
+
+  @return The size of the cache in bytes, or 0 if it is not reported.
+
+**/
+STATIC
+UINTN
+InternalMemLibCacheSize (
+  IN UINT32  MaxLeaf
+  )
+{
+  CPUID_CACHE_PARAMS_EAX          CacheParamsEax;
+  CPUID_CACHE_PARAMS_EBX          CacheParamsEbx;
+  CPUID_EXTENDED_CACHE_INFO_ECX   ExtendedCacheEcx;
+  UINT32                          Sets;
+  UINT32                          SubLeaf;
+  UINT32                          MaxExtendedLeaf;
+  UINT32                          ExtendedCacheEdx;
+  UINTN                           Size;
+
+  Size = 0;
+  if (MaxLeaf >= CPUID_CACHE_PARAMS) {
+    SubLeaf = 0;
+    do {
+      AsmCpuidEx (CPUID_CACHE_PARAMS, SubLeaf, &CacheParamsEax.Uint32, &CacheParamsEbx.Uint32, &Sets, NULL);
+      if ((CacheParamsEax.Bits.CacheType == CPUID_CACHE_PARAMS_CACHE_TYPE_DATA) ||
+          (CacheParamsEax.Bits.CacheType == CPUID_CACHE_PARAMS_CACHE_TYPE_UNIFIED))
+      {
+        Size = MAX (
+                 Size,
+                 (UINTN)(CacheParamsEbx.Bits.Ways + 1) * (CacheParamsEbx.Bits.LinePartitions + 1) *
+                 (CacheParamsEbx.Bits.LineSize + 1) * (Sets + 1)
+                 );
+      }
+
+      SubLeaf++;
+    } while (CacheParamsEax.Bits.CacheType != CPUID_CACHE_PARAMS_CACHE_TYPE_NULL);
+  }
+
+  if (Size != 0) {
+    return Size;
+  }
+
+  //
+  // The processors without the deterministic cache parameters leaf report
+  // the L2 size in KB in ECX[31:16] of the extended cache leaf, and the L3
+  // size in 512 KB units in EDX[31:18].
+  //
+  AsmCpuid (CPUID_EXTENDED_FUNCTION, &MaxExtendedLeaf, NULL, NULL, NULL);
+  if (MaxExtendedLeaf >= CPUID_EXTENDED_CACHE_INFO) {
+    AsmCpuid (CPUID_EXTENDED_CACHE_INFO, NULL, NULL, &ExtendedCacheEcx.Uint32, &ExtendedCacheEdx);
+    Size = MAX ((UINTN)(ExtendedCacheEdx >> 18) * SIZE_512KB, (UINTN)ExtendedCacheEcx.Bits.CacheSize * SIZE_1KB);
+  }
+
+  return Size;
+}
+
+/**
+  Select the kernels and the thresholds for this processor.
+
+  @return The configuration of the library.
+
+**/
+STATIC
+CONST MEM_LIB_CONFIG *
+InternalMemLibProbe (
+  VOID
+  )
+{
+  UINT32                                       MaxLeaf;
+  CPUID_STRUCTURED_EXTENDED_FEATURE_FLAGS_EBX  ExtendedFeatureEbx;
+  CPUID_STRUCTURED_EXTENDED_FEATURE_FLAGS_EDX  ExtendedFeatureEdx;
+  UINTN                                        NonTemporalThreshold;
+  UINTN                                        CacheSize;
+
+  AsmCpuid (CPUID_SIGNATURE, &MaxLeaf, NULL, NULL, NULL);
+
+  ExtendedFeatureEbx.Uint32 = 0;
+  ExtendedFeatureEdx.Uint32 = 0;
+  if (MaxLeaf >= CPUID_STRUCTURED_EXTENDED_FEATURE_FLAGS) {
+    AsmCpuidEx (
+      CPUID_STRUCTURED_EXTENDED_FEATURE_FLAGS,
+      CPUID_STRUCTURED_EXTENDED_FEATURE_FLAGS_SUB_LEAF_INFO,
+      NULL,
+      &ExtendedFeatureEbx.Uint32,
+      NULL,
+      &ExtendedFeatureEdx.Uint32
+      );
+  }
+
+  NonTemporalThreshold = FixedPcdGet32 (PcdMemoryLibSimdNonTemporalThreshold);
+  if (NonTemporalThreshold == 0) {
+    CacheSize            = InternalMemLibCacheSize (MaxLeaf);
+    NonTemporalThreshold = (CacheSize != 0) ? CacheSize / 4 * 3 : MEM_LIB_DEFAULT_NON_TEMPORAL_THRESHOLD;
+  }
+
+  mMemLibConfig.NonTemporalThreshold = MAX (NonTemporalThreshold, MEM_LIB_MIN_NON_TEMPORAL_LENGTH);
+  mMemLibConfig.RepMovsbThreshold    = MAX_UINTN;
+  mMemLibConfig.RepStosbThreshold    = MAX_UINTN;
+  if (FixedPcdGetBool (PcdMemoryLibSimdUseRepString) && (ExtendedFeatureEbx.Bits.EnhancedRepMovsbStosb != 0)) {
+    mMemLibConfig.RepMovsbThreshold = ((ExtendedFeatureEdx.Uint32 & MEM_LIB_CPUID_FSRM) != 0) ?
+                                      MEM_LIB_REP_MOVSB_THRESHOLD_FSRM : MEM_LIB_REP_MOVSB_THRESHOLD;
+    mMemLibConfig.RepStosbThreshold = MEM_LIB_REP_STOSB_THRESHOLD;
+  }
+
+  MemoryFence ();
+  mMemLib = &mMemLibConfig;
+  return &mMemLibConfig;
+}
+
+/**
+  Return the configuration of the library, selecting it on the first call.
+
+  @return The configuration of the library.
+
+**/
+STATIC
+CONST MEM_LIB_CONFIG *
+InternalMemLibGetConfig (
+  VOID
+  )
+{
+  CONST MEM_LIB_CONFIG  *Config;
+
+  Config = mMemLib;
+  if (Config == NULL) {
+    Config = InternalMemLibProbe ();
+  }
+
+  return Config;
+}
+
+/**
+  Fill a buffer with a pattern, with non-temporal stores if the buffer is
+  large.
+
+  @param  Config    The configuration of the library.
+  @param  Buffer    The memory to fill.
+  @param  Length    The number of bytes to fill.
+  @param  Pattern   The pattern to fill the memory with, repeating with the
+                    alignment of Buffer and Length.
+
+  @return Buffer
+
+**/
+STATIC
+VOID *
+InternalMemSetPattern (
+  IN      CONST MEM_LIB_CONFIG  *Config,
+  OUT     VOID                  *Buffer,
+  IN      UINTN                 Length,
+  IN      UINT64                Pattern
+  )
+{
+  if (Length >= Config->NonTemporalThreshold) {
+    return InternalMemSetMemPatternNonTemporalSse2 (Buffer, Length, Pattern);
+  }
+
+  return InternalMemSetMemPatternSse2 (Buffer, Length, Pattern);
+}
+
+/**
+  Copy Length bytes from Source to Destination.
+
+  @param  DestinationBuffer The target of the copy request.
+  @param  SourceBuffer      The place to copy from.
+  @param  Length            The number of bytes to copy.
+
+  @return Destination
+
+**/
+VOID *
+EFIAPI
+InternalMemCopyMem (
+  OUT     VOID        *DestinationBuffer,
+  IN      CONST VOID  *SourceBuffer,
+  IN      UINTN       Length
+  )
+{
+  CONST MEM_LIB_CONFIG  *Config;
+  BOOLEAN               OverlapsEnd;
+
+  Config = InternalMemLibGetConfig ();
+
+  //
+  // Only the SSE2 kernel copies from the end, when Destination overlaps
+  // the end of Source. REP MOVSB copies forward, and the non-temporal kernel
+  // takes disjoint buffers.
+  //
+  OverlapsEnd = (BOOLEAN)((UINTN)DestinationBuffer - (UINTN)SourceBuffer < Length);
+  if (Length >= Config->NonTemporalThreshold) {
+    if (!OverlapsEnd && ((UINTN)SourceBuffer - (UINTN)DestinationBuffer >= Length)) {
+      return InternalMemCopyMemNonTemporalSse2 (DestinationBuffer, SourceBuffer, Length);
+    }
+  } else if ((Length >= Config->RepMovsbThreshold) && !OverlapsEnd) {
+    return InternalMemCopyMemRepMovsb (DestinationBuffer, SourceBuffer, Length);
+  }
+
+  return InternalMemCopyMemSse2 (DestinationBuffer, SourceBuffer, Length);
+}
+
+/**
+  Set Buffer to Value for Size bytes.
+
+  @param  Buffer   The memory to set.
+  @param  Length   The number of bytes to set.
+  @param  Value    The value of the set operation.
+
+  @return Buffer
+
+**/
+VOID *
+EFIAPI
+InternalMemSetMem (
+  OUT     VOID   *Buffer,
+  IN      UINTN  Length,
+  IN      UINT8  Value
+  )
+{
+  CONST MEM_LIB_CONFIG  *Config;
+
+  Config = InternalMemLibGetConfig ();
+  if ((Length >= Config->RepStosbThreshold) && (Length < Config->NonTemporalThreshold)) {
+    return InternalMemSetMemRepStosb (Buffer, Length, Value);
+  }
+
+  return InternalMemSetPattern (Config, Buffer, Length, Value * 0x0101010101010101ULL);
+}
+
+/**
+  Fills a target buffer with a 16-bit value, and returns the target buffer.
+
+  @param  Buffer  The pointer to the target buffer to fill.
+  @param  Length  The count of 16-bit value to fill.
+  @param  Value   The value with which to fill Length bytes of Buffer.
+
+  @return Buffer
+
+**/
+VOID *
+EFIAPI
+InternalMemSetMem16 (
+  OUT     VOID    *Buffer,
+  IN      UINTN   Length,
+  IN      UINT16  Value
+  )
+{
+  return InternalMemSetPattern (
+           InternalMemLibGetConfig (),
+           Buffer,
+           Length * sizeof (Value),
+           Value * 0x0001000100010001ULL
+           );
+}
+
+/**
+  Fills a target buffer with a 32-bit value, and returns the target buffer.
+
+  @param  Buffer  The pointer to the target buffer to fill.
+  @param  Length  The count of 32-bit value to fill.
+  @param  Value   The value with which to fill Length bytes of Buffer.
+
+  @return Buffer
+
+**/
+VOID *
+EFIAPI
+InternalMemSetMem32 (
+  OUT     VOID    *Buffer,
+  IN      UINTN   Length,
+  IN      UINT32  Value
+  )
+{
+  return InternalMemSetPattern (
+           InternalMemLibGetConfig (),
+           Buffer,
+           Length * sizeof (Value),
+           Value * 0x0000000100000001ULL
+           );
+}
+
+/**
+  Fills a target buffer with a 64-bit value, and returns the target buffer.
+
+  @param  Buffer  The pointer to the target buffer to fill.
+  @param  Length  The count of 64-bit value to fill.
+  @param  Value   The value with which to fill Length bytes of Buffer.
+
+  @return Buffer
+
+**/
+VOID *
+EFIAPI
+InternalMemSetMem64 (
+  OUT     VOID    *Buffer,
+  IN      UINTN   Length,
+  IN      UINT64  Value
+  )
+{
+  return InternalMemSetPattern (InternalMemLibGetConfig (), Buffer, Length * sizeof (Value), Value);
+}
+
+/**
+  Set Buffer to 0 for Size bytes.
+
+  @param  Buffer Memory to set.
+  @param  Length The number of bytes to set
+
+  @return Buffer
+
+**/
+VOID *
+EFIAPI
+InternalMemZeroMem (
+  OUT     VOID   *Buffer,
+  IN      UINTN  Length
+  )
+{
+  return InternalMemSetMem (Buffer, Length, 0);
+}
+
+/**
+  Compares two memory buffers of a given length.
+
+  @param  DestinationBuffer The first memory buffer
+  @param  SourceBuffer      The second memory buffer
+  @param  Length            The length of DestinationBuffer and SourceBuffer memory
+                            regions to compare. Must be non-zero.
+
+  @return 0                 All Length bytes of the two buffers are identical.
+  @retval Non-zero          The first mismatched byte in SourceBuffer subtracted from the first
+                            mismatched byte in DestinationBuffer.
+
+**/
+INTN
+EFIAPI
+InternalMemCompareMem (
+  IN      CONST VOID  *DestinationBuffer,
+  IN      CONST VOID  *SourceBuffer,
+  IN      UINTN       Length
+  )
+{
+  return InternalMemCompareMemSse2 (DestinationBuffer, SourceBuffer, Length);
+}
+
+/**
+  Scans a target buffer for an 8-bit value, and returns a pointer to the
+  matching 8-bit value in the target buffer.
+
+  @param  Buffer  The pointer to the target buffer to scan.
+  @param  Length  The count of 8-bit value to scan. Must be non-zero.
+  @param  Value   The value to search for in the target buffer.
+
+  @return The pointer to the first occurrence or NULL if not found.
+
+**/
+CONST VOID *
+EFIAPI
+InternalMemScanMem8 (
+  IN      CONST VOID  *Buffer,
+  IN      UINTN       Length,
+  IN      UINT8       Value
+  )
+{
+  return InternalMemScanMem8Sse2 (Buffer, Length, Value * 0x0101010101010101ULL);
+}
+
+/**
+  Scans a target buffer for a 16-bit value, and returns a pointer to the
+  matching 16-bit value in the target buffer.
+
+  @param  Buffer  The pointer to the target buffer to scan.
+  @param  Length  The count of 16-bit value to scan. Must be non-zero.
+  @param  Value   The value to search for in the target buffer.
+
+  @return The pointer to the first occurrence or NULL if not found.
+
+**/
+CONST VOID *
+EFIAPI
+InternalMemScanMem16 (
+  IN      CONST VOID  *Buffer,
+  IN      UINTN       Length,
+  IN      UINT16      Value
+  )
+{
+  return InternalMemScanMem16Sse2 (Buffer, Length * sizeof (Value), Value * 0x0001000100010001ULL);
+}
+
+/**
+  Scans a target buffer for a 32-bit value, and returns a pointer to the
+  matching 32-bit value in the target buffer.
+
+  @param  Buffer  The pointer to the target buffer to scan.
+  @param  Length  The count of 32-bit value to scan. Must be non-zero.
+  @param  Value   The value to search for in the target buffer.
+
+  @return The pointer to the first occurrence or NULL if not found.
+
+**/
+CONST VOID *
+EFIAPI
+InternalMemScanMem32 (
+  IN      CONST VOID  *Buffer,
+  IN      UINTN       Length,
+  IN      UINT32      Value
+  )
+{
+  return InternalMemScanMem32Sse2 (Buffer, Length * sizeof (Value), Value * 0x0000000100000001ULL);
+}
+
+/**
+  Scans a target buffer for a 64-bit value, and returns a pointer to the
+  matching 64-bit value in the target buffer.
+
+  @param  Buffer  The pointer to the target buffer to scan.
+  @param  Length  The count of 64-bit value to scan. Must be non-zero.
+  @param  Value   The value to search for in the target buffer.
+
+  @return The pointer to the first occurrence or NULL if not found.
+
+**/
+CONST VOID *
+EFIAPI
+InternalMemScanMem64 (
+  IN      CONST VOID  *Buffer,
+  IN      UINTN       Length,
+  IN      UINT64      Value
+  )
+{
+  return InternalMemScanMem64Sse2 (Buffer, Length * sizeof (Value), Value);
+}
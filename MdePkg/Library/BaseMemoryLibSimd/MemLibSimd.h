@@ -0,0 +1,140 @@
+/** @file
+  Declaration of the kernels of the SIMD Base Memory Library.
+
+  The kernels use the SSE2 registers XMM0-XMM15 only, which the interrupt
+  handlers save and restore. The copy and fill kernels also have a
+  non-temporal flavor for the buffers which do not fit in the last level
+  cache, and a REP MOVSB/STOSB flavor for the processors with enhanced REP
+  MOVSB/STOSB, selected on the first call to the library by MemLibSimd.c.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef MEM_LIB_SIMD_H_
+#define MEM_LIB_SIMD_H_
+
+#include "MemLibInternals.h"
+
+//
+// Lengths from which REP MOVSB and REP STOSB are faster than the vector
+// loops, on the processors with enhanced REP MOVSB/STOSB. Fast short REP MOV
+// lowers the startup cost of REP MOVSB.
+//
+#define MEM_LIB_REP_MOVSB_THRESHOLD       SIZE_2KB
+#define MEM_LIB_REP_MOVSB_THRESHOLD_FSRM  SIZE_1KB
+#define MEM_LIB_REP_STOSB_THRESHOLD       SIZE_2KB
+
+//
+// Non-temporal threshold used when the size of the last level cache cannot
+// be read from CPUID.
+//
+#define MEM_LIB_DEFAULT_NON_TEMPORAL_THRESHOLD  SIZE_1MB
+
+//
+// The non-temporal kernels store the first and last vectors apart, so their
+// buffers must be at least two vectors long.
+//
+#define MEM_LIB_MIN_NON_TEMPORAL_LENGTH  32
+
+//
+// Kernels defined in X64/CopyMem.nasm.
+//
+VOID *
+EFIAPI
+InternalMemCopyMemSse2 (
+  OUT     VOID        *DestinationBuffer,
+  IN      CONST VOID  *SourceBuffer,
+  IN      UINTN       Length
+  );
+
+VOID *
+EFIAPI
+InternalMemCopyMemNonTemporalSse2 (
+  OUT     VOID        *DestinationBuffer,
+  IN      CONST VOID  *SourceBuffer,
+  IN      UINTN       Length
+  );
+
+VOID *
+EFIAPI
+InternalMemCopyMemRepMovsb (
+  OUT     VOID        *DestinationBuffer,
+  IN      CONST VOID  *SourceBuffer,
+  IN      UINTN       Length
+  );
+
+//
+// Kernels defined in X64/SetMem.nasm.
+//
+VOID *
+EFIAPI
+InternalMemSetMemPatternSse2 (
+  OUT     VOID    *Buffer,
+  IN      UINTN   Length,
+  IN      UINT64  Pattern
+  );
+
+VOID *
+EFIAPI
+InternalMemSetMemPatternNonTemporalSse2 (
+  OUT     VOID    *Buffer,
+  IN      UINTN   Length,
+  IN      UINT64  Pattern
+  );
+
+VOID *
+EFIAPI
+InternalMemSetMemRepStosb (
+  OUT     VOID   *Buffer,
+  IN      UINTN  Length,
+  IN      UINT8  Value
+  );
+
+//
+// Kernels defined in X64/CompareMem.nasm.
+//
+INTN
+EFIAPI
+InternalMemCompareMemSse2 (
+  IN      CONST VOID  *DestinationBuffer,
+  IN      CONST VOID  *SourceBuffer,
+  IN      UINTN       Length
+  );
+
+//
+// Kernels defined in X64/ScanMem.nasm.
+//
+CONST VOID *
+EFIAPI
+InternalMemScanMem8Sse2 (
+  IN      CONST VOID  *Buffer,
+  IN      UINTN       Length,
+  IN      UINT64      Pattern
+  );
+
+CONST VOID *
+EFIAPI
+InternalMemScanMem16Sse2 (
+  IN      CONST VOID  *Buffer,
+  IN      UINTN       Length,
+  IN      UINT64      Pattern
+  );
+
+CONST VOID *
+EFIAPI
+InternalMemScanMem32Sse2 (
+  IN      CONST VOID  *Buffer,
+  IN      UINTN       Length,
+  IN      UINT64      Pattern
+  );
+
+CONST VOID *
+EFIAPI
+InternalMemScanMem64Sse2 (
+  IN      CONST VOID  *Buffer,
+  IN      UINTN       Length,
+  IN      UINT64      Pattern
+  );
+
+#endif
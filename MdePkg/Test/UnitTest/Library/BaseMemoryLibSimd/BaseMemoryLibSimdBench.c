@@ -0,0 +1,224 @@
+/** @file
+  Host benchmark of the BaseMemoryLib functions.
+
+  CopyMem(), SetMem(), CompareMem() and ScanMem8() run on buffers of 8 bytes
+  to 64 MB, doubling the size at each step. MdePkgHostTest.dsc builds the
+  benchmark with BaseMemoryLibSimd, and with BaseMemoryLibOptDxe as a
+  baseline. The output is comma separated, in GB/s:
+
+    BaseMemoryLibSimdBenchHost [max size] [misalignment]
+
+  The misalignment is added to the source buffer, the destination buffer is
+  always aligned on 64 bytes. CompareMem() compares identical buffers and
+  ScanMem8() looks for a byte that is absent, so that both functions go
+  through the whole buffers.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+
+#include "HostCpuid.h"
+
+#define BENCH_MIN_SIZE          8
+#define BENCH_DEFAULT_MAX_SIZE  SIZE_64MB
+
+//
+// Bytes processed by each measurement, and number of measurements of which
+// the fastest is reported.
+//
+#define BENCH_BYTES_PER_RUN  SIZE_256MB
+#define BENCH_RUNS           3
+
+typedef enum {
+  BenchCopyMem,
+  BenchSetMem,
+  BenchCompareMem,
+  BenchScanMem,
+  BenchFunctionMax
+} BENCH_FUNCTION;
+
+//
+// Sink of the results, so that the calls are not optimized away.
+//
+volatile UINTN  mBenchSink;
+
+/**
+  Return a monotonic time stamp.
+
+  @return The time stamp in nanoseconds.
+
+**/
+UINT64
+BenchGetTimeNs (
+  VOID
+  )
+{
+  struct timespec  Now;
+
+  clock_gettime (CLOCK_MONOTONIC, &Now);
+  return (UINT64)Now.tv_sec * 1000000000ULL + (UINT64)Now.tv_nsec;
+}
+
+/**
+  Call a function of the BaseMemoryLib a number of times.
+
+  @param[in]  Function      The function to call.
+  @param[in]  Destination   The destination buffer.
+  @param[in]  Source        The source buffer.
+  @param[in]  Size          Size of the buffers.
+  @param[in]  Iterations    Number of calls.
+
+**/
+VOID
+BenchCall (
+  IN BENCH_FUNCTION  Function,
+  IN UINT8           *Destination,
+  IN UINT8           *Source,
+  IN UINTN           Size,
+  IN UINTN           Iterations
+  )
+{
+  UINTN  Sink;
+
+  Sink = 0;
+  while (Iterations-- != 0) {
+    switch (Function) {
+      case BenchCopyMem:
+        CopyMem (Destination, Source, Size);
+        break;
+      case BenchSetMem:
+        SetMem (Destination, Size, (UINT8)Iterations);
+        break;
+      case BenchCompareMem:
+        Sink += (UINTN)CompareMem (Destination, Source, Size);
+        break;
+      default:
+        Sink += (UINTN)ScanMem8 (Source, Size, 0xFF);
+        break;
+    }
+  }
+
+  mBenchSink = Sink;
+}
+
+/**
+  Measure the throughput of a function of the BaseMemoryLib.
+
+  @param[in]  Function      The measured function.
+  @param[in]  Destination   The destination buffer.
+  @param[in]  Source        The source buffer.
+  @param[in]  Size          Size of the buffers.
+
+  @return The throughput in GB/s.
+
+**/
+double
+BenchRun (
+  IN BENCH_FUNCTION  Function,
+  IN UINT8           *Destination,
+  IN UINT8           *Source,
+  IN UINTN           Size
+  )
+{
+  UINTN   Iterations;
+  UINTN   Run;
+  UINT64  Start;
+  UINT64  Elapsed;
+  UINT64  Best;
+
+  Iterations = MAX (BENCH_BYTES_PER_RUN / Size, 4);
+
+  //
+  // Warm up the caches and the kernel selection once before measuring.
+  //
+  BenchCall (Function, Destination, Source, Size, 1);
+
+  Best = MAX_UINT64;
+  for (Run = 0; Run < BENCH_RUNS; Run++) {
+    Start = BenchGetTimeNs ();
+    BenchCall (Function, Destination, Source, Size, Iterations);
+    Elapsed = BenchGetTimeNs () - Start;
+    Best    = MIN (Best, MAX (Elapsed, 1));
+  }
+
+  return (double)Size * Iterations / Best;
+}
+
+/**
+  Standard POSIX C entry point of the benchmark.
+
+  @param[in]  argc  Number of arguments.
+  @param[in]  argv  Arguments: maximum size and misalignment of the source.
+
+  @retval 0  The benchmark ran.
+  @retval 1  The buffers could not be allocated.
+
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  UINTN           MaxSize;
+  UINTN           Misalignment;
+  UINTN           Size;
+  UINT8           *Destination;
+  UINT8           *Source;
+  BENCH_FUNCTION  Function;
+
+  HostCpuidHook ();
+
+  MaxSize      = (argc > 1) ? strtoul (argv[1], NULL, 0) : BENCH_DEFAULT_MAX_SIZE;
+  Misalignment = (argc > 2) ? strtoul (argv[2], NULL, 0) % 64 : 0;
+  if (MaxSize < BENCH_MIN_SIZE) {
+    MaxSize = BENCH_DEFAULT_MAX_SIZE;
+  }
+
+  Destination = aligned_alloc (64, ALIGN_VALUE (MaxSize, 64));
+  Source      = aligned_alloc (64, ALIGN_VALUE (MaxSize + 64, 64));
+  if ((Destination == NULL) || (Source == NULL)) {
+    free (Destination);
+    free (Source);
+    return 1;
+  }
+
+  //
+  // Touch the buffers so that the page faults are not measured.
+  //
+  memset (Destination, 0, MaxSize);
+  memset (Source, 0, MaxSize + 64);
+  Source += Misalignment;
+
+  printf ("Size,CopyMem GB/s,SetMem GB/s,CompareMem GB/s,ScanMem8 GB/s\n");
+  for (Size = BENCH_MIN_SIZE; Size <= MaxSize; Size *= 2) {
+    printf ("%lu", (unsigned long)Size);
+    for (Function = BenchCopyMem; Function < BenchFunctionMax; Function++) {
+      //
+      // CompareMem() must find identical buffers.
+      //
+      if (Function == BenchCompareMem) {
+        memset (Destination, 0, Size);
+      }
+
+      printf (",%.2f", BenchRun (Function, Destination, Source, Size));
+    }
+
+    printf ("\n");
+    fflush (stdout);
+  }
+
+  free (Destination);
+  free (Source - Misalignment);
+  return 0;
+}
@@ -0,0 +1,714 @@
+/** @file
+  Unit tests of the BaseMemoryLibSimd kernels.
+
+  The library selects its kernels from the processor features, so the tests
+  are built twice by MdePkgHostTest.dsc, with and without
+  PcdMemoryLibSimdUseRepString. The non-temporal threshold is lowered to 64 KB
+  so that the non-temporal kernels are reached with small buffers.
+
+  The host BaseLib returns zeros from CPUID, so HostCpuid.c passes the CPUID
+  requests to the host processor before the first call to the library.
+
+  Every function is checked against a byte by byte reference, for all the
+  lengths up to a few vectors, for larger lengths, and for the alignments of
+  the buffers within a vector. The bytes around the buffers are checked to be
+  left untouched.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UnitTestLib.h>
+
+#include "HostCpuid.h"
+
+#define UNIT_TEST_APP_NAME     "BaseMemoryLibSimd Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// Lengths up to TEST_SMALL_LENGTH are all tested. They cover the small
+// buffer paths and the vector loops.
+//
+#define TEST_SMALL_LENGTH  520
+
+//
+// Bytes left before and after the tested buffers, and their value.
+//
+#define TEST_GUARD_SIZE  64
+#define TEST_GUARD_BYTE  0xA5
+
+//
+// Offsets of the buffers from a 64-byte boundary.
+//
+UINTN  mOffsets[] = { 0, 1, 7, 8, 15, 16, 31, 32, 33, 48, 63 };
+
+//
+// Lengths around the REP MOVSB threshold, the non-temporal threshold of the
+// tests and the cache sizes.
+//
+UINTN  mLargeLengths[] = {
+  SIZE_1KB - 1,   SIZE_1KB,       SIZE_2KB - 8,   SIZE_2KB,  SIZE_4KB + 3,
+  SIZE_64KB - 8,  SIZE_64KB,      SIZE_64KB + 8,  SIZE_256KB + 5,
+  SIZE_1MB + 17,  SIZE_4MB + 128
+};
+
+//
+// Distances between overlapping buffers.
+//
+UINTN  mOverlaps[] = { 1, 2, 7, 8, 15, 16, 31, 32, 33, 63, 64, 65, 127, 128, 129, 255, 1000 };
+
+UINT32  mRandomSeed;
+
+/**
+  Return a pseudo random number.
+
+  @return The next pseudo random number.
+
+**/
+UINT32
+TestRandom (
+  VOID
+  )
+{
+  mRandomSeed = mRandomSeed * 1103515245 + 12345;
+  return mRandomSeed >> 8;
+}
+
+/**
+  Fill a buffer with pseudo random bytes.
+
+  @param[out] Buffer  The buffer to fill.
+  @param[in]  Length  Length of the buffer.
+
+**/
+VOID
+TestFillRandom (
+  OUT UINT8  *Buffer,
+  IN  UINTN  Length
+  )
+{
+  while (Length-- != 0) {
+    *Buffer++ = (UINT8)TestRandom ();
+  }
+}
+
+/**
+  Allocate a buffer aligned on 64 bytes, with room for the guards and the
+  offsets.
+
+  @param[in]  Length  Length of the largest tested buffer.
+
+  @return The buffer, or NULL.
+
+**/
+UINT8 *
+TestAllocate (
+  IN UINTN  Length
+  )
+{
+  return aligned_alloc (64, ALIGN_VALUE (Length + 2 * TEST_GUARD_SIZE + 64, 64));
+}
+
+/**
+  Check that the guards around a buffer are untouched.
+
+  @param[in]  Buffer  The tested buffer.
+  @param[in]  Length  Length of the tested buffer.
+
+  @return TRUE if the guards are intact.
+
+**/
+BOOLEAN
+TestGuardsIntact (
+  IN CONST UINT8  *Buffer,
+  IN UINTN        Length
+  )
+{
+  UINTN  Index;
+
+  for (Index = 1; Index <= TEST_GUARD_SIZE; Index++) {
+    if ((Buffer[-(INTN)Index] != TEST_GUARD_BYTE) || (Buffer[Length + Index - 1] != TEST_GUARD_BYTE)) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+  Copy a buffer and check the result.
+
+  @param[in]  Base          The allocated destination.
+  @param[in]  Source        The source.
+  @param[in]  Offset        Offset of the destination from a 64-byte boundary.
+  @param[in]  Length        Length to copy.
+
+  @return TRUE if the copy is correct.
+
+**/
+BOOLEAN
+TestOneCopy (
+  IN UINT8        *Base,
+  IN CONST UINT8  *Source,
+  IN UINTN        Offset,
+  IN UINTN        Length
+  )
+{
+  UINT8  *Destination;
+
+  Destination = Base + TEST_GUARD_SIZE + Offset;
+  memset (Base, TEST_GUARD_BYTE, Length + 2 * TEST_GUARD_SIZE + 64);
+  if (CopyMem (Destination, Source, Length) != Destination) {
+    return FALSE;
+  }
+
+  return (BOOLEAN)((memcmp (Destination, Source, Length) == 0) && TestGuardsIntact (Destination, Length));
+}
+
+/**
+  Test CopyMem() on disjoint buffers.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestCopyMem (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8  *Source;
+  UINT8  *Destination;
+  UINTN  Length;
+  UINTN  SourceOffset;
+  UINTN  DestinationOffset;
+  UINTN  Index;
+
+  Source      = TestAllocate (SIZE_4MB + 128);
+  Destination = TestAllocate (SIZE_4MB + 128);
+  UT_ASSERT_NOT_NULL (Source);
+  UT_ASSERT_NOT_NULL (Destination);
+  TestFillRandom (Source, SIZE_4MB + 128 + 64);
+
+  for (SourceOffset = 0; SourceOffset < ARRAY_SIZE (mOffsets); SourceOffset++) {
+    for (DestinationOffset = 0; DestinationOffset < ARRAY_SIZE (mOffsets); DestinationOffset++) {
+      for (Length = 0; Length <= TEST_SMALL_LENGTH; Length++) {
+        UT_ASSERT_TRUE (TestOneCopy (Destination, Source + mOffsets[SourceOffset], mOffsets[DestinationOffset], Length));
+      }
+
+      for (Index = 0; Index < ARRAY_SIZE (mLargeLengths); Index++) {
+        UT_ASSERT_TRUE (TestOneCopy (Destination, Source + mOffsets[SourceOffset], mOffsets[DestinationOffset], mLargeLengths[Index]));
+      }
+    }
+  }
+
+  free (Source);
+  free (Destination);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Copy between overlapping buffers and check the result.
+
+  @param[in]  Buffer      The buffer holding the source and destination.
+  @param[in]  Reference   Copy of the initial content of Buffer.
+  @param[in]  Source      Offset of the source in Buffer.
+  @param[in]  Destination Offset of the destination in Buffer.
+  @param[in]  Length      Length to copy.
+
+  @return TRUE if the copy is correct.
+
+**/
+BOOLEAN
+TestOneOverlappingCopy (
+  IN UINT8        *Buffer,
+  IN CONST UINT8  *Reference,
+  IN UINTN        Source,
+  IN UINTN        Destination,
+  IN UINTN        Length
+  )
+{
+  UINTN  Span;
+
+  //
+  // Only the bytes up to a guard after the buffers are restored and checked.
+  //
+  Span = MAX (Source, Destination) + Length + TEST_GUARD_SIZE;
+  memcpy (Buffer, Reference, Span);
+  if (CopyMem (Buffer + Destination, Buffer + Source, Length) != Buffer + Destination) {
+    return FALSE;
+  }
+
+  return (BOOLEAN)((memcmp (Buffer + Destination, Reference + Source, Length) == 0) &&
+                   (memcmp (Buffer, Reference, Destination) == 0) &&
+                   (memcmp (Buffer + Destination + Length, Reference + Destination + Length, Span - Destination - Length) == 0));
+}
+
+/**
+  Test CopyMem() on overlapping buffers, in both directions.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestCopyMemOverlap (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8  *Buffer;
+  UINT8  *Reference;
+  UINTN  Size;
+  UINTN  Length;
+  UINTN  Overlap;
+  UINTN  Offset;
+  UINTN  Index;
+
+  Size      = SIZE_256KB + 2 * 1000 + 64;
+  Buffer    = TestAllocate (Size);
+  Reference = TestAllocate (Size);
+  UT_ASSERT_NOT_NULL (Buffer);
+  UT_ASSERT_NOT_NULL (Reference);
+  TestFillRandom (Reference, Size);
+
+  for (Overlap = 0; Overlap < ARRAY_SIZE (mOverlaps); Overlap++) {
+    for (Offset = 0; Offset < ARRAY_SIZE (mOffsets); Offset += 2) {
+      for (Length = mOverlaps[Overlap] + 1; Length <= TEST_SMALL_LENGTH; Length++) {
+        UT_ASSERT_TRUE (TestOneOverlappingCopy (Buffer, Reference, mOffsets[Offset], mOffsets[Offset] + mOverlaps[Overlap], Length));
+        UT_ASSERT_TRUE (TestOneOverlappingCopy (Buffer, Reference, mOffsets[Offset] + mOverlaps[Overlap], mOffsets[Offset], Length));
+      }
+
+      for (Index = 0; Index < ARRAY_SIZE (mLargeLengths) && mLargeLengths[Index] <= SIZE_256KB + 5; Index++) {
+        Length = mLargeLengths[Index];
+        UT_ASSERT_TRUE (TestOneOverlappingCopy (Buffer, Reference, mOffsets[Offset], mOffsets[Offset] + mOverlaps[Overlap], Length));
+        UT_ASSERT_TRUE (TestOneOverlappingCopy (Buffer, Reference, mOffsets[Offset] + mOverlaps[Overlap], mOffsets[Offset], Length));
+      }
+    }
+  }
+
+  free (Buffer);
+  free (Reference);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Fill a buffer with one of the SetMem() functions and check the result.
+
+  @param[in]  Base          The allocated buffer.
+  @param[in]  Offset        Offset of the buffer from a 64-byte boundary.
+  @param[in]  Length        Length to fill.
+  @param[in]  ElementSize   Size of the value, 0 for ZeroMem().
+  @param[in]  Value         The value.
+
+  @return TRUE if the buffer is correctly filled.
+
+**/
+BOOLEAN
+TestOneSet (
+  IN UINT8   *Base,
+  IN UINTN   Offset,
+  IN UINTN   Length,
+  IN UINTN   ElementSize,
+  IN UINT64  Value
+  )
+{
+  UINT8  *Buffer;
+  VOID   *Result;
+  UINTN  Index;
+
+  Buffer = Base + TEST_GUARD_SIZE + Offset;
+  memset (Base, TEST_GUARD_BYTE, Length + 2 * TEST_GUARD_SIZE + 64);
+  switch (ElementSize) {
+    case 1:
+      Result = SetMem (Buffer, Length, (UINT8)Value);
+      break;
+    case 2:
+      Result = SetMem16 (Buffer, Length, (UINT16)Value);
+      break;
+    case 4:
+      Result = SetMem32 (Buffer, Length, (UINT32)Value);
+      break;
+    case 8:
+      Result = SetMem64 (Buffer, Length, Value);
+      break;
+    default:
+      Result      = ZeroMem (Buffer, Length);
+      Value       = 0;
+      ElementSize = 1;
+      break;
+  }
+
+  if (Result != Buffer) {
+    return FALSE;
+  }
+
+  for (Index = 0; Index < Length; Index++) {
+    if (Buffer[Index] != (UINT8)RShiftU64 (Value, (Index % ElementSize) * 8)) {
+      return FALSE;
+    }
+  }
+
+  return TestGuardsIntact (Buffer, Length);
+}
+
+/**
+  Test SetMem(), SetMem16(), SetMem32(), SetMem64() and ZeroMem().
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestSetMem (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8   *Buffer;
+  UINTN   ElementSize;
+  UINTN   Offset;
+  UINTN   Length;
+  UINTN   Index;
+  UINT64  Value;
+
+  Buffer = TestAllocate (SIZE_4MB + 128);
+  UT_ASSERT_NOT_NULL (Buffer);
+
+  Value = 0x0123456789ABCDEFULL;
+  for (ElementSize = 0; ElementSize <= 8; ElementSize = (ElementSize == 0) ? 1 : ElementSize * 2) {
+    for (Offset = 0; Offset < ARRAY_SIZE (mOffsets); Offset++) {
+      if ((ElementSize > 1) && ((mOffsets[Offset] % ElementSize) != 0)) {
+        continue;
+      }
+
+      for (Length = 0; Length <= TEST_SMALL_LENGTH; Length += MAX (ElementSize, 1)) {
+        UT_ASSERT_TRUE (TestOneSet (Buffer, mOffsets[Offset], Length, ElementSize, Value));
+      }
+
+      for (Index = 0; Index < ARRAY_SIZE (mLargeLengths); Index++) {
+        Length = mLargeLengths[Index] & ~(MAX (ElementSize, 1) - 1);
+        UT_ASSERT_TRUE (TestOneSet (Buffer, mOffsets[Offset], Length, ElementSize, Value));
+      }
+    }
+  }
+
+  free (Buffer);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Test CompareMem() with equal buffers and with a mismatch at every offset.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestCompareMem (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8  *First;
+  UINT8  *Second;
+  UINT8  *Destination;
+  UINT8  *Source;
+  UINTN  Offset;
+  UINTN  Length;
+  UINTN  Index;
+  UINTN  Mismatch;
+  UINT8  Byte;
+
+  First  = TestAllocate (SIZE_4MB + 128);
+  Second = TestAllocate (SIZE_4MB + 128);
+  UT_ASSERT_NOT_NULL (First);
+  UT_ASSERT_NOT_NULL (Second);
+  TestFillRandom (First, SIZE_4MB + 128 + 64);
+
+  for (Offset = 0; Offset < ARRAY_SIZE (mOffsets); Offset++) {
+    Destination = First + TEST_GUARD_SIZE;
+    Source      = Second + TEST_GUARD_SIZE + mOffsets[Offset];
+    memcpy (Source, Destination, SIZE_4MB + 128);
+
+    for (Length = 1; Length <= TEST_SMALL_LENGTH; Length++) {
+      UT_ASSERT_EQUAL (CompareMem (Destination, Source, Length), 0);
+      for (Mismatch = 0; Mismatch < Length; Mismatch++) {
+        Byte             = Source[Mismatch];
+        Source[Mismatch] = (UINT8)(Byte + 1 + TestRandom () % 255);
+        UT_ASSERT_EQUAL (CompareMem (Destination, Source, Length), (INTN)Destination[Mismatch] - (INTN)Source[Mismatch]);
+
+        //
+        // A second mismatch after the first one must not be reported.
+        //
+        if (Mismatch < Length - 1) {
+          Source[Length - 1] ^= 0x80;
+          UT_ASSERT_EQUAL (CompareMem (Destination, Source, Length), (INTN)Destination[Mismatch] - (INTN)Source[Mismatch]);
+          Source[Length - 1] ^= 0x80;
+        }
+
+        Source[Mismatch] = Byte;
+      }
+    }
+
+    for (Index = 0; Index < ARRAY_SIZE (mLargeLengths); Index++) {
+      Length = mLargeLengths[Index];
+      UT_ASSERT_EQUAL (CompareMem (Destination, Source, Length), 0);
+      for (Mismatch = Length - 129; Mismatch < Length; Mismatch += 3) {
+        Byte             = Source[Mismatch];
+        Source[Mismatch] = (UINT8)~Byte;
+        UT_ASSERT_EQUAL (CompareMem (Destination, Source, Length), (INTN)Destination[Mismatch] - (INTN)Source[Mismatch]);
+        Source[Mismatch] = Byte;
+      }
+
+      //
+      // The first mismatch wins over a later one, far away in the buffers.
+      //
+      Source[0]          ^= 0x01;
+      Source[Length - 1] ^= 0x80;
+      UT_ASSERT_EQUAL (CompareMem (Destination, Source, Length), (INTN)Destination[0] - (INTN)Source[0]);
+      Source[0]          ^= 0x01;
+      Source[Length - 1] ^= 0x80;
+    }
+  }
+
+  free (First);
+  free (Second);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Scan a buffer with one of the ScanMem() functions.
+
+  @param[in]  Buffer        The buffer.
+  @param[in]  Length        Length of the buffer.
+  @param[in]  ElementSize   Size of the value.
+  @param[in]  Value         The value.
+
+  @return The result of the scan.
+
+**/
+VOID *
+TestScan (
+  IN UINT8   *Buffer,
+  IN UINTN   Length,
+  IN UINTN   ElementSize,
+  IN UINT64  Value
+  )
+{
+  switch (ElementSize) {
+    case 1:
+      return ScanMem8 (Buffer, Length, (UINT8)Value);
+    case 2:
+      return ScanMem16 (Buffer, Length, (UINT16)Value);
+    case 4:
+      return ScanMem32 (Buffer, Length, (UINT32)Value);
+    default:
+      return ScanMem64 (Buffer, Length, Value);
+  }
+}
+
+/**
+  Test ScanMem8(), ScanMem16(), ScanMem32() and ScanMem64().
+
+  The buffers are filled with 0xFF bytes, and hold copies of the value
+  straddling two elements, which must not be found. The value is then put at
+  each element, along with a second copy at the last element.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestScanMem (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8   *Base;
+  UINT8   *Buffer;
+  UINTN   ElementSize;
+  UINTN   Offset;
+  UINTN   Length;
+  UINTN   Index;
+  UINTN   Elements;
+  UINTN   Match;
+  UINT64  Value;
+
+  Base = TestAllocate (SIZE_4MB + 128);
+  UT_ASSERT_NOT_NULL (Base);
+
+  Value = 0x0102030405060708ULL;
+  for (ElementSize = 1; ElementSize <= 8; ElementSize *= 2) {
+    for (Offset = 0; Offset < ARRAY_SIZE (mOffsets); Offset++) {
+      if ((mOffsets[Offset] % ElementSize) != 0) {
+        continue;
+      }
+
+      Buffer = Base + TEST_GUARD_SIZE + mOffsets[Offset];
+      for (Index = 0; Index < TEST_SMALL_LENGTH / ElementSize + ARRAY_SIZE (mLargeLengths); Index++) {
+        Elements = Index + 1;
+        if (Elements > TEST_SMALL_LENGTH / ElementSize) {
+          Elements = mLargeLengths[Elements - TEST_SMALL_LENGTH / ElementSize - 1] / ElementSize;
+        }
+
+        Length = Elements * ElementSize;
+        memset (Base, 0xFF, Length + 2 * TEST_GUARD_SIZE + 64);
+        if ((ElementSize > 1) && (Elements > 1)) {
+          memcpy (Buffer + 1, &Value, ElementSize);
+          memcpy (Buffer + Length - ElementSize - 1, &Value, ElementSize);
+        }
+
+        UT_ASSERT_EQUAL ((UINTN)TestScan (Buffer, Length, ElementSize, Value), (UINTN)NULL);
+
+        //
+        // The long buffers are only checked at a few elements.
+        //
+        for (Match = 0; Match < Elements; Match += (Elements > TEST_SMALL_LENGTH) ? Elements / 7 + 1 : 1) {
+          memcpy (Buffer + Match * ElementSize, &Value, ElementSize);
+          memcpy (Buffer + Length - ElementSize, &Value, ElementSize);
+          UT_ASSERT_EQUAL ((UINTN)TestScan (Buffer, Length, ElementSize, Value), (UINTN)(Buffer + Match * ElementSize));
+          memset (Buffer + Match * ElementSize, 0xFF, ElementSize);
+        }
+      }
+    }
+  }
+
+  free (Base);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Test IsZeroBuffer().
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestIsZeroBuffer (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8  *Buffer;
+  UINTN  Length;
+  UINTN  Index;
+
+  Buffer = TestAllocate (TEST_SMALL_LENGTH);
+  UT_ASSERT_NOT_NULL (Buffer);
+
+  for (Length = 1; Length <= TEST_SMALL_LENGTH; Length++) {
+    memset (Buffer, 0, Length + 1);
+    UT_ASSERT_TRUE (IsZeroBuffer (Buffer + 1, Length));
+    for (Index = 1; Index <= Length; Index++) {
+      Buffer[Index] = 1;
+      UT_ASSERT_FALSE (IsZeroBuffer (Buffer + 1, Length));
+      Buffer[Index] = 0;
+    }
+  }
+
+  free (Buffer);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  BaseMemoryLibSimd and run them.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      MemoryTests;
+
+  Framework = NULL;
+
+  //
+  // Setup the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&MemoryTests, Framework, "BaseMemoryLibSimd API Tests", "BaseMemoryLibSimd.BaseMemoryLib", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for BaseMemoryLibSimd API Tests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  AddTestCase (MemoryTests, "Test CopyMem", "CopyMem", TestCopyMem, NULL, NULL, NULL);
+  AddTestCase (MemoryTests, "Test CopyMem on overlapping buffers", "CopyMemOverlap", TestCopyMemOverlap, NULL, NULL, NULL);
+  AddTestCase (MemoryTests, "Test SetMem and ZeroMem", "SetMem", TestSetMem, NULL, NULL, NULL);
+  AddTestCase (MemoryTests, "Test CompareMem", "CompareMem", TestCompareMem, NULL, NULL, NULL);
+  AddTestCase (MemoryTests, "Test ScanMem", "ScanMem", TestScanMem, NULL, NULL, NULL);
+  AddTestCase (MemoryTests, "Test IsZeroBuffer", "IsZeroBuffer", TestIsZeroBuffer, NULL, NULL, NULL);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework != NULL) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param Argc  Number of arguments.
+  @param Argv  Array of arguments.
+
+  @return Test application exit code.
+**/
+INT32
+main (
+  INT32  Argc,
+  CHAR8  *Argv[]
+  )
+{
+  HostCpuidHook ();
+  return UnitTestingEntry ();
+}
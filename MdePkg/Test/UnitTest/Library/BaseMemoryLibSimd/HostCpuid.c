@@ -0,0 +1,130 @@
+/** @file
+  Pass the CPUID requests of the host BaseLib to the host processor.
+
+  The host BaseLib returns zeros from AsmCpuid() and AsmCpuidEx(), which
+  would hide enhanced REP MOVSB/STOSB and the cache sizes from
+  BaseMemoryLibSimd.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#if defined (_MSC_VER)
+  #include <intrin.h>
+#else
+  #include <cpuid.h>
+#endif
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/UnitTestHostBaseLib.h>
+
+#include "HostCpuid.h"
+
+/**
+  Execute CPUID on the host processor.
+
+  @param  Index     The 32-bit value to load into EAX prior to invoking the
+                    CPUID instruction.
+  @param  SubIndex  The 32-bit value to load into ECX prior to invoking the
+                    CPUID instruction.
+  @param  Eax       The pointer to the 32-bit EAX value returned by the CPUID
+                    instruction. This is an optional parameter that may be
+                    NULL.
+  @param  Ebx       The pointer to the 32-bit EBX value returned by the CPUID
+                    instruction. This is an optional parameter that may be
+                    NULL.
+  @param  Ecx       The pointer to the 32-bit ECX value returned by the CPUID
+                    instruction. This is an optional parameter that may be
+                    NULL.
+  @param  Edx       The pointer to the 32-bit EDX value returned by the CPUID
+                    instruction. This is an optional parameter that may be
+                    NULL.
+
+  @return Index.
+
+**/
+UINT32
+EFIAPI
+HostCpuidEx (
+  IN      UINT32  Index,
+  IN      UINT32  SubIndex,
+  OUT     UINT32  *Eax   OPTIONAL,
+  OUT     UINT32  *Ebx   OPTIONAL,
+  OUT     UINT32  *Ecx   OPTIONAL,
+  OUT     UINT32  *Edx   OPTIONAL
+  )
+{
+  UINT32  Registers[4];
+
+ #if defined (_MSC_VER)
+  __cpuidex ((int *)Registers, (int)Index, (int)SubIndex);
+ #else
+  __cpuid_count (Index, SubIndex, Registers[0], Registers[1], Registers[2], Registers[3]);
+ #endif
+
+  if (Eax != NULL) {
+    *Eax = Registers[0];
+  }
+
+  if (Ebx != NULL) {
+    *Ebx = Registers[1];
+  }
+
+  if (Ecx != NULL) {
+    *Ecx = Registers[2];
+  }
+
+  if (Edx != NULL) {
+    *Edx = Registers[3];
+  }
+
+  return Index;
+}
+
+/**
+  Execute CPUID on the host processor, with ECX cleared.
+
+  @param  Index The 32-bit value to load into EAX prior to invoking the CPUID
+                instruction.
+  @param  Eax   The pointer to the 32-bit EAX value returned by the CPUID
+                instruction. This is an optional parameter that may be NULL.
+  @param  Ebx   The pointer to the 32-bit EBX value returned by the CPUID
+                instruction. This is an optional parameter that may be NULL.
+  @param  Ecx   The pointer to the 32-bit ECX value returned by the CPUID
+                instruction. This is an optional parameter that may be NULL.
+  @param  Edx   The pointer to the 32-bit EDX value returned by the CPUID
+                instruction. This is an optional parameter that may be NULL.
+
+  @return Index.
+
+**/
+UINT32
+EFIAPI
+HostCpuid (
+  IN      UINT32  Index,
+  OUT     UINT32  *Eax   OPTIONAL,
+  OUT     UINT32  *Ebx   OPTIONAL,
+  OUT     UINT32  *Ecx   OPTIONAL,
+  OUT     UINT32  *Edx   OPTIONAL
+  )
+{
+  return HostCpuidEx (Index, 0, Eax, Ebx, Ecx, Edx);
+}
+
+/**
+  Hook AsmCpuid() and AsmCpuidEx() of the host BaseLib so that they return
+  the features of the host processor.
+
+  BaseMemoryLibSimd selects its kernels on its first call, so this function
+  must run before any other function of the BaseMemoryLib.
+
+**/
+VOID
+HostCpuidHook (
+  VOID
+  )
+{
+  gUnitTestHostBaseLib.X86->AsmCpuid   = HostCpuid;
+  gUnitTestHostBaseLib.X86->AsmCpuidEx = HostCpuidEx;
+}
@@ -0,0 +1,24 @@
+/** @file
+  Pass the CPUID requests of the host BaseLib to the host processor.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef HOST_CPUID_H_
+#define HOST_CPUID_H_
+
+/**
+  Hook AsmCpuid() and AsmCpuidEx() of the host BaseLib so that they return
+  the features of the host processor.
+
+  BaseMemoryLibSimd selects its kernels on its first call, so this function
+  must run before any other function of the BaseMemoryLib.
+
+**/
+VOID
+HostCpuidHook (
+  VOID
+  );
+
+#endif
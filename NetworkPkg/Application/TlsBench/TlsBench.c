@@ -0,0 +1,334 @@
+/** @file
+  Shell application measuring the HTTPS connection setup rate.
+
+  Each iteration opens a new HTTP child on the NIC, sends a HEAD request to the
+  HTTPS URL and destroys the child again, so every iteration performs a TCP
+  connect and a TLS handshake. The first handshake to a server is a full one;
+  the following ones resume the session cached by TlsDxe, which is what the
+  difference between the first and the average time shows.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+
+#include <Protocol/Http.h>
+#include <Protocol/ServiceBinding.h>
+
+#include <Library/UefiApplicationEntryPoint.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/HttpIoLib.h>
+#include <Library/HttpLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/ShellLib.h>
+#include <Library/TimerLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiLib.h>
+
+#define TLS_BENCH_DEFAULT_COUNT  16
+#define TLS_BENCH_TIMEOUT        5000
+#define TLS_BENCH_USER_AGENT     "TlsBench/1.0"
+
+SHELL_PARAM_ITEM  mParamList[] = {
+  {
+    L"-n",
+    TypeValue
+  },
+  {
+    L"-i",
+    TypeValue
+  },
+  {
+    L"-6",
+    TypeFlag
+  },
+  {
+    NULL,
+    TypeMax
+  }
+};
+
+/**
+  Open a HTTPS connection, send a HEAD request and close the connection again.
+
+  @param[in]  ImageHandle    The image handle of the application.
+  @param[in]  Controller     The NIC handle with the HTTP service binding.
+  @param[in]  IpVersion      IP_VERSION_4 or IP_VERSION_6.
+  @param[in]  Url            The HTTPS URL.
+  @param[in]  HttpIoHeader   The request headers.
+
+  @retval EFI_SUCCESS        The server sent a response.
+  @retval Others             The connection or the request failed.
+
+**/
+EFI_STATUS
+TlsBenchConnect (
+  IN EFI_HANDLE      ImageHandle,
+  IN EFI_HANDLE      Controller,
+  IN UINT8           IpVersion,
+  IN CHAR16          *Url,
+  IN HTTP_IO_HEADER  *HttpIoHeader
+  )
+{
+  EFI_STATUS             Status;
+  HTTP_IO                HttpIo;
+  HTTP_IO_CONFIG_DATA    ConfigData;
+  EFI_HTTP_REQUEST_DATA  RequestData;
+  HTTP_IO_RESPONSE_DATA  ResponseData;
+
+  ZeroMem (&ConfigData, sizeof (ConfigData));
+  if (IpVersion == IP_VERSION_4) {
+    ConfigData.Config4.HttpVersion       = HttpVersion11;
+    ConfigData.Config4.RequestTimeOut    = TLS_BENCH_TIMEOUT;
+    ConfigData.Config4.ResponseTimeOut   = TLS_BENCH_TIMEOUT;
+    ConfigData.Config4.UseDefaultAddress = TRUE;
+  } else {
+    ConfigData.Config6.HttpVersion       = HttpVersion11;
+    ConfigData.Config6.RequestTimeOut    = TLS_BENCH_TIMEOUT;
+    ConfigData.Config6.UseDefaultAddress = TRUE;
+  }
+
+  ZeroMem (&HttpIo, sizeof (HttpIo));
+  Status = HttpIoCreateIo (ImageHandle, Controller, IpVersion, &ConfigData, NULL, NULL, &HttpIo);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  RequestData.Method = HttpMethodHead;
+  RequestData.Url    = Url;
+  Status             = HttpIoSendRequest (
+                         &HttpIo,
+                         &RequestData,
+                         HttpIoHeader->HeaderCount,
+                         HttpIoHeader->Headers,
+                         0,
+                         NULL
+                         );
+  if (EFI_ERROR (Status)) {
+    goto ON_EXIT;
+  }
+
+  ZeroMem (&ResponseData, sizeof (ResponseData));
+  Status = HttpIoRecvResponse (&HttpIo, TRUE, &ResponseData);
+  if (ResponseData.Headers != NULL) {
+    HttpFreeHeaderFields (ResponseData.Headers, ResponseData.HeaderCount);
+  }
+
+  if (!EFI_ERROR (Status)) {
+    Status = ResponseData.Status;
+  }
+
+ON_EXIT:
+  HttpIoDestroyIo (&HttpIo);
+  return Status;
+}
+
+/**
+  Build the request headers for the URL.
+
+  @param[in]   Url            The HTTPS URL.
+  @param[out]  HttpIoHeader   The request headers.
+
+  @retval EFI_SUCCESS        The headers are built.
+  @retval Others             The URL is invalid or out of resources.
+
+**/
+EFI_STATUS
+TlsBenchBuildHeader (
+  IN  CHAR16          *Url,
+  OUT HTTP_IO_HEADER  **HttpIoHeader
+  )
+{
+  EFI_STATUS  Status;
+  CHAR8       *AsciiUrl;
+  UINTN       UrlSize;
+  VOID        *UrlParser;
+  CHAR8       *HostName;
+
+  UrlParser = NULL;
+  HostName  = NULL;
+
+  UrlSize  = StrLen (Url) + 1;
+  AsciiUrl = AllocatePool (UrlSize);
+  if (AsciiUrl == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  UnicodeStrToAsciiStrS (Url, AsciiUrl, UrlSize);
+  if (AsciiStrnCmp (AsciiUrl, "https://", AsciiStrLen ("https://")) != 0) {
+    Status = EFI_INVALID_PARAMETER;
+    goto ON_EXIT;
+  }
+
+  Status = HttpParseUrl (AsciiUrl, (UINT32)AsciiStrLen (AsciiUrl), FALSE, &UrlParser);
+  if (EFI_ERROR (Status)) {
+    goto ON_EXIT;
+  }
+
+  Status = HttpUrlGetHostName (AsciiUrl, UrlParser, &HostName);
+  if (EFI_ERROR (Status)) {
+    goto ON_EXIT;
+  }
+
+  *HttpIoHeader = HttpIoCreateHeader (2);
+  if (*HttpIoHeader == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ON_EXIT;
+  }
+
+  Status = HttpIoSetHeader (*HttpIoHeader, HTTP_HEADER_HOST, HostName);
+  if (!EFI_ERROR (Status)) {
+    Status = HttpIoSetHeader (*HttpIoHeader, HTTP_HEADER_USER_AGENT, TLS_BENCH_USER_AGENT);
+  }
+
+  if (EFI_ERROR (Status)) {
+    HttpIoFreeHeader (*HttpIoHeader);
+    *HttpIoHeader = NULL;
+  }
+
+ON_EXIT:
+  if (HostName != NULL) {
+    FreePool (HostName);
+  }
+
+  if (UrlParser != NULL) {
+    HttpUrlFreeParser (UrlParser);
+  }
+
+  FreePool (AsciiUrl);
+  return Status;
+}
+
+/**
+  The entry point for TlsBench application.
+
+  Usage: TlsBench [-n count] [-i nic-index] [-6] https://host[:port]/path
+
+  @param[in] ImageHandle    The firmware allocated handle for the EFI image.
+  @param[in] SystemTable    A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS       The benchmark completed.
+  @retval Others            The benchmark failed.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsBenchMain (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS      Status;
+  LIST_ENTRY      *List;
+  CONST CHAR16    *Str;
+  CHAR16          *Url;
+  UINTN           Count;
+  UINTN           NicIndex;
+  UINT8           IpVersion;
+  UINTN           HandleCount;
+  EFI_HANDLE      *Handles;
+  HTTP_IO_HEADER  *HttpIoHeader;
+  UINTN           Index;
+  UINT64          Start;
+  UINT64          Elapsed;
+  UINT64          First;
+  UINT64          Total;
+
+  List         = NULL;
+  Handles      = NULL;
+  HttpIoHeader = NULL;
+  Count        = TLS_BENCH_DEFAULT_COUNT;
+  NicIndex     = 0;
+
+  Status = ShellCommandLineParse (mParamList, &List, NULL, FALSE);
+  if (EFI_ERROR (Status) || (ShellCommandLineGetCount (List) != 2)) {
+    Print (L"Usage: TlsBench [-n count] [-i nic-index] [-6] https://host[:port]/path\n");
+    Status = EFI_INVALID_PARAMETER;
+    goto ON_EXIT;
+  }
+
+  Url = (CHAR16 *)ShellCommandLineGetRawValue (List, 1);
+
+  Str = ShellCommandLineGetValue (List, L"-n");
+  if (Str != NULL) {
+    Count = StrDecimalToUintn (Str);
+  }
+
+  Str = ShellCommandLineGetValue (List, L"-i");
+  if (Str != NULL) {
+    NicIndex = StrDecimalToUintn (Str);
+  }
+
+  IpVersion = ShellCommandLineGetFlag (List, L"-6") ? IP_VERSION_6 : IP_VERSION_4;
+
+  if (Count == 0) {
+    Status = EFI_INVALID_PARAMETER;
+    goto ON_EXIT;
+  }
+
+  Status = gBS->LocateHandleBuffer (
+                  ByProtocol,
+                  &gEfiHttpServiceBindingProtocolGuid,
+                  NULL,
+                  &HandleCount,
+                  &Handles
+                  );
+  if (EFI_ERROR (Status) || (NicIndex >= HandleCount)) {
+    Print (L"TlsBench: No HTTP capable NIC %d\n", NicIndex);
+    Status = EFI_NOT_FOUND;
+    goto ON_EXIT;
+  }
+
+  Status = TlsBenchBuildHeader (Url, &HttpIoHeader);
+  if (EFI_ERROR (Status)) {
+    Print (L"TlsBench: Invalid HTTPS URL %s - %r\n", Url, Status);
+    goto ON_EXIT;
+  }
+
+  First = 0;
+  Total = 0;
+  for (Index = 0; Index < Count; Index++) {
+    Start  = GetPerformanceCounter ();
+    Status = TlsBenchConnect (ImageHandle, Handles[NicIndex], IpVersion, Url, HttpIoHeader);
+    if (EFI_ERROR (Status)) {
+      Print (L"TlsBench: Connection %d failed - %r\n", Index, Status);
+      goto ON_EXIT;
+    }
+
+    Elapsed = GetTimeInNanoSecond (GetPerformanceCounter () - Start);
+    if (Index == 0) {
+      First = Elapsed;
+    }
+
+    Total += Elapsed;
+  }
+
+  Print (L"Connections:        %d\n", Count);
+  Print (L"Total time:         %ld us\n", DivU64x32 (Total, 1000));
+  Print (L"First connection:   %ld us\n", DivU64x32 (First, 1000));
+  if (Count > 1) {
+    Print (L"Following average:  %ld us\n", DivU64x64Remainder (DivU64x32 (Total - First, 1000), Count - 1, NULL));
+  }
+
+  if (Total != 0) {
+    Print (L"Handshakes/sec:     %ld\n", DivU64x64Remainder (MultU64x32 (Count, 1000000000), Total, NULL));
+  }
+
+ON_EXIT:
+  if (HttpIoHeader != NULL) {
+    HttpIoFreeHeader (HttpIoHeader);
+  }
+
+  if (Handles != NULL) {
+    FreePool (Handles);
+  }
+
+  if (List != NULL) {
+    ShellCommandLineFreeVarList (List);
+  }
+
+  return Status;
+}
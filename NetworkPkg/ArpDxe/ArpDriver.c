@@ -42,6 +42,7 @@ ArpCreateService (
   )
 {
   EFI_STATUS  Status;
+  UINTN       Index;
 
   ASSERT (ArpService != NULL);
 
@@ -55,6 +56,10 @@ ArpCreateService (
   InitializeListHead (&ArpService->DeniedCacheTable);
   InitializeListHead (&ArpService->ResolvedCacheTable);
 
+  for (Index = 0; Index < ARP_CACHE_HASH_SIZE; Index++) {
+    InitializeListHead (&ArpService->ResolvedCacheHash[Index]);
+  }
+
   //
   // Init the servicebinding protocol members.
   //
@@ -191,6 +196,14 @@ ArpCleanService (
 {
   NET_CHECK_SIGNATURE (ArpService, ARP_SERVICE_DATA_SIGNATURE);
 
+  DEBUG ((
+    DEBUG_INFO,
+    "ArpCleanService: %lu cache lookups, %lu hits, %lu evictions.\n",
+    ArpService->CacheLookups,
+    ArpService->CacheHits,
+    ArpService->CacheEvictions
+    ));
+
   if (ArpService->PeriodicTimer != NULL) {
     //
     // Cancel and close the PeriodicTimer.
@@ -214,13 +214,7 @@ ArpOnFrameRcvdDpc (
   // Check whether the sender's address information is already in the cache.
   //
   MergeFlag  = FALSE;
-  CacheEntry = ArpFindNextCacheEntryInTable (
-                 &ArpService->ResolvedCacheTable,
-                 NULL,
-                 ByProtoAddress,
-                 &SenderAddress[Protocol],
-                 NULL
-                 );
+  CacheEntry = ArpFindResolvedCacheEntry (ArpService, &SenderAddress[Protocol]);
   if (CacheEntry != NULL) {
     //
     // Update the entry with the new information.
@@ -280,7 +274,7 @@ ArpOnFrameRcvdDpc (
     //
     // Add this entry into the ResolvedCacheTable
     //
-    InsertHeadList (&ArpService->ResolvedCacheTable, &CacheEntry->List);
+    ArpInsertResolvedCacheEntry (ArpService, CacheEntry);
   }
 
   if (Head->OpCode == ARP_OPCODE_REQUEST) {
@@ -519,7 +513,7 @@ ArpTimerHandler (
       //
       // Time out, remove it.
       //
-      RemoveEntryList (&CacheEntry->List);
+      ArpRemoveCacheEntry (ArpService, CacheEntry);
       FreePool (CacheEntry);
     } else {
       //
@@ -703,6 +697,159 @@ ArpFindDeniedCacheEntry (
   return CacheEntry;
 }
 
+/**
+  Compute the hash bucket of a protocol address in the ResolvedCacheTable index.
+
+  @param[in]  ProtocolAddress        Pointer to the protocol address.
+
+  @return The index of the bucket in the ResolvedCacheHash.
+
+**/
+STATIC
+UINTN
+ArpCacheHash (
+  IN NET_ARP_ADDRESS  *ProtocolAddress
+  )
+{
+  UINT32  Hash;
+  UINT8   Index;
+
+  //
+  // FNV-1a over the address type, length and the address itself, everything
+  // ArpMatchAddress compares.
+  //
+  Hash = 0x811C9DC5;
+  Hash = (Hash ^ (ProtocolAddress->Type & 0xFF)) * 0x01000193;
+  Hash = (Hash ^ (ProtocolAddress->Type >> 8)) * 0x01000193;
+  Hash = (Hash ^ ProtocolAddress->Length) * 0x01000193;
+  for (Index = 0; Index < ProtocolAddress->Length; Index++) {
+    Hash = (Hash ^ ProtocolAddress->AddressPtr[Index]) * 0x01000193;
+  }
+
+  return Hash & (ARP_CACHE_HASH_SIZE - 1);
+}
+
+/**
+  Find the resolved cache entry of a protocol address through the hash index of
+  the ResolvedCacheTable, and mark it as the most recently used one.
+
+  @param[in]  ArpService             Pointer to the arp service context data.
+  @param[in]  ProtocolAddress        Pointer to the protocol address to match.
+
+  @return Pointer to the matched arp cache entry, if NULL, no match is found.
+
+**/
+ARP_CACHE_ENTRY *
+ArpFindResolvedCacheEntry (
+  IN ARP_SERVICE_DATA  *ArpService,
+  IN NET_ARP_ADDRESS   *ProtocolAddress
+  )
+{
+  LIST_ENTRY       *Bucket;
+  LIST_ENTRY       *Entry;
+  ARP_CACHE_ENTRY  *CacheEntry;
+
+  NET_CHECK_SIGNATURE (ArpService, ARP_SERVICE_DATA_SIGNATURE);
+  ASSERT ((ProtocolAddress != NULL) && (ProtocolAddress->AddressPtr != NULL));
+
+  ArpService->CacheLookups++;
+
+  Bucket = &ArpService->ResolvedCacheHash[ArpCacheHash (ProtocolAddress)];
+  NET_LIST_FOR_EACH (Entry, Bucket) {
+    CacheEntry = NET_LIST_USER_STRUCT (Entry, ARP_CACHE_ENTRY, HashLink);
+
+    if (ArpMatchAddress (ProtocolAddress, &CacheEntry->Addresses[Protocol])) {
+      //
+      // Move it to the head of the ResolvedCacheTable, the tail is the least
+      // recently used entry.
+      //
+      RemoveEntryList (&CacheEntry->List);
+      InsertHeadList (&ArpService->ResolvedCacheTable, &CacheEntry->List);
+
+      ArpService->CacheHits++;
+      return CacheEntry;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Insert a cache entry into the ResolvedCacheTable and its hash index. The least
+  recently used dynamic entry is evicted if the table is full.
+
+  @param[in]  ArpService             Pointer to the arp service context data.
+  @param[in]  CacheEntry             Pointer to the cache entry to insert, its
+                                     protocol address must be filled.
+
+**/
+VOID
+ArpInsertResolvedCacheEntry (
+  IN ARP_SERVICE_DATA  *ArpService,
+  IN ARP_CACHE_ENTRY   *CacheEntry
+  )
+{
+  LIST_ENTRY       *Entry;
+  ARP_CACHE_ENTRY  *OldEntry;
+
+  NET_CHECK_SIGNATURE (ArpService, ARP_SERVICE_DATA_SIGNATURE);
+  ASSERT (IsListEmpty (&CacheEntry->HashLink));
+
+  if (ArpService->ResolvedCacheCount >= ARP_MAX_RESOLVED_CACHE_ENTRIES) {
+    //
+    // Evict the least recently used entry. Static entries are never evicted, so
+    // the table may grow beyond the limit if all the entries are static.
+    //
+    for (Entry = ArpService->ResolvedCacheTable.BackLink;
+         Entry != &ArpService->ResolvedCacheTable;
+         Entry = Entry->BackLink)
+    {
+      OldEntry = NET_LIST_USER_STRUCT (Entry, ARP_CACHE_ENTRY, List);
+      if (OldEntry->DefaultDecayTime != 0) {
+        ASSERT (IsListEmpty (&OldEntry->UserRequestList));
+        ArpRemoveCacheEntry (ArpService, OldEntry);
+        FreePool (OldEntry);
+
+        ArpService->CacheEvictions++;
+        break;
+      }
+    }
+  }
+
+  InsertHeadList (&ArpService->ResolvedCacheTable, &CacheEntry->List);
+  InsertHeadList (
+    &ArpService->ResolvedCacheHash[ArpCacheHash (&CacheEntry->Addresses[Protocol])],
+    &CacheEntry->HashLink
+    );
+  ArpService->ResolvedCacheCount++;
+}
+
+/**
+  Remove a cache entry from the cache table it is in, and from the hash index of
+  the ResolvedCacheTable if it is a resolved entry.
+
+  @param[in]  ArpService             Pointer to the arp service context data.
+  @param[in]  CacheEntry             Pointer to the cache entry to remove.
+
+**/
+VOID
+ArpRemoveCacheEntry (
+  IN ARP_SERVICE_DATA  *ArpService,
+  IN ARP_CACHE_ENTRY   *CacheEntry
+  )
+{
+  RemoveEntryList (&CacheEntry->List);
+  InitializeListHead (&CacheEntry->List);
+
+  if (!IsListEmpty (&CacheEntry->HashLink)) {
+    ASSERT (ArpService->ResolvedCacheCount > 0);
+
+    RemoveEntryList (&CacheEntry->HashLink);
+    InitializeListHead (&CacheEntry->HashLink);
+    ArpService->ResolvedCacheCount--;
+  }
+}
+
 /**
   Allocate a cache entry and initialize it.
 
@@ -732,6 +879,7 @@ ArpAllocCacheEntry (
   // Init the lists.
   //
   InitializeListHead (&CacheEntry->List);
+  InitializeListHead (&CacheEntry->HashLink);
   InitializeListHead (&CacheEntry->UserRequestList);
 
   for (Index = 0; Index < 2; Index++) {
@@ -1222,6 +1370,7 @@ CLEAN_EXIT:
   SwAddressType, AddressBuffer combination as the matching key, if Force is TRUE,
   the cache is deleted event it's a static entry.
 
+  @param[in]  ArpService             Pointer to the arp service context data.
   @param[in]  CacheTable             Pointer to the cache table to do the deletion.
   @param[in]  BySwAddress            Delete the cache entry by software address or by
                                      hardware address.
@@ -1235,11 +1384,12 @@ CLEAN_EXIT:
 **/
 UINTN
 ArpDeleteCacheEntryInTable (
-  IN LIST_ENTRY  *CacheTable,
-  IN BOOLEAN     BySwAddress,
-  IN UINT16      SwAddressType,
-  IN UINT8       *AddressBuffer OPTIONAL,
-  IN BOOLEAN     Force
+  IN ARP_SERVICE_DATA  *ArpService,
+  IN LIST_ENTRY        *CacheTable,
+  IN BOOLEAN           BySwAddress,
+  IN UINT16            SwAddressType,
+  IN UINT8             *AddressBuffer OPTIONAL,
+  IN BOOLEAN           Force
   )
 {
   LIST_ENTRY       *Entry;
@@ -1299,7 +1449,7 @@ MATCHED:
     //
     // Delete this entry.
     //
-    RemoveEntryList (&CacheEntry->List);
+    ArpRemoveCacheEntry (ArpService, CacheEntry);
     ASSERT (IsListEmpty (&CacheEntry->UserRequestList));
     FreePool (CacheEntry);
 
@@ -1341,6 +1491,7 @@ ArpDeleteCacheEntry (
   // Delete the cache entries in the DeniedCacheTable.
   //
   Count = ArpDeleteCacheEntryInTable (
+            ArpService,
             &ArpService->DeniedCacheTable,
             BySwAddress,
             Instance->ConfigData.SwAddressType,
@@ -1352,6 +1503,7 @@ ArpDeleteCacheEntry (
   // Delete the cache entries in the ResolvedCacheTable.
   //
   Count += ArpDeleteCacheEntryInTable (
+             ArpService,
              &ArpService->ResolvedCacheTable,
              BySwAddress,
              Instance->ConfigData.SwAddressType,
@@ -46,6 +46,14 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define ARP_DEFAULT_RETRY_INTERVAL   (5   * TICKS_PER_MS)
 #define ARP_PERIODIC_TIMER_INTERVAL  (500 * TICKS_PER_MS)
 
+//
+// Size of the hash index over the ResolvedCacheTable, must be a power of 2, and
+// the maximum number of dynamic entries kept in the ResolvedCacheTable before the
+// least recently used one is evicted.
+//
+#define ARP_CACHE_HASH_SIZE             256
+#define ARP_MAX_RESOLVED_CACHE_ENTRIES  1024
+
 //
 // ARP packet head definition.
 //
@@ -163,6 +171,16 @@ struct _ARP_SERVICE_DATA {
   LIST_ENTRY                              DeniedCacheTable;
   LIST_ENTRY                              ResolvedCacheTable;
 
+  //
+  // Hash index of the ResolvedCacheTable keyed by the protocol address. The
+  // ResolvedCacheTable itself is kept in most recently used order.
+  //
+  LIST_ENTRY                              ResolvedCacheHash[ARP_CACHE_HASH_SIZE];
+  UINTN                                   ResolvedCacheCount;
+  UINT64                                  CacheLookups;
+  UINT64                                  CacheHits;
+  UINT64                                  CacheEvictions;
+
   EFI_EVENT                               PeriodicTimer;
 };
 
@@ -207,6 +225,7 @@ typedef enum {
 //
 typedef struct {
   LIST_ENTRY         List;
+  LIST_ENTRY         HashLink;
 
   UINT32             RetryCount;
   UINT32             DefaultDecayTime;
@@ -528,6 +547,51 @@ ArpFindNextCacheEntryInTable (
   IN NET_ARP_ADDRESS  *HardwareAddress OPTIONAL
   );
 
+/**
+  Find the resolved cache entry of a protocol address through the hash index of
+  the ResolvedCacheTable, and mark it as the most recently used one.
+
+  @param[in]  ArpService             Pointer to the arp service context data.
+  @param[in]  ProtocolAddress        Pointer to the protocol address to match.
+
+  @return Pointer to the matched arp cache entry, if NULL, no match is found.
+
+**/
+ARP_CACHE_ENTRY *
+ArpFindResolvedCacheEntry (
+  IN ARP_SERVICE_DATA  *ArpService,
+  IN NET_ARP_ADDRESS   *ProtocolAddress
+  );
+
+/**
+  Insert a cache entry into the ResolvedCacheTable and its hash index. The least
+  recently used dynamic entry is evicted if the table is full.
+
+  @param[in]  ArpService             Pointer to the arp service context data.
+  @param[in]  CacheEntry             Pointer to the cache entry to insert, its
+                                     protocol address must be filled.
+
+**/
+VOID
+ArpInsertResolvedCacheEntry (
+  IN ARP_SERVICE_DATA  *ArpService,
+  IN ARP_CACHE_ENTRY   *CacheEntry
+  );
+
+/**
+  Remove a cache entry from the cache table it is in, and from the hash index of
+  the ResolvedCacheTable if it is a resolved entry.
+
+  @param[in]  ArpService             Pointer to the arp service context data.
+  @param[in]  CacheEntry             Pointer to the cache entry to remove.
+
+**/
+VOID
+ArpRemoveCacheEntry (
+  IN ARP_SERVICE_DATA  *ArpService,
+  IN ARP_CACHE_ENTRY   *CacheEntry
+  );
+
 /**
   Allocate a cache entry and initialize it.
 
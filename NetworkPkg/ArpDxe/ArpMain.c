@@ -221,7 +221,7 @@ ArpAdd (
     //
     // Remove it from the Table.
     //
-    RemoveEntryList (&CacheEntry->List);
+    ArpRemoveCacheEntry (ArpService, CacheEntry);
   } else {
     //
     // It's a new entry, allocate memory for the entry.
@@ -261,7 +261,7 @@ ArpAdd (
   if (DenyFlag) {
     InsertHeadList (&ArpService->DeniedCacheTable, &CacheEntry->List);
   } else {
-    InsertHeadList (&ArpService->ResolvedCacheTable, &CacheEntry->List);
+    ArpInsertResolvedCacheEntry (ArpService, CacheEntry);
   }
 
 UNLOCK_EXIT:
@@ -559,13 +559,7 @@ ArpRequest (
   //
   // Check whether the software address is already resolved.
   //
-  CacheEntry = ArpFindNextCacheEntryInTable (
-                 &ArpService->ResolvedCacheTable,
-                 NULL,
-                 ByProtoAddress,
-                 &ProtocolAddress,
-                 NULL
-                 );
+  CacheEntry = ArpFindResolvedCacheEntry (ArpService, &ProtocolAddress);
   if (CacheEntry != NULL) {
     //
     // Resolved, copy the address into the user buffer.
@@ -195,6 +195,13 @@ DnsDestroyService (
   IN DNS_SERVICE  *DnsSb
   )
 {
+  //
+  // The DNS children of the prefetches are gone with the other children.
+  //
+  while (!IsListEmpty (&DnsSb->PrefetchList)) {
+    DnsFreePrefetch (NET_LIST_HEAD (&DnsSb->PrefetchList, DNS_PREFETCH, Link));
+  }
+
   UdpIoFreeIo (DnsSb->ConnectUdp);
 
   if (DnsSb->TimerToGetMap != NULL) {
@@ -269,6 +276,8 @@ DnsCreateService (
 
   DnsSb->IpVersion = IpVersion;
 
+  InitializeListHead (&DnsSb->PrefetchList);
+
   //
   // Create the timer used to time out the procedure which is used to
   // get the default IP address.
@@ -343,11 +352,12 @@ DnsUnload (
 {
   EFI_STATUS  Status;
 
-  LIST_ENTRY      *Entry;
-  DNS4_CACHE      *ItemCache4;
-  DNS4_SERVER_IP  *ItemServerIp4;
-  DNS6_CACHE      *ItemCache6;
-  DNS6_SERVER_IP  *ItemServerIp6;
+  LIST_ENTRY          *Entry;
+  DNS4_CACHE          *ItemCache4;
+  DNS4_SERVER_IP      *ItemServerIp4;
+  DNS6_CACHE          *ItemCache6;
+  DNS6_SERVER_IP      *ItemServerIp6;
+  DNS_NEGATIVE_CACHE  *ItemNegative;
 
   ItemCache4    = NULL;
   ItemServerIp4 = NULL;
@@ -402,6 +412,15 @@ DnsUnload (
       FreePool (ItemServerIp6);
     }
 
+    while (!IsListEmpty (&mDriverData->DnsNegativeCacheList)) {
+      Entry = NetListRemoveHead (&mDriverData->DnsNegativeCacheList);
+      ASSERT (Entry != NULL);
+      mDriverData->DnsNegativeCacheNum--;
+      ItemNegative = NET_LIST_USER_STRUCT (Entry, DNS_NEGATIVE_CACHE, AllCacheLink);
+      FreePool (ItemNegative->HostName);
+      FreePool (ItemNegative);
+    }
+
     FreePool (mDriverData);
   }
 
@@ -427,6 +446,7 @@ DnsDriverEntryPoint (
   )
 {
   EFI_STATUS  Status;
+  UINTN       Index;
 
   Status = EFI_SUCCESS;
 
@@ -492,6 +512,12 @@ DnsDriverEntryPoint (
   InitializeListHead (&mDriverData->Dns4ServerList);
   InitializeListHead (&mDriverData->Dns6CacheList);
   InitializeListHead (&mDriverData->Dns6ServerList);
+  InitializeListHead (&mDriverData->DnsNegativeCacheList);
+
+  for (Index = 0; Index < DNS_CACHE_HASH_SIZE; Index++) {
+    InitializeListHead (&mDriverData->Dns4CacheHash[Index]);
+    InitializeListHead (&mDriverData->Dns6CacheHash[Index]);
+  }
 
   return Status;
 
@@ -1284,6 +1310,7 @@ Dns4ServiceBindingDestroyChild (
 
   RemoveEntryList (&Instance->Link);
   DnsSb->Dns4ChildrenNum--;
+  DnsPrefetchChildDestroyed (DnsSb, ChildHandle);
 
   gBS->RestoreTPL (OldTpl);
 
@@ -1528,6 +1555,7 @@ Dns6ServiceBindingDestroyChild (
 
   RemoveEntryList (&Instance->Link);
   DnsSb->Dns6ChildrenNum--;
+  DnsPrefetchChildDestroyed (DnsSb, ChildHandle);
 
   gBS->RestoreTPL (OldTpl);
 
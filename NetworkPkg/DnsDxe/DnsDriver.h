@@ -31,14 +31,24 @@ typedef struct _DNS_INSTANCE DNS_INSTANCE;
 
 #define DNS_INSTANCE_SIGNATURE  SIGNATURE_32 ('D', 'N', 'S', 'I')
 
+///
+/// Number of host name hash buckets of each DNS cache, must be a power of 2.
+///
+#define DNS_CACHE_HASH_SIZE  64
+
 struct _DNS_DRIVER_DATA {
   EFI_EVENT     Timer;                 /// Ticking timer for DNS cache update.
 
   LIST_ENTRY    Dns4CacheList;
+  LIST_ENTRY    Dns4CacheHash[DNS_CACHE_HASH_SIZE]; /// Dns4CacheList indexed by host name.
   LIST_ENTRY    Dns4ServerList;
 
   LIST_ENTRY    Dns6CacheList;
+  LIST_ENTRY    Dns6CacheHash[DNS_CACHE_HASH_SIZE]; /// Dns6CacheList indexed by host name.
   LIST_ENTRY    Dns6ServerList;
+
+  LIST_ENTRY    DnsNegativeCacheList;  /// Host names reported as nonexistent, most recently used first.
+  UINTN         DnsNegativeCacheNum;
 };
 
 struct _DNS_SERVICE {
@@ -60,6 +70,8 @@ struct _DNS_SERVICE {
 
   UINT8                           IpVersion;
   UDP_IO                          *ConnectUdp;
+
+  LIST_ENTRY                      PrefetchList; /// Background refreshes of cached records.
 };
 
 struct _DNS_INSTANCE {
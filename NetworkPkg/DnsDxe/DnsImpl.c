@@ -767,17 +767,19 @@ UpdateDns4Cache (
 {
   DNS4_CACHE  *NewDnsCache;
   DNS4_CACHE  *Item;
+  LIST_ENTRY  *Bucket;
   LIST_ENTRY  *Entry;
   LIST_ENTRY  *Next;
 
   NewDnsCache = NULL;
   Item        = NULL;
+  Bucket      = &mDriverData->Dns4CacheHash[DnsCacheHash (DnsCacheEntry.HostName)];
 
   //
   // Search the database for the matching EFI_DNS_CACHE_ENTRY
   //
-  NET_LIST_FOR_EACH_SAFE (Entry, Next, Dns4CacheList) {
-    Item = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, AllCacheLink);
+  NET_LIST_FOR_EACH_SAFE (Entry, Next, Bucket) {
+    Item = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, HashLink);
     if ((StrCmp (DnsCacheEntry.HostName, Item->DnsCache.HostName) == 0) && \
         (CompareMem (DnsCacheEntry.IpAddress, Item->DnsCache.IpAddress, sizeof (EFI_IPv4_ADDRESS)) == 0))
     {
@@ -789,6 +791,7 @@ UpdateDns4Cache (
         // Delete matching DNS Cache entry
         //
         RemoveEntryList (&Item->AllCacheLink);
+        RemoveEntryList (&Item->HashLink);
 
         FreePool (Item->DnsCache.HostName);
         FreePool (Item->DnsCache.IpAddress);
@@ -800,6 +803,7 @@ UpdateDns4Cache (
         // Update this one
         //
         Item->DnsCache.Timeout = DnsCacheEntry.Timeout;
+        Item->Prefetching      = FALSE;
 
         return EFI_SUCCESS;
       } else {
@@ -811,12 +815,13 @@ UpdateDns4Cache (
   //
   // Add new one
   //
-  NewDnsCache = AllocatePool (sizeof (DNS4_CACHE));
+  NewDnsCache = AllocateZeroPool (sizeof (DNS4_CACHE));
   if (NewDnsCache == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
 
   InitializeListHead (&NewDnsCache->AllCacheLink);
+  InitializeListHead (&NewDnsCache->HashLink);
 
   NewDnsCache->DnsCache.HostName = AllocatePool (StrSize (DnsCacheEntry.HostName));
   if (NewDnsCache->DnsCache.HostName == NULL) {
@@ -838,6 +843,12 @@ UpdateDns4Cache (
   NewDnsCache->DnsCache.Timeout = DnsCacheEntry.Timeout;
 
   InsertTailList (Dns4CacheList, &NewDnsCache->AllCacheLink);
+  InsertTailList (Bucket, &NewDnsCache->HashLink);
+
+  //
+  // The host name resolves now, forget any earlier NXDOMAIN answer.
+  //
+  DnsRemoveNegativeCache (DnsCacheEntry.HostName);
 
   return EFI_SUCCESS;
 }
@@ -866,17 +877,19 @@ UpdateDns6Cache (
 {
   DNS6_CACHE  *NewDnsCache;
   DNS6_CACHE  *Item;
+  LIST_ENTRY  *Bucket;
   LIST_ENTRY  *Entry;
   LIST_ENTRY  *Next;
 
   NewDnsCache = NULL;
   Item        = NULL;
+  Bucket      = &mDriverData->Dns6CacheHash[DnsCacheHash (DnsCacheEntry.HostName)];
 
   //
   // Search the database for the matching EFI_DNS_CACHE_ENTRY
   //
-  NET_LIST_FOR_EACH_SAFE (Entry, Next, Dns6CacheList) {
-    Item = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, AllCacheLink);
+  NET_LIST_FOR_EACH_SAFE (Entry, Next, Bucket) {
+    Item = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, HashLink);
     if ((StrCmp (DnsCacheEntry.HostName, Item->DnsCache.HostName) == 0) && \
         (CompareMem (DnsCacheEntry.IpAddress, Item->DnsCache.IpAddress, sizeof (EFI_IPv6_ADDRESS)) == 0))
     {
@@ -888,6 +901,7 @@ UpdateDns6Cache (
         // Delete matching DNS Cache entry
         //
         RemoveEntryList (&Item->AllCacheLink);
+        RemoveEntryList (&Item->HashLink);
 
         FreePool (Item->DnsCache.HostName);
         FreePool (Item->DnsCache.IpAddress);
@@ -899,6 +913,7 @@ UpdateDns6Cache (
         // Update this one
         //
         Item->DnsCache.Timeout = DnsCacheEntry.Timeout;
+        Item->Prefetching      = FALSE;
 
         return EFI_SUCCESS;
       } else {
@@ -910,12 +925,13 @@ UpdateDns6Cache (
   //
   // Add new one
   //
-  NewDnsCache = AllocatePool (sizeof (DNS6_CACHE));
+  NewDnsCache = AllocateZeroPool (sizeof (DNS6_CACHE));
   if (NewDnsCache == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
 
   InitializeListHead (&NewDnsCache->AllCacheLink);
+  InitializeListHead (&NewDnsCache->HashLink);
 
   NewDnsCache->DnsCache.HostName = AllocatePool (StrSize (DnsCacheEntry.HostName));
   if (NewDnsCache->DnsCache.HostName == NULL) {
@@ -937,8 +953,549 @@ UpdateDns6Cache (
   NewDnsCache->DnsCache.Timeout = DnsCacheEntry.Timeout;
 
   InsertTailList (Dns6CacheList, &NewDnsCache->AllCacheLink);
+  InsertTailList (Bucket, &NewDnsCache->HashLink);
+
+  //
+  // The host name resolves now, forget any earlier NXDOMAIN answer.
+  //
+  DnsRemoveNegativeCache (DnsCacheEntry.HostName);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Compute the DNS cache hash bucket of a host name.
+
+  @param  HostName           Host name to hash.
+
+  @return The index of the bucket in the DNS cache hash tables.
+
+**/
+UINTN
+DnsCacheHash (
+  IN CHAR16  *HostName
+  )
+{
+  UINT32  Hash;
+
+  //
+  // FNV-1a. Host names are hashed case sensitively, the same way they are
+  // compared by the cache lookups.
+  //
+  Hash = 0x811C9DC5;
+  while (*HostName != L'\0') {
+    Hash = (Hash ^ *HostName) * 0x01000193;
+    HostName++;
+  }
+
+  return Hash & (DNS_CACHE_HASH_SIZE - 1);
+}
+
+/**
+  Find the negative cache entry of a host name and make it the most recently
+  used.
+
+  @param  HostName           Host name to look up.
+
+  @return The negative cache entry, or NULL if not found.
+
+**/
+STATIC
+DNS_NEGATIVE_CACHE *
+DnsFindNegativeCache (
+  IN CHAR16  *HostName
+  )
+{
+  LIST_ENTRY          *Entry;
+  DNS_NEGATIVE_CACHE  *Item;
+
+  NET_LIST_FOR_EACH (Entry, &mDriverData->DnsNegativeCacheList) {
+    Item = NET_LIST_USER_STRUCT (Entry, DNS_NEGATIVE_CACHE, AllCacheLink);
+    if (StrCmp (HostName, Item->HostName) == 0) {
+      RemoveEntryList (&Item->AllCacheLink);
+      InsertHeadList (&mDriverData->DnsNegativeCacheList, &Item->AllCacheLink);
+      return Item;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Remove a negative cache entry and free it.
+
+  @param  Item               The negative cache entry.
+
+**/
+STATIC
+VOID
+DnsFreeNegativeCache (
+  IN DNS_NEGATIVE_CACHE  *Item
+  )
+{
+  RemoveEntryList (&Item->AllCacheLink);
+  mDriverData->DnsNegativeCacheNum--;
+  FreePool (Item->HostName);
+  FreePool (Item);
+}
+
+/**
+  Record a host name that the DNS server reported as nonexistent (NXDOMAIN).
+
+  The number of entries is bounded, as any peer answering a query can add
+  one, the least recently used entry is evicted to make room.
+
+  @param  HostName           Host name which does not exist.
+  @param  Timeout            Lifetime of the entry in seconds.
+
+  @retval EFI_SUCCESS        The negative cache entry was added or refreshed.
+  @retval Others             Failed to update the negative cache.
+
+**/
+EFI_STATUS
+DnsAddNegativeCache (
+  IN CHAR16  *HostName,
+  IN UINT32  Timeout
+  )
+{
+  DNS_NEGATIVE_CACHE  *Item;
+
+  Item = DnsFindNegativeCache (HostName);
+  if (Item != NULL) {
+    Item->Timeout = Timeout;
+    return EFI_SUCCESS;
+  }
+
+  if (mDriverData->DnsNegativeCacheNum >= DNS_NEGATIVE_CACHE_MAX_ENTRIES) {
+    DnsFreeNegativeCache (
+      NET_LIST_TAIL (&mDriverData->DnsNegativeCacheList, DNS_NEGATIVE_CACHE, AllCacheLink)
+      );
+  }
+
+  Item = AllocateZeroPool (sizeof (DNS_NEGATIVE_CACHE));
+  if (Item == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Item->HostName = AllocateCopyPool (StrSize (HostName), HostName);
+  if (Item->HostName == NULL) {
+    FreePool (Item);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Item->Timeout = Timeout;
+  InsertHeadList (&mDriverData->DnsNegativeCacheList, &Item->AllCacheLink);
+  mDriverData->DnsNegativeCacheNum++;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Remove the negative cache entry of a host name, if any.
+
+  @param  HostName           Host name which is known to exist.
+
+**/
+VOID
+DnsRemoveNegativeCache (
+  IN CHAR16  *HostName
+  )
+{
+  DNS_NEGATIVE_CACHE  *Item;
+
+  Item = DnsFindNegativeCache (HostName);
+  if (Item != NULL) {
+    DnsFreeNegativeCache (Item);
+  }
+}
+
+/**
+  Check whether a host name is recorded in the negative cache.
+
+  @param  HostName           Host name to look up.
+
+  @retval TRUE               The host name is known not to exist.
+  @retval FALSE              The host name is not in the negative cache.
+
+**/
+BOOLEAN
+DnsIsInNegativeCache (
+  IN CHAR16  *HostName
+  )
+{
+  return (BOOLEAN)(DnsFindNegativeCache (HostName) != NULL);
+}
+
+/**
+  Get the negative caching lifetime of an NXDOMAIN response.
+
+  As described in RFC 2308, the lifetime is the smaller of the TTL and the
+  MINIMUM field of the SOA record carried in the authority section. Responses
+  without such a record are not cached.
+
+  @param  DnsHeader          The header of the response, in host byte order.
+  @param  AuthorityName      The start of the authority section.
+  @param  RemainingLength    The number of bytes left in the response.
+
+  @return The lifetime in seconds, or 0 if the response must not be cached.
+
+**/
+STATIC
+UINT32
+DnsGetNegativeCacheTimeout (
+  IN DNS_HEADER  *DnsHeader,
+  IN UINT8       *AuthorityName,
+  IN UINT32      RemainingLength
+  )
+{
+  DNS_ANSWER_SECTION  *AuthoritySection;
+  UINT32              NameLength;
+  UINT16              DataLength;
+  UINT32              Minimum;
+
+  if ((DnsHeader->AnswersNum != 0) || (DnsHeader->AuthorityNum < 1)) {
+    return 0;
+  }
+
+  //
+  // Skip the owner name, either a compression pointer or a sequence of labels.
+  //
+  NameLength = 0;
+  while (TRUE) {
+    if (NameLength >= RemainingLength) {
+      return 0;
+    }
+
+    if ((AuthorityName[NameLength] & 0xC0) == 0xC0) {
+      NameLength += sizeof (UINT16);
+      break;
+    }
+
+    if (AuthorityName[NameLength] == 0) {
+      NameLength++;
+      break;
+    }
+
+    NameLength += AuthorityName[NameLength] + 1;
+  }
+
+  if (RemainingLength < NameLength + sizeof (DNS_ANSWER_SECTION)) {
+    return 0;
+  }
+
+  RemainingLength -= NameLength + sizeof (DNS_ANSWER_SECTION);
+
+  AuthoritySection = (DNS_ANSWER_SECTION *)(AuthorityName + NameLength);
+  DataLength       = NTOHS (AuthoritySection->DataLength);
+
+  //
+  // SOA RDATA ends with the SERIAL, REFRESH, RETRY, EXPIRE and MINIMUM fields.
+  //
+  if ((NTOHS (AuthoritySection->Type) != DNS_TYPE_SOA) ||
+      (DataLength < 5 * sizeof (UINT32)) || (DataLength > RemainingLength))
+  {
+    return 0;
+  }
+
+  Minimum = NTOHL (ReadUnaligned32 ((UINT32 *)((UINT8 *)(AuthoritySection + 1) + DataLength - sizeof (UINT32))));
+
+  return MIN (MIN (NTOHL (AuthoritySection->Ttl), Minimum), DNS_NEGATIVE_CACHE_MAX_TIMEOUT);
+}
+
+/**
+  Set or clear the prefetching flag of the cached records of a host name.
+
+  @param  IpVersion          The IP version of the DNS cache.
+  @param  HostName           Host name of the records.
+  @param  Prefetching        Whether a background refresh is in flight.
+
+**/
+STATIC
+VOID
+DnsSetPrefetching (
+  IN UINT8    IpVersion,
+  IN CHAR16   *HostName,
+  IN BOOLEAN  Prefetching
+  )
+{
+  LIST_ENTRY  *Bucket;
+  LIST_ENTRY  *Entry;
+  DNS4_CACHE  *Item4;
+  DNS6_CACHE  *Item6;
+
+  if (IpVersion == IP_VERSION_4) {
+    Bucket = &mDriverData->Dns4CacheHash[DnsCacheHash (HostName)];
+    NET_LIST_FOR_EACH (Entry, Bucket) {
+      Item4 = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, HashLink);
+      if (StrCmp (HostName, Item4->DnsCache.HostName) == 0) {
+        Item4->Prefetching = Prefetching;
+      }
+    }
+  } else {
+    Bucket = &mDriverData->Dns6CacheHash[DnsCacheHash (HostName)];
+    NET_LIST_FOR_EACH (Entry, Bucket) {
+      Item6 = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, HashLink);
+      if (StrCmp (HostName, Item6->DnsCache.HostName) == 0) {
+        Item6->Prefetching = Prefetching;
+      }
+    }
+  }
+}
+
+/**
+  Mark a prefetch as over once its query completes, times out or is canceled.
+
+  The DNS child of the prefetch can not be destroyed from its own token
+  notification, it is released by the next DnsOnTimerRetransmit() tick.
+
+  @param  Event              The event signaled.
+  @param  Context            The prefetch.
+
+**/
+STATIC
+VOID
+EFIAPI
+DnsOnPrefetchDone (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  DNS_PREFETCH  *Prefetch;
+
+  Prefetch = (DNS_PREFETCH *)Context;
+  if (Prefetch->Done) {
+    return;
+  }
+
+  //
+  // ParseDnsResponse() has already refreshed the cache on success. Either way
+  // the host name may be prefetched again.
+  //
+  Prefetch->Done = TRUE;
+  DnsSetPrefetching (Prefetch->Service->IpVersion, Prefetch->HostName, FALSE);
+}
+
+/**
+  Refresh the cached records of a host name in the background.
+
+  The query is issued on a DNS child created for it by the DNS service, so it
+  is not aborted when the caller's instance is reset or destroyed. It uses the
+  DNS server of the caller's instance.
+
+  @param  Instance           The DNS instance whose lookup hit the cache.
+  @param  HostName           Host name of the records to refresh.
+
+  @retval EFI_SUCCESS        The refresh query was sent.
+  @retval Others             Failed to send the refresh query.
+
+**/
+EFI_STATUS
+DnsStartPrefetch (
+  IN DNS_INSTANCE  *Instance,
+  IN CHAR16        *HostName
+  )
+{
+  EFI_STATUS            Status;
+  DNS_SERVICE           *Service;
+  DNS_PREFETCH          *Prefetch;
+  EFI_DNS4_PROTOCOL     *Dns4;
+  EFI_DNS6_PROTOCOL     *Dns6;
+  EFI_DNS4_CONFIG_DATA  Dns4CfgData;
+  EFI_DNS6_CONFIG_DATA  Dns6CfgData;
+
+  Service = Instance->Service;
+
+  Prefetch = AllocateZeroPool (sizeof (DNS_PREFETCH));
+  if (Prefetch == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Prefetch->Service  = Service;
+  Prefetch->HostName = AllocateCopyPool (StrSize (HostName), HostName);
+  if (Prefetch->HostName == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ON_ERROR;
+  }
+
+  Status = gBS->CreateEvent (
+                  EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  DnsOnPrefetchDone,
+                  Prefetch,
+                  &Prefetch->Event
+                  );
+  if (EFI_ERROR (Status)) {
+    goto ON_ERROR;
+  }
+
+  Status = Service->ServiceBinding.CreateChild (&Service->ServiceBinding, &Prefetch->ChildHandle);
+  if (EFI_ERROR (Status)) {
+    goto ON_ERROR;
+  }
+
+  //
+  // Use the DNS server of the caller's instance rather than retrieving one
+  // from DHCP again, and skip the cache lookup, which would only return the
+  // records being refreshed. The answer updates the cache regardless.
+  //
+  if (Service->IpVersion == IP_VERSION_4) {
+    Status = gBS->OpenProtocol (
+                    Prefetch->ChildHandle,
+                    &gEfiDns4ProtocolGuid,
+                    (VOID **)&Dns4,
+                    Service->ImageHandle,
+                    Prefetch->ChildHandle,
+                    EFI_OPEN_PROTOCOL_GET_PROTOCOL
+                    );
+    if (EFI_ERROR (Status)) {
+      goto ON_ERROR;
+    }
+
+    CopyMem (&Dns4CfgData, &Instance->Dns4CfgData, sizeof (EFI_DNS4_CONFIG_DATA));
+    Dns4CfgData.DnsServerListCount = 1;
+    Dns4CfgData.DnsServerList      = &Instance->SessionDnsServer.v4;
+    Dns4CfgData.EnableDnsCache     = FALSE;
+    Dns4CfgData.LocalPort          = 0;
+
+    Status = Dns4->Configure (Dns4, &Dns4CfgData);
+    if (EFI_ERROR (Status)) {
+      goto ON_ERROR;
+    }
+
+    Prefetch->Dns4Token.Event = Prefetch->Event;
+    Status                    = Dns4->HostNameToIp (Dns4, HostName, &Prefetch->Dns4Token);
+  } else {
+    Status = gBS->OpenProtocol (
+                    Prefetch->ChildHandle,
+                    &gEfiDns6ProtocolGuid,
+                    (VOID **)&Dns6,
+                    Service->ImageHandle,
+                    Prefetch->ChildHandle,
+                    EFI_OPEN_PROTOCOL_GET_PROTOCOL
+                    );
+    if (EFI_ERROR (Status)) {
+      goto ON_ERROR;
+    }
+
+    CopyMem (&Dns6CfgData, &Instance->Dns6CfgData, sizeof (EFI_DNS6_CONFIG_DATA));
+    Dns6CfgData.DnsServerCount = 1;
+    Dns6CfgData.DnsServerList  = &Instance->SessionDnsServer.v6;
+    Dns6CfgData.EnableDnsCache = FALSE;
+    Dns6CfgData.LocalPort      = 0;
+
+    Status = Dns6->Configure (Dns6, &Dns6CfgData);
+    if (EFI_ERROR (Status)) {
+      goto ON_ERROR;
+    }
+
+    Prefetch->Dns6Token.Event = Prefetch->Event;
+    Status                    = Dns6->HostNameToIp (Dns6, HostName, &Prefetch->Dns6Token);
+  }
+
+  if (EFI_ERROR (Status)) {
+    goto ON_ERROR;
+  }
+
+  InsertTailList (&Service->PrefetchList, &Prefetch->Link);
+  DnsSetPrefetching (Service->IpVersion, HostName, TRUE);
 
   return EFI_SUCCESS;
+
+ON_ERROR:
+  if (Prefetch->ChildHandle != NULL) {
+    Service->ServiceBinding.DestroyChild (&Service->ServiceBinding, Prefetch->ChildHandle);
+  }
+
+  if (Prefetch->Event != NULL) {
+    gBS->CloseEvent (Prefetch->Event);
+  }
+
+  if (Prefetch->HostName != NULL) {
+    FreePool (Prefetch->HostName);
+  }
+
+  FreePool (Prefetch);
+  return Status;
+}
+
+/**
+  Release a prefetch, destroying its DNS child if it still exists.
+
+  @param  Prefetch           The prefetch to release.
+
+**/
+VOID
+DnsFreePrefetch (
+  IN DNS_PREFETCH  *Prefetch
+  )
+{
+  DNS_SERVICE             *Service;
+  DNS_HOST_TO_ADDR_DATA   *H2AData4;
+  DNS6_HOST_TO_ADDR_DATA  *H2AData6;
+
+  Service = Prefetch->Service;
+  RemoveEntryList (&Prefetch->Link);
+
+  if (Prefetch->ChildHandle != NULL) {
+    Service->ServiceBinding.DestroyChild (&Service->ServiceBinding, Prefetch->ChildHandle);
+  }
+
+  //
+  // Closing the event drops a notification left pending by DestroyChild(), so
+  // clear the prefetching flag here as well.
+  //
+  gBS->CloseEvent (Prefetch->Event);
+  if (!Prefetch->Done) {
+    DnsSetPrefetching (Service->IpVersion, Prefetch->HostName, FALSE);
+  }
+
+  if (Service->IpVersion == IP_VERSION_4) {
+    H2AData4 = Prefetch->Dns4Token.RspData.H2AData;
+    if (H2AData4 != NULL) {
+      if (H2AData4->IpList != NULL) {
+        FreePool (H2AData4->IpList);
+      }
+
+      FreePool (H2AData4);
+    }
+  } else {
+    H2AData6 = Prefetch->Dns6Token.RspData.H2AData;
+    if (H2AData6 != NULL) {
+      if (H2AData6->IpList != NULL) {
+        FreePool (H2AData6->IpList);
+      }
+
+      FreePool (H2AData6);
+    }
+  }
+
+  FreePool (Prefetch->HostName);
+  FreePool (Prefetch);
+}
+
+/**
+  Forget the DNS child of a prefetch which is destroyed by someone else, e.g.
+  by the Stop() function of the driver binding.
+
+  @param  Service            The DNS service.
+  @param  ChildHandle        The handle of the DNS child being destroyed.
+
+**/
+VOID
+DnsPrefetchChildDestroyed (
+  IN DNS_SERVICE  *Service,
+  IN EFI_HANDLE   ChildHandle
+  )
+{
+  LIST_ENTRY    *Entry;
+  DNS_PREFETCH  *Prefetch;
+
+  NET_LIST_FOR_EACH (Entry, &Service->PrefetchList) {
+    Prefetch = NET_LIST_USER_STRUCT (Entry, DNS_PREFETCH, Link);
+    if (Prefetch->ChildHandle == ChildHandle) {
+      Prefetch->ChildHandle = NULL;
+    }
+  }
 }
 
 /**
@@ -1145,6 +1702,7 @@ ParseDnsResponse (
   UINT32  RRCount;
   UINT32  AnswerSectionNum;
   UINT32  CNameTtl;
+  UINT32  NegativeTimeout;
 
   EFI_IPv4_ADDRESS  *HostAddr4;
   EFI_IPv6_ADDRESS  *HostAddr6;
@@ -1287,6 +1845,19 @@ ParseDnsResponse (
     //
     if (DnsHeader->Flags.Bits.RCode == DNS_FLAGS_RCODE_NAME_ERROR) {
       Status = EFI_NOT_FOUND;
+
+      //
+      // Remember the nonexistent host name, so that repeated lookups are answered
+      // locally for as long as the zone allows negative caching.
+      //
+      NegativeTimeout = DnsGetNegativeCacheTimeout (DnsHeader, (UINT8 *)(QuerySection + 1), RemainingLength);
+      if (NegativeTimeout != 0) {
+        if ((Dns4TokenEntry != NULL) && !Dns4TokenEntry->GeneralLookUp && (Dns4TokenEntry->QueryHostName != NULL)) {
+          DnsAddNegativeCache (Dns4TokenEntry->QueryHostName, NegativeTimeout);
+        } else if ((Dns6TokenEntry != NULL) && !Dns6TokenEntry->GeneralLookUp && (Dns6TokenEntry->QueryHostName != NULL)) {
+          DnsAddNegativeCache (Dns6TokenEntry->QueryHostName, NegativeTimeout);
+        }
+      }
     } else {
       Status = EFI_DEVICE_ERROR;
     }
@@ -1537,7 +2108,12 @@ ParseDnsResponse (
             Dns4CacheEntry->Timeout = MAX (CNameTtl, AnswerSection->Ttl);
           }
 
-          UpdateDns4Cache (&mDriverData->Dns4CacheList, FALSE, TRUE, *Dns4CacheEntry);
+          //
+          // A zero TTL means the record must not be cached.
+          //
+          if (Dns4CacheEntry->Timeout != 0) {
+            UpdateDns4Cache (&mDriverData->Dns4CacheList, FALSE, TRUE, *Dns4CacheEntry);
+          }
 
           //
           // Free allocated CacheEntry pool.
@@ -1599,7 +2175,12 @@ ParseDnsResponse (
             Dns6CacheEntry->Timeout = MAX (CNameTtl, AnswerSection->Ttl);
           }
 
-          UpdateDns6Cache (&mDriverData->Dns6CacheList, FALSE, TRUE, *Dns6CacheEntry);
+          //
+          // A zero TTL means the record must not be cached.
+          //
+          if (Dns6CacheEntry->Timeout != 0) {
+            UpdateDns6Cache (&mDriverData->Dns6CacheList, FALSE, TRUE, *Dns6CacheEntry);
+          }
 
           //
           // Free allocated CacheEntry pool.
@@ -2101,12 +2682,23 @@ DnsOnTimerRetransmit (
   NET_MAP_ITEM      *ItemNetMap;
   DNS4_TOKEN_ENTRY  *Dns4TokenEntry;
   DNS6_TOKEN_ENTRY  *Dns6TokenEntry;
+  DNS_PREFETCH      *Prefetch;
 
   Dns4TokenEntry = NULL;
   Dns6TokenEntry = NULL;
 
   Service = (DNS_SERVICE *)Context;
 
+  //
+  // Release the prefetches which are over, outside of their token notification.
+  //
+  NET_LIST_FOR_EACH_SAFE (Entry, Next, &Service->PrefetchList) {
+    Prefetch = NET_LIST_USER_STRUCT (Entry, DNS_PREFETCH, Link);
+    if (Prefetch->Done) {
+      DnsFreePrefetch (Prefetch);
+    }
+  }
+
   if (Service->IpVersion == IP_VERSION_4) {
     //
     // Iterate through all the children of the DNS service instance. Time
@@ -2212,10 +2804,11 @@ DnsOnTimerUpdate (
   IN VOID       *Context
   )
 {
-  LIST_ENTRY  *Entry;
-  LIST_ENTRY  *Next;
-  DNS4_CACHE  *Item4;
-  DNS6_CACHE  *Item6;
+  LIST_ENTRY          *Entry;
+  LIST_ENTRY          *Next;
+  DNS4_CACHE          *Item4;
+  DNS6_CACHE          *Item6;
+  DNS_NEGATIVE_CACHE  *ItemNegative;
 
   Item4 = NULL;
   Item6 = NULL;
@@ -2233,6 +2826,7 @@ DnsOnTimerUpdate (
     Item4 = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, AllCacheLink);
     if (Item4->DnsCache.Timeout == 0) {
       RemoveEntryList (&Item4->AllCacheLink);
+      RemoveEntryList (&Item4->HashLink);
       FreePool (Item4->DnsCache.HostName);
       FreePool (Item4->DnsCache.IpAddress);
       FreePool (Item4);
@@ -2255,6 +2849,7 @@ DnsOnTimerUpdate (
     Item6 = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, AllCacheLink);
     if (Item6->DnsCache.Timeout == 0) {
       RemoveEntryList (&Item6->AllCacheLink);
+      RemoveEntryList (&Item6->HashLink);
       FreePool (Item6->DnsCache.HostName);
       FreePool (Item6->DnsCache.IpAddress);
       FreePool (Item6);
@@ -2263,4 +2858,15 @@ DnsOnTimerUpdate (
       Entry = Entry->ForwardLink;
     }
   }
+
+  //
+  // Iterate through the negative cache list.
+  //
+  NET_LIST_FOR_EACH_SAFE (Entry, Next, &mDriverData->DnsNegativeCacheList) {
+    ItemNegative = NET_LIST_USER_STRUCT (Entry, DNS_NEGATIVE_CACHE, AllCacheLink);
+    ItemNegative->Timeout--;
+    if (ItemNegative->Timeout == 0) {
+      DnsFreeNegativeCache (ItemNegative);
+    }
+  }
 }
@@ -83,20 +83,47 @@ extern EFI_DNS6_PROTOCOL             mDns6Protocol;
 
 #define DNS_TIME_TO_GETMAP  5
 
+//
+// Cached records whose remaining lifetime (in seconds) drops to this value are
+// refreshed in the background on the next cache hit.
+//
+#define DNS_CACHE_PREFETCH_TIMEOUT  10
+
+//
+// Upper bound (in seconds) of the lifetime of a negative (NXDOMAIN) cache entry.
+//
+#define DNS_NEGATIVE_CACHE_MAX_TIMEOUT  300
+
+//
+// Maximum number of negative cache entries, the least recently used one is
+// evicted beyond it.
+//
+#define DNS_NEGATIVE_CACHE_MAX_ENTRIES  64
+
 #pragma pack(1)
 
 typedef union _DNS_FLAGS DNS_FLAGS;
 
 typedef struct {
   LIST_ENTRY              AllCacheLink;
+  LIST_ENTRY              HashLink;     /// Link in the host name hash bucket.
+  BOOLEAN                 Prefetching;  /// A background refresh is in flight.
   EFI_DNS4_CACHE_ENTRY    DnsCache;
 } DNS4_CACHE;
 
 typedef struct {
   LIST_ENTRY              AllCacheLink;
+  LIST_ENTRY              HashLink;     /// Link in the host name hash bucket.
+  BOOLEAN                 Prefetching;  /// A background refresh is in flight.
   EFI_DNS6_CACHE_ENTRY    DnsCache;
 } DNS6_CACHE;
 
+typedef struct {
+  LIST_ENTRY    AllCacheLink;
+  CHAR16        *HostName;
+  UINT32        Timeout;
+} DNS_NEGATIVE_CACHE;
+
 typedef struct {
   LIST_ENTRY          AllServerLink;
   EFI_IPv4_ADDRESS    Dns4ServerIp;
@@ -175,6 +202,21 @@ typedef struct {
 
 #pragma pack()
 
+//
+// A background refresh of the cached records of a host name, issued on a DNS
+// child owned by the DNS service.
+//
+typedef struct {
+  LIST_ENTRY                   Link;        /// Link in the PrefetchList of the service.
+  DNS_SERVICE                  *Service;
+  EFI_HANDLE                   ChildHandle; /// NULL once the child is destroyed.
+  CHAR16                       *HostName;
+  EFI_EVENT                    Event;
+  BOOLEAN                      Done;        /// The query completed, timed out or was canceled.
+  EFI_DNS4_COMPLETION_TOKEN    Dns4Token;
+  EFI_DNS6_COMPLETION_TOKEN    Dns6Token;
+} DNS_PREFETCH;
+
 /**
   Remove TokenEntry from TokenMap.
 
@@ -515,6 +557,105 @@ UpdateDns6Cache (
   IN EFI_DNS6_CACHE_ENTRY  DnsCacheEntry
   );
 
+/**
+  Compute the DNS cache hash bucket of a host name.
+
+  @param  HostName           Host name to hash.
+
+  @return The index of the bucket in the DNS cache hash tables.
+
+**/
+UINTN
+DnsCacheHash (
+  IN CHAR16  *HostName
+  );
+
+/**
+  Record a host name that the DNS server reported as nonexistent (NXDOMAIN).
+
+  @param  HostName           Host name which does not exist.
+  @param  Timeout            Lifetime of the entry in seconds.
+
+  @retval EFI_SUCCESS        The negative cache entry was added or refreshed.
+  @retval Others             Failed to update the negative cache.
+
+**/
+EFI_STATUS
+DnsAddNegativeCache (
+  IN CHAR16  *HostName,
+  IN UINT32  Timeout
+  );
+
+/**
+  Remove the negative cache entry of a host name, if any.
+
+  @param  HostName           Host name which is known to exist.
+
+**/
+VOID
+DnsRemoveNegativeCache (
+  IN CHAR16  *HostName
+  );
+
+/**
+  Check whether a host name is recorded in the negative cache.
+
+  @param  HostName           Host name to look up.
+
+  @retval TRUE               The host name is known not to exist.
+  @retval FALSE              The host name is not in the negative cache.
+
+**/
+BOOLEAN
+DnsIsInNegativeCache (
+  IN CHAR16  *HostName
+  );
+
+/**
+  Refresh the cached records of a host name in the background.
+
+  The query is issued on a DNS child created for it by the DNS service, so it
+  is not aborted when the caller's instance is reset or destroyed. It uses the
+  DNS server of the caller's instance.
+
+  @param  Instance           The DNS instance whose lookup hit the cache.
+  @param  HostName           Host name of the records to refresh.
+
+  @retval EFI_SUCCESS        The refresh query was sent.
+  @retval Others             Failed to send the refresh query.
+
+**/
+EFI_STATUS
+DnsStartPrefetch (
+  IN DNS_INSTANCE  *Instance,
+  IN CHAR16        *HostName
+  );
+
+/**
+  Release a prefetch, destroying its DNS child if it still exists.
+
+  @param  Prefetch           The prefetch to release.
+
+**/
+VOID
+DnsFreePrefetch (
+  IN DNS_PREFETCH  *Prefetch
+  );
+
+/**
+  Forget the DNS child of a prefetch which is destroyed by someone else, e.g.
+  by the Stop() function of the driver binding.
+
+  @param  Service            The DNS service.
+  @param  ChildHandle        The handle of the DNS child being destroyed.
+
+**/
+VOID
+DnsPrefetchChildDestroyed (
+  IN DNS_SERVICE  *Service,
+  IN EFI_HANDLE   ChildHandle
+  );
+
 /**
   Add Dns4 ServerIp to common list of addresses of all configured DNSv4 server.
 
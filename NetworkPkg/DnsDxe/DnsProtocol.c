@@ -344,8 +344,10 @@ Dns4HostNameToIp (
 
   UINTN       Index;
   DNS4_CACHE  *Item;
+  LIST_ENTRY  *Bucket;
   LIST_ENTRY  *Entry;
-  LIST_ENTRY  *Next;
+  BOOLEAN     Prefetch;
+  BOOLEAN     InFlight;
 
   CHAR8  *QueryName;
 
@@ -405,10 +407,15 @@ Dns4HostNameToIp (
   // Check cache
   //
   if (ConfigData->EnableDnsCache) {
-    Index = 0;
-    NET_LIST_FOR_EACH_SAFE (Entry, Next, &mDriverData->Dns4CacheList) {
-      Item = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, AllCacheLink);
+    Index    = 0;
+    Prefetch = FALSE;
+    InFlight = FALSE;
+    Bucket   = &mDriverData->Dns4CacheHash[DnsCacheHash (HostName)];
+    NET_LIST_FOR_EACH (Entry, Bucket) {
+      Item = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, HashLink);
       if (StrCmp (HostName, Item->DnsCache.HostName) == 0) {
+        Prefetch = (BOOLEAN)(Prefetch || (Item->DnsCache.Timeout <= DNS_CACHE_PREFETCH_TIMEOUT));
+        InFlight = (BOOLEAN)(InFlight || Item->Prefetching);
         Index++;
       }
     }
@@ -432,8 +439,8 @@ Dns4HostNameToIp (
       }
 
       Index = 0;
-      NET_LIST_FOR_EACH_SAFE (Entry, Next, &mDriverData->Dns4CacheList) {
-        Item = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, AllCacheLink);
+      NET_LIST_FOR_EACH (Entry, Bucket) {
+        Item = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, HashLink);
         if (((UINT32)Index < Token->RspData.H2AData->IpCount) && (StrCmp (HostName, Item->DnsCache.HostName) == 0)) {
           CopyMem ((Token->RspData.H2AData->IpList) + Index, Item->DnsCache.IpAddress, sizeof (EFI_IPv4_ADDRESS));
           Index++;
@@ -448,6 +455,28 @@ Dns4HostNameToIp (
       }
 
       Status = Token->Status;
+      if (Prefetch && !InFlight) {
+        //
+        // The cached records are about to expire. They have been returned above,
+        // now refresh them in the background so that later lookups keep hitting
+        // the cache instead of waiting on the network. A failed refresh only
+        // means the cached records will expire normally.
+        //
+        DnsStartPrefetch (Instance, HostName);
+      }
+
+      goto ON_EXIT;
+    } else if (DnsIsInNegativeCache (HostName)) {
+      //
+      // The host name was reported as nonexistent and that answer is still valid.
+      //
+      Token->Status = EFI_NOT_FOUND;
+
+      if (Token->Event != NULL) {
+        gBS->SignalEvent (Token->Event);
+        DispatchDpc ();
+      }
+
       goto ON_EXIT;
     }
   }
@@ -1190,8 +1219,10 @@ Dns6HostNameToIp (
 
   UINTN       Index;
   DNS6_CACHE  *Item;
+  LIST_ENTRY  *Bucket;
   LIST_ENTRY  *Entry;
-  LIST_ENTRY  *Next;
+  BOOLEAN     Prefetch;
+  BOOLEAN     InFlight;
 
   CHAR8  *QueryName;
 
@@ -1251,10 +1282,15 @@ Dns6HostNameToIp (
   // Check cache
   //
   if (ConfigData->EnableDnsCache) {
-    Index = 0;
-    NET_LIST_FOR_EACH_SAFE (Entry, Next, &mDriverData->Dns6CacheList) {
-      Item = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, AllCacheLink);
+    Index    = 0;
+    Prefetch = FALSE;
+    InFlight = FALSE;
+    Bucket   = &mDriverData->Dns6CacheHash[DnsCacheHash (HostName)];
+    NET_LIST_FOR_EACH (Entry, Bucket) {
+      Item = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, HashLink);
       if (StrCmp (HostName, Item->DnsCache.HostName) == 0) {
+        Prefetch = (BOOLEAN)(Prefetch || (Item->DnsCache.Timeout <= DNS_CACHE_PREFETCH_TIMEOUT));
+        InFlight = (BOOLEAN)(InFlight || Item->Prefetching);
         Index++;
       }
     }
@@ -1278,8 +1314,8 @@ Dns6HostNameToIp (
       }
 
       Index = 0;
-      NET_LIST_FOR_EACH_SAFE (Entry, Next, &mDriverData->Dns6CacheList) {
-        Item = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, AllCacheLink);
+      NET_LIST_FOR_EACH (Entry, Bucket) {
+        Item = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, HashLink);
         if (((UINT32)Index < Token->RspData.H2AData->IpCount) && (StrCmp (HostName, Item->DnsCache.HostName) == 0)) {
           CopyMem ((Token->RspData.H2AData->IpList) + Index, Item->DnsCache.IpAddress, sizeof (EFI_IPv6_ADDRESS));
           Index++;
@@ -1294,6 +1330,28 @@ Dns6HostNameToIp (
       }
 
       Status = Token->Status;
+      if (Prefetch && !InFlight) {
+        //
+        // The cached records are about to expire. They have been returned above,
+        // now refresh them in the background so that later lookups keep hitting
+        // the cache instead of waiting on the network. A failed refresh only
+        // means the cached records will expire normally.
+        //
+        DnsStartPrefetch (Instance, HostName);
+      }
+
+      goto ON_EXIT;
+    } else if (DnsIsInNegativeCache (HostName)) {
+      //
+      // The host name was reported as nonexistent and that answer is still valid.
+      //
+      Token->Status = EFI_NOT_FOUND;
+
+      if (Token->Event != NULL) {
+        gBS->SignalEvent (Token->Event);
+        DispatchDpc ();
+      }
+
       goto ON_EXIT;
     }
   }
@@ -597,23 +597,22 @@ HttpBootHttpIoCallback (
 }
 
 /**
-  Create a HttpIo instance for the file download.
+  Get the HttpIo configuration data for the NIC that HTTP Boot is using.
 
   @param[in]    Private        The pointer to the driver's private data.
+  @param[out]   ConfigData     The HttpIo configuration data.
 
-  @retval EFI_SUCCESS          Successfully created.
-  @retval Others               Failed to create HttpIo.
+  @return The image handle of the HTTP Boot driver managing the NIC.
 
 **/
-EFI_STATUS
-HttpBootCreateHttpIo (
-  IN     HTTP_BOOT_PRIVATE_DATA  *Private
+STATIC
+EFI_HANDLE
+HttpBootGetHttpIoConfigData (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private,
+  OUT    HTTP_IO_CONFIG_DATA     *ConfigData
   )
 {
-  HTTP_IO_CONFIG_DATA  ConfigData;
-  EFI_STATUS           Status;
-  EFI_HANDLE           ImageHandle;
-  UINT32               TimeoutValue;
+  UINT32  TimeoutValue;
 
   ASSERT (Private != NULL);
 
@@ -622,29 +621,108 @@ HttpBootCreateHttpIo (
   //
   TimeoutValue = PcdGet32 (PcdHttpIoTimeout);
 
-  ZeroMem (&ConfigData, sizeof (HTTP_IO_CONFIG_DATA));
+  ZeroMem (ConfigData, sizeof (HTTP_IO_CONFIG_DATA));
   if (!Private->UsingIpv6) {
-    ConfigData.Config4.HttpVersion    = HttpVersion11;
-    ConfigData.Config4.RequestTimeOut = TimeoutValue;
-    IP4_COPY_ADDRESS (&ConfigData.Config4.LocalIp, &Private->StationIp.v4);
-    IP4_COPY_ADDRESS (&ConfigData.Config4.SubnetMask, &Private->SubnetMask.v4);
-    ImageHandle = Private->Ip4Nic->ImageHandle;
-  } else {
-    ConfigData.Config6.HttpVersion    = HttpVersion11;
-    ConfigData.Config6.RequestTimeOut = TimeoutValue;
-    IP6_COPY_ADDRESS (&ConfigData.Config6.LocalIp, &Private->StationIp.v6);
-    ImageHandle = Private->Ip6Nic->ImageHandle;
-  }
-
-  Status = HttpIoCreateIo (
-             ImageHandle,
-             Private->Controller,
-             Private->UsingIpv6 ? IP_VERSION_6 : IP_VERSION_4,
-             &ConfigData,
-             HttpBootHttpIoCallback,
-             (VOID *)Private,
-             &Private->HttpIo
-             );
+    ConfigData->Config4.HttpVersion    = HttpVersion11;
+    ConfigData->Config4.RequestTimeOut = TimeoutValue;
+    IP4_COPY_ADDRESS (&ConfigData->Config4.LocalIp, &Private->StationIp.v4);
+    IP4_COPY_ADDRESS (&ConfigData->Config4.SubnetMask, &Private->SubnetMask.v4);
+    return Private->Ip4Nic->ImageHandle;
+  }
+
+  ConfigData->Config6.HttpVersion    = HttpVersion11;
+  ConfigData->Config6.RequestTimeOut = TimeoutValue;
+  IP6_COPY_ADDRESS (&ConfigData->Config6.LocalIp, &Private->StationIp.v6);
+  return Private->Ip6Nic->ImageHandle;
+}
+
+/**
+  Create and configure a HttpIo instance on the NIC that HTTP Boot is using.
+
+  @param[in]    Private        The pointer to the driver's private data.
+  @param[out]   HttpIo         The HttpIo instance to initialize.
+
+  @retval EFI_SUCCESS          Successfully created.
+  @retval Others               Failed to create HttpIo.
+
+**/
+STATIC
+EFI_STATUS
+HttpBootCreateHttpIoInstance (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private,
+  OUT    HTTP_IO                 *HttpIo
+  )
+{
+  HTTP_IO_CONFIG_DATA  ConfigData;
+  EFI_HANDLE           ImageHandle;
+
+  ImageHandle = HttpBootGetHttpIoConfigData (Private, &ConfigData);
+  return HttpIoCreateIo (
+           ImageHandle,
+           Private->Controller,
+           Private->UsingIpv6 ? IP_VERSION_6 : IP_VERSION_4,
+           &ConfigData,
+           HttpBootHttpIoCallback,
+           (VOID *)Private,
+           HttpIo
+           );
+}
+
+/**
+  Get a HttpIo instance for a request to Url from the HttpIoLib keep-alive
+  pool, which hands out an idle instance still connected to the server if
+  there is one, so that the TCP and TLS handshakes are skipped.
+
+  @param[in]    Private        The pointer to the driver's private data.
+  @param[in]    Url            The URL the HttpIo instance sends requests to.
+  @param[out]   HttpIo         The HttpIo instance, to be released with
+                               HttpIoPoolRelease().
+
+  @retval EFI_SUCCESS          Successfully acquired.
+  @retval Others               Failed to create HttpIo.
+
+**/
+STATIC
+EFI_STATUS
+HttpBootAcquireHttpIo (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private,
+  IN     CHAR16                  *Url,
+  OUT    HTTP_IO                 **HttpIo
+  )
+{
+  HTTP_IO_CONFIG_DATA  ConfigData;
+  EFI_HANDLE           ImageHandle;
+
+  ImageHandle = HttpBootGetHttpIoConfigData (Private, &ConfigData);
+  return HttpIoPoolAcquire (
+           ImageHandle,
+           Private->Controller,
+           Private->UsingIpv6 ? IP_VERSION_6 : IP_VERSION_4,
+           &ConfigData,
+           HttpBootHttpIoCallback,
+           (VOID *)Private,
+           Url,
+           HttpIo
+           );
+}
+
+/**
+  Create a HttpIo instance for the file download.
+
+  @param[in]    Private        The pointer to the driver's private data.
+
+  @retval EFI_SUCCESS          Successfully created.
+  @retval Others               Failed to create HttpIo.
+
+**/
+EFI_STATUS
+HttpBootCreateHttpIo (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private
+  )
+{
+  EFI_STATUS  Status;
+
+  Status = HttpBootCreateHttpIoInstance (Private, &Private->HttpIo);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -901,6 +979,554 @@ HttpBootGetBootFileCallback (
   return EFI_SUCCESS;
 }
 
+/**
+  Send the GET request for the remaining part of the byte range of a parallel
+  ranged download connection, without waiting for the transmission to finish.
+
+  @param[in]       Private         The pointer to the driver's private data.
+  @param[in, out]  Connection      The connection to send the request on.
+
+  @retval EFI_SUCCESS              The request has been queued.
+  @retval Others                   Failed to queue the request.
+
+**/
+STATIC
+EFI_STATUS
+HttpBootRangeSendRequest (
+  IN     HTTP_BOOT_PRIVATE_DATA      *Private,
+  IN OUT HTTP_BOOT_RANGE_CONNECTION  *Connection
+  )
+{
+  EFI_STATUS  Status;
+  HTTP_IO     *HttpIo;
+  CHAR8       RangeValue[HTTP_BOOT_RANGE_HEADER_LENGTH];
+
+  ASSERT (Connection->ReceivedSize < Connection->RangeLength);
+
+  AsciiSPrint (
+    RangeValue,
+    sizeof (RangeValue),
+    "bytes=%Lu-%Lu",
+    (UINT64)(Connection->RangeStart + Connection->ReceivedSize),
+    (UINT64)(Connection->RangeStart + Connection->RangeLength - 1)
+    );
+  Status = HttpIoSetHeader (Connection->HttpIoHeader, HTTP_HEADER_RANGE, RangeValue);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  HttpIo                                 = Connection->HttpIo;
+  HttpIo->ReqToken.Status                = EFI_NOT_READY;
+  HttpIo->ReqToken.Message->Data.Request = &Connection->RequestData;
+  HttpIo->ReqToken.Message->HeaderCount  = Connection->HttpIoHeader->HeaderCount;
+  HttpIo->ReqToken.Message->Headers      = Connection->HttpIoHeader->Headers;
+  HttpIo->ReqToken.Message->BodyLength   = 0;
+  HttpIo->ReqToken.Message->Body         = NULL;
+
+  if (HttpIo->Callback != NULL) {
+    Status = HttpIo->Callback (HttpIoRequest, HttpIo->ReqToken.Message, HttpIo->Context);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  HttpIo->IsTxDone  = FALSE;
+  Connection->State = HttpBootRangeStateRequest;
+  return HttpIo->Http->Request (HttpIo->Http, &HttpIo->ReqToken);
+}
+
+/**
+  Queue a response token on a parallel ranged download connection, without
+  waiting for the reception to finish.
+
+  @param[in, out]  Connection      The connection to receive on.
+  @param[in]       Buffer          The buffer holding the whole boot file.
+
+  @retval EFI_SUCCESS              The response token has been queued.
+  @retval Others                   Failed to queue the response token.
+
+**/
+STATIC
+EFI_STATUS
+HttpBootRangeRecvResponse (
+  IN OUT HTTP_BOOT_RANGE_CONNECTION  *Connection,
+  IN     UINT8                       *Buffer
+  )
+{
+  EFI_STATUS  Status;
+  HTTP_IO     *HttpIo;
+
+  HttpIo                  = Connection->HttpIo;
+  HttpIo->RspToken.Status = EFI_NOT_READY;
+  if (Connection->State == HttpBootRangeStateHeader) {
+    ZeroMem (&Connection->Response, sizeof (EFI_HTTP_RESPONSE_DATA));
+    HttpIo->RspToken.Message->Data.Response = &Connection->Response;
+    HttpIo->RspToken.Message->BodyLength    = 0;
+    HttpIo->RspToken.Message->Body          = NULL;
+  } else {
+    HttpIo->RspToken.Message->Data.Response = NULL;
+    HttpIo->RspToken.Message->BodyLength    = Connection->RangeLength - Connection->ReceivedSize;
+    HttpIo->RspToken.Message->Body          = Buffer + Connection->RangeStart + Connection->ReceivedSize;
+  }
+
+  HttpIo->RspToken.Message->HeaderCount = 0;
+  HttpIo->RspToken.Message->Headers     = NULL;
+  HttpIo->IsRxDone                      = FALSE;
+
+  Status = gBS->SetTimer (HttpIo->TimeoutEvent, TimerRelative, HttpIo->Timeout * TICKS_PER_MS);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = HttpIo->Http->Response (HttpIo->Http, &HttpIo->RspToken);
+  if (EFI_ERROR (Status)) {
+    gBS->SetTimer (HttpIo->TimeoutEvent, TimerCancel, 0);
+  }
+
+  return Status;
+}
+
+/**
+  Check that the Content-Range header of a 206 response carries exactly the
+  part of the byte range of a connection that was requested, out of a file of
+  the expected size.
+
+  @param[in]  Connection      The connection that received the response.
+  @param[in]  FileSize        The size of the boot file.
+  @param[in]  Message         The response message, with its headers.
+
+  @retval TRUE                The response carries the requested bytes.
+  @retval FALSE               The Content-Range header is missing, malformed
+                              or describes other bytes.
+
+**/
+STATIC
+BOOLEAN
+HttpBootRangeCheckContentRange (
+  IN CONST HTTP_BOOT_RANGE_CONNECTION  *Connection,
+  IN       UINTN                       FileSize,
+  IN CONST EFI_HTTP_MESSAGE            *Message
+  )
+{
+  EFI_HTTP_HEADER  *Header;
+  CHAR8            *Value;
+  CHAR8            *End;
+  UINT64           First;
+  UINT64           Last;
+  UINT64           CompleteLength;
+
+  Header = HttpFindHeader (Message->HeaderCount, Message->Headers, HTTP_HEADER_CONTENT_RANGE);
+  if ((Header == NULL) || (AsciiStrnCmp (Header->FieldValue, "bytes ", 6) != 0)) {
+    return FALSE;
+  }
+
+  //
+  // bytes First-Last/CompleteLength
+  //
+  Value = Header->FieldValue + 6;
+  if (RETURN_ERROR (AsciiStrDecimalToUint64S (Value, &End, &First)) || (*End != '-')) {
+    return FALSE;
+  }
+
+  Value = End + 1;
+  if (RETURN_ERROR (AsciiStrDecimalToUint64S (Value, &End, &Last)) || (*End != '/')) {
+    return FALSE;
+  }
+
+  Value = End + 1;
+  if (RETURN_ERROR (AsciiStrDecimalToUint64S (Value, &End, &CompleteLength)) || (*End != '\0')) {
+    return FALSE;
+  }
+
+  return (BOOLEAN)((First == Connection->RangeStart + Connection->ReceivedSize) &&
+                   (Last == Connection->RangeStart + Connection->RangeLength - 1) &&
+                   (CompleteLength == FileSize));
+}
+
+/**
+  Reopen a parallel ranged download connection after a failure, and request
+  the part of its byte range that has not been received yet.
+
+  @param[in]       Private         The pointer to the driver's private data.
+  @param[in, out]  Connection      The failed connection.
+  @param[in]       ErrorStatus     The status code of the failure.
+
+  @retval EFI_SUCCESS              The connection has been reopened.
+  @retval Others                   The retry count is exhausted, or failed to
+                                   reopen the connection.
+
+**/
+STATIC
+EFI_STATUS
+HttpBootRangeRetry (
+  IN     HTTP_BOOT_PRIVATE_DATA      *Private,
+  IN OUT HTTP_BOOT_RANGE_CONNECTION  *Connection,
+  IN     EFI_STATUS                  ErrorStatus
+  )
+{
+  EFI_STATUS  Status;
+
+  DEBUG ((
+    DEBUG_WARN,
+    "HttpBootRangeRetry: range at 0x%Lx failed after 0x%Lx bytes: %r\n",
+    (UINT64)Connection->RangeStart,
+    (UINT64)Connection->ReceivedSize,
+    ErrorStatus
+    ));
+
+  //
+  // A reused connection that fails before any response has most likely been
+  // closed by the server while it was idle in the pool; retrying on a fresh
+  // connection does not count against the retry limit.
+  //
+  if ((Connection->HttpIo == NULL) || !HttpIoPoolIsReused (Connection->HttpIo)) {
+    if (Connection->RetryCount >= PcdGet8 (PcdHttpBootRangeRetryCount)) {
+      return ErrorStatus;
+    }
+
+    Connection->RetryCount++;
+  }
+
+  //
+  // The connection of the failed HttpIo instance is not reused.
+  //
+  if (Connection->HttpIo != NULL) {
+    HttpIoPoolRelease (Connection->HttpIo, FALSE);
+    Connection->HttpIo = NULL;
+  }
+
+  Status = HttpBootAcquireHttpIo (Private, Connection->RequestData.Url, &Connection->HttpIo);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  return HttpBootRangeSendRequest (Private, Connection);
+}
+
+/**
+  Advance the state machine of a parallel ranged download connection, after
+  the network has been polled.
+
+  @param[in]       Private         The pointer to the driver's private data.
+  @param[in, out]  Connection      The connection to advance.
+  @param[in]       Buffer          The buffer holding the whole boot file.
+
+  @retval EFI_SUCCESS              The connection is progressing or done.
+  @retval EFI_UNSUPPORTED          The server ignored the Range header, sent
+                                   other bytes than requested, or the file
+                                   has changed since the HEAD request.
+  @retval Others                   The connection failed and the retry count
+                                   is exhausted, or the download was aborted.
+
+**/
+STATIC
+EFI_STATUS
+HttpBootRangeProcess (
+  IN     HTTP_BOOT_PRIVATE_DATA      *Private,
+  IN OUT HTTP_BOOT_RANGE_CONNECTION  *Connection,
+  IN     UINT8                       *Buffer
+  )
+{
+  EFI_STATUS  Status;
+  HTTP_IO     *HttpIo;
+  UINTN       BodyLength;
+  BOOLEAN     RangeMatch;
+
+  HttpIo = Connection->HttpIo;
+
+  switch (Connection->State) {
+    case HttpBootRangeStateRequest:
+      if (!HttpIo->IsTxDone) {
+        return EFI_SUCCESS;
+      }
+
+      if (EFI_ERROR (HttpIo->ReqToken.Status)) {
+        return HttpBootRangeRetry (Private, Connection, HttpIo->ReqToken.Status);
+      }
+
+      Connection->State = HttpBootRangeStateHeader;
+      Status            = HttpBootRangeRecvResponse (Connection, Buffer);
+      if (EFI_ERROR (Status)) {
+        return HttpBootRangeRetry (Private, Connection, Status);
+      }
+
+      return EFI_SUCCESS;
+
+    case HttpBootRangeStateHeader:
+    case HttpBootRangeStateBody:
+      if (!HttpIo->IsRxDone) {
+        if (!EFI_ERROR (gBS->CheckEvent (HttpIo->TimeoutEvent))) {
+          HttpIo->Http->Cancel (HttpIo->Http, &HttpIo->RspToken);
+          return HttpBootRangeRetry (Private, Connection, EFI_TIMEOUT);
+        }
+
+        return EFI_SUCCESS;
+      }
+
+      gBS->SetTimer (HttpIo->TimeoutEvent, TimerCancel, 0);
+      if (HttpIo->RspToken.Status == EFI_HTTP_ERROR) {
+        //
+        // No point in retrying a range that the server has refused.
+        //
+        HttpBootPrintErrorMessage (Connection->Response.StatusCode);
+        return HttpIo->RspToken.Status;
+      }
+
+      if (EFI_ERROR (HttpIo->RspToken.Status)) {
+        return HttpBootRangeRetry (Private, Connection, HttpIo->RspToken.Status);
+      }
+
+      if (Connection->State == HttpBootRangeStateHeader) {
+        if (HttpIo->Callback != NULL) {
+          Status = HttpIo->Callback (HttpIoResponse, HttpIo->RspToken.Message, HttpIo->Context);
+          if (EFI_ERROR (Status)) {
+            return Status;
+          }
+        }
+
+        //
+        // With If-Range, a server whose file has changed answers with the
+        // complete entity instead of 206.
+        //
+        RangeMatch = (BOOLEAN)((Connection->Response.StatusCode == HTTP_STATUS_206_PARTIAL_CONTENT) &&
+                               HttpBootRangeCheckContentRange (Connection, Private->BootFileSize, HttpIo->RspToken.Message));
+
+        HttpIoPoolNoteResponse (
+          HttpIo,
+          HttpIo->RspToken.Message->HeaderCount,
+          HttpIo->RspToken.Message->Headers
+          );
+
+        if (HttpIo->RspToken.Message->Headers != NULL) {
+          HttpFreeHeaderFields (
+            HttpIo->RspToken.Message->Headers,
+            HttpIo->RspToken.Message->HeaderCount
+            );
+          HttpIo->RspToken.Message->Headers = NULL;
+        }
+
+        if (!RangeMatch) {
+          //
+          // The server answered with the complete entity, another range, or
+          // something else; let the caller fall back to the sequential
+          // download of the whole file.
+          //
+          DEBUG ((
+            DEBUG_WARN,
+            "HttpBootRangeProcess: unexpected response %d for the range at 0x%Lx\n",
+            Connection->Response.StatusCode,
+            (UINT64)Connection->RangeStart
+            ));
+          return EFI_UNSUPPORTED;
+        }
+
+        Connection->State = HttpBootRangeStateBody;
+      } else {
+        BodyLength = HttpIo->RspToken.Message->BodyLength;
+        ASSERT (BodyLength <= Connection->RangeLength - Connection->ReceivedSize);
+        if (Private->HttpBootCallback != NULL) {
+          Status = Private->HttpBootCallback->Callback (
+                                                Private->HttpBootCallback,
+                                                HttpBootHttpEntityBody,
+                                                TRUE,
+                                                (UINT32)BodyLength,
+                                                Buffer + Connection->RangeStart + Connection->ReceivedSize
+                                                );
+          if (EFI_ERROR (Status)) {
+            return Status;
+          }
+        }
+
+        Connection->ReceivedSize += BodyLength;
+        if (Connection->ReceivedSize == Connection->RangeLength) {
+          Connection->State = HttpBootRangeStateDone;
+          return EFI_SUCCESS;
+        }
+      }
+
+      Status = HttpBootRangeRecvResponse (Connection, Buffer);
+      if (EFI_ERROR (Status)) {
+        return HttpBootRangeRetry (Private, Connection, Status);
+      }
+
+      return EFI_SUCCESS;
+
+    default:
+      return EFI_SUCCESS;
+  }
+}
+
+/**
+  Download the boot file over several concurrent HTTP connections, each of
+  them fetching a disjoint byte range of the file directly into Buffer.
+
+  This is only possible if the server has advertised "Accept-Ranges: bytes"
+  and a strong ETag or a Last-Modified date in the response to the HEAD
+  request, and if PcdHttpBootParallelConnections allows more than one
+  connection. Every range is requested with If-Range, so that all of them come
+  from the version of the file described by the HEAD response.
+
+  @param[in]       Private         The pointer to the driver's private data.
+  @param[in]       Url             The URL of the boot file.
+  @param[in]       FileSize        The size of the boot file.
+  @param[out]      Buffer          The memory buffer to transfer the file to,
+                                   at least FileSize bytes in size.
+
+  @retval EFI_SUCCESS              The file was loaded.
+  @retval EFI_UNSUPPORTED          A parallel ranged download is not possible
+                                   or not worthwhile; the caller should
+                                   download the file sequentially.
+  @retval EFI_OUT_OF_RESOURCES     Could not allocate needed resources.
+  @retval Others                   Unexpected error happened.
+
+**/
+STATIC
+EFI_STATUS
+HttpBootGetBootFileRanged (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private,
+  IN     CHAR16                  *Url,
+  IN     UINTN                   FileSize,
+  OUT UINT8                      *Buffer
+  )
+{
+  EFI_STATUS                  Status;
+  UINTN                       ConnectionCount;
+  UINTN                       RangeLength;
+  UINTN                       Index;
+  HTTP_BOOT_RANGE_CONNECTION  *Connections;
+  HTTP_BOOT_RANGE_CONNECTION  *Connection;
+  CHAR8                       *HostName;
+  BOOLEAN                     Pending;
+
+  ConnectionCount = MIN (PcdGet8 (PcdHttpBootParallelConnections), HTTP_BOOT_RANGE_MAX_CONNECTION);
+  ConnectionCount = MIN (ConnectionCount, FileSize / HTTP_BOOT_RANGE_MIN_SIZE);
+  if (ConnectionCount < 2) {
+    return EFI_UNSUPPORTED;
+  }
+
+  HostName = NULL;
+  Status   = HttpUrlGetHostName (
+               Private->BootFileUri,
+               Private->BootFileUriParser,
+               &HostName
+               );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Connections = AllocateZeroPool (ConnectionCount * sizeof (HTTP_BOOT_RANGE_CONNECTION));
+  if (Connections == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ON_EXIT;
+  }
+
+  DEBUG ((
+    DEBUG_INFO,
+    "HttpBootGetBootFileRanged: downloading 0x%Lx bytes over %Lu connections\n",
+    (UINT64)FileSize,
+    (UINT64)ConnectionCount
+    ));
+
+  //
+  // Split the file into equally sized ranges, the last one taking the
+  // remainder, and start all requests before waiting for any of them.
+  //
+  RangeLength = FileSize / ConnectionCount;
+  for (Index = 0; Index < ConnectionCount; Index++) {
+    Connection                     = &Connections[Index];
+    Connection->RangeStart         = Index * RangeLength;
+    Connection->RangeLength        = (Index == ConnectionCount - 1) ? FileSize - Connection->RangeStart : RangeLength;
+    Connection->RequestData.Method = HttpMethodGet;
+    Connection->RequestData.Url    = Url;
+
+    //
+    // Host, Accept, User-Agent, If-Range and Range
+    //
+    Connection->HttpIoHeader = HttpIoCreateHeader (5);
+    if (Connection->HttpIoHeader == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto ON_EXIT;
+    }
+
+    Status = HttpIoSetHeader (Connection->HttpIoHeader, HTTP_HEADER_HOST, HostName);
+    if (!EFI_ERROR (Status)) {
+      Status = HttpIoSetHeader (Connection->HttpIoHeader, HTTP_HEADER_ACCEPT, "*/*");
+    }
+
+    if (!EFI_ERROR (Status)) {
+      Status = HttpIoSetHeader (Connection->HttpIoHeader, HTTP_HEADER_USER_AGENT, HTTP_USER_AGENT_EFI_HTTP_BOOT);
+    }
+
+    if (!EFI_ERROR (Status)) {
+      Status = HttpIoSetHeader (Connection->HttpIoHeader, HTTP_HEADER_IF_RANGE, Private->RangeValidator);
+    }
+
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+
+    Status = HttpBootAcquireHttpIo (Private, Url, &Connection->HttpIo);
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+
+    Status = HttpBootRangeSendRequest (Private, Connection);
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+  }
+
+  //
+  // Poll all connections until every range has been received.
+  //
+  do {
+    Pending = FALSE;
+    for (Index = 0; Index < ConnectionCount; Index++) {
+      Connection = &Connections[Index];
+      if (Connection->State == HttpBootRangeStateDone) {
+        continue;
+      }
+
+      Pending = TRUE;
+      Connection->HttpIo->Http->Poll (Connection->HttpIo->Http);
+      Status = HttpBootRangeProcess (Private, Connection, Buffer);
+      if (EFI_ERROR (Status)) {
+        goto ON_EXIT;
+      }
+    }
+  } while (Pending);
+
+  Status = EFI_SUCCESS;
+
+ON_EXIT:
+  if (Connections != NULL) {
+    for (Index = 0; Index < ConnectionCount; Index++) {
+      Connection = &Connections[Index];
+      //
+      // A connection that has received its whole range is idle and can
+      // serve the next download from the same server.
+      //
+      if (Connection->HttpIo != NULL) {
+        HttpIoPoolRelease (Connection->HttpIo, (BOOLEAN)(Connection->State == HttpBootRangeStateDone));
+      }
+
+      if (Connection->HttpIoHeader != NULL) {
+        HttpIoFreeHeader (Connection->HttpIoHeader);
+      }
+    }
+
+    //
+    // Flush the DPCs that may still refer to the IsTxDone / IsRxDone flags of
+    // the connections before releasing them.
+    //
+    DispatchDpc ();
+    FreePool (Connections);
+  }
+
+  FreePool (HostName);
+  return Status;
+}
+
 /**
   This function download the boot file by using UEFI HTTP protocol.
 
@@ -951,6 +1577,7 @@ HttpBootGetBootFile (
   CHAR16                   *Url;
   BOOLEAN                  IdentityMode;
   UINTN                    ReceivedSize;
+  EFI_HTTP_HEADER          *Header;
 
   ASSERT (Private != NULL);
   ASSERT (Private->HttpCreated);
@@ -979,6 +1606,32 @@ HttpBootGetBootFile (
       FreePool (Url);
       return Status;
     }
+
+    //
+    // If the server accepts byte ranges, try to download the file over
+    // several connections in parallel, to hide the round trip time and the
+    // congestion window ramp-up of a single connection.
+    //
+    if (Private->AcceptRanges && (Private->BootFileSize != 0) &&
+        (*BufferSize >= Private->BootFileSize))
+    {
+      Status = HttpBootGetBootFileRanged (Private, Url, Private->BootFileSize, Buffer);
+      if (Status != EFI_UNSUPPORTED) {
+        if (!EFI_ERROR (Status)) {
+          *BufferSize = Private->BootFileSize;
+          *ImageType  = Private->ImageType;
+        }
+
+        FreePool (Url);
+        return Status;
+      }
+    }
+  } else if (HeaderOnly) {
+    Private->AcceptRanges = FALSE;
+    if (Private->RangeValidator != NULL) {
+      FreePool (Private->RangeValidator);
+      Private->RangeValidator = NULL;
+    }
   }
 
   //
@@ -1140,6 +1793,26 @@ HttpBootGetBootFile (
     goto ERROR_5;
   }
 
+  //
+  // Remember whether the server accepts byte ranges, for a parallel ranged
+  // download of the file. The ranges are requested with If-Range, which
+  // needs a strong entity tag or, failing that, the Last-Modified date.
+  //
+  if (HeaderOnly) {
+    Header = HttpFindHeader (ResponseData->HeaderCount, ResponseData->Headers, HTTP_HEADER_ETAG);
+    if ((Header == NULL) || (AsciiStrnCmp (Header->FieldValue, "W/", 2) == 0)) {
+      Header = HttpFindHeader (ResponseData->HeaderCount, ResponseData->Headers, HTTP_HEADER_LAST_MODIFIED);
+    }
+
+    if (Header != NULL) {
+      Private->RangeValidator = AllocateCopyPool (AsciiStrSize (Header->FieldValue), Header->FieldValue);
+    }
+
+    Header                = HttpFindHeader (ResponseData->HeaderCount, ResponseData->Headers, HTTP_HEADER_ACCEPT_RANGES);
+    Private->AcceptRanges = (BOOLEAN)((Header != NULL) && (AsciiStriCmp (Header->FieldValue, "bytes") == 0) &&
+                                      (Private->RangeValidator != NULL));
+  }
+
   //
   // 3.2 Cache the response header.
   //
@@ -13,6 +13,14 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define HTTP_BOOT_BLOCK_SIZE           1500
 #define HTTP_USER_AGENT_EFI_HTTP_BOOT  "UefiHttpBoot/1.0"
 
+//
+// Files smaller than this per connection are not worth a parallel ranged
+// download; the extra TCP/TLS handshakes would cost more than they save.
+//
+#define HTTP_BOOT_RANGE_MIN_SIZE        SIZE_1MB
+#define HTTP_BOOT_RANGE_MAX_CONNECTION  16
+#define HTTP_BOOT_RANGE_HEADER_LENGTH   64
+
 //
 // Record the data length and start address of a data block.
 //
@@ -57,6 +65,33 @@ typedef struct {
   HTTP_BOOT_PRIVATE_DATA     *Private;
 } HTTP_BOOT_CALLBACK_DATA;
 
+//
+// State of a single connection of a parallel ranged download.
+//
+typedef enum {
+  HttpBootRangeStateRequest,
+  HttpBootRangeStateHeader,
+  HttpBootRangeStateBody,
+  HttpBootRangeStateDone
+} HTTP_BOOT_RANGE_STATE;
+
+//
+// One HTTP child of a parallel ranged download, fetching the byte range
+// [RangeStart, RangeStart + RangeLength) of the boot file. The HTTP_IO comes
+// from the HttpIoLib keep-alive pool.
+//
+typedef struct {
+  HTTP_IO                   *HttpIo;
+  HTTP_IO_HEADER            *HttpIoHeader;
+  EFI_HTTP_REQUEST_DATA     RequestData;
+  EFI_HTTP_RESPONSE_DATA    Response;
+  HTTP_BOOT_RANGE_STATE     State;
+  UINTN                     RangeStart;
+  UINTN                     RangeLength;
+  UINTN                     ReceivedSize;
+  UINTN                     RetryCount;
+} HTTP_BOOT_RANGE_CONNECTION;
+
 /**
   Discover all the boot information for boot file.
 
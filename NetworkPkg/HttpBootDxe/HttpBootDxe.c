@@ -158,6 +158,10 @@ HttpBootDestroyIp4Children (
     Private->HttpCreated = FALSE;
   }
 
+  if (Private->Ip6Nic == NULL) {
+    HttpIoPoolFlush (Private->Controller);
+  }
+
   if (Private->Ip4Nic != NULL) {
     gBS->CloseProtocol (
            Private->Controller,
@@ -232,6 +236,10 @@ HttpBootDestroyIp6Children (
     Private->HttpCreated = FALSE;
   }
 
+  if (Private->Ip4Nic == NULL) {
+    HttpIoPoolFlush (Private->Controller);
+  }
+
   if (Private->Ip6Nic != NULL) {
     gBS->CloseProtocol (
            Private->Controller,
@@ -452,6 +452,8 @@ HttpBootStop (
     Private->HttpCreated = FALSE;
   }
 
+  HttpIoPoolFlush (Private->Controller);
+
   Private->Started = FALSE;
   ZeroMem (&Private->StationIp, sizeof (EFI_IP_ADDRESS));
   ZeroMem (&Private->SubnetMask, sizeof (EFI_IP_ADDRESS));
@@ -460,6 +462,12 @@ HttpBootStop (
   Private->BootFileUri       = NULL;
   Private->BootFileUriParser = NULL;
   Private->BootFileSize      = 0;
+  Private->AcceptRanges      = FALSE;
+  if (Private->RangeValidator != NULL) {
+    FreePool (Private->RangeValidator);
+    Private->RangeValidator = NULL;
+  }
+
   Private->SelectIndex       = 0;
   Private->SelectProxyType   = HttpOfferTypeMax;
 
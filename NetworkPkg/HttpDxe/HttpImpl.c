@@ -477,6 +477,9 @@ EfiHttpRequest (
 
           Wrap->TcpWrap.Method = Request->Method;
 
+          HttpInstance->RequestCount++;
+          HttpInstance->ConnectionReuseCount++;
+
           FreePool (HostName);
 
           HttpUrlFreeParser (UrlParser);
@@ -664,6 +667,13 @@ EfiHttpRequest (
 
   DispatchDpc ();
 
+  if (Request != NULL) {
+    HttpInstance->RequestCount++;
+    if (!Configure && !ReConfigure && !TlsConfigure) {
+      HttpInstance->ConnectionReuseCount++;
+    }
+  }
+
   if (HostName != NULL) {
     FreePool (HostName);
   }
@@ -823,6 +823,13 @@ HttpCleanProtocol (
 
   HttpCloseTcpConnCloseEvent (HttpInstance);
 
+  DEBUG ((
+    DEBUG_INFO,
+    "HttpCleanProtocol: %Lu of %Lu requests reused an open connection\n",
+    (UINT64)HttpInstance->ConnectionReuseCount,
+    (UINT64)HttpInstance->RequestCount
+    ));
+
   if (HttpInstance->TimeoutEvent != NULL) {
     gBS->CloseEvent (HttpInstance->TimeoutEvent);
     HttpInstance->TimeoutEvent = NULL;
@@ -194,6 +194,13 @@ typedef struct _HTTP_PROTOCOL {
   EFI_TCP6_IO_TOKEN                 Tcp6TlsRxToken;
   EFI_TCP6_RECEIVE_DATA             Tcp6TlsRxData;
   BOOLEAN                           TlsIsRxDone;
+
+  //
+  // Number of requests sent by this instance, and how many of them went out
+  // on an already open TCP (and TLS) connection.
+  //
+  UINTN                             RequestCount;
+  UINTN                             ConnectionReuseCount;
 } HTTP_PROTOCOL;
 
 typedef struct {
@@ -639,7 +639,8 @@ TlsConfigureSession (
   IN OUT HTTP_PROTOCOL  *HttpInstance
   )
 {
-  EFI_STATUS  Status;
+  EFI_STATUS                        Status;
+  EDKII_TLS_SESSION_CACHE_PROTOCOL  *TlsSessionCache;
 
   //
   // TlsConfigData initialization
@@ -696,6 +697,22 @@ TlsConfigureSession (
     return Status;
   }
 
+  //
+  // The TLS driver only resumes a session of the same host and port, so let
+  // it know the port if it supports the session cache.
+  //
+  Status = gBS->HandleProtocol (
+                  HttpInstance->TlsChildHandle,
+                  &gEdkiiTlsSessionCacheProtocolGuid,
+                  (VOID **)&TlsSessionCache
+                  );
+  if (!EFI_ERROR (Status)) {
+    Status = TlsSessionCache->SetPeerPort (TlsSessionCache, HttpInstance->RemotePort);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
   //
   // Tls Cipher List
   //
@@ -90,7 +90,7 @@ IScsiExtScsiPassThruFunction (
     return EFI_INVALID_PARAMETER;
   }
 
-  Status = IScsiExecuteScsiCommand (This, Target, Lun, Packet);
+  Status = IScsiExecuteScsiCommand (This, Target, Lun, Packet, Event);
   if ((Status != EFI_SUCCESS) && (Status != EFI_NOT_READY)) {
     //
     // Try to reinstate the session and re-execute the Scsi command.
@@ -100,7 +100,7 @@ IScsiExtScsiPassThruFunction (
       return EFI_DEVICE_ERROR;
     }
 
-    Status = IScsiExecuteScsiCommand (This, Target, Lun, Packet);
+    Status = IScsiExecuteScsiCommand (This, Target, Lun, Packet, Event);
   }
 
   return Status;
@@ -106,6 +106,9 @@ struct _ISCSI_SESSION {
   UINT32                         NumConns;
 
   LIST_ENTRY                     TcbList;
+  UINT32                         NumAsyncTcbs;
+  EFI_EVENT                      PollEvent;    ///< Drives the nonblocking commands in flight.
+  UINT32                         NestingLevel; ///< Number of nested commands using the connection.
 
   //
   // Session-wide parameters
@@ -157,6 +160,15 @@ struct _ISCSI_CONNECTION {
   BOOLEAN              Ipv6Flag;
   TCP_IO               TcpIo;
 
+  //
+  // The PDU being received. It is kept across calls, so that the session
+  // poll timer can receive a PDU piece by piece without waiting for it.
+  //
+  LIST_ENTRY           *RxNbufList;     ///< NULL if no PDU is partially received.
+  BOOLEAN              RxHdrRcvd;
+  UINT32               RxSegRcvd;       ///< Bytes of the current PDU segment received.
+  UINT32               RxPadAndCRC32[2];
+
   //
   // Connection-only parameters.
   //
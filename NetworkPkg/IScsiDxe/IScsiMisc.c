@@ -1789,7 +1789,9 @@ IScsiCreateDriverData (
   // 0 is designated to the TargetId, so use another value for the AdapterId.
   //
   Private->ExtScsiPassThruMode.AdapterId  = 2;
-  Private->ExtScsiPassThruMode.Attributes = EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_PHYSICAL | EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_LOGICAL;
+  Private->ExtScsiPassThruMode.Attributes = EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_PHYSICAL |
+                                            EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_LOGICAL |
+                                            EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_NONBLOCKIO;
   Private->ExtScsiPassThruMode.IoAlign    = 4;
   Private->IScsiExtScsiPassThru.Mode      = &Private->ExtScsiPassThruMode;
 
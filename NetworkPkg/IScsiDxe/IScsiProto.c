@@ -313,6 +313,10 @@ IScsiDestroyConnection (
 {
   TcpIoDestroySocket (&Conn->TcpIo);
 
+  if (Conn->RxNbufList != NULL) {
+    IScsiFreeNbufList (Conn->RxNbufList);
+  }
+
   NetbufQueFlush (&Conn->RspQue);
   gBS->CloseEvent (Conn->TimeoutEvent);
   FreePool (Conn);
@@ -1284,10 +1288,185 @@ IScsiNbufExtFree (
 }
 
 /**
-  Receive an iSCSI response PDU. An iSCSI response PDU contains an iSCSI PDU header and
-  an optional data segment. The two parts will be put into two blocks of buffers in the
-  net buffer. The digest check will be conducted in this function if needed and the digests
-  will be trimmed from the PDU buffer.
+  Find the task control block of a SCSI command by its initiator task tag.
+
+  @param[in]  Session          The iSCSI session.
+  @param[in]  InitiatorTaskTag The initiator task tag, in host byte order.
+
+  @return The task control block, or NULL if no command uses this tag.
+
+**/
+STATIC
+ISCSI_TCB *
+IScsiFindTcb (
+  IN ISCSI_SESSION  *Session,
+  IN UINT32         InitiatorTaskTag
+  )
+{
+  LIST_ENTRY  *Entry;
+  ISCSI_TCB   *Tcb;
+
+  NET_LIST_FOR_EACH (Entry, &Session->TcbList) {
+    Tcb = NET_LIST_USER_STRUCT (Entry, ISCSI_TCB, Link);
+    if (Tcb->InitiatorTaskTag == InitiatorTaskTag) {
+      return Tcb;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Receive the part of a PDU segment that is not received yet. Conn->RxSegRcvd
+  records how many bytes of the segment are already received.
+
+  @param[in]  Conn         The iSCSI connection to receive data from.
+  @param[in]  Nbuf         The net buffer of the PDU segment.
+  @param[in]  NoWait       Return instead of waiting if the data is not there yet.
+  @param[in]  TimeoutEvent The timeout event. It is optional.
+
+  @retval EFI_SUCCESS          The segment is received.
+  @retval EFI_NOT_READY        NoWait is TRUE and the segment is not fully received yet.
+  @retval EFI_TIMEOUT          The timeout event is signaled before the segment is received.
+  @retval EFI_OUT_OF_RESOURCES Failed to allocate memory.
+  @retval Others               Other errors as indicated.
+
+**/
+STATIC
+EFI_STATUS
+IScsiReceiveNbuf (
+  IN ISCSI_CONNECTION  *Conn,
+  IN NET_BUF           *Nbuf,
+  IN BOOLEAN           NoWait,
+  IN EFI_EVENT         TimeoutEvent OPTIONAL
+  )
+{
+  TCP_IO                 *TcpIo;
+  EFI_TCP4_RECEIVE_DATA  *RxData;
+  NET_FRAGMENT           *Fragment;
+  UINT32                 FragmentCount;
+  UINT32                 Index;
+  UINT32                 Skip;
+  EFI_STATUS             Status;
+
+  TcpIo  = &Conn->TcpIo;
+  RxData = TcpIo->RxToken.Tcp4Token.Packet.RxData;
+  if ((TcpIo->Tcp.Tcp4 == NULL) || (RxData == NULL)) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  FragmentCount = Nbuf->BlockOpNum;
+  Fragment      = AllocatePool (FragmentCount * sizeof (NET_FRAGMENT));
+  if (Fragment == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  NetbufBuildExt (Nbuf, Fragment, &FragmentCount);
+
+  RxData->FragmentCount = 1;
+  Status                = EFI_SUCCESS;
+  Skip                  = Conn->RxSegRcvd;
+  Index                 = 0;
+
+  while (Index < FragmentCount) {
+    if (Skip >= Fragment[Index].Len) {
+      //
+      // This fragment is already received.
+      //
+      Skip -= Fragment[Index].Len;
+      Index++;
+      continue;
+    }
+
+    RxData->DataLength                      = Fragment[Index].Len - Skip;
+    RxData->FragmentTable[0].FragmentLength = Fragment[Index].Len - Skip;
+    RxData->FragmentTable[0].FragmentBuffer = Fragment[Index].Bulk + Skip;
+
+    if (TcpIo->TcpVersion == TCP_VERSION_4) {
+      Status = TcpIo->Tcp.Tcp4->Receive (TcpIo->Tcp.Tcp4, &TcpIo->RxToken.Tcp4Token);
+    } else {
+      Status = TcpIo->Tcp.Tcp6->Receive (TcpIo->Tcp.Tcp6, &TcpIo->RxToken.Tcp6Token);
+    }
+
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+
+    //
+    // TCP completes the receive right away if it has data buffered. Without
+    // NoWait, poll until some data is received or the timeout occurs.
+    //
+    while (!NoWait && !TcpIo->IsRxDone && ((TimeoutEvent == NULL) || EFI_ERROR (gBS->CheckEvent (TimeoutEvent)))) {
+      if (TcpIo->TcpVersion == TCP_VERSION_4) {
+        TcpIo->Tcp.Tcp4->Poll (TcpIo->Tcp.Tcp4);
+      } else {
+        TcpIo->Tcp.Tcp6->Poll (TcpIo->Tcp.Tcp6);
+      }
+    }
+
+    if (!TcpIo->IsRxDone) {
+      //
+      // Take the receive request back. It completes with EFI_ABORTED, unless
+      // some data has just arrived for it.
+      //
+      if (TcpIo->TcpVersion == TCP_VERSION_4) {
+        TcpIo->Tcp.Tcp4->Cancel (TcpIo->Tcp.Tcp4, &TcpIo->RxToken.Tcp4Token.CompletionToken);
+      } else {
+        TcpIo->Tcp.Tcp6->Cancel (TcpIo->Tcp.Tcp6, &TcpIo->RxToken.Tcp6Token.CompletionToken);
+      }
+
+      if (!TcpIo->IsRxDone) {
+        Status = EFI_DEVICE_ERROR;
+        goto ON_EXIT;
+      }
+    }
+
+    TcpIo->IsRxDone = FALSE;
+
+    Status = TcpIo->RxToken.Tcp4Token.CompletionToken.Status;
+    if (Status == EFI_ABORTED) {
+      Status = NoWait ? EFI_NOT_READY : EFI_TIMEOUT;
+    }
+
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+
+    Conn->RxSegRcvd += RxData->FragmentTable[0].FragmentLength;
+    Skip            += RxData->FragmentTable[0].FragmentLength;
+  }
+
+ON_EXIT:
+
+  FreePool (Fragment);
+
+  return Status;
+}
+
+/**
+  Free the PDU partially received on the connection, if any.
+
+  @param[in]  Conn         The iSCSI connection.
+
+**/
+STATIC
+VOID
+IScsiFreeRxPdu (
+  IN ISCSI_CONNECTION  *Conn
+  )
+{
+  if (Conn->RxNbufList != NULL) {
+    IScsiFreeNbufList (Conn->RxNbufList);
+  }
+
+  Conn->RxNbufList = NULL;
+  Conn->RxHdrRcvd  = FALSE;
+  Conn->RxSegRcvd  = 0;
+}
+
+/**
+  Receive an iSCSI response PDU, or the rest of the one partially received on
+  the connection. See IScsiReceivePdu().
 
   @param[in]  Conn         The iSCSI connection to receive data from.
   @param[out] Pdu          The received iSCSI pdu.
@@ -1295,21 +1474,26 @@ IScsiNbufExtFree (
                            buffer to receive data segment of the iSCSI pdu. It is optional.
   @param[in]  HeaderDigest Whether there will be header digest received.
   @param[in]  DataDigest   Whether there will be data digest.
+  @param[in]  NoWait       Return EFI_NOT_READY instead of waiting for the data of
+                           the PDU. What is received so far is kept in Conn.
   @param[in]  TimeoutEvent The timeout event. It is optional.
 
   @retval EFI_SUCCESS          An iSCSI pdu is received.
+  @retval EFI_NOT_READY        NoWait is TRUE and the PDU is not fully received yet.
   @retval EFI_OUT_OF_RESOURCES Failed to allocate memory.
   @retval EFI_PROTOCOL_ERROR   Some kind of iSCSI protocol error occurred.
   @retval Others               Other errors as indicated.
 
 **/
+STATIC
 EFI_STATUS
-IScsiReceivePdu (
+IScsiReceivePduWorker (
   IN ISCSI_CONNECTION         *Conn,
   OUT NET_BUF                 **Pdu,
   IN ISCSI_IN_BUFFER_CONTEXT  *Context  OPTIONAL,
   IN BOOLEAN                  HeaderDigest,
   IN BOOLEAN                  DataDigest,
+  IN BOOLEAN                  NoWait,
   IN EFI_EVENT                TimeoutEvent OPTIONAL
   )
 {
@@ -1323,135 +1507,164 @@ IScsiReceivePdu (
   NET_FRAGMENT  Fragment[2];
   UINT32        FragmentCount;
   NET_BUF       *DataSeg;
-  UINT32        PadAndCRC32[2];
-
-  NbufList = AllocatePool (sizeof (LIST_ENTRY));
-  if (NbufList == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  InitializeListHead (NbufList);
+  ISCSI_TCB     *Tcb;
 
-  //
-  // The header digest will be received together with the PDU header, if exists.
-  //
-  Len    = sizeof (ISCSI_BASIC_HEADER) + (HeaderDigest ? sizeof (UINT32) : 0);
-  PduHdr = NetbufAlloc (Len);
-  if (PduHdr == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto ON_EXIT;
-  }
+  if (Conn->RxNbufList == NULL) {
+    NbufList = AllocatePool (sizeof (LIST_ENTRY));
+    if (NbufList == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
 
-  Header = NetbufAllocSpace (PduHdr, Len, NET_BUF_TAIL);
-  if (Header == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto ON_EXIT;
-  }
+    InitializeListHead (NbufList);
+    Conn->RxNbufList = NbufList;
+    Conn->RxHdrRcvd  = FALSE;
+    Conn->RxSegRcvd  = 0;
 
-  InsertTailList (NbufList, &PduHdr->List);
+    //
+    // The header digest will be received together with the PDU header, if exists.
+    //
+    Len    = sizeof (ISCSI_BASIC_HEADER) + (HeaderDigest ? sizeof (UINT32) : 0);
+    PduHdr = NetbufAlloc (Len);
+    if (PduHdr == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto ON_EXIT;
+    }
 
-  //
-  // First step, receive the BHS of the PDU.
-  //
-  Status = TcpIoReceive (&Conn->TcpIo, PduHdr, FALSE, TimeoutEvent);
+    Header = NetbufAllocSpace (PduHdr, Len, NET_BUF_TAIL);
+    if (Header == NULL) {
+      NetbufFree (PduHdr);
+      Status = EFI_OUT_OF_RESOURCES;
+      goto ON_EXIT;
+    }
 
-  if (EFI_ERROR (Status)) {
-    goto ON_EXIT;
+    InsertTailList (NbufList, &PduHdr->List);
   }
 
-  if (HeaderDigest) {
-    //
-    // TODO: check the header-digest.
-    //
-    //
-    // Trim off the digest.
-    //
-    NetbufTrim (PduHdr, sizeof (UINT32), NET_BUF_TAIL);
-  }
+  NbufList = Conn->RxNbufList;
+  PduHdr   = NET_LIST_USER_STRUCT (NbufList->ForwardLink, NET_BUF, List);
+  Header   = NetbufGetByte (PduHdr, 0, NULL);
 
-  Len = ISCSI_GET_DATASEG_LEN (Header);
-  if (Len == 0) {
+  if (!Conn->RxHdrRcvd) {
     //
-    // No data segment.
+    // First step, receive the BHS of the PDU.
     //
-    goto FORM_PDU;
-  }
+    Status = IScsiReceiveNbuf (Conn, PduHdr, NoWait, TimeoutEvent);
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
 
-  //
-  // Get the length of the padding bytes of the data segment.
-  //
-  PadLen = ISCSI_GET_PAD_LEN (Len);
+    Conn->RxHdrRcvd = TRUE;
+    Conn->RxSegRcvd = 0;
 
-  switch (ISCSI_GET_OPCODE (Header)) {
-    case ISCSI_OPCODE_SCSI_DATA_IN:
+    if (HeaderDigest) {
       //
-      // To reduce memory copy overhead, try to use the buffer described by Context
-      // if the PDU is an iSCSI SCSI data.
+      // TODO: check the header-digest.
       //
-      InDataOffset = ISCSI_GET_BUFFER_OFFSET (Header);
-      if ((Context == NULL) || ((InDataOffset + Len) > Context->InDataLen)) {
-        Status = EFI_PROTOCOL_ERROR;
-        goto ON_EXIT;
-      }
+      //
+      // Trim off the digest.
+      //
+      NetbufTrim (PduHdr, sizeof (UINT32), NET_BUF_TAIL);
+    }
 
-      Fragment[0].Len  = Len;
-      Fragment[0].Bulk = Context->InData + InDataOffset;
+    Len = ISCSI_GET_DATASEG_LEN (Header);
+    if (Len == 0) {
+      //
+      // No data segment.
+      //
+      goto FORM_PDU;
+    }
 
-      if (DataDigest || (PadLen != 0)) {
+    //
+    // Get the length of the padding bytes of the data segment.
+    //
+    PadLen = ISCSI_GET_PAD_LEN (Len);
+
+    switch (ISCSI_GET_OPCODE (Header)) {
+      case ISCSI_OPCODE_SCSI_DATA_IN:
         //
-        // The data segment is padded. Use two fragments to receive it:
-        // the first to receive the useful data; the second to receive the padding.
+        // To reduce memory copy overhead, try to use the buffer described by Context
+        // if the PDU is an iSCSI SCSI data.
         //
-        Fragment[1].Len  = PadLen + (DataDigest ? sizeof (UINT32) : 0);
-        Fragment[1].Bulk = (UINT8 *)PadAndCRC32 + (4 - PadLen);
+        InDataOffset = ISCSI_GET_BUFFER_OFFSET (Header);
+        if ((Context == NULL) && (Conn->Session != NULL)) {
+          //
+          // Without a given buffer, the data goes to the buffer of the command
+          // it belongs to, as several commands may be in flight.
+          //
+          Tcb = IScsiFindTcb (Conn->Session, NTOHL (((ISCSI_BASIC_HEADER *)Header)->InitiatorTaskTag));
+          if (Tcb != NULL) {
+            Context = &Tcb->InBufferContext;
+          }
+        }
+
+        if ((Context == NULL) || ((InDataOffset + Len) > Context->InDataLen)) {
+          Status = EFI_PROTOCOL_ERROR;
+          goto ON_EXIT;
+        }
+
+        Fragment[0].Len  = Len;
+        Fragment[0].Bulk = Context->InData + InDataOffset;
+
+        if (DataDigest || (PadLen != 0)) {
+          //
+          // The data segment is padded. Use two fragments to receive it:
+          // the first to receive the useful data; the second to receive the padding.
+          //
+          Fragment[1].Len  = PadLen + (DataDigest ? sizeof (UINT32) : 0);
+          Fragment[1].Bulk = (UINT8 *)Conn->RxPadAndCRC32 + (4 - PadLen);
+
+          FragmentCount = 2;
+        } else {
+          FragmentCount = 1;
+        }
+
+        DataSeg = NetbufFromExt (&Fragment[0], FragmentCount, 0, 0, IScsiNbufExtFree, NULL);
+        if (DataSeg == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          goto ON_EXIT;
+        }
 
-        FragmentCount = 2;
-      } else {
-        FragmentCount = 1;
-      }
-
-      DataSeg = NetbufFromExt (&Fragment[0], FragmentCount, 0, 0, IScsiNbufExtFree, NULL);
-      if (DataSeg == NULL) {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto ON_EXIT;
-      }
+        break;
 
-      break;
+      case ISCSI_OPCODE_SCSI_RSP:
+      case ISCSI_OPCODE_NOP_IN:
+      case ISCSI_OPCODE_LOGIN_RSP:
+      case ISCSI_OPCODE_TEXT_RSP:
+      case ISCSI_OPCODE_ASYNC_MSG:
+      case ISCSI_OPCODE_REJECT:
+      case ISCSI_OPCODE_VENDOR_T0:
+      case ISCSI_OPCODE_VENDOR_T1:
+      case ISCSI_OPCODE_VENDOR_T2:
+        //
+        // Allocate buffer to receive the data segment.
+        //
+        Len    += PadLen + (DataDigest ? sizeof (UINT32) : 0);
+        DataSeg = NetbufAlloc (Len);
+        if (DataSeg == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          goto ON_EXIT;
+        }
+
+        NetbufAllocSpace (DataSeg, Len, NET_BUF_TAIL);
+        break;
 
-    case ISCSI_OPCODE_SCSI_RSP:
-    case ISCSI_OPCODE_NOP_IN:
-    case ISCSI_OPCODE_LOGIN_RSP:
-    case ISCSI_OPCODE_TEXT_RSP:
-    case ISCSI_OPCODE_ASYNC_MSG:
-    case ISCSI_OPCODE_REJECT:
-    case ISCSI_OPCODE_VENDOR_T0:
-    case ISCSI_OPCODE_VENDOR_T1:
-    case ISCSI_OPCODE_VENDOR_T2:
-      //
-      // Allocate buffer to receive the data segment.
-      //
-      Len    += PadLen + (DataDigest ? sizeof (UINT32) : 0);
-      DataSeg = NetbufAlloc (Len);
-      if (DataSeg == NULL) {
-        Status = EFI_OUT_OF_RESOURCES;
+      default:
+        Status = EFI_PROTOCOL_ERROR;
         goto ON_EXIT;
-      }
-
-      NetbufAllocSpace (DataSeg, Len, NET_BUF_TAIL);
-      break;
+    }
 
-    default:
-      Status = EFI_PROTOCOL_ERROR;
-      goto ON_EXIT;
+    InsertTailList (NbufList, &DataSeg->List);
+  } else if (ISCSI_GET_DATASEG_LEN (Header) == 0) {
+    goto FORM_PDU;
   }
 
-  InsertTailList (NbufList, &DataSeg->List);
+  DataSeg = NET_LIST_USER_STRUCT (NbufList->BackLink, NET_BUF, List);
+  PadLen  = ISCSI_GET_PAD_LEN (ISCSI_GET_DATASEG_LEN (Header));
 
   //
   // Receive the data segment with the data digest, if any.
   //
-  Status = TcpIoReceive (&Conn->TcpIo, DataSeg, FALSE, TimeoutEvent);
-
+  Status = IScsiReceiveNbuf (Conn, DataSeg, NoWait, TimeoutEvent);
   if (EFI_ERROR (Status)) {
     goto ON_EXIT;
   }
@@ -1477,20 +1690,63 @@ FORM_PDU:
   *Pdu = NetbufFromBufList (NbufList, 0, 0, IScsiFreeNbufList, NbufList);
   if (*Pdu == NULL) {
     Status = EFI_OUT_OF_RESOURCES;
+    goto ON_EXIT;
   }
 
+  //
+  // The PDU owns the NbufList now.
+  //
+  Conn->RxNbufList = NULL;
+  Status           = EFI_SUCCESS;
+
 ON_EXIT:
 
-  if (EFI_ERROR (Status)) {
+  if (EFI_ERROR (Status) && (Status != EFI_NOT_READY)) {
     //
     // Free the Nbufs in this NbufList and the NbufList itself.
     //
-    IScsiFreeNbufList (NbufList);
+    IScsiFreeRxPdu (Conn);
   }
 
   return Status;
 }
 
+/**
+  Receive an iSCSI response PDU. An iSCSI response PDU contains an iSCSI PDU header and
+  an optional data segment. The two parts will be put into two blocks of buffers in the
+  net buffer. The digest check will be conducted in this function if needed and the digests
+  will be trimmed from the PDU buffer.
+
+  If the session poll timer has received a part of a PDU, the rest of that PDU is
+  received first.
+
+  @param[in]  Conn         The iSCSI connection to receive data from.
+  @param[out] Pdu          The received iSCSI pdu.
+  @param[in]  Context      The context used to describe information on the caller provided
+                           buffer to receive data segment of the iSCSI pdu. It is optional.
+  @param[in]  HeaderDigest Whether there will be header digest received.
+  @param[in]  DataDigest   Whether there will be data digest.
+  @param[in]  TimeoutEvent The timeout event. It is optional.
+
+  @retval EFI_SUCCESS          An iSCSI pdu is received.
+  @retval EFI_OUT_OF_RESOURCES Failed to allocate memory.
+  @retval EFI_PROTOCOL_ERROR   Some kind of iSCSI protocol error occurred.
+  @retval Others               Other errors as indicated.
+
+**/
+EFI_STATUS
+IScsiReceivePdu (
+  IN ISCSI_CONNECTION         *Conn,
+  OUT NET_BUF                 **Pdu,
+  IN ISCSI_IN_BUFFER_CONTEXT  *Context  OPTIONAL,
+  IN BOOLEAN                  HeaderDigest,
+  IN BOOLEAN                  DataDigest,
+  IN EFI_EVENT                TimeoutEvent OPTIONAL
+  )
+{
+  return IScsiReceivePduWorker (Conn, Pdu, Context, HeaderDigest, DataDigest, FALSE, TimeoutEvent);
+}
+
 /**
   Check and get the result of the parameter negotiation.
 
@@ -2882,17 +3138,277 @@ IScsiOnNopInRcvd (
   return EFI_SUCCESS;
 }
 
+/**
+  Complete a nonblocking SCSI command: report the result through its request
+  packet, release the task control block and signal the caller.
+
+  @param[in]  Tcb              The task control block of the command.
+  @param[in]  Status           The result of the command.
+
+**/
+STATIC
+VOID
+IScsiCompleteTcb (
+  IN ISCSI_TCB   *Tcb,
+  IN EFI_STATUS  Status
+  )
+{
+  EFI_EVENT  Event;
+
+  ASSERT (Tcb->Event != NULL);
+
+  if (EFI_ERROR (Status) && (Status != EFI_BAD_BUFFER_SIZE)) {
+    if (Status == EFI_TIMEOUT) {
+      Tcb->Packet->HostAdapterStatus = EFI_EXT_SCSI_STATUS_HOST_ADAPTER_TIMEOUT_COMMAND;
+    } else {
+      Tcb->Packet->HostAdapterStatus = EFI_EXT_SCSI_STATUS_HOST_ADAPTER_OTHER;
+    }
+  }
+
+  Event = Tcb->Event;
+  Tcb->Conn->Session->NumAsyncTcbs--;
+  IScsiDelTcb (Tcb);
+
+  gBS->SignalEvent (Event);
+}
+
+/**
+  Fail all the nonblocking SCSI commands in flight on the session.
+
+  @param[in]  Session          The iSCSI session.
+  @param[in]  Status           The error to report.
+
+**/
+STATIC
+VOID
+IScsiFlushAsyncTcbs (
+  IN ISCSI_SESSION  *Session,
+  IN EFI_STATUS     Status
+  )
+{
+  LIST_ENTRY  *Entry;
+  LIST_ENTRY  *Next;
+  ISCSI_TCB   *Tcb;
+
+  NET_LIST_FOR_EACH_SAFE (Entry, Next, &Session->TcbList) {
+    Tcb = NET_LIST_USER_STRUCT (Entry, ISCSI_TCB, Link);
+    if (Tcb->Event != NULL) {
+      IScsiCompleteTcb (Tcb, Status);
+    }
+  }
+}
+
+/**
+  Process a PDU received in the full feature phase and route it to the task
+  it belongs to. A nonblocking task is completed here once its status is
+  received.
+
+  @param[in]  Conn             The connection the PDU is received on.
+  @param[in]  Pdu              The PDU received.
+
+  @retval EFI_SUCCESS          The PDU is processed.
+  @retval EFI_PROTOCOL_ERROR   Some kind of iSCSI protocol error occurred.
+  @retval Others               Other errors as indicated.
+
+**/
+STATIC
+EFI_STATUS
+IScsiOnPduRcvd (
+  IN ISCSI_CONNECTION  *Conn,
+  IN NET_BUF           *Pdu
+  )
+{
+  EFI_STATUS          Status;
+  ISCSI_BASIC_HEADER  *PduHdr;
+  ISCSI_TCB           *Tcb;
+
+  PduHdr = (ISCSI_BASIC_HEADER *)NetbufGetByte (Pdu, 0, NULL);
+  if (PduHdr == NULL) {
+    return EFI_PROTOCOL_ERROR;
+  }
+
+  Tcb = IScsiFindTcb (Conn->Session, NTOHL (PduHdr->InitiatorTaskTag));
+  if ((Tcb == NULL) && (ISCSI_GET_OPCODE (PduHdr) == ISCSI_OPCODE_NOP_IN)) {
+    //
+    // An unsolicited NOP In only updates the sequence numbers, any task of
+    // the connection will do.
+    //
+    ASSERT (!IsListEmpty (&Conn->Session->TcbList));
+    Tcb = NET_LIST_USER_STRUCT (Conn->Session->TcbList.ForwardLink, ISCSI_TCB, Link);
+  }
+
+  switch (ISCSI_GET_OPCODE (PduHdr)) {
+    case ISCSI_OPCODE_SCSI_DATA_IN:
+      if (Tcb == NULL) {
+        return EFI_PROTOCOL_ERROR;
+      }
+
+      Status = IScsiOnDataInRcvd (Pdu, Tcb, Tcb->Packet);
+      break;
+
+    case ISCSI_OPCODE_R2T:
+      if (Tcb == NULL) {
+        return EFI_PROTOCOL_ERROR;
+      }
+
+      Status = IScsiOnR2TRcvd (Pdu, Tcb, Tcb->Lun, Tcb->Packet);
+      break;
+
+    case ISCSI_OPCODE_SCSI_RSP:
+      if (Tcb == NULL) {
+        return EFI_PROTOCOL_ERROR;
+      }
+
+      Status = IScsiOnScsiRspRcvd (Pdu, Tcb, Tcb->Packet);
+      break;
+
+    case ISCSI_OPCODE_NOP_IN:
+      return IScsiOnNopInRcvd (Pdu, Tcb);
+
+    case ISCSI_OPCODE_VENDOR_T0:
+    case ISCSI_OPCODE_VENDOR_T1:
+    case ISCSI_OPCODE_VENDOR_T2:
+      //
+      // These messages are vendor specific. Skip them.
+      //
+      return EFI_SUCCESS;
+
+    default:
+      return EFI_PROTOCOL_ERROR;
+  }
+
+  if ((Tcb->Event != NULL) && (Tcb->StatusXferd || EFI_ERROR (Status))) {
+    IScsiCompleteTcb (Tcb, Status);
+
+    //
+    // A residual overflow is reported to the caller through the packet only,
+    // it does not break the connection.
+    //
+    if (Status == EFI_BAD_BUFFER_SIZE) {
+      Status = EFI_SUCCESS;
+    }
+  }
+
+  return Status;
+}
+
+/**
+  Timer notify function to make progress on the nonblocking SCSI commands of
+  the session. It polls the TCP connection once and processes the PDUs already
+  received, it never waits for the target. A command that does not complete
+  in its timeout fails, and the session is aborted as the target still owns
+  the task. A command with a timeout of zero never times out.
+
+  @param[in]  Event            The poll timer event.
+  @param[in]  Context          The iSCSI session.
+
+**/
+STATIC
+VOID
+EFIAPI
+IScsiOnPollTimer (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  EFI_STATUS        Status;
+  ISCSI_SESSION     *Session;
+  ISCSI_CONNECTION  *Conn;
+  ISCSI_TCB         *Tcb;
+  LIST_ENTRY        *Entry;
+  LIST_ENTRY        *Next;
+  NET_BUF           *Pdu;
+
+  Session = (ISCSI_SESSION *)Context;
+
+  //
+  // A command in progress drives the connection by itself.
+  //
+  if ((Session->State != SESSION_STATE_LOGGED_IN) || (Session->NestingLevel != 0) || (Session->NumAsyncTcbs == 0)) {
+    return;
+  }
+
+  Session->NestingLevel++;
+
+  Conn = NET_LIST_USER_STRUCT_S (
+           Session->Conns.ForwardLink,
+           ISCSI_CONNECTION,
+           Link,
+           ISCSI_CONNECTION_SIGNATURE
+           );
+
+  if (Conn->TcpIo.TcpVersion == TCP_VERSION_4) {
+    Conn->TcpIo.Tcp.Tcp4->Poll (Conn->TcpIo.Tcp.Tcp4);
+  } else {
+    Conn->TcpIo.Tcp.Tcp6->Poll (Conn->TcpIo.Tcp.Tcp6);
+  }
+
+  Status = EFI_SUCCESS;
+  while (Session->NumAsyncTcbs != 0) {
+    Status = IScsiReceivePduWorker (Conn, &Pdu, NULL, FALSE, FALSE, TRUE, NULL);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    Status = IScsiOnPduRcvd (Conn, Pdu);
+    NetbufFree (Pdu);
+
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+  }
+
+  if (Status == EFI_NOT_READY) {
+    Status = EFI_SUCCESS;
+  }
+
+  if (!EFI_ERROR (Status)) {
+    NET_LIST_FOR_EACH_SAFE (Entry, Next, &Session->TcbList) {
+      Tcb = NET_LIST_USER_STRUCT (Entry, ISCSI_TCB, Link);
+      if ((Tcb->Event == NULL) || (Tcb->TimeLeft == 0)) {
+        continue;
+      }
+
+      if (Tcb->TimeLeft > ISCSI_POLL_INTERVAL) {
+        Tcb->TimeLeft -= ISCSI_POLL_INTERVAL;
+      } else {
+        IScsiCompleteTcb (Tcb, EFI_TIMEOUT);
+        Status = EFI_ABORTED;
+      }
+    }
+  }
+
+  Session->NestingLevel--;
+
+  if (EFI_ERROR (Status)) {
+    //
+    // The connection is out of step with the target. Fail the outstanding
+    // commands and drop the connection, the next command reinstates the session.
+    //
+    IScsiFlushAsyncTcbs (Session, Status);
+    IScsiSessionAbort (Session);
+  }
+}
+
 /**
   Execute the SCSI command issued through the EXT SCSI PASS THRU protocol.
 
+  If Event is NULL, the command is executed in blocking mode. Otherwise the
+  command is only sent and this function returns; the command is completed by
+  the session poll timer and Event is signaled then. Several nonblocking
+  commands may be in flight at the same time, up to the command window
+  granted by the target.
+
   @param[in]       PassThru  The EXT SCSI PASS THRU protocol.
   @param[in]       Target    The target ID.
   @param[in]       Lun       The LUN.
   @param[in, out]  Packet    The request packet containing IO request, SCSI command
                              buffer and buffers to read/write.
+  @param[in]       Event     The event to signal when a nonblocking command completes.
+                             This parameter is optional and may be NULL.
 
   @retval EFI_SUCCESS          The SCSI command is executed and the result is updated to
-                               the Packet.
+                               the Packet, or the nonblocking command is sent.
   @retval EFI_DEVICE_ERROR     Session state was not as required.
   @retval EFI_OUT_OF_RESOURCES Failed to allocate memory.
   @retval EFI_PROTOCOL_ERROR   There is no such data in the net buffer.
@@ -2905,21 +3421,21 @@ IScsiExecuteScsiCommand (
   IN EFI_EXT_SCSI_PASS_THRU_PROTOCOL                 *PassThru,
   IN UINT8                                           *Target,
   IN UINT64                                          Lun,
-  IN OUT EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET  *Packet
+  IN OUT EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET  *Packet,
+  IN EFI_EVENT                                       Event     OPTIONAL
   )
 {
-  EFI_STATUS               Status;
-  ISCSI_DRIVER_DATA        *Private;
-  ISCSI_SESSION            *Session;
-  EFI_EVENT                TimeoutEvent;
-  ISCSI_CONNECTION         *Conn;
-  ISCSI_TCB                *Tcb;
-  NET_BUF                  *Pdu;
-  ISCSI_XFER_CONTEXT       *XferContext;
-  UINT8                    *Data;
-  ISCSI_IN_BUFFER_CONTEXT  InBufferContext;
-  UINT64                   Timeout;
-  UINT8                    *PduHdr;
+  EFI_STATUS          Status;
+  ISCSI_DRIVER_DATA   *Private;
+  ISCSI_SESSION       *Session;
+  EFI_EVENT           TimeoutEvent;
+  ISCSI_CONNECTION    *Conn;
+  ISCSI_TCB           *Tcb;
+  NET_BUF             *Pdu;
+  ISCSI_XFER_CONTEXT  *XferContext;
+  UINT8               *Data;
+  UINT64              Timeout;
+  UINT8               *PduHdr;
 
   Private      = ISCSI_DRIVER_DATA_FROM_EXT_SCSI_PASS_THRU (PassThru);
   Session      = Private->Session;
@@ -2928,6 +3444,13 @@ IScsiExecuteScsiCommand (
   TimeoutEvent = NULL;
   Timeout      = 0;
 
+  //
+  // Keep the session poll timer off the connection while this command uses it.
+  // The count allows the protocol to be called again from a notify function
+  // while this command is in progress.
+  //
+  Session->NestingLevel++;
+
   if (Session->State != SESSION_STATE_LOGGED_IN) {
     Status = EFI_DEVICE_ERROR;
     goto ON_EXIT;
@@ -2944,11 +3467,36 @@ IScsiExecuteScsiCommand (
     Timeout = MultU64x32 (Packet->Timeout, 4);
   }
 
+  if ((Event != NULL) && (Session->PollEvent == NULL)) {
+    Status = gBS->CreateEvent (
+                    EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                    TPL_CALLBACK,
+                    IScsiOnPollTimer,
+                    Session,
+                    &Session->PollEvent
+                    );
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+
+    Status = gBS->SetTimer (Session->PollEvent, TimerPeriodic, ISCSI_POLL_INTERVAL);
+    if (EFI_ERROR (Status)) {
+      gBS->CloseEvent (Session->PollEvent);
+      Session->PollEvent = NULL;
+      goto ON_EXIT;
+    }
+  }
+
   Status = IScsiNewTcb (Conn, &Tcb);
   if (EFI_ERROR (Status)) {
     goto ON_EXIT;
   }
 
+  Tcb->Packet                    = Packet;
+  Tcb->Lun                       = Lun;
+  Tcb->InBufferContext.InData    = (UINT8 *)Packet->InDataBuffer;
+  Tcb->InBufferContext.InDataLen = Packet->InTransferLength;
+
   //
   // Encapsulate the SCSI request packet into an iSCSI SCSI Command PDU.
   //
@@ -3001,8 +3549,16 @@ IScsiExecuteScsiCommand (
     }
   }
 
-  InBufferContext.InData    = (UINT8 *)Packet->InDataBuffer;
-  InBufferContext.InDataLen = Packet->InTransferLength;
+  if (Event != NULL) {
+    //
+    // The command is on the wire, leave the rest to the session poll timer.
+    //
+    Tcb->Event    = Event;
+    Tcb->TimeLeft = Timeout;
+    Tcb           = NULL;
+    Session->NumAsyncTcbs++;
+    goto ON_EXIT;
+  }
 
   while (!Tcb->StatusXferd) {
     //
@@ -3018,49 +3574,15 @@ IScsiExecuteScsiCommand (
     }
 
     //
-    // Try to receive PDU from target.
+    // Try to receive PDU from target. It may belong to this command or to
+    // one of the nonblocking commands in flight.
     //
-    Status = IScsiReceivePdu (Conn, &Pdu, &InBufferContext, FALSE, FALSE, TimeoutEvent);
+    Status = IScsiReceivePdu (Conn, &Pdu, NULL, FALSE, FALSE, TimeoutEvent);
     if (EFI_ERROR (Status)) {
       goto ON_EXIT;
     }
 
-    PduHdr = NetbufGetByte (Pdu, 0, NULL);
-    if (PduHdr == NULL) {
-      Status = EFI_PROTOCOL_ERROR;
-      NetbufFree (Pdu);
-      goto ON_EXIT;
-    }
-
-    switch (ISCSI_GET_OPCODE (PduHdr)) {
-      case ISCSI_OPCODE_SCSI_DATA_IN:
-        Status = IScsiOnDataInRcvd (Pdu, Tcb, Packet);
-        break;
-
-      case ISCSI_OPCODE_R2T:
-        Status = IScsiOnR2TRcvd (Pdu, Tcb, Lun, Packet);
-        break;
-
-      case ISCSI_OPCODE_SCSI_RSP:
-        Status = IScsiOnScsiRspRcvd (Pdu, Tcb, Packet);
-        break;
-
-      case ISCSI_OPCODE_NOP_IN:
-        Status = IScsiOnNopInRcvd (Pdu, Tcb);
-        break;
-
-      case ISCSI_OPCODE_VENDOR_T0:
-      case ISCSI_OPCODE_VENDOR_T1:
-      case ISCSI_OPCODE_VENDOR_T2:
-        //
-        // These messages are vendor specific. Skip them.
-        //
-        break;
-
-      default:
-        Status = EFI_PROTOCOL_ERROR;
-        break;
-    }
+    Status = IScsiOnPduRcvd (Conn, Pdu);
 
     NetbufFree (Pdu);
 
@@ -3079,6 +3601,8 @@ ON_EXIT:
     IScsiDelTcb (Tcb);
   }
 
+  Session->NestingLevel--;
+
   return Status;
 }
 
@@ -3174,6 +3698,17 @@ IScsiSessionAbort (
     return;
   }
 
+  //
+  // The nonblocking commands in flight cannot complete on the connections
+  // being reset.
+  //
+  IScsiFlushAsyncTcbs (Session, EFI_ABORTED);
+
+  if (Session->PollEvent != NULL) {
+    gBS->CloseEvent (Session->PollEvent);
+    Session->PollEvent = NULL;
+  }
+
   ASSERT (!IsListEmpty (&Session->Conns));
 
   while (!IsListEmpty (&Session->Conns)) {
@@ -31,6 +31,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define MAX_RECV_DATA_SEG_LEN_IN_FFP   65536
 #define DEFAULT_MAX_OUTSTANDING_R2T    1
 
+#define ISCSI_POLL_INTERVAL  EFI_TIMER_PERIOD_MILLISECONDS (1)
+
 #define ISCSI_VERSION_MAX  0x00
 #define ISCSI_VERSION_MIN  0x00
 
@@ -611,6 +613,12 @@ typedef struct _ISCSI_TCB {
   ISCSI_XFER_CONTEXT    XferContext;
 
   ISCSI_CONNECTION      *Conn;
+
+  EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET    *Packet;
+  UINT64                                        Lun;
+  ISCSI_IN_BUFFER_CONTEXT                       InBufferContext;
+  EFI_EVENT                                     Event;    ///< Signaled when a nonblocking command completes.
+  UINT64                                        TimeLeft; ///< Until a nonblocking command times out, 0 for never.
 } ISCSI_TCB;
 
 typedef struct _ISCSI_KEY_VALUE_PAIR {
@@ -977,9 +985,11 @@ IScsiNormalizeName (
   @param[in]       Lun       The LUN.
   @param[in, out]  Packet    The request packet containing IO request, SCSI command
                              buffer and buffers to read/write.
+  @param[in]       Event     The event to signal when a nonblocking command completes.
+                             If NULL, the command is executed in blocking mode.
 
   @retval EFI_SUCCESS          The SCSI command is executed and the result is updated to
-                               the Packet.
+                               the Packet, or the nonblocking command is sent.
   @retval EFI_DEVICE_ERROR     Session state was not as required.
   @retval EFI_OUT_OF_RESOURCES Failed to allocate memory.
   @retval EFI_NOT_READY        The target can not accept new commands.
@@ -991,7 +1001,8 @@ IScsiExecuteScsiCommand (
   IN EFI_EXT_SCSI_PASS_THRU_PROTOCOL                 *PassThru,
   IN UINT8                                           *Target,
   IN UINT64                                          Lun,
-  IN OUT EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET  *Packet
+  IN OUT EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET  *Packet,
+  IN EFI_EVENT                                       Event     OPTIONAL
   );
 
 /**
@@ -0,0 +1,937 @@
+/** @file
+  Host based unit tests of the nonblocking SCSI commands of IScsiDxe. The
+  session poll timer is driven by hand against a fake TCP connection, so the
+  tests can check that it never waits for the target.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include "../IScsiImpl.h"
+
+#include <Library/UnitTestLib.h>
+
+#define UNIT_TEST_APP_NAME     "IScsiDxe Poll Timer Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// Number of poll timer ticks run with no data from the target.
+//
+#define TEST_IDLE_TICKS  1000
+
+//
+// A command timeout of 10 ms, in 100 ns units.
+//
+#define TEST_COMMAND_TIMEOUT  100000
+
+//
+// The events of the fake boot services.
+//
+typedef struct {
+  UINT32              Type;
+  EFI_EVENT_NOTIFY    NotifyFunction;
+  VOID                *NotifyContext;
+  BOOLEAN             Signaled;
+} TEST_EVENT;
+
+//
+// The data the fake target has sent, and the receive request waiting for it.
+//
+UINT8                    mRxBuffer[256];
+UINT32                   mRxLength;
+UINT32                   mRxOffset;
+EFI_TCP4_IO_TOKEN        *mRxPending;
+UINT32                   mTransmitCount;
+UINT32                   mLastTaskTag;
+TEST_EVENT               *mPollEvent;
+EFI_BOOT_SERVICES        mTestBootServices;
+EFI_TCP4_PROTOCOL        mTestTcp4;
+EFI_TCP4_RECEIVE_DATA    mTestRxData;
+ISCSI_DRIVER_DATA        mTestPrivate;
+ISCSI_SESSION            mTestSession;
+
+/**
+  Fake of EFI_BOOT_SERVICES.FreePool(), for the net buffers.
+
+  @param[in]  Buffer  The buffer to free.
+
+  @retval EFI_SUCCESS  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+TestFreePool (
+  IN VOID  *Buffer
+  )
+{
+  FreePool (Buffer);
+  return EFI_SUCCESS;
+}
+
+/**
+  Fake of EFI_BOOT_SERVICES.CreateEvent().
+
+  @param[in]  Type            The type of event to create.
+  @param[in]  NotifyTpl       The task priority level of the notify function.
+  @param[in]  NotifyFunction  The notify function.
+  @param[in]  NotifyContext   The context of the notify function.
+  @param[out] Event           The event created.
+
+  @retval EFI_SUCCESS           The event is created.
+  @retval EFI_OUT_OF_RESOURCES  Failed to allocate memory.
+
+**/
+EFI_STATUS
+EFIAPI
+TestCreateEvent (
+  IN  UINT32            Type,
+  IN  EFI_TPL           NotifyTpl,
+  IN  EFI_EVENT_NOTIFY  NotifyFunction  OPTIONAL,
+  IN  VOID              *NotifyContext  OPTIONAL,
+  OUT EFI_EVENT         *Event
+  )
+{
+  TEST_EVENT  *TestEvent;
+
+  TestEvent = AllocateZeroPool (sizeof (TEST_EVENT));
+  if (TestEvent == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  TestEvent->Type           = Type;
+  TestEvent->NotifyFunction = NotifyFunction;
+  TestEvent->NotifyContext  = NotifyContext;
+
+  if ((Type & EVT_TIMER) != 0) {
+    mPollEvent = TestEvent;
+  }
+
+  *Event = TestEvent;
+  return EFI_SUCCESS;
+}
+
+/**
+  Fake of EFI_BOOT_SERVICES.SetTimer(). The timers never fire by themselves,
+  the tests call the poll timer notify function instead.
+
+  @param[in]  Event        The timer event.
+  @param[in]  Type         The type of the timer.
+  @param[in]  TriggerTime  The trigger time.
+
+  @retval EFI_SUCCESS  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+TestSetTimer (
+  IN EFI_EVENT        Event,
+  IN EFI_TIMER_DELAY  Type,
+  IN UINT64           TriggerTime
+  )
+{
+  return EFI_SUCCESS;
+}
+
+/**
+  Fake of EFI_BOOT_SERVICES.SignalEvent(). The notify function is called
+  right away.
+
+  @param[in]  Event  The event to signal.
+
+  @retval EFI_SUCCESS  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+TestSignalEvent (
+  IN EFI_EVENT  Event
+  )
+{
+  TEST_EVENT  *TestEvent;
+
+  TestEvent           = (TEST_EVENT *)Event;
+  TestEvent->Signaled = TRUE;
+  if (((TestEvent->Type & EVT_NOTIFY_SIGNAL) != 0) && (TestEvent->NotifyFunction != NULL)) {
+    TestEvent->NotifyFunction (Event, TestEvent->NotifyContext);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Fake of EFI_BOOT_SERVICES.CheckEvent().
+
+  @param[in]  Event  The event to check.
+
+  @retval EFI_SUCCESS    The event is signaled.
+  @retval EFI_NOT_READY  The event is not signaled.
+
+**/
+EFI_STATUS
+EFIAPI
+TestCheckEvent (
+  IN EFI_EVENT  Event
+  )
+{
+  return ((TEST_EVENT *)Event)->Signaled ? EFI_SUCCESS : EFI_NOT_READY;
+}
+
+/**
+  Fake of EFI_BOOT_SERVICES.CloseEvent().
+
+  @param[in]  Event  The event to close.
+
+  @retval EFI_SUCCESS  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+TestCloseEvent (
+  IN EFI_EVENT  Event
+  )
+{
+  if (Event == mPollEvent) {
+    mPollEvent = NULL;
+  }
+
+  FreePool (Event);
+  return EFI_SUCCESS;
+}
+
+/**
+  Fake of EFI_BOOT_SERVICES.CloseProtocol().
+
+  @param[in]  Handle            The handle.
+  @param[in]  Protocol          The protocol.
+  @param[in]  AgentHandle       The agent handle.
+  @param[in]  ControllerHandle  The controller handle.
+
+  @retval EFI_SUCCESS  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+TestCloseProtocol (
+  IN EFI_HANDLE  Handle,
+  IN EFI_GUID    *Protocol,
+  IN EFI_HANDLE  AgentHandle,
+  IN EFI_HANDLE  ControllerHandle
+  )
+{
+  return EFI_SUCCESS;
+}
+
+/**
+  Complete the pending receive request with the data the target has sent.
+
+**/
+VOID
+TestCompleteReceive (
+  VOID
+  )
+{
+  EFI_TCP4_IO_TOKEN      *Token;
+  EFI_TCP4_RECEIVE_DATA  *RxData;
+  UINT32                 Length;
+
+  Token = mRxPending;
+  if ((Token == NULL) || (mRxOffset == mRxLength)) {
+    return;
+  }
+
+  RxData = Token->Packet.RxData;
+  Length = MIN (RxData->FragmentTable[0].FragmentLength, mRxLength - mRxOffset);
+  CopyMem (RxData->FragmentTable[0].FragmentBuffer, mRxBuffer + mRxOffset, Length);
+  mRxOffset                              += Length;
+  RxData->DataLength                      = Length;
+  RxData->FragmentTable[0].FragmentLength = Length;
+
+  mRxPending                    = NULL;
+  Token->CompletionToken.Status = EFI_SUCCESS;
+  gBS->SignalEvent (Token->CompletionToken.Event);
+}
+
+/**
+  Fake of EFI_TCP4_PROTOCOL.Receive().
+
+  @param[in]  This   The TCP4 protocol.
+  @param[in]  Token  The receive request.
+
+  @retval EFI_SUCCESS        The request is queued or completed.
+  @retval EFI_ACCESS_DENIED  A request is already pending.
+
+**/
+EFI_STATUS
+EFIAPI
+TestTcp4Receive (
+  IN EFI_TCP4_PROTOCOL  *This,
+  IN EFI_TCP4_IO_TOKEN  *Token
+  )
+{
+  if (mRxPending != NULL) {
+    return EFI_ACCESS_DENIED;
+  }
+
+  mRxPending = Token;
+  TestCompleteReceive ();
+  return EFI_SUCCESS;
+}
+
+/**
+  Fake of EFI_TCP4_PROTOCOL.Cancel().
+
+  @param[in]  This   The TCP4 protocol.
+  @param[in]  Token  The request to cancel.
+
+  @retval EFI_SUCCESS    The request is aborted.
+  @retval EFI_NOT_FOUND  The request is not pending.
+
+**/
+EFI_STATUS
+EFIAPI
+TestTcp4Cancel (
+  IN EFI_TCP4_PROTOCOL          *This,
+  IN EFI_TCP4_COMPLETION_TOKEN  *Token
+  )
+{
+  if ((mRxPending == NULL) || (&mRxPending->CompletionToken != Token)) {
+    return EFI_NOT_FOUND;
+  }
+
+  mRxPending    = NULL;
+  Token->Status = EFI_ABORTED;
+  gBS->SignalEvent (Token->Event);
+  return EFI_SUCCESS;
+}
+
+/**
+  Fake of EFI_TCP4_PROTOCOL.Poll().
+
+  @param[in]  This  The TCP4 protocol.
+
+  @retval EFI_SUCCESS  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+TestTcp4Poll (
+  IN EFI_TCP4_PROTOCOL  *This
+  )
+{
+  TestCompleteReceive ();
+  return EFI_SUCCESS;
+}
+
+/**
+  Notify function of the receive request, as set up by TcpIoCreateSocket().
+
+  @param[in]  Event    The event signaled.
+  @param[in]  Context  The flag to set.
+
+**/
+VOID
+EFIAPI
+TestRxNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  *((BOOLEAN *)Context) = TRUE;
+}
+
+/**
+  Stub of TcpIoCreateSocket(). The tests set up the connection themselves.
+
+  @param[in]  Image       The handle of the driver image.
+  @param[in]  Controller  The handle of the controller.
+  @param[in]  TcpVersion  The version of Tcp, TCP_VERSION_4 or TCP_VERSION_6.
+  @param[in]  ConfigData  The Tcp configuration data.
+  @param[out] TcpIo       The TcpIo.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+TcpIoCreateSocket (
+  IN EFI_HANDLE          Image,
+  IN EFI_HANDLE          Controller,
+  IN UINT8               TcpVersion,
+  IN TCP_IO_CONFIG_DATA  *ConfigData,
+  OUT TCP_IO             *TcpIo
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  Stub of TcpIoConnect().
+
+  @param[in, out]  TcpIo    The TcpIo.
+  @param[in]       Timeout  The timeout event.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+TcpIoConnect (
+  IN OUT TCP_IO     *TcpIo,
+  IN     EFI_EVENT  Timeout        OPTIONAL
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  Stub of IScsiCHAPOnRspReceived(), login is not tested.
+
+  @param[in]  Conn  The iSCSI connection.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+EFI_STATUS
+IScsiCHAPOnRspReceived (
+  IN ISCSI_CONNECTION  *Conn
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  Stub of IScsiCHAPToSendReq(), login is not tested.
+
+  @param[in]       Conn  The iSCSI connection.
+  @param[in, out]  Pdu   The login PDU.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+EFI_STATUS
+IScsiCHAPToSendReq (
+  IN      ISCSI_CONNECTION  *Conn,
+  IN OUT  NET_BUF           *Pdu
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  Stub of IScsiDns4(), login is not tested.
+
+  @param[in]       Image       The handle of the driver image.
+  @param[in]       Controller  The handle of the controller.
+  @param[in, out]  NvData      The Session config data structure.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+EFI_STATUS
+IScsiDns4 (
+  IN     EFI_HANDLE                   Image,
+  IN     EFI_HANDLE                   Controller,
+  IN OUT ISCSI_SESSION_CONFIG_NVDATA  *NvData
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  Stub of IScsiDns6(), login is not tested.
+
+  @param[in]       Image       The handle of the driver image.
+  @param[in]       Controller  The handle of the controller.
+  @param[in, out]  NvData      The Session config data structure.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+EFI_STATUS
+IScsiDns6 (
+  IN     EFI_HANDLE                   Image,
+  IN     EFI_HANDLE                   Controller,
+  IN OUT ISCSI_SESSION_CONFIG_NVDATA  *NvData
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  Stub of IScsiAsciiStrToIp(), login is not tested.
+
+  @param[in]  Str     The ASCII string.
+  @param[in]  IpMode  Indicates whether the IP address is v4 or v6.
+  @param[out] Ip      The storage to return the IP address.
+
+  @retval EFI_UNSUPPORTED  Always.
+
+**/
+EFI_STATUS
+IScsiAsciiStrToIp (
+  IN  CHAR8           *Str,
+  IN  UINT8           IpMode,
+  OUT EFI_IP_ADDRESS  *Ip
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  Stub of IScsiNetNtoi(), login is not tested.
+
+  @param[in]  Str  The ASCII string.
+
+  @retval 0  Always.
+
+**/
+UINTN
+IScsiNetNtoi (
+  IN     CHAR8  *Str
+  )
+{
+  return 0;
+}
+
+/**
+  Stub of TcpIoTransmit(). It records the task tag of the PDU sent.
+
+  @param[in]  TcpIo   The TCP_IO.
+  @param[in]  Packet  The PDU.
+
+  @retval EFI_SUCCESS  Always.
+
+**/
+EFI_STATUS
+EFIAPI
+TcpIoTransmit (
+  IN TCP_IO   *TcpIo,
+  IN NET_BUF  *Packet
+  )
+{
+  ISCSI_BASIC_HEADER  *Header;
+
+  Header = (ISCSI_BASIC_HEADER *)NetbufGetByte (Packet, 0, NULL);
+  mTransmitCount++;
+  mLastTaskTag = NTOHL (Header->InitiatorTaskTag);
+  return EFI_SUCCESS;
+}
+
+/**
+  Stub of TcpIoReset().
+
+  @param[in]  TcpIo  The TCP_IO.
+
+**/
+VOID
+EFIAPI
+TcpIoReset (
+  IN TCP_IO  *TcpIo
+  )
+{
+}
+
+/**
+  Stub of TcpIoDestroySocket(). It frees the receive event created by
+  TestCreateConnection().
+
+  @param[in]  TcpIo  The TCP_IO.
+
+**/
+VOID
+EFIAPI
+TcpIoDestroySocket (
+  IN TCP_IO  *TcpIo
+  )
+{
+  gBS->CloseEvent (TcpIo->RxToken.Tcp4Token.CompletionToken.Event);
+}
+
+/**
+  Queue a SCSI Response PDU from the fake target.
+
+  @param[in]  TaskTag  The initiator task tag of the command.
+  @param[in]  StatSN   The status sequence number.
+
+**/
+VOID
+TestQueueScsiResponse (
+  IN UINT32  TaskTag,
+  IN UINT32  StatSN
+  )
+{
+  SCSI_RESPONSE  *Response;
+
+  Response = (SCSI_RESPONSE *)(mRxBuffer + mRxLength);
+  ZeroMem (Response, sizeof (SCSI_RESPONSE));
+  Response->OpCode           = ISCSI_OPCODE_SCSI_RSP;
+  Response->Flags            = ISCSI_BHS_FLAG_FINAL;
+  Response->Response         = ISCSI_SERVICE_RSP_COMMAND_COMPLETE_AT_TARGET;
+  Response->Status           = EFI_EXT_SCSI_STATUS_TARGET_GOOD;
+  Response->InitiatorTaskTag = HTONL (TaskTag);
+  Response->StatSN           = HTONL (StatSN);
+  Response->ExpCmdSN         = HTONL (mTestSession.CmdSN);
+  Response->MaxCmdSN         = HTONL (mTestSession.CmdSN + 16);
+
+  mRxLength += sizeof (SCSI_RESPONSE);
+}
+
+/**
+  Set up a logged in session with one connection on the fake TCP.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED  The session is set up.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestSessionSetup (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  ISCSI_CONNECTION  *Conn;
+
+  mRxLength      = 0;
+  mRxOffset      = 0;
+  mRxPending     = NULL;
+  mTransmitCount = 0;
+  mPollEvent     = NULL;
+
+  ZeroMem (&mTestPrivate, sizeof (mTestPrivate));
+  mTestPrivate.Signature = ISCSI_DRIVER_DATA_SIGNATURE;
+  mTestPrivate.Session   = &mTestSession;
+
+  ZeroMem (&mTestSession, sizeof (mTestSession));
+  mTestSession.Signature        = ISCSI_SESSION_SIGNATURE;
+  mTestSession.Private          = &mTestPrivate;
+  mTestSession.State            = SESSION_STATE_LOGGED_IN;
+  mTestSession.CmdSN            = 1;
+  mTestSession.ExpCmdSN         = 1;
+  mTestSession.MaxCmdSN         = 16;
+  mTestSession.InitiatorTaskTag = 1;
+  mTestSession.InitialR2T       = TRUE;
+  InitializeListHead (&mTestSession.Conns);
+  InitializeListHead (&mTestSession.TcbList);
+
+  Conn = AllocateZeroPool (sizeof (ISCSI_CONNECTION));
+  UT_ASSERT_NOT_NULL (Conn);
+
+  Conn->Signature                             = ISCSI_CONNECTION_SIGNATURE;
+  Conn->ExpStatSN                             = 1;
+  Conn->TcpIo.TcpVersion                      = TCP_VERSION_4;
+  Conn->TcpIo.Tcp.Tcp4                        = &mTestTcp4;
+  Conn->TcpIo.RxToken.Tcp4Token.Packet.RxData = &mTestRxData;
+  NetbufQueInit (&Conn->RspQue);
+
+  UT_ASSERT_NOT_EFI_ERROR (
+    gBS->CreateEvent (EVT_NOTIFY_SIGNAL, TPL_NOTIFY, TestRxNotify, &Conn->TcpIo.IsRxDone, &Conn->TcpIo.RxToken.Tcp4Token.CompletionToken.Event)
+    );
+  UT_ASSERT_NOT_EFI_ERROR (gBS->CreateEvent (0, TPL_CALLBACK, NULL, NULL, &Conn->TimeoutEvent));
+
+  IScsiAttatchConnection (&mTestSession, Conn);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Tear down the session.
+
+  @param[in]  Context  Unused.
+
+**/
+VOID
+EFIAPI
+TestSessionCleanup (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  IScsiSessionAbort (&mTestSession);
+}
+
+/**
+  Run the session poll timer for a number of ticks.
+
+  @param[in]  Ticks  The number of ticks.
+
+**/
+VOID
+TestRunPollTimer (
+  IN UINTN  Ticks
+  )
+{
+  while ((Ticks-- != 0) && (mPollEvent != NULL)) {
+    mPollEvent->NotifyFunction (mPollEvent, mPollEvent->NotifyContext);
+  }
+}
+
+/**
+  Send a nonblocking TEST UNIT READY command.
+
+  @param[out] Packet   The request packet.
+  @param[in]  Cdb      The CDB buffer of 16 bytes.
+  @param[in]  Timeout  The timeout of the command.
+  @param[out] Event    The completion event.
+
+  @return The status of IScsiExecuteScsiCommand().
+
+**/
+EFI_STATUS
+TestSendCommand (
+  OUT EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET  *Packet,
+  IN  UINT8                                       *Cdb,
+  IN  UINT64                                      Timeout,
+  OUT EFI_EVENT                                   *Event
+  )
+{
+  EFI_STATUS  Status;
+
+  Status = gBS->CreateEvent (0, TPL_CALLBACK, NULL, NULL, Event);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  ZeroMem (Packet, sizeof (*Packet));
+  ZeroMem (Cdb, 16);
+  Packet->Timeout       = Timeout;
+  Packet->Cdb           = Cdb;
+  Packet->CdbLength     = 6;
+  Packet->DataDirection = EFI_EXT_SCSI_DATA_DIRECTION_READ;
+
+  return IScsiExecuteScsiCommand (&mTestPrivate.IScsiExtScsiPassThru, NULL, 0, Packet, *Event);
+}
+
+/**
+  A nonblocking command with no timeout must not make the poll timer wait for
+  the target. It completes once its response is received, even when the
+  response arrives a piece at a time.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED  The test passed.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+NoTimeoutCommandShouldNotBlock (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET  Packet;
+  UINT8                                       Cdb[16];
+  EFI_EVENT                                   Event;
+
+  UT_ASSERT_NOT_EFI_ERROR (TestSendCommand (&Packet, Cdb, 0, &Event));
+  UT_ASSERT_EQUAL (mTransmitCount, 1);
+  UT_ASSERT_NOT_NULL (mPollEvent);
+
+  //
+  // Every tick returns, and the command stays in flight.
+  //
+  TestRunPollTimer (TEST_IDLE_TICKS);
+  UT_ASSERT_EQUAL (gBS->CheckEvent (Event), EFI_NOT_READY);
+  UT_ASSERT_EQUAL (mTestSession.NumAsyncTcbs, 1);
+  UT_ASSERT_EQUAL (mTestSession.State, SESSION_STATE_LOGGED_IN);
+
+  //
+  // Only a part of the response header is there.
+  //
+  TestQueueScsiResponse (mLastTaskTag, 1);
+  mRxLength -= 20;
+  TestRunPollTimer (1);
+  UT_ASSERT_EQUAL (gBS->CheckEvent (Event), EFI_NOT_READY);
+  UT_ASSERT_EQUAL (mTestSession.NumAsyncTcbs, 1);
+
+  mRxLength += 20;
+  TestRunPollTimer (1);
+  UT_ASSERT_NOT_EFI_ERROR (gBS->CheckEvent (Event));
+  UT_ASSERT_EQUAL (mTestSession.NumAsyncTcbs, 0);
+  UT_ASSERT_EQUAL (Packet.HostAdapterStatus, EFI_EXT_SCSI_STATUS_HOST_ADAPTER_OK);
+  UT_ASSERT_EQUAL (Packet.TargetStatus, EFI_EXT_SCSI_STATUS_TARGET_GOOD);
+  UT_ASSERT_EQUAL (mTestSession.State, SESSION_STATE_LOGGED_IN);
+
+  gBS->CloseEvent (Event);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  A nonblocking command that gets no response within its timeout fails, and
+  the session is aborted.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED  The test passed.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TimedOutCommandShouldFail (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET  Packet;
+  UINT8                                       Cdb[16];
+  EFI_EVENT                                   Event;
+  UINT64                                      Ticks;
+
+  UT_ASSERT_NOT_EFI_ERROR (TestSendCommand (&Packet, Cdb, TEST_COMMAND_TIMEOUT, &Event));
+
+  //
+  // The driver waits four times the timeout of the packet.
+  //
+  Ticks = DivU64x32 (MultU64x32 (TEST_COMMAND_TIMEOUT, 4), ISCSI_POLL_INTERVAL);
+  TestRunPollTimer ((UINTN)Ticks - 1);
+  UT_ASSERT_EQUAL (gBS->CheckEvent (Event), EFI_NOT_READY);
+
+  TestRunPollTimer (1);
+  UT_ASSERT_NOT_EFI_ERROR (gBS->CheckEvent (Event));
+  UT_ASSERT_EQUAL (Packet.HostAdapterStatus, EFI_EXT_SCSI_STATUS_HOST_ADAPTER_TIMEOUT_COMMAND);
+  UT_ASSERT_EQUAL (mTestSession.NumAsyncTcbs, 0);
+  UT_ASSERT_EQUAL (mTestSession.State, SESSION_STATE_FAILED);
+  UT_ASSERT_TRUE (mPollEvent == NULL);
+
+  gBS->CloseEvent (Event);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  The poll timer must keep off the connection while a command, nested or not,
+  is using it.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED  The test passed.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+PollTimerShouldYieldToCommands (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET  Packet;
+  UINT8                                       Cdb[16];
+  EFI_EVENT                                   Event;
+
+  UT_ASSERT_NOT_EFI_ERROR (TestSendCommand (&Packet, Cdb, 0, &Event));
+  UT_ASSERT_EQUAL (mTestSession.NestingLevel, 0);
+
+  TestQueueScsiResponse (mLastTaskTag, 1);
+
+  mTestSession.NestingLevel = 2;
+  TestRunPollTimer (1);
+  UT_ASSERT_EQUAL (gBS->CheckEvent (Event), EFI_NOT_READY);
+  UT_ASSERT_EQUAL (mRxOffset, 0);
+
+  mTestSession.NestingLevel = 0;
+  TestRunPollTimer (1);
+  UT_ASSERT_NOT_EFI_ERROR (gBS->CheckEvent (Event));
+  UT_ASSERT_EQUAL (mTestSession.NestingLevel, 0);
+
+  gBS->CloseEvent (Event);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests and run them.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      PollTimerTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  mTestBootServices.CreateEvent   = TestCreateEvent;
+  mTestBootServices.SetTimer      = TestSetTimer;
+  mTestBootServices.SignalEvent   = TestSignalEvent;
+  mTestBootServices.CheckEvent    = TestCheckEvent;
+  mTestBootServices.CloseEvent    = TestCloseEvent;
+  mTestBootServices.CloseProtocol = TestCloseProtocol;
+  mTestBootServices.FreePool      = TestFreePool;
+  gBS                             = &mTestBootServices;
+
+  mTestTcp4.Receive = TestTcp4Receive;
+  mTestTcp4.Cancel  = TestTcp4Cancel;
+  mTestTcp4.Poll    = TestTcp4Poll;
+
+  mTestRxData.FragmentCount = 1;
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&PollTimerTests, Framework, "IScsiDxe Poll Timer Tests", "IScsiDxe.PollTimer", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for IScsiDxe Poll Timer Tests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite-----------Description-------------------------------------Name-----------Function--------------------------Pre----------------Post----------------Context
+  //
+  AddTestCase (PollTimerTests, "Command with no timeout does not block the timer", "NoTimeout", NoTimeoutCommandShouldNotBlock, TestSessionSetup, TestSessionCleanup, NULL);
+  AddTestCase (PollTimerTests, "Command past its timeout fails", "Timeout", TimedOutCommandShouldFail, TestSessionSetup, TestSessionCleanup, NULL);
+  AddTestCase (PollTimerTests, "Timer yields to commands in progress", "Nesting", PollTimerShouldYieldToCommands, TestSessionSetup, TestSessionCleanup, NULL);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+///
+/// Avoid ECC error for function name that starts with lower case letter
+///
+#define IScsiPollTimerUnitTestMain  main
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param[in] Argc  Number of arguments
+  @param[in] Argv  Array of pointers to arguments
+
+  @retval 0      Success
+  @retval other  Error
+**/
+INT32
+IScsiPollTimerUnitTestMain (
+  IN INT32  Argc,
+  IN CHAR8  *Argv[]
+  )
+{
+  UnitTestingEntry ();
+  return 0;
+}
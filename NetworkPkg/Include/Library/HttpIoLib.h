@@ -171,6 +171,134 @@ HttpIoNotify (
   IN VOID       *Context
   );
 
+/**
+  Get a HTTP_IO for a request to Url, from the keep-alive pool if an idle
+  HTTP_IO with an open connection to the same scheme, host and port, and for
+  HTTPS with the same TLS configuration, is available there, or create a new
+  one otherwise.
+
+  The HTTP_IO must be returned with HttpIoPoolRelease(), not destroyed with
+  HttpIoDestroyIo().
+
+  @param[in]  Image          The handle of the driver image.
+  @param[in]  Controller     The handle of the controller.
+  @param[in]  IpVersion      IP_VERSION_4 or IP_VERSION_6.
+  @param[in]  ConfigData     The HTTP_IO configuration data.
+  @param[in]  Callback       Callback function which will be invoked when specified
+                             HTTP_IO_CALLBACK_EVENT happened.
+  @param[in]  Context        The Context data which will be passed to the Callback function.
+  @param[in]  Url            The URL the HTTP_IO is going to send requests to.
+  @param[out] HttpIo         The HTTP_IO.
+
+  @retval EFI_SUCCESS            The HTTP_IO is ready for use.
+  @retval EFI_INVALID_PARAMETER  One or more parameters are invalid.
+  @retval EFI_OUT_OF_RESOURCES   Failed to allocate memory.
+  @retval Others                 Failed to create the HTTP_IO or configure it.
+
+**/
+EFI_STATUS
+HttpIoPoolAcquire (
+  IN  EFI_HANDLE           Image,
+  IN  EFI_HANDLE           Controller,
+  IN  UINT8                IpVersion,
+  IN  HTTP_IO_CONFIG_DATA  *ConfigData OPTIONAL,
+  IN  HTTP_IO_CALLBACK     Callback,
+  IN  VOID                 *Context,
+  IN  CHAR16               *Url,
+  OUT HTTP_IO              **HttpIo
+  );
+
+/**
+  Tell whether a HTTP_IO is an idle connection that HttpIoPoolAcquire() has
+  handed out again, and on which no response has been received since.
+
+  The server may have closed such a connection while it was idle, so a
+  failure of the first request on it is no reason to give up: the caller
+  should release it with KeepAlive FALSE and retry on a fresh connection.
+
+  @param[in]  HttpIo         The HTTP_IO obtained with HttpIoPoolAcquire().
+
+  @retval TRUE               HttpIo is a reused connection not yet known to
+                             be alive.
+  @retval FALSE              HttpIo is a new connection, has received a
+                             response already, or is not from the pool.
+
+**/
+BOOLEAN
+HttpIoPoolIsReused (
+  IN HTTP_IO  *HttpIo
+  );
+
+/**
+  Record the keep-alive policy of the server from the headers of a response
+  received on a HTTP_IO obtained with HttpIoPoolAcquire().
+
+  "Connection: close" keeps HttpIoPoolRelease() from pooling the HTTP_IO, and
+  the timeout of a "Keep-Alive" header shortens its idle timeout in the pool.
+  HttpIoRecvResponse() calls this itself; callers that receive responses on
+  HttpIo->Http directly must call it before freeing the headers.
+
+  @param[in]  HttpIo         The HTTP_IO the response was received on. Nothing
+                             is done if it was not obtained from the pool.
+  @param[in]  HeaderCount    Number of HTTP header structures in Headers.
+  @param[in]  Headers        The headers of the response.
+
+**/
+VOID
+HttpIoPoolNoteResponse (
+  IN HTTP_IO          *HttpIo,
+  IN UINTN            HeaderCount,
+  IN EFI_HTTP_HEADER  *Headers
+  );
+
+/**
+  Return a HTTP_IO obtained with HttpIoPoolAcquire() to the keep-alive pool.
+
+  The HTTP_IO is destroyed instead if KeepAlive is FALSE, if the server has
+  answered with "Connection: close", if the pool is disabled by a zero
+  PcdHttpIoPoolIdleTimeout, or if the pool is full.
+
+  @param[in]  HttpIo         The HTTP_IO to release.
+  @param[in]  KeepAlive      TRUE if the last transfer on HttpIo has completed
+                             cleanly, so that its connection may be reused.
+
+**/
+VOID
+HttpIoPoolRelease (
+  IN HTTP_IO  *HttpIo,
+  IN BOOLEAN  KeepAlive
+  );
+
+/**
+  Destroy the idle HTTP_IO instances kept open by the keep-alive pool.
+
+  Drivers call this when they stop managing Controller, or before the network
+  stack is torn down.
+
+  @param[in]  Controller     Only destroy the instances created for this
+                             controller; NULL destroys all idle instances.
+
+**/
+VOID
+HttpIoPoolFlush (
+  IN EFI_HANDLE  Controller OPTIONAL
+  );
+
+/**
+  Get the connection reuse statistics of the keep-alive pool.
+
+  @param[out]  AcquireCount   The number of HttpIoPoolAcquire() calls that
+                              succeeded.
+  @param[out]  ReuseCount     The number of them that were served by an idle
+                              HTTP_IO with an open connection.
+
+**/
+VOID
+HttpIoPoolGetStatistics (
+  OUT UINTN  *AcquireCount,
+  OUT UINTN  *ReuseCount
+  );
+
 /**
   Destroy the HTTP_IO and release the resources.
 
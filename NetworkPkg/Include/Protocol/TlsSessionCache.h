@@ -0,0 +1,53 @@
+/** @file
+  This file defines the EDKII TLS Session Cache Protocol interface.
+
+  TlsDxe installs the protocol on every TLS child handle. A client that sets
+  the port of the server with it allows TlsDxe to resume a session previously
+  established with the same server, port, verification method and TLS
+  configuration data, instead of performing a full handshake.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef EDKII_TLS_SESSION_CACHE_H_
+#define EDKII_TLS_SESSION_CACHE_H_
+
+#define EDKII_TLS_SESSION_CACHE_PROTOCOL_GUID \
+  { \
+    0xc002f4eb, 0x10ef, 0x43fb, {0x99, 0xa8, 0x9b, 0x2d, 0x2f, 0x5d, 0x7e, 0x6e} \
+  }
+
+typedef struct _EDKII_TLS_SESSION_CACHE_PROTOCOL EDKII_TLS_SESSION_CACHE_PROTOCOL;
+
+/**
+  Set the port of the server the TLS child connects to.
+
+  The TLS session is only cached, and a cached session is only resumed, once
+  the port is set. It must be set before the handshake starts.
+
+  @param[in]  This              Pointer to the EDKII_TLS_SESSION_CACHE_PROTOCOL instance.
+  @param[in]  Port              The port of the server.
+
+  @retval EFI_SUCCESS           The port is set.
+  @retval EFI_INVALID_PARAMETER This is NULL.
+  @retval EFI_ACCESS_DENIED     The handshake has already started.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_TLS_SESSION_CACHE_SET_PEER_PORT)(
+  IN EDKII_TLS_SESSION_CACHE_PROTOCOL  *This,
+  IN UINT16                            Port
+  );
+
+///
+/// EDKII TLS Session Cache Protocol is used by TLS clients to identify the
+/// server whose session may be resumed.
+///
+struct _EDKII_TLS_SESSION_CACHE_PROTOCOL {
+  EDKII_TLS_SESSION_CACHE_SET_PEER_PORT    SetPeerPort;
+};
+
+extern EFI_GUID  gEdkiiTlsSessionCacheProtocolGuid;
+
+#endif
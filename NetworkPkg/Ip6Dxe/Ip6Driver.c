@@ -234,6 +234,14 @@ Ip6CleanService (
   //
   // Free the Neighbor Discovery resources
   //
+  DEBUG ((
+    DEBUG_INFO,
+    "Ip6CleanService: %ld neighbor cache lookups, %ld hits, %ld evictions.\n",
+    IpSb->NeighborLookups,
+    IpSb->NeighborHits,
+    IpSb->NeighborEvictions
+    ));
+
   while (!IsListEmpty (&IpSb->NeighborTable)) {
     NeighborCache = NET_LIST_HEAD (&IpSb->NeighborTable, IP6_NEIGHBOR_ENTRY, Link);
     Ip6FreeNeighborEntry (IpSb, NeighborCache, FALSE, TRUE, EFI_SUCCESS, NULL, NULL);
@@ -266,6 +274,7 @@ Ip6CreateService (
   EFI_STATUS                            Status;
   EFI_MANAGED_NETWORK_COMPLETION_TOKEN  *MnpToken;
   EFI_MANAGED_NETWORK_CONFIG_DATA       *Config;
+  UINTN                                 Index;
 
   ASSERT (Service != NULL);
 
@@ -325,6 +334,10 @@ Ip6CreateService (
   IpSb->RoundRobin = 0;
 
   InitializeListHead (&IpSb->NeighborTable);
+  for (Index = 0; Index < IP6_NEIGHBOR_HASH_SIZE; Index++) {
+    InitializeListHead (&IpSb->NeighborHash[Index]);
+  }
+
   InitializeListHead (&IpSb->DefaultRouterList);
   InitializeListHead (&IpSb->OnlinkPrefix);
   InitializeListHead (&IpSb->AutonomousPrefix);
@@ -197,6 +197,11 @@ struct _IP6_SERVICE {
   UINT32                             ReachableTime;
   UINT32                             RetransTimer;
   LIST_ENTRY                         NeighborTable;
+  LIST_ENTRY                         NeighborHash[IP6_NEIGHBOR_HASH_SIZE];
+  UINTN                              NeighborCount;
+  UINT64                             NeighborLookups;
+  UINT64                             NeighborHits;
+  UINT64                             NeighborEvictions;
 
   LIST_ENTRY                         OnlinkPrefix;
   LIST_ENTRY                         AutonomousPrefix;
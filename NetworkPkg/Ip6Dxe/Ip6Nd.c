@@ -476,6 +476,71 @@ Ip6OnArpResolved (
   }
 }
 
+/**
+  Compute the hash bucket of an IPv6 address in the neighbor cache index.
+
+  @param[in]  Ip6Address        Points to the IPv6 address of the neighbor.
+
+  @return The index of the bucket in the neighbor cache hash table.
+
+**/
+STATIC
+UINTN
+Ip6NeighborHash (
+  IN EFI_IPv6_ADDRESS  *Ip6Address
+  )
+{
+  UINT32  Hash;
+  UINTN   Index;
+
+  //
+  // FNV-1a over the address. Neighbors on one link mostly share the prefix, so
+  // every byte is folded in rather than just the interface identifier.
+  //
+  Hash = 0x811C9DC5;
+  for (Index = 0; Index < sizeof (EFI_IPv6_ADDRESS); Index++) {
+    Hash = (Hash ^ Ip6Address->Addr[Index]) * 0x01000193;
+  }
+
+  return Hash & (IP6_NEIGHBOR_HASH_SIZE - 1);
+}
+
+/**
+  Evict the least recently used neighbor cache entry that can be dropped without
+  side effects, that is a stale entry which is not a router, not referenced by a
+  default router and has no frames waiting on it.
+
+  @param[in]  IpSb              The pointer to the IP6_SERVICE instance.
+
+  @retval TRUE                  An entry was evicted.
+  @retval FALSE                 No entry could be evicted.
+
+**/
+STATIC
+BOOLEAN
+Ip6EvictNeighborEntry (
+  IN IP6_SERVICE  *IpSb
+  )
+{
+  LIST_ENTRY          *Entry;
+  IP6_NEIGHBOR_ENTRY  *Neighbor;
+
+  for (Entry = IpSb->NeighborTable.BackLink; Entry != &IpSb->NeighborTable; Entry = Entry->BackLink) {
+    Neighbor = NET_LIST_USER_STRUCT (Entry, IP6_NEIGHBOR_ENTRY, Link);
+    if ((Neighbor->State != EfiNeighborStale) || Neighbor->IsRouter || Neighbor->ArpFree ||
+        !IsListEmpty (&Neighbor->Frames) || (Ip6FindDefaultRouter (IpSb, &Neighbor->Neighbor) != NULL))
+    {
+      continue;
+    }
+
+    Ip6FreeNeighborEntry (IpSb, Neighbor, FALSE, TRUE, EFI_SUCCESS, NULL, NULL);
+    IpSb->NeighborEvictions++;
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
 /**
   Allocate and initialize an IP6 neighbor cache entry.
 
@@ -504,6 +569,14 @@ Ip6CreateNeighborEntry (
   NET_CHECK_SIGNATURE (IpSb, IP6_SERVICE_SIGNATURE);
   ASSERT (Ip6Address != NULL);
 
+  //
+  // Keep the cache bounded on large segments. If every entry is in use, the
+  // cache grows past the limit until the incomplete or reachable ones expire.
+  //
+  if (IpSb->NeighborCount >= IP6_MAX_NEIGHBOR_CACHE_ENTRIES) {
+    Ip6EvictNeighborEntry (IpSb);
+  }
+
   Entry = AllocateZeroPool (sizeof (IP6_NEIGHBOR_ENTRY));
   if (Entry == NULL) {
     return NULL;
@@ -529,6 +602,8 @@ Ip6CreateNeighborEntry (
   }
 
   InsertHeadList (&IpSb->NeighborTable, &Entry->Link);
+  InsertHeadList (&IpSb->NeighborHash[Ip6NeighborHash (Ip6Address)], &Entry->HashLink);
+  IpSb->NeighborCount++;
 
   //
   // If corresponding default router entry exists, establish the relationship.
@@ -558,18 +633,23 @@ Ip6FindNeighborEntry (
   )
 {
   LIST_ENTRY          *Entry;
-  LIST_ENTRY          *Next;
   IP6_NEIGHBOR_ENTRY  *Neighbor;
 
   NET_CHECK_SIGNATURE (IpSb, IP6_SERVICE_SIGNATURE);
   ASSERT (Ip6Address != NULL);
 
-  NET_LIST_FOR_EACH_SAFE (Entry, Next, &IpSb->NeighborTable) {
-    Neighbor = NET_LIST_USER_STRUCT (Entry, IP6_NEIGHBOR_ENTRY, Link);
+  IpSb->NeighborLookups++;
+
+  NET_LIST_FOR_EACH (Entry, &IpSb->NeighborHash[Ip6NeighborHash (Ip6Address)]) {
+    Neighbor = NET_LIST_USER_STRUCT (Entry, IP6_NEIGHBOR_ENTRY, HashLink);
     if (EFI_IP6_EQUAL (Ip6Address, &Neighbor->Neighbor)) {
-      RemoveEntryList (Entry);
-      InsertHeadList (&IpSb->NeighborTable, Entry);
+      //
+      // Keep the NeighborTable in most recently used order.
+      //
+      RemoveEntryList (&Neighbor->Link);
+      InsertHeadList (&IpSb->NeighborTable, &Neighbor->Link);
 
+      IpSb->NeighborHits++;
       return Neighbor;
     }
   }
@@ -658,6 +738,9 @@ Ip6FreeNeighborEntry (
     }
 
     RemoveEntryList (&NeighborCache->Link);
+    RemoveEntryList (&NeighborCache->HashLink);
+    ASSERT (IpSb->NeighborCount > 0);
+    IpSb->NeighborCount--;
     FreePool (NeighborCache);
   }
 
@@ -2756,10 +2839,11 @@ Ip6DelNeighbor (
     return EFI_NOT_FOUND;
   }
 
-  RemoveEntryList (&Neighbor->Link);
-  FreePool (Neighbor);
-
-  return EFI_SUCCESS;
+  //
+  // Go through Ip6FreeNeighborEntry so the entry also leaves the hash bucket,
+  // the ARP queue and the neighbor count, and pending frames are completed.
+  //
+  return Ip6FreeNeighborEntry (IpSb, Neighbor, FALSE, TRUE, EFI_ABORTED, NULL, NULL);
 }
 
 /**
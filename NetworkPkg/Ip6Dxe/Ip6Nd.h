@@ -12,6 +12,14 @@
 
 #define IP6_GET_TICKS(Ms)  (((Ms) + IP6_TIMER_INTERVAL_IN_MS - 1) / IP6_TIMER_INTERVAL_IN_MS)
 
+//
+// Size of the hash index over the neighbor cache, must be a power of 2, and the
+// number of neighbor cache entries above which the least recently used stale
+// entry is evicted to make room for a new one.
+//
+#define IP6_NEIGHBOR_HASH_SIZE          256
+#define IP6_MAX_NEIGHBOR_CACHE_ENTRIES  1024
+
 enum {
   IP6_INF_ROUTER_LIFETIME = 0xFFFF,
 
@@ -125,6 +133,7 @@ typedef struct _IP6_DELAY_JOIN_LIST {
 
 typedef struct _IP6_NEIGHBOR_ENTRY {
   LIST_ENTRY                Link;
+  LIST_ENTRY                HashLink;
   LIST_ENTRY                ArpList;
   INTN                      RefCnt;
   BOOLEAN                   IsRouter;
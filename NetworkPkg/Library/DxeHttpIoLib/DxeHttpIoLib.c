@@ -461,6 +461,10 @@ HttpIoRecvResponse (
   ResponseData->Headers     = HttpIo->RspToken.Message->Headers;
   ResponseData->BodyLength  = HttpIo->RspToken.Message->BodyLength;
 
+  if (RecvMsgHeader && (ResponseData->Headers != NULL)) {
+    HttpIoPoolNoteResponse (HttpIo, ResponseData->HeaderCount, ResponseData->Headers);
+  }
+
   return Status;
 }
 
@@ -0,0 +1,621 @@
+/** @file
+  Keep-alive pool of HTTP_IO instances for the Http IO Helper Library.
+
+  An HTTP child keeps its TCP (and TLS) session to the remote host open for as
+  long as it stays configured. Instead of destroying the child once a transfer
+  is done, HttpIoPoolRelease() parks it in the pool, and HttpIoPoolAcquire()
+  hands it out again to the next transfer to the same scheme, host and port,
+  which then skips the TCP and TLS handshakes. HTTPS connections are only
+  reused while the TLS configuration that HttpDxe applies to new sessions, the
+  TlsCaCertificate and HttpTlsCipherList variables, is unchanged.
+
+  Idle instances are destroyed lazily once PcdHttpIoPoolIdleTimeout, or the
+  shorter keep-alive timeout announced by the server, has elapsed, and are not
+  kept at all after the server has answered with "Connection: close".
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include <Uefi.h>
+
+#include <Protocol/Http.h>
+#include <Guid/TlsAuthentication.h>
+#include <Guid/HttpTlsCipherList.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/HttpIoLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
+
+#define HTTP_IO_POOL_ENTRY_SIGNATURE  SIGNATURE_32 ('H', 'I', 'O', 'P')
+
+//
+// Upper limit of idle HTTP_IO instances kept open by the pool.
+//
+#define HTTP_IO_POOL_MAX_IDLE  8
+
+#define HTTP_IO_POOL_HTTP_PORT   80
+#define HTTP_IO_POOL_HTTPS_PORT  443
+
+typedef struct {
+  UINT32                 Signature;
+  LIST_ENTRY             Link;
+  HTTP_IO                HttpIo;
+  BOOLEAN                InUse;
+  EFI_EVENT              IdleTimer;
+  //
+  // The key of the pooled connection.
+  //
+  BOOLEAN                HasConfigData;
+  HTTP_IO_CONFIG_DATA    ConfigData;
+  BOOLEAN                UseHttps;
+  UINT16                 RemotePort;
+  CHAR8                  *HostName;
+  UINT32                 TlsCaCertificateCrc;
+  UINT32                 TlsCipherListCrc;
+  //
+  // The state of the pooled connection.
+  //
+  BOOLEAN                Reused;
+  BOOLEAN                ServerClose;
+  UINT32                 ServerIdleTimeout;
+} HTTP_IO_POOL_ENTRY;
+
+#define HTTP_IO_POOL_ENTRY_FROM_LINK(a) \
+  CR (a, HTTP_IO_POOL_ENTRY, Link, HTTP_IO_POOL_ENTRY_SIGNATURE)
+#define HTTP_IO_POOL_ENTRY_FROM_HTTP_IO(a) \
+  CR (a, HTTP_IO_POOL_ENTRY, HttpIo, HTTP_IO_POOL_ENTRY_SIGNATURE)
+
+STATIC LIST_ENTRY  mHttpIoPool = INITIALIZE_LIST_HEAD_VARIABLE (mHttpIoPool);
+STATIC UINTN       mHttpIoPoolAcquireCount;
+STATIC UINTN       mHttpIoPoolReuseCount;
+
+/**
+  Extract the scheme, host name and port from an URL, i.e. the key of the
+  connection that a HTTP request to the URL uses.
+
+  @param[in]   Url           The URL of the request.
+  @param[out]  UseHttps      TRUE if the URL scheme is "https".
+  @param[out]  HostName      The host name of the URL; the caller shall free it.
+  @param[out]  RemotePort    The port of the URL, or the default port of the
+                             scheme.
+
+  @retval EFI_SUCCESS            The key has been extracted.
+  @retval EFI_OUT_OF_RESOURCES   Failed to allocate memory.
+  @retval Others                 The URL could not be parsed.
+
+**/
+STATIC
+EFI_STATUS
+HttpIoPoolGetUrlKey (
+  IN  CHAR16   *Url,
+  OUT BOOLEAN  *UseHttps,
+  OUT CHAR8    **HostName,
+  OUT UINT16   *RemotePort
+  )
+{
+  EFI_STATUS  Status;
+  CHAR8       *AsciiUrl;
+  UINTN       UrlSize;
+  VOID        *UrlParser;
+
+  UrlSize  = StrLen (Url) + 1;
+  AsciiUrl = AllocatePool (UrlSize);
+  if (AsciiUrl == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  UnicodeStrToAsciiStrS (Url, AsciiUrl, UrlSize);
+  *UseHttps = (BOOLEAN)(AsciiStrnCmp (AsciiUrl, "https://", AsciiStrLen ("https://")) == 0);
+
+  UrlParser = NULL;
+  Status    = HttpParseUrl (AsciiUrl, (UINT32)AsciiStrLen (AsciiUrl), FALSE, &UrlParser);
+  if (EFI_ERROR (Status)) {
+    goto ON_EXIT;
+  }
+
+  Status = HttpUrlGetHostName (AsciiUrl, UrlParser, HostName);
+  if (EFI_ERROR (Status)) {
+    goto ON_EXIT;
+  }
+
+  Status = HttpUrlGetPort (AsciiUrl, UrlParser, RemotePort);
+  if (EFI_ERROR (Status)) {
+    *RemotePort = *UseHttps ? HTTP_IO_POOL_HTTPS_PORT : HTTP_IO_POOL_HTTP_PORT;
+    Status      = EFI_SUCCESS;
+  }
+
+ON_EXIT:
+  if (UrlParser != NULL) {
+    HttpUrlFreeParser (UrlParser);
+  }
+
+  FreePool (AsciiUrl);
+  return Status;
+}
+
+/**
+  Get the CRC32 of the content of a variable, so that a change of it can be
+  detected.
+
+  @param[in]   VariableName  The name of the variable.
+  @param[in]   VendorGuid    The vendor GUID of the variable.
+  @param[out]  Crc           The CRC32 of the variable data, or 0 if the
+                             variable does not exist.
+
+  @retval EFI_SUCCESS            Crc has been computed.
+  @retval EFI_OUT_OF_RESOURCES   Failed to allocate memory.
+  @retval Others                 Failed to read the variable.
+
+**/
+STATIC
+EFI_STATUS
+HttpIoPoolGetVariableCrc (
+  IN  CHAR16    *VariableName,
+  IN  EFI_GUID  *VendorGuid,
+  OUT UINT32    *Crc
+  )
+{
+  EFI_STATUS  Status;
+  VOID        *Data;
+  UINTN       DataSize;
+
+  *Crc     = 0;
+  DataSize = 0;
+  Status   = gRT->GetVariable (VariableName, VendorGuid, NULL, &DataSize, NULL);
+  if (Status == EFI_NOT_FOUND) {
+    return EFI_SUCCESS;
+  }
+
+  if (Status != EFI_BUFFER_TOO_SMALL) {
+    return Status;
+  }
+
+  Data = AllocatePool (DataSize);
+  if (Data == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = gRT->GetVariable (VariableName, VendorGuid, NULL, &DataSize, Data);
+  if (!EFI_ERROR (Status)) {
+    Status = gBS->CalculateCrc32 (Data, DataSize, Crc);
+  }
+
+  FreePool (Data);
+  return Status;
+}
+
+/**
+  Find the pool entry of a HTTP_IO.
+
+  @param[in]  HttpIo         The HTTP_IO.
+
+  @return The pool entry, or NULL if HttpIo was not obtained with
+          HttpIoPoolAcquire().
+
+**/
+STATIC
+HTTP_IO_POOL_ENTRY *
+HttpIoPoolFindEntry (
+  IN HTTP_IO  *HttpIo
+  )
+{
+  LIST_ENTRY          *Link;
+  HTTP_IO_POOL_ENTRY  *Entry;
+
+  BASE_LIST_FOR_EACH (Link, &mHttpIoPool) {
+    Entry = HTTP_IO_POOL_ENTRY_FROM_LINK (Link);
+    if (&Entry->HttpIo == HttpIo) {
+      return Entry;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Destroy a pool entry together with its HTTP_IO.
+
+  @param[in]  Entry          The entry to destroy; it must not be in use.
+
+**/
+STATIC
+VOID
+HttpIoPoolDestroyEntry (
+  IN HTTP_IO_POOL_ENTRY  *Entry
+  )
+{
+  RemoveEntryList (&Entry->Link);
+  HttpIoDestroyIo (&Entry->HttpIo);
+
+  //
+  // Flush the DPCs that may still refer to the IsTxDone / IsRxDone flags of
+  // the HTTP_IO before releasing it.
+  //
+  DispatchDpc ();
+
+  if (Entry->IdleTimer != NULL) {
+    gBS->CloseEvent (Entry->IdleTimer);
+  }
+
+  if (Entry->HostName != NULL) {
+    FreePool (Entry->HostName);
+  }
+
+  FreePool (Entry);
+}
+
+/**
+  Destroy the idle pool entries whose idle timeout has elapsed.
+
+**/
+STATIC
+VOID
+HttpIoPoolSweep (
+  VOID
+  )
+{
+  LIST_ENTRY          *Link;
+  LIST_ENTRY          *NextLink;
+  HTTP_IO_POOL_ENTRY  *Entry;
+
+  BASE_LIST_FOR_EACH_SAFE (Link, NextLink, &mHttpIoPool) {
+    Entry = HTTP_IO_POOL_ENTRY_FROM_LINK (Link);
+    if (!Entry->InUse && !EFI_ERROR (gBS->CheckEvent (Entry->IdleTimer))) {
+      HttpIoPoolDestroyEntry (Entry);
+    }
+  }
+}
+
+/**
+  Get a HTTP_IO for a request to Url, from the keep-alive pool if an idle
+  HTTP_IO with an open connection to the same scheme, host and port, and for
+  HTTPS with the same TLS configuration, is available there, or create a new
+  one otherwise.
+
+  The HTTP_IO must be returned with HttpIoPoolRelease(), not destroyed with
+  HttpIoDestroyIo().
+
+  @param[in]  Image          The handle of the driver image.
+  @param[in]  Controller     The handle of the controller.
+  @param[in]  IpVersion      IP_VERSION_4 or IP_VERSION_6.
+  @param[in]  ConfigData     The HTTP_IO configuration data.
+  @param[in]  Callback       Callback function which will be invoked when specified
+                             HTTP_IO_CALLBACK_EVENT happened.
+  @param[in]  Context        The Context data which will be passed to the Callback function.
+  @param[in]  Url            The URL the HTTP_IO is going to send requests to.
+  @param[out] HttpIo         The HTTP_IO.
+
+  @retval EFI_SUCCESS            The HTTP_IO is ready for use.
+  @retval EFI_INVALID_PARAMETER  One or more parameters are invalid.
+  @retval EFI_OUT_OF_RESOURCES   Failed to allocate memory.
+  @retval Others                 Failed to create the HTTP_IO or configure it.
+
+**/
+EFI_STATUS
+HttpIoPoolAcquire (
+  IN  EFI_HANDLE           Image,
+  IN  EFI_HANDLE           Controller,
+  IN  UINT8                IpVersion,
+  IN  HTTP_IO_CONFIG_DATA  *ConfigData OPTIONAL,
+  IN  HTTP_IO_CALLBACK     Callback,
+  IN  VOID                 *Context,
+  IN  CHAR16               *Url,
+  OUT HTTP_IO              **HttpIo
+  )
+{
+  EFI_STATUS          Status;
+  LIST_ENTRY          *Link;
+  HTTP_IO_POOL_ENTRY  *Entry;
+  BOOLEAN             UseHttps;
+  CHAR8               *HostName;
+  UINT16              RemotePort;
+  UINT32              TlsCaCertificateCrc;
+  UINT32              TlsCipherListCrc;
+
+  if ((Image == NULL) || (Controller == NULL) || (Url == NULL) || (HttpIo == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Status = HttpIoPoolGetUrlKey (Url, &UseHttps, &HostName, &RemotePort);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  TlsCaCertificateCrc = 0;
+  TlsCipherListCrc    = 0;
+  if (UseHttps) {
+    Status = HttpIoPoolGetVariableCrc (EFI_TLS_CA_CERTIFICATE_VARIABLE, &gEfiTlsCaCertificateGuid, &TlsCaCertificateCrc);
+    if (!EFI_ERROR (Status)) {
+      Status = HttpIoPoolGetVariableCrc (EDKII_HTTP_TLS_CIPHER_LIST_VARIABLE, &gEdkiiHttpTlsCipherListGuid, &TlsCipherListCrc);
+    }
+
+    if (EFI_ERROR (Status)) {
+      FreePool (HostName);
+      return Status;
+    }
+  }
+
+  HttpIoPoolSweep ();
+
+  BASE_LIST_FOR_EACH (Link, &mHttpIoPool) {
+    Entry = HTTP_IO_POOL_ENTRY_FROM_LINK (Link);
+    if (Entry->InUse ||
+        (Entry->HttpIo.Image != Image) ||
+        (Entry->HttpIo.Controller != Controller) ||
+        (Entry->HttpIo.IpVersion != IpVersion) ||
+        (Entry->UseHttps != UseHttps) ||
+        (Entry->RemotePort != RemotePort) ||
+        (AsciiStriCmp (Entry->HostName, HostName) != 0) ||
+        (Entry->TlsCaCertificateCrc != TlsCaCertificateCrc) ||
+        (Entry->TlsCipherListCrc != TlsCipherListCrc) ||
+        (Entry->HasConfigData != (BOOLEAN)(ConfigData != NULL)) ||
+        ((ConfigData != NULL) &&
+         (CompareMem (&Entry->ConfigData, ConfigData, sizeof (HTTP_IO_CONFIG_DATA)) != 0)))
+    {
+      continue;
+    }
+
+    gBS->SetTimer (Entry->IdleTimer, TimerCancel, 0);
+    Entry->InUse           = TRUE;
+    Entry->Reused          = TRUE;
+    Entry->HttpIo.Callback = Callback;
+    Entry->HttpIo.Context  = Context;
+    mHttpIoPoolAcquireCount++;
+    mHttpIoPoolReuseCount++;
+    FreePool (HostName);
+
+    DEBUG ((
+      DEBUG_INFO,
+      "HttpIoPoolAcquire: %Lu of %Lu acquisitions reused an open connection\n",
+      (UINT64)mHttpIoPoolReuseCount,
+      (UINT64)mHttpIoPoolAcquireCount
+      ));
+
+    *HttpIo = &Entry->HttpIo;
+    return EFI_SUCCESS;
+  }
+
+  Entry = AllocateZeroPool (sizeof (HTTP_IO_POOL_ENTRY));
+  if (Entry == NULL) {
+    FreePool (HostName);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Entry->Signature  = HTTP_IO_POOL_ENTRY_SIGNATURE;
+  Entry->UseHttps   = UseHttps;
+  Entry->RemotePort = RemotePort;
+  Entry->HostName   = HostName;
+
+  Entry->TlsCaCertificateCrc = TlsCaCertificateCrc;
+  Entry->TlsCipherListCrc    = TlsCipherListCrc;
+  if (ConfigData != NULL) {
+    Entry->HasConfigData = TRUE;
+    CopyMem (&Entry->ConfigData, ConfigData, sizeof (HTTP_IO_CONFIG_DATA));
+  }
+
+  Status = gBS->CreateEvent (EVT_TIMER, TPL_CALLBACK, NULL, NULL, &Entry->IdleTimer);
+  if (EFI_ERROR (Status)) {
+    goto ON_ERROR;
+  }
+
+  Status = HttpIoCreateIo (Image, Controller, IpVersion, ConfigData, Callback, Context, &Entry->HttpIo);
+  if (EFI_ERROR (Status)) {
+    goto ON_ERROR;
+  }
+
+  Entry->InUse = TRUE;
+  InsertTailList (&mHttpIoPool, &Entry->Link);
+  mHttpIoPoolAcquireCount++;
+
+  *HttpIo = &Entry->HttpIo;
+  return EFI_SUCCESS;
+
+ON_ERROR:
+  if (Entry->IdleTimer != NULL) {
+    gBS->CloseEvent (Entry->IdleTimer);
+  }
+
+  FreePool (Entry->HostName);
+  FreePool (Entry);
+  return Status;
+}
+
+/**
+  Tell whether a HTTP_IO is an idle connection that HttpIoPoolAcquire() has
+  handed out again, and on which no response has been received since.
+
+  The server may have closed such a connection while it was idle, so a
+  failure of the first request on it is no reason to give up: the caller
+  should release it with KeepAlive FALSE and retry on a fresh connection.
+
+  @param[in]  HttpIo         The HTTP_IO obtained with HttpIoPoolAcquire().
+
+  @retval TRUE               HttpIo is a reused connection not yet known to
+                             be alive.
+  @retval FALSE              HttpIo is a new connection, has received a
+                             response already, or is not from the pool.
+
+**/
+BOOLEAN
+HttpIoPoolIsReused (
+  IN HTTP_IO  *HttpIo
+  )
+{
+  HTTP_IO_POOL_ENTRY  *Entry;
+
+  Entry = HttpIoPoolFindEntry (HttpIo);
+  return (BOOLEAN)(Entry != NULL && Entry->Reused);
+}
+
+/**
+  Record the keep-alive policy of the server from the headers of a response
+  received on a HTTP_IO obtained with HttpIoPoolAcquire().
+
+  "Connection: close" keeps HttpIoPoolRelease() from pooling the HTTP_IO, and
+  the timeout of a "Keep-Alive" header shortens its idle timeout in the pool.
+  HttpIoRecvResponse() calls this itself; callers that receive responses on
+  HttpIo->Http directly must call it before freeing the headers.
+
+  @param[in]  HttpIo         The HTTP_IO the response was received on. Nothing
+                             is done if it was not obtained from the pool.
+  @param[in]  HeaderCount    Number of HTTP header structures in Headers.
+  @param[in]  Headers        The headers of the response.
+
+**/
+VOID
+HttpIoPoolNoteResponse (
+  IN HTTP_IO          *HttpIo,
+  IN UINTN            HeaderCount,
+  IN EFI_HTTP_HEADER  *Headers
+  )
+{
+  HTTP_IO_POOL_ENTRY  *Entry;
+  EFI_HTTP_HEADER     *Header;
+  CHAR8               *Value;
+  UINTN               Timeout;
+
+  Entry = HttpIoPoolFindEntry (HttpIo);
+  if (Entry == NULL) {
+    return;
+  }
+
+  Entry->Reused = FALSE;
+
+  Header = HttpFindHeader (HeaderCount, Headers, HTTP_HEADER_CONNECTION);
+  if ((Header != NULL) && (AsciiStriCmp (Header->FieldValue, "close") == 0)) {
+    Entry->ServerClose = TRUE;
+    return;
+  }
+
+  //
+  // Keep-Alive: timeout=Seconds, max=Requests
+  //
+  Header = HttpFindHeader (HeaderCount, Headers, HTTP_HEADER_KEEP_ALIVE);
+  if (Header == NULL) {
+    return;
+  }
+
+  Value = AsciiStrStr (Header->FieldValue, "timeout=");
+  if ((Value == NULL) ||
+      RETURN_ERROR (AsciiStrDecimalToUintnS (Value + AsciiStrLen ("timeout="), NULL, &Timeout)))
+  {
+    return;
+  }
+
+  //
+  // The server counts from when it sent the response; stop reusing the
+  // connection a second early so that it is not closed under a new request.
+  //
+  if (Timeout <= 1) {
+    Entry->ServerClose = TRUE;
+  } else {
+    Entry->ServerIdleTimeout = (UINT32)MIN (Timeout - 1, MAX_UINT32 / 1000) * 1000;
+  }
+}
+
+/**
+  Return a HTTP_IO obtained with HttpIoPoolAcquire() to the keep-alive pool.
+
+  The HTTP_IO is destroyed instead if KeepAlive is FALSE, if the server has
+  answered with "Connection: close", if the pool is disabled by a zero
+  PcdHttpIoPoolIdleTimeout, or if the pool is full.
+
+  @param[in]  HttpIo         The HTTP_IO to release.
+  @param[in]  KeepAlive      TRUE if the last transfer on HttpIo has completed
+                             cleanly, so that its connection may be reused.
+
+**/
+VOID
+HttpIoPoolRelease (
+  IN HTTP_IO  *HttpIo,
+  IN BOOLEAN  KeepAlive
+  )
+{
+  HTTP_IO_POOL_ENTRY  *Entry;
+  LIST_ENTRY          *Link;
+  UINTN               IdleCount;
+  UINT32              IdleTimeout;
+
+  if (HttpIo == NULL) {
+    return;
+  }
+
+  Entry = HTTP_IO_POOL_ENTRY_FROM_HTTP_IO (HttpIo);
+  ASSERT (Entry->InUse);
+  Entry->InUse = FALSE;
+
+  HttpIoPoolSweep ();
+
+  IdleCount = 0;
+  BASE_LIST_FOR_EACH (Link, &mHttpIoPool) {
+    if (!HTTP_IO_POOL_ENTRY_FROM_LINK (Link)->InUse) {
+      IdleCount++;
+    }
+  }
+
+  IdleTimeout = PcdGet32 (PcdHttpIoPoolIdleTimeout);
+  if (Entry->ServerIdleTimeout != 0) {
+    IdleTimeout = MIN (IdleTimeout, Entry->ServerIdleTimeout);
+  }
+
+  if (!KeepAlive || Entry->ServerClose || (IdleTimeout == 0) || (IdleCount > HTTP_IO_POOL_MAX_IDLE) ||
+      EFI_ERROR (gBS->SetTimer (Entry->IdleTimer, TimerRelative, IdleTimeout * TICKS_PER_MS)))
+  {
+    HttpIoPoolDestroyEntry (Entry);
+  }
+}
+
+/**
+  Destroy the idle HTTP_IO instances kept open by the keep-alive pool.
+
+  Drivers call this when they stop managing Controller, or before the network
+  stack is torn down.
+
+  @param[in]  Controller     Only destroy the instances created for this
+                             controller; NULL destroys all idle instances.
+
+**/
+VOID
+HttpIoPoolFlush (
+  IN EFI_HANDLE  Controller OPTIONAL
+  )
+{
+  LIST_ENTRY          *Link;
+  LIST_ENTRY          *NextLink;
+  HTTP_IO_POOL_ENTRY  *Entry;
+
+  BASE_LIST_FOR_EACH_SAFE (Link, NextLink, &mHttpIoPool) {
+    Entry = HTTP_IO_POOL_ENTRY_FROM_LINK (Link);
+    if (!Entry->InUse && ((Controller == NULL) || (Entry->HttpIo.Controller == Controller))) {
+      HttpIoPoolDestroyEntry (Entry);
+    }
+  }
+}
+
+/**
+  Get the connection reuse statistics of the keep-alive pool.
+
+  @param[out]  AcquireCount   The number of HttpIoPoolAcquire() calls that
+                              succeeded.
+  @param[out]  ReuseCount     The number of them that were served by an idle
+                              HTTP_IO with an open connection.
+
+**/
+VOID
+HttpIoPoolGetStatistics (
+  OUT UINTN  *AcquireCount,
+  OUT UINTN  *ReuseCount
+  )
+{
+  if (AcquireCount != NULL) {
+    *AcquireCount = mHttpIoPoolAcquireCount;
+  }
+
+  if (ReuseCount != NULL) {
+    *ReuseCount = mHttpIoPoolReuseCount;
+  }
+}
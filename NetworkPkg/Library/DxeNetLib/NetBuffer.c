@@ -14,6 +14,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/MemoryAllocationLib.h>
 
+#include "NetChecksum.h"
+
 /**
   Allocate and build up the sketch for a NET_BUF.
 
@@ -1617,25 +1619,12 @@ NetblockChecksum (
   IN UINT32  Len
   )
 {
-  register UINT32  Sum;
-
-  Sum = 0;
+  UINT64  Sum;
 
-  //
-  // Add left-over byte, if any
-  //
-  if (Len % 2 != 0) {
-    Sum += *(Bulk + Len - 1);
-  }
-
-  while (Len > 1) {
-    Sum  += *(UINT16 *)Bulk;
-    Bulk += 2;
-    Len  -= 2;
-  }
+  Sum = InternalNetChecksum (Bulk, Len);
 
   //
-  // Fold 32-bit sum to 16 bits
+  // Fold 64-bit sum to 16 bits
   //
   while ((Sum >> 16) != 0) {
     Sum = (Sum & 0xffff) + (Sum >> 16);
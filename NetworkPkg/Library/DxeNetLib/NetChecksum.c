@@ -0,0 +1,66 @@
+/** @file
+  Portable Internet checksum worker of DxeNetLib.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include "NetChecksum.h"
+
+/**
+  Sum the 16-bit words of a buffer, in host byte order, in portable C. A
+  trailing odd byte is added as if padded with a zero byte. The sum is not
+  folded.
+
+  The one's complement sum does not depend on how the data is split into
+  words, as 2^16 is 1 modulo 0xFFFF, so 32-bit words are summed into a 64-bit
+  accumulator, which needs a quarter of the additions of the byte pair loop
+  and cannot overflow for any UINT32 length.
+
+  @param[in]   Bulk                  Pointer to the data.
+  @param[in]   Len                   Length of the data, in bytes.
+
+  @return    The unfolded sum.
+
+**/
+UINT64
+InternalNetChecksumScalar (
+  IN CONST UINT8  *Bulk,
+  IN UINT32       Len
+  )
+{
+  UINT64  Sum0;
+  UINT64  Sum1;
+
+  Sum0 = 0;
+  Sum1 = 0;
+
+  while (Len >= 16) {
+    Sum0 += *(UINT32 *)Bulk;
+    Sum1 += *(UINT32 *)(Bulk + 4);
+    Sum0 += *(UINT32 *)(Bulk + 8);
+    Sum1 += *(UINT32 *)(Bulk + 12);
+    Bulk += 16;
+    Len  -= 16;
+  }
+
+  while (Len >= 4) {
+    Sum0 += *(UINT32 *)Bulk;
+    Bulk += 4;
+    Len  -= 4;
+  }
+
+  if (Len >= 2) {
+    Sum1 += *(UINT16 *)Bulk;
+    Bulk += 2;
+    Len  -= 2;
+  }
+
+  //
+  // Add left-over byte, if any
+  //
+  if (Len != 0) {
+    Sum1 += *Bulk;
+  }
+
+  return Sum0 + Sum1;
+}
@@ -0,0 +1,75 @@
+/** @file
+  Internal definitions of the Internet checksum workers of DxeNetLib.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef NET_CHECKSUM_H_
+#define NET_CHECKSUM_H_
+
+#include <Uefi.h>
+
+/**
+  Sum the 16-bit words of a buffer, in host byte order. A trailing odd byte is
+  added as if padded with a zero byte. The sum is not folded.
+
+  This is the architecture specific entry, which picks the fastest worker the
+  processor supports.
+
+  @param[in]   Bulk                  Pointer to the data.
+  @param[in]   Len                   Length of the data, in bytes.
+
+  @return    The unfolded sum.
+
+**/
+UINT64
+InternalNetChecksum (
+  IN CONST UINT8  *Bulk,
+  IN UINT32       Len
+  );
+
+/**
+  Sum the 16-bit words of a buffer, in host byte order, in portable C. A
+  trailing odd byte is added as if padded with a zero byte. The sum is not
+  folded.
+
+  @param[in]   Bulk                  Pointer to the data.
+  @param[in]   Len                   Length of the data, in bytes.
+
+  @return    The unfolded sum.
+
+**/
+UINT64
+InternalNetChecksumScalar (
+  IN CONST UINT8  *Bulk,
+  IN UINT32       Len
+  );
+
+#if defined (MDE_CPU_X64)
+
+//
+// Upper bound of the blocks passed to one call of the SIMD workers, so that
+// the 32-bit lanes, each adding at most 0xFFFF per block, cannot overflow.
+//
+#define NET_CHECKSUM_MAX_BLOCKS  0x8000
+
+/**
+  Sum the 16-bit words of a buffer with SSE2.
+
+  @param[in]   Bulk                  Pointer to the data.
+  @param[in]   Count                 Number of 16-byte blocks to sum, at most
+                                     NET_CHECKSUM_MAX_BLOCKS.
+
+  @return    The unfolded sum.
+
+**/
+UINT64
+EFIAPI
+InternalNetChecksumSse2 (
+  IN CONST UINT8  *Bulk,
+  IN UINTN        Count
+  );
+
+#endif
+
+#endif
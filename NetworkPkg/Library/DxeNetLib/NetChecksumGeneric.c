@@ -0,0 +1,27 @@
+/** @file
+  Internet checksum worker selection for the architectures without a SIMD
+  worker in DxeNetLib.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include "NetChecksum.h"
+
+/**
+  Sum the 16-bit words of a buffer, in host byte order. A trailing odd byte is
+  added as if padded with a zero byte. The sum is not folded.
+
+  @param[in]   Bulk                  Pointer to the data.
+  @param[in]   Len                   Length of the data, in bytes.
+
+  @return    The unfolded sum.
+
+**/
+UINT64
+InternalNetChecksum (
+  IN CONST UINT8  *Bulk,
+  IN UINT32       Len
+  )
+{
+  return InternalNetChecksumScalar (Bulk, Len);
+}
@@ -0,0 +1,345 @@
+/** @file
+  Host based unit tests of the Internet checksum workers of DxeNetLib. The
+  portable worker and, on X64, the SSE2 worker are checked against
+  a byte pair reference loop over random buffers of every alignment and of
+  lengths that are not a multiple of the block size.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UnitTestLib.h>
+
+#include "../NetChecksum.h"
+
+#define UNIT_TEST_APP_NAME     "DxeNetLib Checksum Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// Every length up to TEST_SHORT_LENGTH is checked at every alignment, then
+// TEST_RANDOM_ROUNDS random lengths up to TEST_BUFFER_SIZE.
+//
+#define TEST_SHORT_LENGTH   256
+#define TEST_RANDOM_ROUNDS  2000
+#define TEST_BUFFER_SIZE    SIZE_64KB
+#define TEST_ALIGNMENT      64
+
+//
+// Sum a buffer with one SIMD worker, which only takes whole blocks.
+//
+typedef
+UINT64
+(EFIAPI *NET_CHECKSUM_WORKER)(
+  IN CONST UINT8  *Bulk,
+  IN UINTN        Count
+  );
+
+typedef struct {
+  NET_CHECKSUM_WORKER    Worker;
+  UINTN                  BlockSize;
+} NET_CHECKSUM_CONTEXT;
+
+STATIC UINT8   *mBuffer;
+STATIC UINT32  mRandomState = 0x2545F491;
+
+/**
+  Return a pseudo random number, so that a failure can be reproduced.
+
+  @return  The next number of a xorshift sequence.
+
+**/
+STATIC
+UINT32
+TestRandom (
+  VOID
+  )
+{
+  mRandomState ^= mRandomState << 13;
+  mRandomState ^= mRandomState >> 17;
+  mRandomState ^= mRandomState << 5;
+  return mRandomState;
+}
+
+/**
+  Fold a sum of 16-bit words to 16 bits, as NetblockChecksum does.
+
+  @param[in]  Sum  The unfolded sum.
+
+  @return  The folded sum.
+
+**/
+STATIC
+UINT16
+TestFold (
+  IN UINT64  Sum
+  )
+{
+  while ((Sum >> 16) != 0) {
+    Sum = (Sum & 0xFFFF) + (Sum >> 16);
+  }
+
+  return (UINT16)Sum;
+}
+
+/**
+  Sum a buffer one 16-bit word at a time, as NetblockChecksum did before it
+  had SIMD workers.
+
+  @param[in]  Bulk  Pointer to the data.
+  @param[in]  Len   Length of the data, in bytes.
+
+  @return  The folded sum.
+
+**/
+STATIC
+UINT16
+TestReferenceChecksum (
+  IN CONST UINT8  *Bulk,
+  IN UINT32       Len
+  )
+{
+  UINT64  Sum;
+  UINT16  Word;
+
+  Sum = 0;
+  while (Len > 1) {
+    CopyMem (&Word, Bulk, sizeof (Word));
+    Sum  += Word;
+    Bulk += 2;
+    Len  -= 2;
+  }
+
+  if (Len != 0) {
+    Word = 0;
+    CopyMem (&Word, Bulk, 1);
+    Sum += Word;
+  }
+
+  return TestFold (Sum);
+}
+
+/**
+  Sum a buffer with the worker of Context, or with InternalNetChecksumScalar
+  if Context is NULL. The bytes past the last whole block are summed with
+  InternalNetChecksumScalar, as InternalNetChecksum does.
+
+  @param[in]  Context  The worker to test, or NULL.
+  @param[in]  Bulk     Pointer to the data.
+  @param[in]  Len      Length of the data, in bytes.
+
+  @return  The folded sum.
+
+**/
+STATIC
+UINT16
+TestWorkerChecksum (
+  IN NET_CHECKSUM_CONTEXT  *Context,
+  IN CONST UINT8           *Bulk,
+  IN UINT32                Len
+  )
+{
+  UINT64  Sum;
+  UINTN   Count;
+
+  Sum = 0;
+  if (Context != NULL) {
+    Count = Len / Context->BlockSize;
+    Sum   = Context->Worker (Bulk, Count);
+    Bulk += Count * Context->BlockSize;
+    Len  -= (UINT32)(Count * Context->BlockSize);
+  }
+
+  return TestFold (Sum + InternalNetChecksumScalar (Bulk, Len));
+}
+
+/**
+  Check a worker against the reference loop for every short length and
+  every alignment, then for random lengths and alignments.
+
+  @param[in]  Context  The worker to test, or NULL for the portable worker.
+
+  @retval  UNIT_TEST_PASSED             Every sum matched.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A sum did not match.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+WorkerShouldMatchReference (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT32  Offset;
+  UINT32  Len;
+  UINTN   Round;
+
+  for (Offset = 0; Offset < TEST_ALIGNMENT; Offset++) {
+    for (Len = 0; Len <= TEST_SHORT_LENGTH; Len++) {
+      UT_ASSERT_EQUAL (
+        TestWorkerChecksum (Context, mBuffer + Offset, Len),
+        TestReferenceChecksum (mBuffer + Offset, Len)
+        );
+    }
+  }
+
+  for (Round = 0; Round < TEST_RANDOM_ROUNDS; Round++) {
+    Offset = TestRandom () % TEST_ALIGNMENT;
+    Len    = TestRandom () % (TEST_BUFFER_SIZE + 1);
+    UT_ASSERT_EQUAL (
+      TestWorkerChecksum (Context, mBuffer + Offset, Len),
+      TestReferenceChecksum (mBuffer + Offset, Len)
+      );
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+#if defined (MDE_CPU_X64)
+
+/**
+  Check that the 32-bit lanes of a SIMD worker do not overflow when summing
+  NET_CHECKSUM_MAX_BLOCKS blocks of 0xFFFF words, by comparing the unfolded
+  sum with its exact value.
+
+  @param[in]  Context  The worker to test.
+
+  @retval  UNIT_TEST_PASSED             The sum was exact.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  The sum was not exact.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+WorkerShouldNotOverflow (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  NET_CHECKSUM_CONTEXT  *WorkerContext;
+  UINTN                 Size;
+  UINT8                 *Ones;
+  UINT64                Sum;
+
+  WorkerContext = (NET_CHECKSUM_CONTEXT *)Context;
+  Size          = NET_CHECKSUM_MAX_BLOCKS * WorkerContext->BlockSize;
+  Ones          = AllocatePool (Size);
+  UT_ASSERT_NOT_NULL (Ones);
+
+  SetMem (Ones, Size, 0xFF);
+  Sum = WorkerContext->Worker (Ones, NET_CHECKSUM_MAX_BLOCKS);
+  FreePool (Ones);
+
+  UT_ASSERT_EQUAL (Sum, (UINT64)(Size / 2) * 0xFFFF);
+  return UNIT_TEST_PASSED;
+}
+
+STATIC NET_CHECKSUM_CONTEXT  mSse2Context = { InternalNetChecksumSse2, 16 };
+
+#endif
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the checksum
+  workers and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      ChecksumTests;
+  UINTN                       Index;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  mBuffer = AllocatePool (TEST_BUFFER_SIZE + TEST_ALIGNMENT);
+  if (mBuffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < TEST_BUFFER_SIZE + TEST_ALIGNMENT; Index++) {
+    mBuffer[Index] = (UINT8)TestRandom ();
+  }
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&ChecksumTests, Framework, "DxeNetLib Checksum Tests", "DxeNetLib.Checksum", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for DxeNetLib Checksum Tests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite----------Description-------------------------------------Name-------------Function---------------------Pre------------------Post--Context
+  //
+  AddTestCase (ChecksumTests, "Portable worker matches the reference", "Scalar", WorkerShouldMatchReference, NULL, NULL, NULL);
+ #if defined (MDE_CPU_X64)
+  AddTestCase (ChecksumTests, "SSE2 worker matches the reference", "Sse2", WorkerShouldMatchReference, NULL, NULL, &mSse2Context);
+  AddTestCase (ChecksumTests, "SSE2 worker does not overflow", "Sse2Overflow", WorkerShouldNotOverflow, NULL, NULL, &mSse2Context);
+ #endif
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  FreePool (mBuffer);
+  return Status;
+}
+
+///
+/// Avoid ECC error for function name that starts with lower case letter
+///
+#define NetChecksumUnitTestMain  main
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param[in] Argc  Number of arguments
+  @param[in] Argv  Array of pointers to arguments
+
+  @retval 0      Success
+  @retval other  Error
+**/
+INT32
+NetChecksumUnitTestMain (
+  IN INT32  Argc,
+  IN CHAR8  *Argv[]
+  )
+{
+  UnitTestingEntry ();
+  return 0;
+}
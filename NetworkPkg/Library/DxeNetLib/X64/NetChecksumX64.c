@@ -0,0 +1,46 @@
+/** @file
+  Internet checksum worker for X64 in DxeNetLib.
+
+  SSE2 is part of the X64 baseline and is always used. There is no AVX2
+  worker: NetblockChecksum() runs from DPCs and timer notify functions, which
+  interrupt other code, and the interrupt and exception handlers only save
+  the FXSAVE state. Touching the YMM registers here would corrupt the upper
+  halves that the interrupted code keeps there.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include <Library/BaseLib.h>
+
+#include "NetChecksum.h"
+
+/**
+  Sum the 16-bit words of a buffer, in host byte order. A trailing odd byte is
+  added as if padded with a zero byte. The sum is not folded.
+
+  @param[in]   Bulk                  Pointer to the data.
+  @param[in]   Len                   Length of the data, in bytes.
+
+  @return    The unfolded sum.
+
+**/
+UINT64
+InternalNetChecksum (
+  IN CONST UINT8  *Bulk,
+  IN UINT32       Len
+  )
+{
+  UINT64  Sum;
+  UINTN   Count;
+
+  Sum = 0;
+
+  while (Len >= 16) {
+    Count = MIN (Len / 16, NET_CHECKSUM_MAX_BLOCKS);
+    Sum  += InternalNetChecksumSse2 (Bulk, Count);
+    Bulk += Count * 16;
+    Len  -= (UINT32)(Count * 16);
+  }
+
+  return Sum + InternalNetChecksumScalar (Bulk, Len);
+}
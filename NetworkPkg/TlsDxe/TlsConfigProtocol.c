@@ -74,6 +74,10 @@ TlsConfigurationSetData (
       Status = EFI_UNSUPPORTED;
   }
 
+  if (!EFI_ERROR (Status)) {
+    TlsSessionCacheUpdateConfigDigest (Instance, DataType, Data, DataSize);
+  }
+
   gBS->RestoreTPL (OldTpl);
   return Status;
 }
@@ -30,6 +30,10 @@ TlsCleanInstance (
       TlsFree (Instance->TlsConn);
     }
 
+    if (Instance->HostName != NULL) {
+      FreePool (Instance->HostName);
+    }
+
     FreePool (Instance);
   }
 }
@@ -66,6 +70,7 @@ TlsCreateInstance (
 
   CopyMem (&TlsInstance->Tls, &mTlsProtocol, sizeof (TlsInstance->Tls));
   CopyMem (&TlsInstance->TlsConfig, &mTlsConfigurationProtocol, sizeof (TlsInstance->TlsConfig));
+  TlsInstance->TlsSessionCache.SetPeerPort = TlsSessionCacheSetPeerPort;
 
   TlsInstance->TlsSessionState = EfiTlsSessionNotStarted;
 
@@ -90,6 +95,8 @@ TlsCleanService (
       TlsCtxFree (Service->TlsCtx);
     }
 
+    TlsSessionCacheFlush (Service);
+
     FreePool (Service);
   }
 }
@@ -131,6 +138,7 @@ TlsCreateService (
   CopyMem (&TlsService->ServiceBinding, &mTlsServiceBinding, sizeof (TlsService->ServiceBinding));
   TlsService->TlsChildrenNum = 0;
   InitializeListHead (&TlsService->TlsChildrenList);
+  InitializeListHead (&TlsService->SessionCache);
   TlsService->ImageHandle = Image;
 
   *Service = TlsService;
@@ -349,7 +357,8 @@ TlsServiceBindingCreateChild (
   }
 
   //
-  // Install TLS protocol and configuration protocol onto ChildHandle
+  // Install TLS protocol, configuration protocol and session cache protocol
+  // onto ChildHandle
   //
   Status = gBS->InstallMultipleProtocolInterfaces (
                   ChildHandle,
@@ -357,6 +366,8 @@ TlsServiceBindingCreateChild (
                   &TlsInstance->Tls,
                   &gEfiTlsConfigurationProtocolGuid,
                   &TlsInstance->TlsConfig,
+                  &gEdkiiTlsSessionCacheProtocolGuid,
+                  &TlsInstance->TlsSessionCache,
                   NULL
                   );
   if (EFI_ERROR (Status)) {
@@ -466,7 +477,8 @@ TlsServiceBindingDestroyChild (
   TlsInstance->InDestroy = TRUE;
 
   //
-  // Uninstall the TLS protocol and TLS Configuration Protocol interface installed in ChildHandle.
+  // Uninstall the TLS protocol, TLS Configuration Protocol and TLS Session Cache
+  // Protocol interface installed in ChildHandle.
   //
   Status = gBS->UninstallMultipleProtocolInterfaces (
                   ChildHandle,
@@ -474,6 +486,8 @@ TlsServiceBindingDestroyChild (
                   Tls,
                   &gEfiTlsConfigurationProtocolGuid,
                   TlsConfig,
+                  &gEdkiiTlsSessionCacheProtocolGuid,
+                  &TlsInstance->TlsSessionCache,
                   NULL
                   );
   if (EFI_ERROR (Status)) {
@@ -483,6 +497,16 @@ TlsServiceBindingDestroyChild (
   RemoveEntryList (&TlsInstance->Link);
   TlsService->TlsChildrenNum--;
 
+  //
+  // Session tickets may arrive after the handshake, so save the session once
+  // more before the connection is released.
+  //
+  if ((TlsInstance->TlsSessionState == EfiTlsSessionDataTransferring) ||
+      (TlsInstance->TlsSessionState == EfiTlsSessionClosing))
+  {
+    TlsSessionCacheSave (TlsInstance);
+  }
+
   gBS->RestoreTPL (OldTpl);
 
   TlsCleanInstance (TlsInstance);
@@ -26,6 +26,13 @@
 
 #define TLS_INSTANCE_SIGNATURE  SIGNATURE_32 ('T', 'L', 'S', 'I')
 
+#define TLS_SESSION_CACHE_ENTRY_SIGNATURE  SIGNATURE_32 ('T', 'L', 'S', 'C')
+
+//
+// The maximum number of servers whose sessions are kept for resumption.
+//
+#define TLS_SESSION_CACHE_MAX_ENTRIES  16
+
 ///
 /// TLS Service Data
 ///
@@ -55,29 +62,72 @@ struct _TLS_SERVICE {
   // created for the connections.
   //
   VOID                            *TlsCtx;
+
+  //
+  // Sessions of the servers previously connected as a client, most recently
+  // used first, to resume instead of performing a full handshake.
+  //
+  UINTN                           SessionCacheNum;
+  LIST_ENTRY                      SessionCache;
 };
 
 struct _TLS_INSTANCE {
-  UINT32                            Signature;
-  LIST_ENTRY                        Link;
+  UINT32                              Signature;
+  LIST_ENTRY                          Link;
 
-  BOOLEAN                           InDestroy;
+  BOOLEAN                             InDestroy;
 
-  TLS_SERVICE                       *Service;
-  EFI_HANDLE                        ChildHandle;
+  TLS_SERVICE                         *Service;
+  EFI_HANDLE                          ChildHandle;
 
-  EFI_TLS_PROTOCOL                  Tls;
-  EFI_TLS_CONFIGURATION_PROTOCOL    TlsConfig;
+  EFI_TLS_PROTOCOL                    Tls;
+  EFI_TLS_CONFIGURATION_PROTOCOL      TlsConfig;
+  EDKII_TLS_SESSION_CACHE_PROTOCOL    TlsSessionCache;
 
-  EFI_TLS_SESSION_STATE             TlsSessionState;
+  EFI_TLS_SESSION_STATE               TlsSessionState;
 
   //
   // Main SSL Connection which is created by a server or a client
   // per established connection.
   //
-  VOID                              *TlsConn;
+  VOID                                *TlsConn;
+
+  //
+  // Host name set by EfiTlsVerifyHost, port set by SetPeerPort(), method set
+  // by EfiTlsVerifyMethod, and digest of the data set through the TLS
+  // configuration protocol, which together are the key of the session cache.
+  // The session is not cached if the digest could not be computed.
+  //
+  CHAR8                               *HostName;
+  BOOLEAN                             PeerPortValid;
+  UINT16                              PeerPort;
+  EFI_TLS_VERIFY                      VerifyMethod;
+  UINT8                               ConfigDigest[SHA256_DIGEST_SIZE];
+  BOOLEAN                             ConfigDigestFailed;
 };
 
+///
+/// TLS Session Cache Entry
+///
+typedef struct {
+  UINT32            Signature;
+  LIST_ENTRY        Link;
+
+  //
+  // Key of the session, see TLS_INSTANCE.
+  //
+  CHAR8             *HostName;
+  UINT16            PeerPort;
+  EFI_TLS_VERIFY    VerifyMethod;
+  UINT8             ConfigDigest[SHA256_DIGEST_SIZE];
+
+  //
+  // Session data returned by TlsGetResumableSession().
+  //
+  UINTN             SessionSize;
+  UINT8             *Session;
+} TLS_SESSION_CACHE_ENTRY;
+
 #define TLS_SERVICE_FROM_THIS(a)   \
   CR (a, TLS_SERVICE, ServiceBinding, TLS_SERVICE_SIGNATURE)
 
@@ -87,6 +137,12 @@ struct _TLS_INSTANCE {
 #define TLS_INSTANCE_FROM_CONFIGURATION(a)  \
   CR (a, TLS_INSTANCE, TlsConfig, TLS_INSTANCE_SIGNATURE)
 
+#define TLS_INSTANCE_FROM_SESSION_CACHE(a)  \
+  CR (a, TLS_INSTANCE, TlsSessionCache, TLS_INSTANCE_SIGNATURE)
+
+#define TLS_SESSION_CACHE_ENTRY_FROM_LINK(a)  \
+  CR (a, TLS_SESSION_CACHE_ENTRY, Link, TLS_SESSION_CACHE_ENTRY_SIGNATURE)
+
 /**
   Release all the resources used by the TLS instance.
 
@@ -348,3 +348,322 @@ ERROR:
 
   return Status;
 }
+
+/**
+  Check if the session of the TLS instance can be cached, i.e. the instance is
+  a client which verifies the certificate and the host name of the server, and
+  whose caller set the port of the server.
+
+  Resuming a session skips the verification of the server certificate, so the
+  session must only be resumed by a connection to the same server and port,
+  with the same verification method and TLS configuration data.
+
+  @param[in]  TlsInstance    The pointer to the TLS instance.
+
+  @retval TRUE     The session can be cached.
+  @retval FALSE    The session can not be cached.
+
+**/
+STATIC
+BOOLEAN
+TlsSessionCacheable (
+  IN     TLS_INSTANCE  *TlsInstance
+  )
+{
+  return (BOOLEAN)((TlsInstance->HostName != NULL) &&
+                   TlsInstance->PeerPortValid &&
+                   !TlsInstance->ConfigDigestFailed &&
+                   ((TlsInstance->VerifyMethod & EFI_TLS_VERIFY_PEER) != 0) &&
+                   (TlsGetConnectionEnd (TlsInstance->TlsConn) == EfiTlsClient));
+}
+
+/**
+  Find the session cache entry matching the host name, port, verification
+  method and configuration digest of the TLS instance, and make it the most
+  recently used.
+
+  @param[in]  TlsInstance    The pointer to the TLS instance.
+
+  @return The session cache entry, or NULL if the key is not in the cache.
+
+**/
+STATIC
+TLS_SESSION_CACHE_ENTRY *
+TlsSessionCacheFind (
+  IN     TLS_INSTANCE  *TlsInstance
+  )
+{
+  TLS_SERVICE              *Service;
+  LIST_ENTRY               *Entry;
+  TLS_SESSION_CACHE_ENTRY  *CacheEntry;
+
+  Service = TlsInstance->Service;
+  BASE_LIST_FOR_EACH (Entry, &Service->SessionCache) {
+    CacheEntry = TLS_SESSION_CACHE_ENTRY_FROM_LINK (Entry);
+    if ((CacheEntry->PeerPort == TlsInstance->PeerPort) &&
+        (CacheEntry->VerifyMethod == TlsInstance->VerifyMethod) &&
+        (CompareMem (CacheEntry->ConfigDigest, TlsInstance->ConfigDigest, SHA256_DIGEST_SIZE) == 0) &&
+        (AsciiStriCmp (CacheEntry->HostName, TlsInstance->HostName) == 0))
+    {
+      RemoveEntryList (&CacheEntry->Link);
+      InsertHeadList (&Service->SessionCache, &CacheEntry->Link);
+      return CacheEntry;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Remove an entry from the session cache and free it.
+
+  @param[in]  Service        The pointer to the TLS service.
+  @param[in]  CacheEntry     The session cache entry to remove.
+
+**/
+STATIC
+VOID
+TlsSessionCacheFreeEntry (
+  IN     TLS_SERVICE              *Service,
+  IN     TLS_SESSION_CACHE_ENTRY  *CacheEntry
+  )
+{
+  RemoveEntryList (&CacheEntry->Link);
+  Service->SessionCacheNum--;
+
+  //
+  // The session holds the master secret.
+  //
+  ZeroMem (CacheEntry->Session, CacheEntry->SessionSize);
+  FreePool (CacheEntry->Session);
+  FreePool (CacheEntry->HostName);
+  FreePool (CacheEntry);
+}
+
+/**
+  Set the session cached for the server of the TLS instance, if any, so that
+  the handshake resumes it instead of performing a full handshake.
+
+  @param[in]  TlsInstance    The pointer to the TLS instance.
+
+**/
+VOID
+TlsSessionCacheResume (
+  IN     TLS_INSTANCE  *TlsInstance
+  )
+{
+  TLS_SESSION_CACHE_ENTRY  *CacheEntry;
+  EFI_STATUS               Status;
+
+  if (!TlsSessionCacheable (TlsInstance)) {
+    return;
+  }
+
+  CacheEntry = TlsSessionCacheFind (TlsInstance);
+  if (CacheEntry == NULL) {
+    return;
+  }
+
+  Status = TlsSetResumableSession (TlsInstance->TlsConn, CacheEntry->Session, CacheEntry->SessionSize);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "TlsSessionCacheResume: Drop the session of %a - %r\n", CacheEntry->HostName, Status));
+    TlsSessionCacheFreeEntry (TlsInstance->Service, CacheEntry);
+  }
+}
+
+/**
+  Save the resumable session of the TLS instance in the session cache of the
+  TLS service, replacing the least recently used entry if the cache is full.
+
+  @param[in]  TlsInstance    The pointer to the TLS instance.
+
+**/
+VOID
+TlsSessionCacheSave (
+  IN     TLS_INSTANCE  *TlsInstance
+  )
+{
+  TLS_SERVICE              *Service;
+  TLS_SESSION_CACHE_ENTRY  *CacheEntry;
+  UINT8                    *Session;
+  UINTN                    SessionSize;
+  EFI_STATUS               Status;
+
+  if (!TlsSessionCacheable (TlsInstance)) {
+    return;
+  }
+
+  Service     = TlsInstance->Service;
+  SessionSize = 0;
+  Status      = TlsGetResumableSession (TlsInstance->TlsConn, NULL, &SessionSize);
+  if (Status != EFI_BUFFER_TOO_SMALL) {
+    return;
+  }
+
+  Session = AllocatePool (SessionSize);
+  if (Session == NULL) {
+    return;
+  }
+
+  Status = TlsGetResumableSession (TlsInstance->TlsConn, Session, &SessionSize);
+  if (EFI_ERROR (Status)) {
+    FreePool (Session);
+    return;
+  }
+
+  CacheEntry = TlsSessionCacheFind (TlsInstance);
+  if (CacheEntry == NULL) {
+    if (Service->SessionCacheNum >= TLS_SESSION_CACHE_MAX_ENTRIES) {
+      TlsSessionCacheFreeEntry (
+        Service,
+        TLS_SESSION_CACHE_ENTRY_FROM_LINK (GetPreviousNode (&Service->SessionCache, &Service->SessionCache))
+        );
+    }
+
+    CacheEntry = AllocateZeroPool (sizeof (TLS_SESSION_CACHE_ENTRY));
+    if (CacheEntry == NULL) {
+      FreePool (Session);
+      return;
+    }
+
+    CacheEntry->HostName = AllocateCopyPool (AsciiStrSize (TlsInstance->HostName), TlsInstance->HostName);
+    if (CacheEntry->HostName == NULL) {
+      FreePool (CacheEntry);
+      FreePool (Session);
+      return;
+    }
+
+    CacheEntry->Signature    = TLS_SESSION_CACHE_ENTRY_SIGNATURE;
+    CacheEntry->PeerPort     = TlsInstance->PeerPort;
+    CacheEntry->VerifyMethod = TlsInstance->VerifyMethod;
+    CopyMem (CacheEntry->ConfigDigest, TlsInstance->ConfigDigest, SHA256_DIGEST_SIZE);
+    InsertHeadList (&Service->SessionCache, &CacheEntry->Link);
+    Service->SessionCacheNum++;
+  } else {
+    ZeroMem (CacheEntry->Session, CacheEntry->SessionSize);
+    FreePool (CacheEntry->Session);
+  }
+
+  CacheEntry->Session     = Session;
+  CacheEntry->SessionSize = SessionSize;
+}
+
+/**
+  Remove the session cached for the server of the TLS instance.
+
+  @param[in]  TlsInstance    The pointer to the TLS instance.
+
+**/
+VOID
+TlsSessionCacheRemove (
+  IN     TLS_INSTANCE  *TlsInstance
+  )
+{
+  TLS_SESSION_CACHE_ENTRY  *CacheEntry;
+
+  if (!TlsSessionCacheable (TlsInstance)) {
+    return;
+  }
+
+  CacheEntry = TlsSessionCacheFind (TlsInstance);
+  if (CacheEntry != NULL) {
+    TlsSessionCacheFreeEntry (TlsInstance->Service, CacheEntry);
+  }
+}
+
+/**
+  Add configuration data set through the TLS configuration protocol to the
+  configuration digest of the TLS instance, i.e. compute
+  SHA256 (ConfigDigest || DataType || Data).
+
+  @param[in]  TlsInstance    The pointer to the TLS instance.
+  @param[in]  DataType       Configuration data type.
+  @param[in]  Data           Pointer to configuration data.
+  @param[in]  DataSize       Total size of configuration data.
+
+**/
+VOID
+TlsSessionCacheUpdateConfigDigest (
+  IN     TLS_INSTANCE              *TlsInstance,
+  IN     EFI_TLS_CONFIG_DATA_TYPE  DataType,
+  IN     VOID                      *Data,
+  IN     UINTN                     DataSize
+  )
+{
+  VOID     *HashContext;
+  BOOLEAN  Result;
+
+  HashContext = AllocatePool (Sha256GetContextSize ());
+  if (HashContext == NULL) {
+    TlsInstance->ConfigDigestFailed = TRUE;
+    return;
+  }
+
+  Result = Sha256Init (HashContext) &&
+           Sha256Update (HashContext, TlsInstance->ConfigDigest, SHA256_DIGEST_SIZE) &&
+           Sha256Update (HashContext, &DataType, sizeof (DataType)) &&
+           Sha256Update (HashContext, Data, DataSize) &&
+           Sha256Final (HashContext, TlsInstance->ConfigDigest);
+  if (!Result) {
+    TlsInstance->ConfigDigestFailed = TRUE;
+  }
+
+  FreePool (HashContext);
+}
+
+/**
+  Set the port of the server the TLS child connects to.
+
+  @param[in]  This              Pointer to the EDKII_TLS_SESSION_CACHE_PROTOCOL instance.
+  @param[in]  Port              The port of the server.
+
+  @retval EFI_SUCCESS           The port is set.
+  @retval EFI_INVALID_PARAMETER This is NULL.
+  @retval EFI_ACCESS_DENIED     The handshake has already started.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsSessionCacheSetPeerPort (
+  IN EDKII_TLS_SESSION_CACHE_PROTOCOL  *This,
+  IN UINT16                            Port
+  )
+{
+  TLS_INSTANCE  *Instance;
+  EFI_TPL       OldTpl;
+  EFI_STATUS    Status;
+
+  if (This == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
+
+  Instance = TLS_INSTANCE_FROM_SESSION_CACHE (This);
+  if (Instance->TlsSessionState != EfiTlsSessionNotStarted) {
+    Status = EFI_ACCESS_DENIED;
+  } else {
+    Instance->PeerPort      = Port;
+    Instance->PeerPortValid = TRUE;
+    Status                  = EFI_SUCCESS;
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Status;
+}
+
+/**
+  Remove all the sessions in the session cache of the TLS service.
+
+  @param[in]  Service        The pointer to the TLS service.
+
+**/
+VOID
+TlsSessionCacheFlush (
+  IN     TLS_SERVICE  *Service
+  )
+{
+  while (!IsListEmpty (&Service->SessionCache)) {
+    TlsSessionCacheFreeEntry (Service, TLS_SESSION_CACHE_ENTRY_FROM_LINK (GetFirstNode (&Service->SessionCache)));
+  }
+}
@@ -28,6 +28,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 #include <Protocol/Tls.h>
 #include <Protocol/TlsConfig.h>
+#include <Protocol/TlsSessionCache.h>
 
 #include <IndustryStandard/Tls1.h>
 
@@ -86,6 +87,89 @@ TlsDecryptPacket (
   IN     UINT32                 *FragmentCount
   );
 
+/**
+  Set the session cached for the server of the TLS instance, if any, so that
+  the handshake resumes it instead of performing a full handshake.
+
+  @param[in]  TlsInstance    The pointer to the TLS instance.
+
+**/
+VOID
+TlsSessionCacheResume (
+  IN     TLS_INSTANCE  *TlsInstance
+  );
+
+/**
+  Save the resumable session of the TLS instance in the session cache of the
+  TLS service, replacing the least recently used entry if the cache is full.
+
+  @param[in]  TlsInstance    The pointer to the TLS instance.
+
+**/
+VOID
+TlsSessionCacheSave (
+  IN     TLS_INSTANCE  *TlsInstance
+  );
+
+/**
+  Remove the session cached for the server of the TLS instance.
+
+  @param[in]  TlsInstance    The pointer to the TLS instance.
+
+**/
+VOID
+TlsSessionCacheRemove (
+  IN     TLS_INSTANCE  *TlsInstance
+  );
+
+/**
+  Add configuration data set through the TLS configuration protocol to the
+  configuration digest of the TLS instance, i.e. compute
+  SHA256 (ConfigDigest || DataType || Data).
+
+  @param[in]  TlsInstance    The pointer to the TLS instance.
+  @param[in]  DataType       Configuration data type.
+  @param[in]  Data           Pointer to configuration data.
+  @param[in]  DataSize       Total size of configuration data.
+
+**/
+VOID
+TlsSessionCacheUpdateConfigDigest (
+  IN     TLS_INSTANCE              *TlsInstance,
+  IN     EFI_TLS_CONFIG_DATA_TYPE  DataType,
+  IN     VOID                      *Data,
+  IN     UINTN                     DataSize
+  );
+
+/**
+  Set the port of the server the TLS child connects to.
+
+  @param[in]  This              Pointer to the EDKII_TLS_SESSION_CACHE_PROTOCOL instance.
+  @param[in]  Port              The port of the server.
+
+  @retval EFI_SUCCESS           The port is set.
+  @retval EFI_INVALID_PARAMETER This is NULL.
+  @retval EFI_ACCESS_DENIED     The handshake has already started.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsSessionCacheSetPeerPort (
+  IN EDKII_TLS_SESSION_CACHE_PROTOCOL  *This,
+  IN UINT16                            Port
+  );
+
+/**
+  Remove all the sessions in the session cache of the TLS service.
+
+  @param[in]  Service        The pointer to the TLS service.
+
+**/
+VOID
+TlsSessionCacheFlush (
+  IN     TLS_SERVICE  *Service
+  );
+
 /**
   Set TLS session data.
 
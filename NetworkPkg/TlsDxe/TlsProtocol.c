@@ -152,6 +152,7 @@ TlsSetSessionData (
       }
 
       TlsSetVerify (Instance->TlsConn, *((UINT32 *)Data));
+      Instance->VerifyMethod = *((EFI_TLS_VERIFY *)Data);
       break;
     case EfiTlsVerifyHost:
       if (DataSize != sizeof (EFI_TLS_VERIFY_HOST)) {
@@ -187,6 +188,22 @@ TlsSetSessionData (
       }
 
       Status = TlsSetVerifyHost (Instance->TlsConn, TlsVerifyHost->Flags, TlsVerifyHost->HostName);
+      if (EFI_ERROR (Status)) {
+        goto ON_EXIT;
+      }
+
+      //
+      // Keep the host name as part of the key of the session cache.
+      //
+      if (Instance->HostName != NULL) {
+        FreePool (Instance->HostName);
+      }
+
+      Instance->HostName = AllocateCopyPool (AsciiStrSize (TlsVerifyHost->HostName), TlsVerifyHost->HostName);
+      if (Instance->HostName == NULL) {
+        Status = EFI_OUT_OF_RESOURCES;
+        goto ON_EXIT;
+      }
 
       break;
     case EfiTlsSessionID:
@@ -485,8 +502,11 @@ TlsBuildResponsePacket (
     switch (Instance->TlsSessionState) {
       case EfiTlsSessionNotStarted:
         //
-        // ClientHello.
+        // ClientHello, offering the session cached for the server, if any.
+        // The whole key of the session cache is only known at this point.
         //
+        TlsSessionCacheResume (Instance);
+
         Status = TlsDoHandshake (
                    Instance->TlsConn,
                    NULL,
@@ -570,11 +590,23 @@ TlsBuildResponsePacket (
                  BufferSize
                  );
       if (EFI_ERROR (Status)) {
+        if (Status != EFI_BUFFER_TOO_SMALL) {
+          TlsSessionCacheRemove (Instance);
+        }
+
         goto ON_EXIT;
       }
 
       if (!TlsInHandshake (Instance->TlsConn)) {
         Instance->TlsSessionState = EfiTlsSessionDataTransferring;
+
+        DEBUG ((
+          DEBUG_INFO,
+          "TlsBuildResponsePacket: Handshake with %a done, session %a\n",
+          (Instance->HostName != NULL) ? Instance->HostName : "server",
+          TlsIsSessionResumed (Instance->TlsConn) ? "resumed" : "established"
+          ));
+        TlsSessionCacheSave (Instance);
       }
     } else {
       //
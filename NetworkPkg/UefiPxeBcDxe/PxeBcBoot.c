@@ -1124,6 +1124,47 @@ PxeBcReadBootFileList (
   return Status;
 }
 
+/**
+  Get the time elapsed since a performance counter value was read.
+
+  @param[in]  StartTicks  The performance counter value at the start.
+
+  @return The time elapsed in microseconds, or 0 if the platform TimerLib
+          does not provide a performance counter.
+
+**/
+STATIC
+UINT64
+PxeBcElapsedMicroSeconds (
+  IN UINT64  StartTicks
+  )
+{
+  UINT64  EndTicks;
+  UINT64  CounterStart;
+  UINT64  CounterEnd;
+  UINT64  Ticks;
+
+  EndTicks = GetPerformanceCounter ();
+  GetPerformanceCounterProperties (&CounterStart, &CounterEnd);
+
+  //
+  // The counter may count down, and may wrap around once during the download.
+  //
+  if (CounterStart > CounterEnd) {
+    Ticks = StartTicks - EndTicks;
+    if (EndTicks > StartTicks) {
+      Ticks += CounterStart - CounterEnd;
+    }
+  } else {
+    Ticks = EndTicks - StartTicks;
+    if (StartTicks > EndTicks) {
+      Ticks += CounterEnd - CounterStart;
+    }
+  }
+
+  return DivU64x32 (GetTimeInNanoSecond (Ticks), 1000);
+}
+
 /**
   Load boot file into user buffer.
 
@@ -1151,12 +1192,15 @@ PxeBcLoadBootFile (
   EFI_STATUS                  Status;
   EFI_PXE_BASE_CODE_PROTOCOL  *PxeBc;
   EFI_PXE_BASE_CODE_MODE      *PxeBcMode;
+  UINT64                      StartTime;
+  UINT64                      ElapsedUs;
 
   NewMakeCallback = FALSE;
   PxeBc           = &Private->PxeBc;
   PxeBcMode       = &Private->Mode;
   CurrentSize     = *BufferSize;
   RequiredSize    = 0;
+  ElapsedUs       = 0;
 
   //
   // Install pxebc callback protocol if hasn't been installed yet.
@@ -1216,6 +1260,14 @@ PxeBcLoadBootFile (
   // Begin to download the bootfile if everything is ready.
   //
   AsciiPrint ("\n Downloading NBP file...\n");
+  DEBUG ((
+    DEBUG_INFO,
+    "PxeBcLoadBootFile: requesting blksize %Lu, windowsize %Lu\n",
+    (UINT64)Private->BlockSize,
+    PcdGet64 (PcdPxeTftpWindowSize)
+    ));
+
+  StartTime = GetPerformanceCounter ();
   if (PxeBcMode->UsingIpv6) {
     Status = PxeBcReadBootFileList (
                Private,
@@ -1237,12 +1289,26 @@ PxeBcLoadBootFile (
                       );
   }
 
+  ElapsedUs = PxeBcElapsedMicroSeconds (StartTime);
+
 ON_EXIT:
   *BufferSize = (UINTN)CurrentSize;
   PxeBcUninstallCallback (Private, NewMakeCallback);
 
   if (Status == EFI_SUCCESS) {
     AsciiPrint ("\n  NBP file downloaded successfully.\n");
+    if (ElapsedUs != 0) {
+      //
+      // Report the achieved throughput, it tells whether the TFTP options took effect.
+      //
+      AsciiPrint (
+        "  %lu Bytes in %lu ms (%lu KB/s)\n",
+        CurrentSize,
+        DivU64x32 (ElapsedUs, 1000),
+        DivU64x64Remainder (MultU64x32 (CurrentSize, 1000000), MultU64x32 (ElapsedUs, 1024), NULL)
+        );
+    }
+
     return EFI_SUCCESS;
   } else if ((Status == EFI_BUFFER_TOO_SMALL) && (Buffer != NULL)) {
     AsciiPrint ("\n  PXE-E05: Buffer size is smaller than the requested file.\n");
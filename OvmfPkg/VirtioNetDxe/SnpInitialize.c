@@ -214,9 +214,10 @@ VirtioNetInitTx (
 
   //
   // In VirtIo 1.0, the NumBuffers field is mandatory. In 0.9.5, it depends on
-  // VIRTIO_NET_F_MRG_RXBUF, which we never negotiate.
+  // VIRTIO_NET_F_MRG_RXBUF.
   //
-  TxSharedReqSize = (Dev->VirtIo->Revision < VIRTIO_SPEC_REVISION (1, 0, 0)) ?
+  TxSharedReqSize = ((Dev->VirtIo->Revision < VIRTIO_SPEC_REVISION (1, 0, 0)) &&
+                     ((Dev->Features & VIRTIO_NET_F_MRG_RXBUF) == 0)) ?
                     sizeof (Dev->TxSharedReq->V0_9_5) :
                     sizeof *Dev->TxSharedReq;
 
@@ -249,7 +250,8 @@ VirtioNetInitTx (
   Dev->TxSharedReq->V0_9_5.GsoType = VIRTIO_NET_HDR_GSO_NONE;
 
   //
-  // For VirtIo 1.0 only -- the field exists, but it is unused
+  // For VirtIo 1.0 and VIRTIO_NET_F_MRG_RXBUF only -- the field exists, but it
+  // is unused
   //
   Dev->TxSharedReq->NumBuffers = 0;
 
@@ -324,9 +326,10 @@ VirtioNetInitRx (
 
   //
   // In VirtIo 1.0, the NumBuffers field is mandatory. In 0.9.5, it depends on
-  // VIRTIO_NET_F_MRG_RXBUF, which we never negotiate.
+  // VIRTIO_NET_F_MRG_RXBUF.
   //
-  VirtioNetReqSize = (Dev->VirtIo->Revision < VIRTIO_SPEC_REVISION (1, 0, 0)) ?
+  VirtioNetReqSize = ((Dev->VirtIo->Revision < VIRTIO_SPEC_REVISION (1, 0, 0)) &&
+                      ((Dev->Features & VIRTIO_NET_F_MRG_RXBUF) == 0)) ?
                      sizeof (VIRTIO_NET_REQ) :
                      sizeof (VIRTIO_1_0_NET_REQ);
 
@@ -557,8 +560,16 @@ VirtioNetInitialize (
     !!(Features & VIRTIO_NET_F_STATUS)
     );
 
+  //
+  // Besides the features we depend on, accept mergeable RX buffers if the
+  // device offers them. They let the device fill each RX buffer in a single
+  // pass on its fast path (we always post buffers that are large enough for a
+  // complete frame, so NumBuffers stays 1). RX checksum offload is not
+  // accepted: the guest would have to complete the partial checksums itself,
+  // and the protocol stack verifies every checksum again anyway.
+  //
   Features &= VIRTIO_NET_F_MAC | VIRTIO_NET_F_STATUS | VIRTIO_F_VERSION_1 |
-              VIRTIO_F_IOMMU_PLATFORM;
+              VIRTIO_F_IOMMU_PLATFORM | VNET_OPTIONAL_FEATURES;
 
   //
   // In virtio-1.0, feature negotiation is expected to complete before queue
@@ -605,6 +616,8 @@ VirtioNetInitialize (
     }
   }
 
+  Dev->Features = Features;
+
   //
   // step 6 -- virtio-net initialization complete
   //
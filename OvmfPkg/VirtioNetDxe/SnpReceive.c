@@ -76,6 +76,7 @@ VirtioNetReceive (
   UINT16      AvailIdx;
   EFI_STATUS  NotifyStatus;
   UINTN       RxBufOffset;
+  UINT8       *RxHdrPtr;
 
   if ((This == NULL) || (BufferSize == NULL) || (Buffer == NULL)) {
     return EFI_INVALID_PARAMETER;
@@ -140,6 +141,18 @@ VirtioNetReceive (
   RxBufOffset = (UINTN)(Dev->RxRing.Desc[DescIdx + 1].Addr -
                         Dev->RxBufDeviceBase);
   RxPtr = Dev->RxBuf + RxBufOffset;
+
+  if ((Dev->Features & VIRTIO_NET_F_MRG_RXBUF) != 0) {
+    RxHdrPtr = Dev->RxBuf + (UINTN)(Dev->RxRing.Desc[DescIdx].Addr -
+                                    Dev->RxBufDeviceBase);
+
+    //
+    // Every RX buffer we post can hold a complete frame, hence the device
+    // never has to merge buffers.
+    //
+    ASSERT (((VIRTIO_1_0_NET_REQ *)RxHdrPtr)->NumBuffers == 1);
+  }
+
   CopyMem (Buffer, RxPtr, RxLen);
 
   if (DestAddr != NULL) {
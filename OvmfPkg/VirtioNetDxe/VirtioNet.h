@@ -27,7 +27,12 @@
 //
 // maximum number of pending packets, separately for each direction
 //
-#define VNET_MAX_PENDING  64
+#define VNET_MAX_PENDING  256
+
+//
+// optional features that the driver accepts if the device offers them
+//
+#define VNET_OPTIONAL_FEATURES  VIRTIO_NET_F_MRG_RXBUF
 
 //
 // State diagram:
@@ -76,6 +81,7 @@ typedef struct {
   EFI_EVENT                      ExitBoot;       // VirtioNetSnpPopulate
   EFI_DEVICE_PATH_PROTOCOL       *MacDevicePath; // VirtioNetDriverBindingStart
   EFI_HANDLE                     MacHandle;      // VirtioNetDriverBindingStart
+  UINT64                         Features;       // VirtioNetInitialize
 
   VRING                          RxRing;          // VirtioNetInitRing
   VOID                           *RxRingMap;      // VirtioRingMap and
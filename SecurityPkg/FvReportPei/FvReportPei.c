@@ -9,9 +9,9 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include "FvReportPei.h"
 
 STATIC CONST HASH_ALG_INFO  mHashAlgInfo[] = {
-  { TPM_ALG_SHA256, SHA256_DIGEST_SIZE, Sha256Init, Sha256Update, Sha256Final, Sha256HashAll }, // 000B
-  { TPM_ALG_SHA384, SHA384_DIGEST_SIZE, Sha384Init, Sha384Update, Sha384Final, Sha384HashAll }, // 000C
-  { TPM_ALG_SHA512, SHA512_DIGEST_SIZE, Sha512Init, Sha512Update, Sha512Final, Sha512HashAll }, // 000D
+  { TPM_ALG_SHA256, SHA256_DIGEST_SIZE, Sha256GetContextSize, Sha256Init, Sha256Update, Sha256Final, Sha256HashAll }, // 000B
+  { TPM_ALG_SHA384, SHA384_DIGEST_SIZE, Sha384GetContextSize, Sha384Init, Sha384Update, Sha384Final, Sha384HashAll }, // 000C
+  { TPM_ALG_SHA512, SHA512_DIGEST_SIZE, Sha512GetContextSize, Sha512Init, Sha512Update, Sha512Final, Sha512HashAll }, // 000D
 };
 
 /**
@@ -93,6 +93,145 @@ InstallPreHashFvPpi (
   ASSERT_EFI_ERROR (Status);
 }
 
+/**
+  Copy a FV to memory and hash the copy.
+
+  The FV is copied in pieces, each of them being hashed right after it has
+  been copied, while it is still in the cache. The hash covers the copy, not
+  the flash, so that the FV cannot be changed after it has been hashed.
+
+  This function neither uses PEI services nor reads the performance counter,
+  so it may run on an AP. The hash functions must not use PEI services either,
+  which holds for PeiCryptLib but not for BaseCryptLibOnProtocolPpi.
+
+  @param[in, out]  Job    The FV to copy and hash.
+
+**/
+STATIC
+VOID
+CopyAndHashFv (
+  IN OUT FV_HASH_JOB  *Job
+  )
+{
+  CONST HASH_ALG_INFO  *AlgInfo;
+  UINTN                Offset;
+  UINTN                Size;
+
+  AlgInfo = Job->AlgInfo;
+
+  Job->Result = AlgInfo->HashInit (Job->HashContext);
+  for (Offset = 0; Job->Result && (Offset < Job->Length); Offset += Size) {
+    Size = MIN (Job->Length - Offset, FV_COPY_CHUNK_SIZE);
+    CopyMem ((UINT8 *)Job->Buffer + Offset, (CONST UINT8 *)Job->Source + Offset, Size);
+    Job->Result = AlgInfo->HashUpdate (Job->HashContext, (UINT8 *)Job->Buffer + Offset, Size);
+  }
+
+  if (Job->Result) {
+    Job->Result = AlgInfo->HashFinal (Job->HashContext, Job->HashValue);
+  }
+}
+
+/**
+  Copy and hash FVs on an AP until no job is left.
+
+  @param[in, out]  Buffer   Pointer to the FV_HASH_JOB_LIST.
+
+**/
+STATIC
+VOID
+EFIAPI
+HashFvJobs (
+  IN OUT VOID  *Buffer
+  )
+{
+  FV_HASH_JOB_LIST  *JobList;
+  UINT32            Index;
+
+  JobList = (FV_HASH_JOB_LIST *)Buffer;
+  while (TRUE) {
+    Index = InterlockedIncrement (&JobList->NextJob) - 1;
+    if (Index >= JobList->JobCount) {
+      break;
+    }
+
+    CopyAndHashFv (&JobList->Jobs[Index]);
+  }
+}
+
+/**
+  Copy and hash the FVs left on the BSP, recording the time spent on each of
+  them.
+
+  @param[in, out]  JobList    The FVs to copy and hash.
+
+**/
+STATIC
+VOID
+HashFvJobsOnBsp (
+  IN OUT FV_HASH_JOB_LIST  *JobList
+  )
+{
+  FV_HASH_JOB  *Job;
+  UINT32       Index;
+
+  while (TRUE) {
+    Index = InterlockedIncrement (&JobList->NextJob) - 1;
+    if (Index >= JobList->JobCount) {
+      break;
+    }
+
+    Job              = &JobList->Jobs[Index];
+    Job->StartTicker = GetPerformanceCounter ();
+    CopyAndHashFv (Job);
+    Job->EndTicker = GetPerformanceCounter ();
+  }
+}
+
+/**
+  Run the FV hash jobs.
+
+  If PcdFvReportParallelHash is TRUE and the MP services PPI is available,
+  the jobs are run concurrently on the APs. Otherwise, or if the APs could
+  not be started, they are run one after the other on the BSP.
+
+  The performance counter is only read on the BSP. The time spent hashing on
+  the APs is recorded as a whole, in the "FvHash" FPDT records.
+
+  @param[in, out]  JobList    The FVs to copy and hash.
+
+**/
+STATIC
+VOID
+RunFvHashJobs (
+  IN OUT FV_HASH_JOB_LIST  *JobList
+  )
+{
+  EFI_STATUS               Status;
+  EFI_PEI_MP_SERVICES_PPI  *MpServices;
+
+  if (PcdGetBool (PcdFvReportParallelHash) && (JobList->JobCount > 1)) {
+    Status = PeiServicesLocatePpi (&gEfiPeiMpServicesPpiGuid, 0, NULL, (VOID **)&MpServices);
+    if (!EFI_ERROR (Status)) {
+      PERF_START_EX (NULL, "FvHash", "FvReportPei", 0, PERF_ID_FV_REPORT_PEI);
+      Status = MpServices->StartupAllAPs (
+                             GetPeiServicesTablePointer (),
+                             MpServices,
+                             HashFvJobs,
+                             FALSE,
+                             0,
+                             JobList
+                             );
+      PERF_END_EX (NULL, "FvHash", "FvReportPei", 0, PERF_ID_FV_REPORT_PEI + 1);
+      DEBUG ((DEBUG_INFO, "Hash %d FVs on APs: %r\r\n", JobList->JobCount, Status));
+    }
+  }
+
+  //
+  // Run whatever is left, which is every job if no AP ran.
+  //
+  HashFvJobsOnBsp (JobList);
+}
+
 /**
   Calculate and verify hash value for given FV.
 
@@ -115,10 +254,13 @@ VerifyHashedFv (
   )
 {
   UINTN                FvIndex;
+  UINTN                JobIndex;
   CONST HASH_ALG_INFO  *AlgInfo;
   UINT8                *HashValue;
   UINT8                *FvHashValue;
-  VOID                 *FvBuffer;
+  FV_HASH_JOB_LIST     JobList;
+  FV_HASH_JOB          *Job;
+  CHAR8                Token[FPDT_STRING_EVENT_RECORD_NAME_LENGTH];
   EFI_STATUS           Status;
 
   if ((HashInfo == NULL) ||
@@ -149,10 +291,14 @@ VerifyHashedFv (
   HashValue = AllocateZeroPool (AlgInfo->HashSize * (FvNumber + 1));
   ASSERT (HashValue != NULL);
 
+  JobList.Jobs     = AllocateZeroPool (sizeof (FV_HASH_JOB) * FvNumber);
+  JobList.JobCount = 0;
+  JobList.NextJob  = 0;
+  ASSERT (JobList.Jobs != NULL);
+
   //
-  // Calculate hash value for each FV first.
+  // Prepare a job for each FV to hash.
   //
-  FvHashValue = HashValue;
   for (FvIndex = 0; FvIndex < FvNumber; ++FvIndex) {
     //
     // Not meant for verified boot and/or measured boot?
@@ -188,24 +334,52 @@ VerifyHashedFv (
       ));
 
     //
-    // Copy FV to permanent memory to avoid potential TOC/TOU.
+    // The FV is copied to permanent memory to avoid potential TOC/TOU.
     //
-    FvBuffer = AllocatePages (EFI_SIZE_TO_PAGES ((UINTN)FvInfo[FvIndex].Length));
-    ASSERT (FvBuffer != NULL);
-    CopyMem (FvBuffer, (CONST VOID *)(UINTN)FvInfo[FvIndex].Base, (UINTN)FvInfo[FvIndex].Length);
+    Job              = &JobList.Jobs[JobList.JobCount++];
+    Job->FvInfo      = &FvInfo[FvIndex];
+    Job->AlgInfo     = AlgInfo;
+    Job->Source      = (CONST VOID *)(UINTN)FvInfo[FvIndex].Base;
+    Job->Length      = (UINTN)FvInfo[FvIndex].Length;
+    Job->Buffer      = AllocatePages (EFI_SIZE_TO_PAGES (Job->Length));
+    Job->HashContext = AllocatePool (AlgInfo->HashGetContextSize ());
+    ASSERT (Job->Buffer != NULL);
+    ASSERT (Job->HashContext != NULL);
+  }
+
+  //
+  // Calculate hash value for each FV first.
+  //
+  RunFvHashJobs (&JobList);
+
+  //
+  // Report the results in the order of the FVs, whichever processor hashed
+  // them, and record the time spent on each FV hashed on the BSP.
+  //
+  FvHashValue = HashValue;
+  for (JobIndex = 0; JobIndex < JobList.JobCount; ++JobIndex) {
+    Job = &JobList.Jobs[JobIndex];
 
-    if (!AlgInfo->HashAll (FvBuffer, (UINTN)FvInfo[FvIndex].Length, FvHashValue)) {
+    if (Job->EndTicker != 0) {
+      AsciiSPrint (Token, sizeof (Token), "FvHash:%08lX", Job->FvInfo->Base);
+      PERF_START_EX (NULL, Token, "FvReportPei", Job->StartTicker, PERF_ID_FV_REPORT_PEI);
+      PERF_END_EX (NULL, Token, "FvReportPei", Job->EndTicker, PERF_ID_FV_REPORT_PEI + 1);
+    }
+
+    if (!Job->Result) {
       Status = EFI_ABORTED;
       goto Done;
     }
 
+    CopyMem (FvHashValue, Job->HashValue, AlgInfo->HashSize);
+
     //
     // Report the FV measurement.
     //
-    if ((FvInfo[FvIndex].Flag & HASHED_FV_FLAG_MEASURED_BOOT) != 0) {
+    if ((Job->FvInfo->Flag & HASHED_FV_FLAG_MEASURED_BOOT) != 0) {
       InstallPreHashFvPpi (
-        FvBuffer,
-        (UINTN)FvInfo[FvIndex].Length,
+        Job->Buffer,
+        Job->Length,
         HashInfo->HashAlgoId,
         HashInfo->HashSize,
         FvHashValue
@@ -215,14 +389,14 @@ VerifyHashedFv (
     //
     // Don't keep the hash value of current FV if we don't need to verify it.
     //
-    if ((FvInfo[FvIndex].Flag & HASHED_FV_FLAG_VERIFIED_BOOT) != 0) {
+    if ((Job->FvInfo->Flag & HASHED_FV_FLAG_VERIFIED_BOOT) != 0) {
       FvHashValue += AlgInfo->HashSize;
     }
 
     //
     // Use memory copy of the FV from now on.
     //
-    FvInfo[FvIndex].Base = (UINT64)(UINTN)FvBuffer;
+    Job->FvInfo->Base = (UINT64)(UINTN)Job->Buffer;
   }
 
   //
@@ -238,6 +412,11 @@ VerifyHashedFv (
   }
 
 Done:
+  for (JobIndex = 0; JobIndex < JobList.JobCount; ++JobIndex) {
+    FreePool (JobList.Jobs[JobIndex].HashContext);
+  }
+
+  FreePool (JobList.Jobs);
   FreePool (HashValue);
   return Status;
 }
@@ -13,9 +13,13 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <IndustryStandard/Tpm20.h>
 
+#include <Guid/ExtendedFirmwarePerformance.h>
+
 #include <Ppi/FirmwareVolumeInfoStoredHashFv.h>
+#include <Ppi/MpServices.h>
 
 #include <Library/PeiServicesLib.h>
+#include <Library/PeiServicesTablePointerLib.h>
 #include <Library/PcdLib.h>
 #include <Library/HobLib.h>
 #include <Library/DebugLib.h>
@@ -23,6 +27,10 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/MemoryAllocationLib.h>
 #include <Library/BaseCryptLib.h>
 #include <Library/ReportStatusCodeLib.h>
+#include <Library/SynchronizationLib.h>
+#include <Library/TimerLib.h>
+#include <Library/PerformanceLib.h>
+#include <Library/PrintLib.h>
 
 #define HASH_INFO_PTR(PreHashedFvPpi)  \
   (HASH_INFO *)((UINT8 *)(PreHashedFvPpi) + sizeof (EDKII_PEI_FIRMWARE_VOLUME_INFO_PREHASHED_FV_PPI))
@@ -30,6 +38,26 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define HASH_VALUE_PTR(HashInfo)   \
   (VOID *)((UINT8 *)(HashInfo) + sizeof (HASH_INFO))
 
+//
+// Size of the pieces in which a FV is copied to memory and hashed, so that
+// each piece is hashed while it is still in the cache.
+//
+#define FV_COPY_CHUNK_SIZE  SIZE_256KB
+
+#define PERF_ID_FV_REPORT_PEI  0x30A0
+
+/**
+  Retrieves the size, in bytes, of the context buffer required for hash operations.
+
+  @return  The size, in bytes, of the context buffer required for hash operations.
+
+**/
+typedef
+UINTN
+(EFIAPI *HASH_GET_CONTEXT_SIZE_METHOD)(
+  VOID
+  );
+
 /**
   Computes the message digest of a input data buffer.
 
@@ -110,12 +138,41 @@ BOOLEAN
   );
 
 typedef struct {
-  UINT16                HashAlgId;
-  UINTN                 HashSize;
-  HASH_INIT_METHOD      HashInit;
-  HASH_UPDATE_METHOD    HashUpdate;
-  HASH_FINAL_METHOD     HashFinal;
-  HASH_ALL_METHOD       HashAll;
+  UINT16                          HashAlgId;
+  UINTN                           HashSize;
+  HASH_GET_CONTEXT_SIZE_METHOD    HashGetContextSize;
+  HASH_INIT_METHOD                HashInit;
+  HASH_UPDATE_METHOD              HashUpdate;
+  HASH_FINAL_METHOD               HashFinal;
+  HASH_ALL_METHOD                 HashAll;
 } HASH_ALG_INFO;
 
+//
+// Copy and hash of one FV. Everything the job needs is allocated beforehand
+// so that it can run on an AP, which cannot use PEI services. StartTicker and
+// EndTicker are only set when the job runs on the BSP.
+//
+typedef struct {
+  HASHED_FV_INFO         *FvInfo;
+  CONST HASH_ALG_INFO    *AlgInfo;
+  VOID                   *HashContext;
+  CONST VOID             *Source;
+  VOID                   *Buffer;
+  UINTN                  Length;
+  UINT64                 StartTicker;
+  UINT64                 EndTicker;
+  BOOLEAN                Result;
+  UINT8                  HashValue[SHA512_DIGEST_SIZE];
+} FV_HASH_JOB;
+
+//
+// Jobs shared by the processors. Each processor takes the next job until none
+// is left.
+//
+typedef struct {
+  FV_HASH_JOB        *Jobs;
+  UINT32             JobCount;
+  volatile UINT32    NextJob;
+} FV_HASH_JOB_LIST;
+
 #endif //__FV_REPORT_PEI_H__
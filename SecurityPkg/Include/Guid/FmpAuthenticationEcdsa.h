@@ -0,0 +1,56 @@
+/** @file
+  Defines the certificate type and the certificate blocks of FMP images
+  signed with EC-DSA.
+
+  EFI_FIRMWARE_IMAGE_AUTHENTICATION.AuthInfo.CertType is
+  gEdkiiCertTypeEcdsaGuid and AuthInfo.CertData is one of the blocks below,
+  selected by its HashType. The signature covers the payload that follows
+  AuthInfo, then the MonotonicCount, like the RSA2048SHA256 certificate type.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef FMP_AUTHENTICATION_ECDSA_H_
+#define FMP_AUTHENTICATION_ECDSA_H_
+
+#define EDKII_CERT_TYPE_ECDSA_GUID \
+  { \
+    0x81f10a76, 0x03cf, 0x473c, { 0x86, 0x05, 0xb7, 0x2f, 0xc4, 0xe2, 0xf2, 0x8e } \
+  }
+
+extern EFI_GUID  gEdkiiCertTypeEcdsaGuid;
+
+///
+/// EC-DSA certificate block with the NIST P-256 curve and SHA-256.
+/// HashType is EFI_HASH_ALGORITHM_SHA256_GUID.
+///
+typedef struct {
+  EFI_GUID    HashType;
+  ///
+  /// The X and Y coordinates of the public key, big-endian.
+  ///
+  UINT8       PublicKey[64];
+  ///
+  /// The r and s values of the signature, big-endian.
+  ///
+  UINT8       Signature[64];
+} EDKII_CERT_BLOCK_ECDSA_P256_SHA256;
+
+///
+/// EC-DSA certificate block with the NIST P-384 curve and SHA-384.
+/// HashType is EFI_HASH_ALGORITHM_SHA384_GUID.
+///
+typedef struct {
+  EFI_GUID    HashType;
+  ///
+  /// The X and Y coordinates of the public key, big-endian.
+  ///
+  UINT8       PublicKey[96];
+  ///
+  /// The r and s values of the signature, big-endian.
+  ///
+  UINT8       Signature[96];
+} EDKII_CERT_BLOCK_ECDSA_P384_SHA384;
+
+#endif
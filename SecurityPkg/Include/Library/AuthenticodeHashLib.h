@@ -0,0 +1,83 @@
+/** @file
+  Authenticode hashing of PE/COFF images.
+
+  This library walks the ranges of a PE/COFF image covered by the Authenticode
+  digest, as described in PE/COFF Specification 8.0 Appendix A, and feeds them
+  to a caller supplied hash update function. The image is either resident in
+  memory and hashed in place, or read incrementally through a
+  PE_COFF_LOADER_READ_FILE function, so that it does not need to be buffered
+  whole. A single walk can feed several digests through one update function.
+
+  Caution: This library may receive untrusted input. The PE/COFF image is
+  external input, so the image structure is validated before use.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef AUTHENTICODE_HASH_LIB_H_
+#define AUTHENTICODE_HASH_LIB_H_
+
+#include <Library/PeCoffLib.h>
+
+/**
+  Performs digest on a data buffer of the specified length. This function is
+  called several times, in file order, with the ranges of the image covered by
+  the Authenticode digest.
+
+  The prototype matches the HashUpdate functions of BaseCryptLib.
+
+  @param[in, out]  HashContext  Context passed to AuthenticodeHashPeImage().
+  @param[in]       Data         Pointer to the image data to be hashed.
+  @param[in]       DataSize     Size of Data in bytes.
+
+  @retval TRUE     The data was hashed.
+  @retval FALSE    The data could not be hashed, the walk is aborted.
+
+**/
+typedef
+BOOLEAN
+(EFIAPI *AUTHENTICODE_HASH_UPDATE)(
+  IN OUT  VOID        *HashContext,
+  IN      CONST VOID  *Data,
+  IN      UINTN       DataSize
+  );
+
+/**
+  Feed the ranges of a PE/COFF image covered by its Authenticode digest to a
+  hash update function.
+
+  The hash is neither initialized nor finalized by this function, so that the
+  caller can use any algorithm, or several of them at once.
+
+  @param[in]       FileHandle   Pointer to the image in memory when ImageRead is
+                                NULL, otherwise the handle passed to ImageRead.
+  @param[in]       ImageRead    Function reading the image, NULL if the image is
+                                resident in memory at FileHandle.
+  @param[in]       ImageSize    Size of the image file in bytes.
+  @param[in]       HashUpdate   Function hashing the image data.
+  @param[in, out]  HashContext  Context passed to HashUpdate.
+
+  @retval RETURN_SUCCESS            The image was hashed.
+  @retval RETURN_INVALID_PARAMETER  FileHandle or HashUpdate is NULL.
+  @retval RETURN_UNSUPPORTED        The image is not a valid PE/COFF image, or
+                                    its headers or sections do not fit in
+                                    ImageSize.
+  @retval RETURN_OUT_OF_RESOURCES   The section table or the read buffer could
+                                    not be allocated.
+  @retval RETURN_LOAD_ERROR         ImageRead failed or returned less data than
+                                    requested.
+  @retval RETURN_ABORTED            HashUpdate returned FALSE.
+
+**/
+RETURN_STATUS
+EFIAPI
+AuthenticodeHashPeImage (
+  IN     VOID                      *FileHandle,
+  IN     PE_COFF_LOADER_READ_FILE  ImageRead  OPTIONAL,
+  IN     UINTN                     ImageSize,
+  IN     AUTHENTICODE_HASH_UPDATE  HashUpdate,
+  IN OUT VOID                      *HashContext
+  );
+
+#endif
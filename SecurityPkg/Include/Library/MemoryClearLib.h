@@ -0,0 +1,74 @@
+/** @file
+  Provides services to clear system memory, typically when the MOR
+  (Memory Overwrite Request) bit is set.
+
+  The memory is split into chunks which are cleared concurrently by all the
+  APs through the MP services, with non-temporal stores when the BaseMemoryLib
+  instance linked to the module provides them, as BaseMemoryLibSse2 does. The
+  progress is reported through status codes, and through the
+  DisplayUpdateProgressLib in DXE.
+  MemoryClearLibNull clears nothing, for the platforms that clear the memory
+  themselves.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef MEMORY_CLEAR_LIB_H_
+#define MEMORY_CLEAR_LIB_H_
+
+typedef struct {
+  EFI_PHYSICAL_ADDRESS    BaseAddress;
+  UINT64                  Length;
+} MEMORY_CLEAR_RANGE;
+
+/**
+  Clear ranges of memory.
+
+  The ranges must not be used by the firmware until the function returns.
+
+  @param[in]  Ranges      The ranges to clear.
+  @param[in]  RangeCount  Number of ranges.
+
+  @retval EFI_SUCCESS             The ranges were cleared.
+  @retval EFI_INVALID_PARAMETER   Ranges is NULL and RangeCount is not 0.
+  @retval EFI_INVALID_PARAMETER   A range is not addressable by the processor.
+  @retval EFI_OUT_OF_RESOURCES    There is not enough memory to split the
+                                  ranges. Nothing was cleared.
+  @retval EFI_UNSUPPORTED         The instance does not clear memory.
+
+**/
+EFI_STATUS
+EFIAPI
+MemoryClearRanges (
+  IN CONST MEMORY_CLEAR_RANGE  *Ranges,
+  IN UINTN                     RangeCount
+  );
+
+/**
+  Clear the system memory that the firmware does not use.
+
+  In PEI, the cleared memory is the system memory described by the resource
+  descriptor HOBs above 1 MB, except the memory allocated by HOBs and the PEI
+  memory. In DXE, it is the free system memory in the GCD memory space map,
+  which is allocated for the duration of the clearing so that no other agent
+  uses it meanwhile.
+
+  Only the memory addressable by the processor is cleared, and the first page
+  is skipped, as it may be unmapped to detect NULL pointer accesses.
+
+  @retval EFI_SUCCESS             The memory was cleared.
+  @retval EFI_OUT_OF_RESOURCES    There is not enough memory to list the
+                                  ranges. Nothing was cleared.
+  @retval EFI_UNSUPPORTED         The instance does not clear memory.
+  @retval Others                  The memory map could not be read. Nothing
+                                  was cleared.
+
+**/
+EFI_STATUS
+EFIAPI
+MemoryClearFreeMemory (
+  VOID
+  );
+
+#endif
@@ -56,6 +56,17 @@ EFI_SIGNATURE_ITEM  mSupportSigItem[] = {
   { EFI_CERT_X509_SHA512_GUID,    0, 80            }
 };
 
+//
+// Parsed X.509 trust anchors, PK and KEK certificates, keyed by the SHA-256
+// digest of their DER encoding. The certificate that verified the latest
+// write comes first; a certificate that is parsed but fails to verify is
+// kept at the end. Provisioning tools sign all their updates with the same
+// key, so neither the X.509 parsing nor the failing attempts with the other
+// KEK certificates are repeated on every write.
+//
+AUTH_TRUST_ANCHOR  mTrustAnchorCache[AUTH_TRUST_ANCHOR_CACHE_SIZE];
+UINTN              mTrustAnchorCount = 0;
+
 /**
   Finds variable in storage blocks of volatile and non-volatile storage areas.
 
@@ -550,6 +561,257 @@ VendorKeyIsModified (
            );
 }
 
+/**
+  Release the parsed trust anchors.
+
+  This function is called when PK, KEK or db change.
+
+**/
+VOID
+FlushTrustAnchorCache (
+  VOID
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < mTrustAnchorCount; Index++) {
+    X509Free (mTrustAnchorCache[Index].X509Cert);
+  }
+
+  ZeroMem (mTrustAnchorCache, sizeof (mTrustAnchorCache));
+  mTrustAnchorCount = 0;
+}
+
+/**
+  Look a certificate up in the trust anchor cache.
+
+  @param[in]  Digest          SHA-256 digest of the DER encoded certificate.
+
+  @return The index of the certificate in the cache, or
+          AUTH_TRUST_ANCHOR_CACHE_SIZE if it is not cached.
+
+**/
+UINTN
+FindTrustAnchor (
+  IN CONST UINT8  *Digest
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < mTrustAnchorCount; Index++) {
+    if (CompareMem (mTrustAnchorCache[Index].Digest, Digest, SHA256_DIGEST_SIZE) == 0) {
+      return Index;
+    }
+  }
+
+  return AUTH_TRUST_ANCHOR_CACHE_SIZE;
+}
+
+/**
+  Calculate the SHA-256 digest of a certificate.
+
+  @param[in]  Cert            Pointer to the DER encoded certificate.
+  @param[in]  CertSize        Size of the certificate in bytes.
+  @param[out] Digest          SHA-256 digest of the certificate.
+
+  @retval TRUE                The digest was calculated.
+  @retval FALSE               The digest could not be calculated.
+
+**/
+BOOLEAN
+CalculateCertDigest (
+  IN  CONST UINT8  *Cert,
+  IN  UINTN        CertSize,
+  OUT UINT8        *Digest
+  )
+{
+  return (BOOLEAN)(Sha256Init (mHashCtx) &&
+                   Sha256Update (mHashCtx, Cert, CertSize) &&
+                   Sha256Final (mHashCtx, Digest));
+}
+
+/**
+  Verify a PKCS#7 SignedData against a trusted certificate, parsing the
+  certificate only if it is not in the trust anchor cache yet.
+
+  A certificate that verifies the SignedData moves to the front of the cache.
+  A new certificate takes the last entry of a full cache.
+
+  @param[in]  SigData         Pointer to the PKCS#7 SignedData.
+  @param[in]  SigDataSize     Size of the SignedData in bytes.
+  @param[in]  TrustedCert     Pointer to the DER encoded trusted certificate.
+  @param[in]  TrustedCertSize Size of the trusted certificate in bytes.
+  @param[in]  NewData         Pointer to the signed content.
+  @param[in]  NewDataSize     Size of the signed content in bytes.
+
+  @retval TRUE                The trusted certificate verified the SignedData.
+  @retval FALSE               The SignedData is not valid for the certificate.
+
+**/
+BOOLEAN
+VerifyWithTrustAnchor (
+  IN CONST UINT8  *SigData,
+  IN UINTN        SigDataSize,
+  IN CONST UINT8  *TrustedCert,
+  IN UINTN        TrustedCertSize,
+  IN CONST UINT8  *NewData,
+  IN UINTN        NewDataSize
+  )
+{
+  UINT8              Digest[SHA256_DIGEST_SIZE];
+  UINTN              Index;
+  UINT8              *X509Cert;
+  AUTH_TRUST_ANCHOR  Anchor;
+
+  if (!CalculateCertDigest (TrustedCert, TrustedCertSize, Digest)) {
+    return Pkcs7Verify (SigData, SigDataSize, TrustedCert, TrustedCertSize, NewData, NewDataSize);
+  }
+
+  Index = FindTrustAnchor (Digest);
+  if (Index == AUTH_TRUST_ANCHOR_CACHE_SIZE) {
+    X509Cert = NULL;
+    if (!X509ConstructCertificate (TrustedCert, TrustedCertSize, &X509Cert)) {
+      return FALSE;
+    }
+
+    if (mTrustAnchorCount < AUTH_TRUST_ANCHOR_CACHE_SIZE) {
+      mTrustAnchorCount++;
+    } else {
+      X509Free (mTrustAnchorCache[AUTH_TRUST_ANCHOR_CACHE_SIZE - 1].X509Cert);
+    }
+
+    Index = mTrustAnchorCount - 1;
+    CopyMem (mTrustAnchorCache[Index].Digest, Digest, SHA256_DIGEST_SIZE);
+    mTrustAnchorCache[Index].X509Cert = X509Cert;
+  }
+
+  if (!Pkcs7VerifyWithX509 (SigData, SigDataSize, mTrustAnchorCache[Index].X509Cert, NewData, NewDataSize)) {
+    return FALSE;
+  }
+
+  CopyMem (&Anchor, &mTrustAnchorCache[Index], sizeof (Anchor));
+  CopyMem (&mTrustAnchorCache[1], &mTrustAnchorCache[0], Index * sizeof (AUTH_TRUST_ANCHOR));
+  CopyMem (&mTrustAnchorCache[0], &Anchor, sizeof (Anchor));
+  return TRUE;
+}
+
+/**
+  Verify a PKCS#7 SignedData against the X.509 certificates of the KEK database.
+
+  The cached certificate which verified the latest write is tried first; the
+  other certificates are then tried in database order, so the result is the
+  same as trying every certificate in turn.
+
+  @param[in]  SigData         Pointer to the PKCS#7 SignedData.
+  @param[in]  SigDataSize     Size of the SignedData in bytes.
+  @param[in]  KekData         Pointer to the KEK database.
+  @param[in]  KekDataSize     Size of the KEK database in bytes.
+  @param[in]  NewData         Pointer to the signed content.
+  @param[in]  NewDataSize     Size of the signed content in bytes.
+
+  @retval TRUE                A certificate of the KEK database verified the
+                              SignedData.
+  @retval FALSE               No certificate of the KEK database verified the
+                              SignedData.
+
+**/
+BOOLEAN
+VerifyWithKekDatabase (
+  IN CONST UINT8  *SigData,
+  IN UINTN        SigDataSize,
+  IN UINT8        *KekData,
+  IN UINT32       KekDataSize,
+  IN CONST UINT8  *NewData,
+  IN UINTN        NewDataSize
+  )
+{
+  EFI_SIGNATURE_LIST  *CertList;
+  EFI_SIGNATURE_DATA  *Cert;
+  UINT32              ListSize;
+  UINTN               Index;
+  UINTN               CertCount;
+  UINT8               *TrustedCert;
+  UINTN               TrustedCertSize;
+  UINT8               *BestCert;
+  UINTN               BestCertSize;
+  UINTN               BestIndex;
+  UINTN               CacheIndex;
+  UINT8               Digest[SHA256_DIGEST_SIZE];
+
+  //
+  // Find the certificate of the KEK database that comes first in the trust
+  // anchor cache.
+  //
+  BestCert     = NULL;
+  BestCertSize = 0;
+  BestIndex    = AUTH_TRUST_ANCHOR_CACHE_SIZE;
+  if (mTrustAnchorCount != 0) {
+    ListSize = KekDataSize;
+    CertList = (EFI_SIGNATURE_LIST *)KekData;
+    while ((ListSize > 0) && (ListSize >= CertList->SignatureListSize)) {
+      if (CompareGuid (&CertList->SignatureType, &gEfiCertX509Guid)) {
+        Cert      = (EFI_SIGNATURE_DATA *)((UINT8 *)CertList + sizeof (EFI_SIGNATURE_LIST) + CertList->SignatureHeaderSize);
+        CertCount = (CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST) - CertList->SignatureHeaderSize) / CertList->SignatureSize;
+        for (Index = 0; Index < CertCount; Index++) {
+          TrustedCert     = Cert->SignatureData;
+          TrustedCertSize = CertList->SignatureSize - (sizeof (EFI_SIGNATURE_DATA) - 1);
+          if (CalculateCertDigest (TrustedCert, TrustedCertSize, Digest)) {
+            CacheIndex = FindTrustAnchor (Digest);
+            if (CacheIndex < BestIndex) {
+              BestCert     = TrustedCert;
+              BestCertSize = TrustedCertSize;
+              BestIndex    = CacheIndex;
+            }
+          }
+
+          Cert = (EFI_SIGNATURE_DATA *)((UINT8 *)Cert + CertList->SignatureSize);
+        }
+      }
+
+      ListSize -= CertList->SignatureListSize;
+      CertList  = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
+    }
+  }
+
+  if ((BestCert != NULL) &&
+      VerifyWithTrustAnchor (SigData, SigDataSize, BestCert, BestCertSize, NewData, NewDataSize))
+  {
+    return TRUE;
+  }
+
+  //
+  // Go through the whole KEK database, skipping the certificate tried above.
+  //
+  ListSize = KekDataSize;
+  CertList = (EFI_SIGNATURE_LIST *)KekData;
+  while ((ListSize > 0) && (ListSize >= CertList->SignatureListSize)) {
+    if (CompareGuid (&CertList->SignatureType, &gEfiCertX509Guid)) {
+      Cert      = (EFI_SIGNATURE_DATA *)((UINT8 *)CertList + sizeof (EFI_SIGNATURE_LIST) + CertList->SignatureHeaderSize);
+      CertCount = (CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST) - CertList->SignatureHeaderSize) / CertList->SignatureSize;
+      for (Index = 0; Index < CertCount; Index++) {
+        //
+        // Iterate each Signature Data Node within this CertList for a verify
+        //
+        TrustedCert     = Cert->SignatureData;
+        TrustedCertSize = CertList->SignatureSize - (sizeof (EFI_SIGNATURE_DATA) - 1);
+
+        if ((TrustedCert != BestCert) &&
+            VerifyWithTrustAnchor (SigData, SigDataSize, TrustedCert, TrustedCertSize, NewData, NewDataSize))
+        {
+          return TRUE;
+        }
+
+        Cert = (EFI_SIGNATURE_DATA *)((UINT8 *)Cert + CertList->SignatureSize);
+      }
+    }
+
+    ListSize -= CertList->SignatureListSize;
+    CertList  = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
+  }
+
+  return FALSE;
+}
+
 /**
   Process variable with platform key for verification.
 
@@ -1837,9 +2099,6 @@ VerifyTimeBasedPayload (
   EFI_STATUS                     Status;
   EFI_SIGNATURE_LIST             *CertList;
   EFI_SIGNATURE_DATA             *Cert;
-  UINTN                          Index;
-  UINTN                          CertCount;
-  UINT32                         KekDataSize;
   UINT8                          *NewData;
   UINTN                          NewDataSize;
   UINT8                          *Buffer;
@@ -2039,9 +2298,9 @@ VerifyTimeBasedPayload (
     }
 
     //
-    // Verify Pkcs7 SignedData via Pkcs7Verify library.
+    // Verify Pkcs7 SignedData against the platform key.
     //
-    VerifyStatus = Pkcs7Verify (
+    VerifyStatus = VerifyWithTrustAnchor (
                      SigData,
                      SigDataSize,
                      TopLevelCert,
@@ -2066,41 +2325,14 @@ VerifyTimeBasedPayload (
     //
     // Ready to verify Pkcs7 SignedData. Go through KEK Signature Database to find out X.509 CertList.
     //
-    KekDataSize = (UINT32)DataSize;
-    CertList    = (EFI_SIGNATURE_LIST *)Data;
-    while ((KekDataSize > 0) && (KekDataSize >= CertList->SignatureListSize)) {
-      if (CompareGuid (&CertList->SignatureType, &gEfiCertX509Guid)) {
-        Cert      = (EFI_SIGNATURE_DATA *)((UINT8 *)CertList + sizeof (EFI_SIGNATURE_LIST) + CertList->SignatureHeaderSize);
-        CertCount = (CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST) - CertList->SignatureHeaderSize) / CertList->SignatureSize;
-        for (Index = 0; Index < CertCount; Index++) {
-          //
-          // Iterate each Signature Data Node within this CertList for a verify
-          //
-          TrustedCert     = Cert->SignatureData;
-          TrustedCertSize = CertList->SignatureSize - (sizeof (EFI_SIGNATURE_DATA) - 1);
-
-          //
-          // Verify Pkcs7 SignedData via Pkcs7Verify library.
-          //
-          VerifyStatus = Pkcs7Verify (
-                           SigData,
-                           SigDataSize,
-                           TrustedCert,
-                           TrustedCertSize,
-                           NewData,
-                           NewDataSize
-                           );
-          if (VerifyStatus) {
-            goto Exit;
-          }
-
-          Cert = (EFI_SIGNATURE_DATA *)((UINT8 *)Cert + CertList->SignatureSize);
-        }
-      }
-
-      KekDataSize -= CertList->SignatureListSize;
-      CertList     = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
-    }
+    VerifyStatus = VerifyWithKekDatabase (
+                     SigData,
+                     SigDataSize,
+                     Data,
+                     (UINT32)DataSize,
+                     NewData,
+                     NewDataSize
+                     );
   } else if (AuthVarType == AuthVarTypePriv) {
     //
     // Process common authenticated variable except PK/KEK/DB/DBX/DBT.
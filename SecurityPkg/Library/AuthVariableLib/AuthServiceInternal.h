@@ -27,6 +27,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/MemoryAllocationLib.h>
 #include <Library/BaseCryptLib.h>
 #include <Library/PlatformSecureLib.h>
+#include <Library/PerformanceLib.h>
 
 #include <Guid/AuthenticatedVariableFormat.h>
 #include <Guid/ImageAuthentication.h>
@@ -94,6 +95,20 @@ extern UINT8   mVendorKeyState;
 
 extern VOID  *mHashCtx;
 
+///
+/// Number of parsed X.509 trust anchors kept by the trust anchor cache.
+///
+#define AUTH_TRUST_ANCHOR_CACHE_SIZE  8
+
+///
+/// A parsed X.509 trust anchor, keyed by the SHA-256 digest of its DER
+/// encoding.
+///
+typedef struct {
+  UINT8    Digest[SHA256_DIGEST_SIZE];
+  VOID     *X509Cert;
+} AUTH_TRUST_ANCHOR;
+
 extern AUTH_VAR_LIB_CONTEXT_IN  *mAuthVarLibContextIn;
 
 /**
@@ -188,6 +203,17 @@ FilterSignatureList (
   IN OUT UINTN  *NewDataSize
   );
 
+/**
+  Release the parsed trust anchors.
+
+  This function is called when PK, KEK or db change.
+
+**/
+VOID
+FlushTrustAnchorCache (
+  VOID
+  );
+
 /**
   Process variable with platform key for verification.
 
@@ -401,11 +401,17 @@ AuthVariableLibProcessVariable (
   )
 {
   EFI_STATUS  Status;
+  BOOLEAN     TrustAnchorChanged;
 
+  PERF_INMODULE_BEGIN ("AuthVarProcess");
+
+  TrustAnchorChanged = FALSE;
   if (CompareGuid (VendorGuid, &gEfiGlobalVariableGuid) && (StrCmp (VariableName, EFI_PLATFORM_KEY_NAME) == 0)) {
-    Status = ProcessVarWithPk (VariableName, VendorGuid, Data, DataSize, Attributes, TRUE);
+    Status             = ProcessVarWithPk (VariableName, VendorGuid, Data, DataSize, Attributes, TRUE);
+    TrustAnchorChanged = TRUE;
   } else if (CompareGuid (VendorGuid, &gEfiGlobalVariableGuid) && (StrCmp (VariableName, EFI_KEY_EXCHANGE_KEY_NAME) == 0)) {
-    Status = ProcessVarWithPk (VariableName, VendorGuid, Data, DataSize, Attributes, FALSE);
+    Status             = ProcessVarWithPk (VariableName, VendorGuid, Data, DataSize, Attributes, FALSE);
+    TrustAnchorChanged = TRUE;
   } else if (CompareGuid (VendorGuid, &gEfiImageSecurityDatabaseGuid) &&
              ((StrCmp (VariableName, EFI_IMAGE_SECURITY_DATABASE)  == 0) ||
               (StrCmp (VariableName, EFI_IMAGE_SECURITY_DATABASE1) == 0) ||
@@ -416,9 +422,20 @@ AuthVariableLibProcessVariable (
     if (EFI_ERROR (Status)) {
       Status = ProcessVarWithKek (VariableName, VendorGuid, Data, DataSize, Attributes);
     }
+
+    TrustAnchorChanged = (BOOLEAN)(StrCmp (VariableName, EFI_IMAGE_SECURITY_DATABASE) == 0);
   } else {
     Status = ProcessVariable (VariableName, VendorGuid, Data, DataSize, Attributes);
   }
 
+  if (!EFI_ERROR (Status) && TrustAnchorChanged) {
+    //
+    // PK, KEK or db changed, drop the parsed trust anchors.
+    //
+    FlushTrustAnchorCache ();
+  }
+
+  PERF_INMODULE_END ("AuthVarProcess");
+
   return Status;
 }
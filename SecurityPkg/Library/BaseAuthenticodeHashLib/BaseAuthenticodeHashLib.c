@@ -0,0 +1,458 @@
+/** @file
+  Authenticode hashing of PE/COFF images, based on the authenticode image
+  hashing in PE/COFF Specification 8.0 Appendix A.
+
+  Caution: This file requires additional review when modified.
+  This library will have external input - PE/COFF image.
+  This external input must be validated carefully to avoid security issue like
+  buffer overflow, integer overflow.
+
+  AuthenticodeHashPeImage() will accept untrusted PE/COFF image and validate
+  its data structure within the image size before use.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <IndustryStandard/PeImage.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/AuthenticodeHashLib.h>
+
+//
+// Size of the blocks an image read through a PE_COFF_LOADER_READ_FILE
+// function is hashed in.
+//
+#define AUTHENTICODE_HASH_BLOCK_SIZE  SIZE_64KB
+
+typedef struct {
+  VOID                        *FileHandle;
+  PE_COFF_LOADER_READ_FILE    ImageRead;
+  UINTN                       ImageSize;
+  AUTHENTICODE_HASH_UPDATE    HashUpdate;
+  VOID                        *HashContext;
+  //
+  // Buffer the image is read into, allocated on the first range hashed
+  // through ImageRead.
+  //
+  UINT8                       *Buffer;
+} AUTHENTICODE_HASH_WALK;
+
+/**
+  Copy a range of the image.
+
+  @param[in]   Walk        The image being hashed.
+  @param[in]   Offset      Offset of the range in the image file.
+  @param[in]   Size        Size of the range in bytes.
+  @param[out]  Buffer      Buffer receiving the range.
+
+  @retval RETURN_SUCCESS       The range was copied.
+  @retval RETURN_UNSUPPORTED   The range is not within the image.
+  @retval RETURN_LOAD_ERROR    The range could not be read.
+
+**/
+STATIC
+RETURN_STATUS
+AuthenticodeReadImage (
+  IN  AUTHENTICODE_HASH_WALK  *Walk,
+  IN  UINTN                   Offset,
+  IN  UINTN                   Size,
+  OUT VOID                    *Buffer
+  )
+{
+  RETURN_STATUS  Status;
+  UINTN          ReadSize;
+
+  if ((Offset > Walk->ImageSize) || (Size > Walk->ImageSize - Offset)) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  if (Walk->ImageRead == NULL) {
+    CopyMem (Buffer, (UINT8 *)Walk->FileHandle + Offset, Size);
+    return RETURN_SUCCESS;
+  }
+
+  ReadSize = Size;
+  Status   = Walk->ImageRead (Walk->FileHandle, Offset, &ReadSize, Buffer);
+  if (RETURN_ERROR (Status) || (ReadSize != Size)) {
+    return RETURN_LOAD_ERROR;
+  }
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Hash a range of the image.
+
+  @param[in]   Walk        The image being hashed.
+  @param[in]   Offset      Offset of the range in the image file.
+  @param[in]   Size        Size of the range in bytes.
+
+  @retval RETURN_SUCCESS            The range was hashed.
+  @retval RETURN_UNSUPPORTED        The range is not within the image.
+  @retval RETURN_OUT_OF_RESOURCES   The read buffer could not be allocated.
+  @retval RETURN_LOAD_ERROR         The range could not be read.
+  @retval RETURN_ABORTED            The hash update function failed.
+
+**/
+STATIC
+RETURN_STATUS
+AuthenticodeHashRange (
+  IN AUTHENTICODE_HASH_WALK  *Walk,
+  IN UINTN                   Offset,
+  IN UINTN                   Size
+  )
+{
+  RETURN_STATUS  Status;
+  UINTN          Length;
+
+  if ((Offset > Walk->ImageSize) || (Size > Walk->ImageSize - Offset)) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  if (Size == 0) {
+    return RETURN_SUCCESS;
+  }
+
+  //
+  // An image in memory is hashed in place.
+  //
+  if (Walk->ImageRead == NULL) {
+    if (!Walk->HashUpdate (Walk->HashContext, (UINT8 *)Walk->FileHandle + Offset, Size)) {
+      return RETURN_ABORTED;
+    }
+
+    return RETURN_SUCCESS;
+  }
+
+  if (Walk->Buffer == NULL) {
+    Walk->Buffer = AllocatePool (AUTHENTICODE_HASH_BLOCK_SIZE);
+    if (Walk->Buffer == NULL) {
+      return RETURN_OUT_OF_RESOURCES;
+    }
+  }
+
+  while (Size > 0) {
+    Length = MIN (Size, AUTHENTICODE_HASH_BLOCK_SIZE);
+    Status = AuthenticodeReadImage (Walk, Offset, Length, Walk->Buffer);
+    if (RETURN_ERROR (Status)) {
+      return Status;
+    }
+
+    if (!Walk->HashUpdate (Walk->HashContext, Walk->Buffer, Length)) {
+      return RETURN_ABORTED;
+    }
+
+    Offset += Length;
+    Size   -= Length;
+  }
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Feed the ranges of a PE/COFF image covered by its Authenticode digest to a
+  hash update function.
+
+  The hash is neither initialized nor finalized by this function, so that the
+  caller can use any algorithm, or several of them at once.
+
+  @param[in]       FileHandle   Pointer to the image in memory when ImageRead is
+                                NULL, otherwise the handle passed to ImageRead.
+  @param[in]       ImageRead    Function reading the image, NULL if the image is
+                                resident in memory at FileHandle.
+  @param[in]       ImageSize    Size of the image file in bytes.
+  @param[in]       HashUpdate   Function hashing the image data.
+  @param[in, out]  HashContext  Context passed to HashUpdate.
+
+  @retval RETURN_SUCCESS            The image was hashed.
+  @retval RETURN_INVALID_PARAMETER  FileHandle or HashUpdate is NULL.
+  @retval RETURN_UNSUPPORTED        The image is not a valid PE/COFF image, or
+                                    its headers or sections do not fit in
+                                    ImageSize.
+  @retval RETURN_OUT_OF_RESOURCES   The section table or the read buffer could
+                                    not be allocated.
+  @retval RETURN_LOAD_ERROR         ImageRead failed or returned less data than
+                                    requested.
+  @retval RETURN_ABORTED            HashUpdate returned FALSE.
+
+**/
+RETURN_STATUS
+EFIAPI
+AuthenticodeHashPeImage (
+  IN     VOID                      *FileHandle,
+  IN     PE_COFF_LOADER_READ_FILE  ImageRead  OPTIONAL,
+  IN     UINTN                     ImageSize,
+  IN     AUTHENTICODE_HASH_UPDATE  HashUpdate,
+  IN OUT VOID                      *HashContext
+  )
+{
+  RETURN_STATUS                    Status;
+  AUTHENTICODE_HASH_WALK           Walk;
+  EFI_IMAGE_DOS_HEADER             DosHdr;
+  EFI_IMAGE_OPTIONAL_HEADER_UNION  Hdr;
+  UINTN                            HdrSize;
+  UINTN                            PeCoffHeaderOffset;
+  UINTN                            CheckSumOffset;
+  UINTN                            SecDirOffset;
+  UINTN                            SizeOfHeaders;
+  UINT32                           NumberOfRvaAndSizes;
+  UINT32                           CertSize;
+  EFI_IMAGE_SECTION_HEADER         *SectionHeader;
+  EFI_IMAGE_SECTION_HEADER         Section;
+  UINTN                            NumberOfSections;
+  UINTN                            Index;
+  UINTN                            Pos;
+  UINT64                           SumOfBytesHashed;
+
+  if ((FileHandle == NULL) || (HashUpdate == NULL)) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  ZeroMem (&Walk, sizeof (Walk));
+  Walk.FileHandle  = FileHandle;
+  Walk.ImageRead   = ImageRead;
+  Walk.ImageSize   = ImageSize;
+  Walk.HashUpdate  = HashUpdate;
+  Walk.HashContext = HashContext;
+  SectionHeader    = NULL;
+
+  //
+  // 1.  Load the image header into memory.
+  //
+  Status = AuthenticodeReadImage (&Walk, 0, sizeof (DosHdr), &DosHdr);
+  if (RETURN_ERROR (Status)) {
+    goto Done;
+  }
+
+  PeCoffHeaderOffset = 0;
+  if (DosHdr.e_magic == EFI_IMAGE_DOS_SIGNATURE) {
+    PeCoffHeaderOffset = DosHdr.e_lfanew;
+  }
+
+  if (PeCoffHeaderOffset >= ImageSize) {
+    Status = RETURN_UNSUPPORTED;
+    goto Done;
+  }
+
+  HdrSize = MIN (sizeof (Hdr), ImageSize - PeCoffHeaderOffset);
+  Status  = AuthenticodeReadImage (&Walk, PeCoffHeaderOffset, HdrSize, &Hdr);
+  if (RETURN_ERROR (Status)) {
+    goto Done;
+  }
+
+  if ((HdrSize < OFFSET_OF (EFI_IMAGE_NT_HEADERS32, OptionalHeader.Magic) + sizeof (UINT16)) ||
+      (Hdr.Pe32.Signature != EFI_IMAGE_NT_SIGNATURE))
+  {
+    Status = RETURN_UNSUPPORTED;
+    goto Done;
+  }
+
+  //
+  // Locate the checksum and the Cert Directory, which are excluded from the
+  // digest.
+  //
+  if (Hdr.Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
+    if (HdrSize < OFFSET_OF (EFI_IMAGE_NT_HEADERS32, OptionalHeader.DataDirectory)) {
+      Status = RETURN_UNSUPPORTED;
+      goto Done;
+    }
+
+    CheckSumOffset      = PeCoffHeaderOffset + OFFSET_OF (EFI_IMAGE_NT_HEADERS32, OptionalHeader.CheckSum);
+    SecDirOffset        = PeCoffHeaderOffset + OFFSET_OF (EFI_IMAGE_NT_HEADERS32, OptionalHeader.DataDirectory) +
+                          EFI_IMAGE_DIRECTORY_ENTRY_SECURITY * sizeof (EFI_IMAGE_DATA_DIRECTORY);
+    SizeOfHeaders       = Hdr.Pe32.OptionalHeader.SizeOfHeaders;
+    NumberOfRvaAndSizes = Hdr.Pe32.OptionalHeader.NumberOfRvaAndSizes;
+  } else if (Hdr.Pe32Plus.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
+    if (HdrSize < OFFSET_OF (EFI_IMAGE_NT_HEADERS64, OptionalHeader.DataDirectory)) {
+      Status = RETURN_UNSUPPORTED;
+      goto Done;
+    }
+
+    CheckSumOffset      = PeCoffHeaderOffset + OFFSET_OF (EFI_IMAGE_NT_HEADERS64, OptionalHeader.CheckSum);
+    SecDirOffset        = PeCoffHeaderOffset + OFFSET_OF (EFI_IMAGE_NT_HEADERS64, OptionalHeader.DataDirectory) +
+                          EFI_IMAGE_DIRECTORY_ENTRY_SECURITY * sizeof (EFI_IMAGE_DATA_DIRECTORY);
+    SizeOfHeaders       = Hdr.Pe32Plus.OptionalHeader.SizeOfHeaders;
+    NumberOfRvaAndSizes = Hdr.Pe32Plus.OptionalHeader.NumberOfRvaAndSizes;
+  } else {
+    //
+    // Invalid header magic number.
+    //
+    Status = RETURN_UNSUPPORTED;
+    goto Done;
+  }
+
+  CertSize = 0;
+  if (NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_SECURITY) {
+    if ((SecDirOffset + sizeof (EFI_IMAGE_DATA_DIRECTORY) > PeCoffHeaderOffset + HdrSize) ||
+        (SecDirOffset + sizeof (EFI_IMAGE_DATA_DIRECTORY) > SizeOfHeaders))
+    {
+      Status = RETURN_UNSUPPORTED;
+      goto Done;
+    }
+
+    CertSize = ((EFI_IMAGE_DATA_DIRECTORY *)((UINT8 *)&Hdr + SecDirOffset - PeCoffHeaderOffset))->Size;
+  }
+
+  if ((SizeOfHeaders > ImageSize) || (CheckSumOffset + sizeof (UINT32) > SizeOfHeaders)) {
+    Status = RETURN_UNSUPPORTED;
+    goto Done;
+  }
+
+  //
+  // 2.  Initializing the hash context is left to the caller.
+  // 3.  Calculate the distance from the base of the image header to the image checksum address.
+  // 4.  Hash the image header from its base to beginning of the image checksum.
+  //
+  Status = AuthenticodeHashRange (&Walk, 0, CheckSumOffset);
+  if (RETURN_ERROR (Status)) {
+    goto Done;
+  }
+
+  //
+  // 5.  Skip over the image checksum (it occupies a single ULONG).
+  //
+  if (NumberOfRvaAndSizes <= EFI_IMAGE_DIRECTORY_ENTRY_SECURITY) {
+    //
+    // 6.  Since there is no Cert Directory in optional header, hash everything
+    //     from the end of the checksum to the end of image header.
+    //
+    Status = AuthenticodeHashRange (
+               &Walk,
+               CheckSumOffset + sizeof (UINT32),
+               SizeOfHeaders - (CheckSumOffset + sizeof (UINT32))
+               );
+    if (RETURN_ERROR (Status)) {
+      goto Done;
+    }
+  } else {
+    //
+    // 7.  Hash everything from the end of the checksum to the start of the Cert Directory.
+    //
+    Status = AuthenticodeHashRange (
+               &Walk,
+               CheckSumOffset + sizeof (UINT32),
+               SecDirOffset - (CheckSumOffset + sizeof (UINT32))
+               );
+    if (RETURN_ERROR (Status)) {
+      goto Done;
+    }
+
+    //
+    // 8.  Skip over the Cert Directory. (It is sizeof(IMAGE_DATA_DIRECTORY) bytes.)
+    // 9.  Hash everything from the end of the Cert Directory to the end of image header.
+    //
+    Status = AuthenticodeHashRange (
+               &Walk,
+               SecDirOffset + sizeof (EFI_IMAGE_DATA_DIRECTORY),
+               SizeOfHeaders - (SecDirOffset + sizeof (EFI_IMAGE_DATA_DIRECTORY))
+               );
+    if (RETURN_ERROR (Status)) {
+      goto Done;
+    }
+  }
+
+  //
+  // 10. Set the SUM_OF_BYTES_HASHED to the size of the header.
+  //
+  SumOfBytesHashed = SizeOfHeaders;
+
+  //
+  // 11. Build a temporary table of all the IMAGE_SECTION_HEADER structures in
+  //     the image. The 'NumberOfSections' field of the image header indicates
+  //     how big the table should be.
+  // 12. Using the 'PointerToRawData' in the section headers as a key, arrange
+  //     the elements in the table in ascending order. In other words, sort the
+  //     section headers according to the disk-file offset of the section.
+  //
+  NumberOfSections = Hdr.Pe32.FileHeader.NumberOfSections;
+  if (NumberOfSections != 0) {
+    SectionHeader = AllocatePool (NumberOfSections * sizeof (EFI_IMAGE_SECTION_HEADER));
+    if (SectionHeader == NULL) {
+      Status = RETURN_OUT_OF_RESOURCES;
+      goto Done;
+    }
+
+    Status = AuthenticodeReadImage (
+               &Walk,
+               PeCoffHeaderOffset + sizeof (UINT32) + sizeof (EFI_IMAGE_FILE_HEADER) + Hdr.Pe32.FileHeader.SizeOfOptionalHeader,
+               NumberOfSections * sizeof (EFI_IMAGE_SECTION_HEADER),
+               SectionHeader
+               );
+    if (RETURN_ERROR (Status)) {
+      goto Done;
+    }
+
+    for (Index = 1; Index < NumberOfSections; Index++) {
+      CopyMem (&Section, &SectionHeader[Index], sizeof (Section));
+      Pos = Index;
+      while ((Pos > 0) && (Section.PointerToRawData < SectionHeader[Pos - 1].PointerToRawData)) {
+        CopyMem (&SectionHeader[Pos], &SectionHeader[Pos - 1], sizeof (EFI_IMAGE_SECTION_HEADER));
+        Pos--;
+      }
+
+      CopyMem (&SectionHeader[Pos], &Section, sizeof (Section));
+    }
+  }
+
+  //
+  // 13.  Walk through the sorted table, bring the corresponding section
+  //      into memory, and hash the entire section (using the 'SizeOfRawData'
+  //      field in the section header to determine the amount of data to hash).
+  //      Sections whose 'SizeOfRawData' field is zero are skipped.
+  // 14.  Add the section's 'SizeOfRawData' to SUM_OF_BYTES_HASHED .
+  // 15.  Repeat steps 13 and 14 for all the sections in the sorted table.
+  //
+  for (Index = 0; Index < NumberOfSections; Index++) {
+    if (SectionHeader[Index].SizeOfRawData == 0) {
+      continue;
+    }
+
+    Status = AuthenticodeHashRange (&Walk, SectionHeader[Index].PointerToRawData, SectionHeader[Index].SizeOfRawData);
+    if (RETURN_ERROR (Status)) {
+      goto Done;
+    }
+
+    SumOfBytesHashed += SectionHeader[Index].SizeOfRawData;
+  }
+
+  //
+  // 16.  If the file size is greater than SUM_OF_BYTES_HASHED, there is extra
+  //      data in the file that needs to be added to the hash. This data begins
+  //      at file offset SUM_OF_BYTES_HASHED and its length is:
+  //             FileSize  -  (CertDirectory->Size)
+  //
+  if (ImageSize > SumOfBytesHashed) {
+    if (ImageSize > CertSize + SumOfBytesHashed) {
+      Status = AuthenticodeHashRange (
+                 &Walk,
+                 (UINTN)SumOfBytesHashed,
+                 (UINTN)(ImageSize - CertSize - SumOfBytesHashed)
+                 );
+      if (RETURN_ERROR (Status)) {
+        goto Done;
+      }
+    } else if (ImageSize < CertSize + SumOfBytesHashed) {
+      Status = RETURN_UNSUPPORTED;
+      goto Done;
+    }
+  }
+
+  //
+  // 17.  Finalizing the hash is left to the caller.
+  //
+  Status = RETURN_SUCCESS;
+
+Done:
+  if (SectionHeader != NULL) {
+    FreePool (SectionHeader);
+  }
+
+  if (Walk.Buffer != NULL) {
+    FreePool (Walk.Buffer);
+  }
+
+  return Status;
+}
@@ -0,0 +1,690 @@
+/** @file
+  Host based unit tests of AuthenticodeHashLib.
+
+  Each test builds a small PE32+ image in memory and records the bytes fed to
+  the hash update function, so the walk can be compared byte for byte with
+  the ranges of PE/COFF Specification 8.0 Appendix A. Valid images are hashed
+  both in place and through a PE_COFF_LOADER_READ_FILE function. Malformed
+  images must be rejected without reading outside the image.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <Uefi.h>
+#include <IndustryStandard/PeImage.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UnitTestLib.h>
+#include <Library/AuthenticodeHashLib.h>
+
+#define UNIT_TEST_APP_NAME     "AuthenticodeHashLib Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// Layout of the test image: the headers, TEST_SECTION_COUNT sections of
+// TEST_SECTION_SIZE bytes, TEST_TRAILER_SIZE bytes of data that are not in a
+// section, then the attribute certificate table. The first section is larger
+// than the block size of the library, so reads through ImageRead are split.
+//
+#define TEST_PE_OFFSET        0x80
+#define TEST_HEADERS_SIZE     0x400
+#define TEST_SECTION_COUNT    3
+#define TEST_SECTION_SIZE     (SIZE_64KB + 0x200)
+#define TEST_TRAILER_SIZE     0x30
+#define TEST_CERT_SIZE        0x100
+#define TEST_IMAGE_SIZE       (TEST_HEADERS_SIZE + TEST_SECTION_COUNT * TEST_SECTION_SIZE + TEST_TRAILER_SIZE + TEST_CERT_SIZE)
+#define TEST_RECORD_CAPACITY  (3 * TEST_IMAGE_SIZE)
+
+//
+// Reader behaviors of TestImageRead().
+//
+typedef enum {
+  TestReadFull,
+  TestReadShort,
+  TestReadError
+} TEST_READ_MODE;
+
+//
+// The bytes fed to TestHashUpdate().
+//
+typedef struct {
+  UINT8    *Data;
+  UINTN    Size;
+} TEST_HASH_RECORD;
+
+STATIC UINT8             *mImage;
+STATIC UINTN             mImageSize;
+STATIC TEST_READ_MODE    mReadMode;
+STATIC UINTN             mReadCount;
+STATIC UINTN             mShortReadAt;
+STATIC BOOLEAN           mReadOutside;
+STATIC TEST_HASH_RECORD  mRecord;
+STATIC TEST_HASH_RECORD  mExpected;
+
+/**
+  Return the NT headers of the test image.
+
+  @return  The NT headers.
+
+**/
+STATIC
+EFI_IMAGE_NT_HEADERS64 *
+TestNtHeaders (
+  VOID
+  )
+{
+  return (EFI_IMAGE_NT_HEADERS64 *)(mImage + TEST_PE_OFFSET);
+}
+
+/**
+  Return the section table of the test image.
+
+  @return  The first section header.
+
+**/
+STATIC
+EFI_IMAGE_SECTION_HEADER *
+TestSectionTable (
+  VOID
+  )
+{
+  return (EFI_IMAGE_SECTION_HEADER *)((UINT8 *)&TestNtHeaders ()->OptionalHeader +
+                                      TestNtHeaders ()->FileHeader.SizeOfOptionalHeader);
+}
+
+/**
+  Record the data fed to the hash, instead of hashing it.
+
+  @param[in, out]  HashContext  The TEST_HASH_RECORD receiving the data.
+  @param[in]       Data         The data.
+  @param[in]       DataSize     Size of Data in bytes.
+
+  @retval TRUE     The data was recorded.
+  @retval FALSE    The record is full.
+
+**/
+STATIC
+BOOLEAN
+EFIAPI
+TestHashUpdate (
+  IN OUT  VOID        *HashContext,
+  IN      CONST VOID  *Data,
+  IN      UINTN       DataSize
+  )
+{
+  TEST_HASH_RECORD  *Record;
+
+  Record = (TEST_HASH_RECORD *)HashContext;
+  if (DataSize > TEST_RECORD_CAPACITY - Record->Size) {
+    return FALSE;
+  }
+
+  CopyMem (Record->Data + Record->Size, Data, DataSize);
+  Record->Size += DataSize;
+  return TRUE;
+}
+
+/**
+  Read the test image, as selected by mReadMode.
+
+  @param[in]      FileHandle  The test image.
+  @param[in]      FileOffset  Offset of the read.
+  @param[in, out] ReadSize    On input the size to read, on output the size
+                              read.
+  @param[out]     Buffer      Buffer receiving the data.
+
+  @retval RETURN_SUCCESS            The data was read, maybe partly.
+  @retval RETURN_DEVICE_ERROR       The read failed.
+  @retval RETURN_INVALID_PARAMETER  The read is not within the image.
+
+**/
+STATIC
+RETURN_STATUS
+EFIAPI
+TestImageRead (
+  IN     VOID   *FileHandle,
+  IN     UINTN  FileOffset,
+  IN OUT UINTN  *ReadSize,
+  OUT    VOID   *Buffer
+  )
+{
+  //
+  // AuthenticodeHashPeImage() must never read outside the image.
+  //
+  if ((FileOffset > mImageSize) || (*ReadSize > mImageSize - FileOffset)) {
+    mReadOutside = TRUE;
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  mReadCount++;
+  if (mReadCount == mShortReadAt) {
+    if (mReadMode == TestReadError) {
+      return RETURN_DEVICE_ERROR;
+    }
+
+    if (mReadMode == TestReadShort) {
+      *ReadSize /= 2;
+    }
+  }
+
+  CopyMem (Buffer, (UINT8 *)FileHandle + FileOffset, *ReadSize);
+  return RETURN_SUCCESS;
+}
+
+/**
+  Append a range of the test image to the expected hash input.
+
+  @param[in]  Offset  Offset of the range.
+  @param[in]  Size    Size of the range.
+
+**/
+STATIC
+VOID
+TestExpectRange (
+  IN UINTN  Offset,
+  IN UINTN  Size
+  )
+{
+  TestHashUpdate (&mExpected, mImage + Offset, Size);
+}
+
+/**
+  Append the headers, minus the checksum and the Cert Directory, to the
+  expected hash input.
+
+**/
+STATIC
+VOID
+TestExpectHeaders (
+  VOID
+  )
+{
+  UINTN  CheckSum;
+  UINTN  SecDir;
+
+  CheckSum = TEST_PE_OFFSET + OFFSET_OF (EFI_IMAGE_NT_HEADERS64, OptionalHeader.CheckSum);
+  SecDir   = TEST_PE_OFFSET + OFFSET_OF (EFI_IMAGE_NT_HEADERS64, OptionalHeader.DataDirectory) +
+             EFI_IMAGE_DIRECTORY_ENTRY_SECURITY * sizeof (EFI_IMAGE_DATA_DIRECTORY);
+
+  TestExpectRange (0, CheckSum);
+  TestExpectRange (CheckSum + sizeof (UINT32), SecDir - CheckSum - sizeof (UINT32));
+  TestExpectRange (SecDir + sizeof (EFI_IMAGE_DATA_DIRECTORY), TEST_HEADERS_SIZE - SecDir - sizeof (EFI_IMAGE_DATA_DIRECTORY));
+}
+
+/**
+  Build a valid signed PE32+ test image, with a random looking content.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED  The image was built.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TestBuildImage (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_IMAGE_DOS_HEADER      *DosHdr;
+  EFI_IMAGE_NT_HEADERS64    *NtHdr;
+  EFI_IMAGE_SECTION_HEADER  *Section;
+  UINTN                     Index;
+  UINT32                    Seed;
+
+  mImageSize = TEST_IMAGE_SIZE;
+  Seed       = 0x1D872B41;
+  for (Index = 0; Index < mImageSize; Index++) {
+    Seed          = Seed * 1103515245 + 12345;
+    mImage[Index] = (UINT8)(Seed >> 16);
+  }
+
+  ZeroMem (mImage, TEST_HEADERS_SIZE);
+  DosHdr           = (EFI_IMAGE_DOS_HEADER *)mImage;
+  DosHdr->e_magic  = EFI_IMAGE_DOS_SIGNATURE;
+  DosHdr->e_lfanew = TEST_PE_OFFSET;
+
+  NtHdr                                     = TestNtHeaders ();
+  NtHdr->Signature                          = EFI_IMAGE_NT_SIGNATURE;
+  NtHdr->FileHeader.Machine                 = IMAGE_FILE_MACHINE_X64;
+  NtHdr->FileHeader.NumberOfSections        = TEST_SECTION_COUNT;
+  NtHdr->FileHeader.SizeOfOptionalHeader    = sizeof (EFI_IMAGE_OPTIONAL_HEADER64);
+  NtHdr->OptionalHeader.Magic               = EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC;
+  NtHdr->OptionalHeader.CheckSum            = 0x5A5A5A5A;
+  NtHdr->OptionalHeader.SizeOfHeaders       = TEST_HEADERS_SIZE;
+  NtHdr->OptionalHeader.NumberOfRvaAndSizes = EFI_IMAGE_NUMBER_OF_DIRECTORY_ENTRIES;
+
+  NtHdr->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY].VirtualAddress = TEST_IMAGE_SIZE - TEST_CERT_SIZE;
+  NtHdr->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY].Size           = TEST_CERT_SIZE;
+
+  Section = TestSectionTable ();
+  for (Index = 0; Index < TEST_SECTION_COUNT; Index++) {
+    Section[Index].SizeOfRawData    = TEST_SECTION_SIZE;
+    Section[Index].PointerToRawData = (UINT32)(TEST_HEADERS_SIZE + Index * TEST_SECTION_SIZE);
+  }
+
+  //
+  // Some bytes in the headers after the section table are hashed as well.
+  //
+  SetMem ((UINT8 *)&Section[TEST_SECTION_COUNT], 0x10, 0xA5);
+
+  mReadMode    = TestReadFull;
+  mReadCount   = 0;
+  mShortReadAt = 0;
+  mReadOutside = FALSE;
+  mRecord.Size = 0;
+  ZeroMem (mRecord.Data, TEST_RECORD_CAPACITY);
+  mExpected.Size = 0;
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Hash the test image in place and through TestImageRead(), and check that
+  both fed the expected bytes to the hash.
+
+  @retval UNIT_TEST_PASSED             Both walks matched mExpected.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A walk failed or did not match.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+TestHashBothWays (
+  VOID
+  )
+{
+  RETURN_STATUS  Status;
+
+  Status = AuthenticodeHashPeImage (mImage, NULL, mImageSize, TestHashUpdate, &mRecord);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (mRecord.Size, mExpected.Size);
+  UT_ASSERT_MEM_EQUAL (mRecord.Data, mExpected.Data, mExpected.Size);
+
+  mRecord.Size = 0;
+  Status       = AuthenticodeHashPeImage (mImage, TestImageRead, mImageSize, TestHashUpdate, &mRecord);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_FALSE (mReadOutside);
+  UT_ASSERT_EQUAL (mRecord.Size, mExpected.Size);
+  UT_ASSERT_MEM_EQUAL (mRecord.Data, mExpected.Data, mExpected.Size);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that both walks reject the test image with ExpectedStatus, and that
+  the reader never reads outside the image.
+
+  @param[in]  ExpectedStatus  The status both walks must return.
+
+  @retval UNIT_TEST_PASSED             Both walks failed as expected.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A walk did not fail as expected.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+TestRejectBothWays (
+  IN RETURN_STATUS  ExpectedStatus
+  )
+{
+  UT_ASSERT_STATUS_EQUAL (
+    AuthenticodeHashPeImage (mImage, NULL, mImageSize, TestHashUpdate, &mRecord),
+    ExpectedStatus
+    );
+  UT_ASSERT_STATUS_EQUAL (
+    AuthenticodeHashPeImage (mImage, TestImageRead, mImageSize, TestHashUpdate, &mRecord),
+    ExpectedStatus
+    );
+  UT_ASSERT_FALSE (mReadOutside);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  A valid image is hashed in the order of Appendix A, in place and through
+  ImageRead, and the attribute certificate table is left out.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED             The walks matched.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A walk did not match.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+ValidImageShouldBeHashed (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  TestExpectHeaders ();
+  TestExpectRange (TEST_HEADERS_SIZE, TEST_SECTION_COUNT * TEST_SECTION_SIZE + TEST_TRAILER_SIZE);
+
+  return TestHashBothWays ();
+}
+
+/**
+  Sections listed out of file order are hashed in file order.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED             The walks matched.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A walk did not match.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+UnsortedSectionsShouldBeHashedInFileOrder (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_IMAGE_SECTION_HEADER  *Section;
+  EFI_IMAGE_SECTION_HEADER  Swap;
+
+  Section = TestSectionTable ();
+  CopyMem (&Swap, &Section[0], sizeof (Swap));
+  CopyMem (&Section[0], &Section[2], sizeof (Swap));
+  CopyMem (&Section[2], &Swap, sizeof (Swap));
+
+  TestExpectHeaders ();
+  TestExpectRange (TEST_HEADERS_SIZE, TEST_SECTION_COUNT * TEST_SECTION_SIZE + TEST_TRAILER_SIZE);
+
+  return TestHashBothWays ();
+}
+
+/**
+  Overlapping sections are each hashed whole, in file order, and the data
+  after the sections still starts at SUM_OF_BYTES_HASHED, as in the walks
+  this library replaced.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED             The walks matched.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A walk did not match.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+OverlappingSectionsShouldBeHashedWhole (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_IMAGE_SECTION_HEADER  *Section;
+  UINTN                     Overlap;
+  UINTN                     Sum;
+
+  Overlap                      = 0x1000;
+  Section                      = TestSectionTable ();
+  Section[1].PointerToRawData -= (UINT32)Overlap;
+
+  TestExpectHeaders ();
+  TestExpectRange (Section[0].PointerToRawData, TEST_SECTION_SIZE);
+  TestExpectRange (Section[1].PointerToRawData, TEST_SECTION_SIZE);
+  TestExpectRange (Section[2].PointerToRawData, TEST_SECTION_SIZE);
+  Sum = TEST_HEADERS_SIZE + TEST_SECTION_COUNT * TEST_SECTION_SIZE;
+  TestExpectRange (Sum, TEST_IMAGE_SIZE - TEST_CERT_SIZE - Sum);
+
+  return TestHashBothWays ();
+}
+
+/**
+  A section that ends past the end of the image, or whose end overflows, is
+  rejected.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED             The image was rejected.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The image was not rejected.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+SectionPastEndShouldBeRejected (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_IMAGE_SECTION_HEADER  *Section;
+  UNIT_TEST_STATUS          Status;
+
+  Section                   = TestSectionTable ();
+  Section[2].SizeOfRawData += TEST_TRAILER_SIZE + TEST_CERT_SIZE + 1;
+  Status                    = TestRejectBothWays (RETURN_UNSUPPORTED);
+  if (Status != UNIT_TEST_PASSED) {
+    return Status;
+  }
+
+  Section[2].PointerToRawData = MAX_UINT32 - 0x100;
+  Section[2].SizeOfRawData    = 0x200;
+  return TestRejectBothWays (RETURN_UNSUPPORTED);
+}
+
+/**
+  A section table that does not fit in the image is rejected.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED             The image was rejected.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The image was not rejected.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+SectionTablePastEndShouldBeRejected (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  TestNtHeaders ()->FileHeader.NumberOfSections = MAX_UINT16;
+  return TestRejectBothWays (RETURN_UNSUPPORTED);
+}
+
+/**
+  An image truncated in the middle of its Cert Directory, a Cert Directory
+  outside SizeOfHeaders, and a certificate table larger than the data after
+  the sections are rejected.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED             The images were rejected.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  An image was not rejected.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+TruncatedSecurityDirectoryShouldBeRejected (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_STATUS  Status;
+  UINTN             SecDir;
+
+  SecDir = TEST_PE_OFFSET + OFFSET_OF (EFI_IMAGE_NT_HEADERS64, OptionalHeader.DataDirectory) +
+           EFI_IMAGE_DIRECTORY_ENTRY_SECURITY * sizeof (EFI_IMAGE_DATA_DIRECTORY);
+
+  mImageSize = SecDir + sizeof (EFI_IMAGE_DATA_DIRECTORY) / 2;
+  Status     = TestRejectBothWays (RETURN_UNSUPPORTED);
+  if (Status != UNIT_TEST_PASSED) {
+    return Status;
+  }
+
+  mImageSize                                       = TEST_IMAGE_SIZE;
+  TestNtHeaders ()->OptionalHeader.SizeOfHeaders = (UINT32)SecDir;
+  Status                                           = TestRejectBothWays (RETURN_UNSUPPORTED);
+  if (Status != UNIT_TEST_PASSED) {
+    return Status;
+  }
+
+  TestNtHeaders ()->OptionalHeader.SizeOfHeaders                                         = TEST_HEADERS_SIZE;
+  TestNtHeaders ()->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY].Size = TEST_TRAILER_SIZE + TEST_CERT_SIZE + 1;
+  return TestRejectBothWays (RETURN_UNSUPPORTED);
+}
+
+/**
+  A reader that returns less data than requested, or fails, makes the walk
+  fail at any read: header, section table or section data.
+
+  @param[in]  Context  Unused.
+
+  @retval UNIT_TEST_PASSED             Every failed read was reported.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A failed read was not reported.
+
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+ShortReadShouldFail (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  ReadCount;
+  UINTN  Index;
+
+  //
+  // Count the reads of a full walk first.
+  //
+  UT_ASSERT_NOT_EFI_ERROR (AuthenticodeHashPeImage (mImage, TestImageRead, mImageSize, TestHashUpdate, &mRecord));
+  ReadCount = mReadCount;
+  UT_ASSERT_TRUE (ReadCount > TEST_SECTION_COUNT + 2);
+
+  for (Index = 1; Index <= ReadCount; Index++) {
+    mReadMode    = TestReadShort;
+    mShortReadAt = Index;
+    mReadCount   = 0;
+    mRecord.Size = 0;
+    UT_ASSERT_STATUS_EQUAL (
+      AuthenticodeHashPeImage (mImage, TestImageRead, mImageSize, TestHashUpdate, &mRecord),
+      RETURN_LOAD_ERROR
+      );
+
+    mReadMode    = TestReadError;
+    mReadCount   = 0;
+    mRecord.Size = 0;
+    UT_ASSERT_STATUS_EQUAL (
+      AuthenticodeHashPeImage (mImage, TestImageRead, mImageSize, TestHashUpdate, &mRecord),
+      RETURN_LOAD_ERROR
+      );
+  }
+
+  UT_ASSERT_FALSE (mReadOutside);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for
+  AuthenticodeHashLib and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      HashTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  mImage         = AllocatePool (TEST_IMAGE_SIZE);
+  mRecord.Data   = AllocatePool (TEST_RECORD_CAPACITY);
+  mExpected.Data = AllocatePool (TEST_RECORD_CAPACITY);
+  if ((mImage == NULL) || (mRecord.Data == NULL) || (mExpected.Data == NULL)) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&HashTests, Framework, "AuthenticodeHashPeImage Tests", "AuthenticodeHashLib.HashPeImage", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for AuthenticodeHashPeImage Tests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite------Description---------------------------------------------Name---------------Function-------------------------------------Pre-------------Post--Context
+  //
+  AddTestCase (HashTests, "Valid image is hashed in place and through ImageRead", "Valid", ValidImageShouldBeHashed, TestBuildImage, NULL, NULL);
+  AddTestCase (HashTests, "Unsorted sections are hashed in file order", "Unsorted", UnsortedSectionsShouldBeHashedInFileOrder, TestBuildImage, NULL, NULL);
+  AddTestCase (HashTests, "Overlapping sections are hashed whole", "Overlapping", OverlappingSectionsShouldBeHashedWhole, TestBuildImage, NULL, NULL);
+  AddTestCase (HashTests, "Section past the end of the image is rejected", "SectionPastEnd", SectionPastEndShouldBeRejected, TestBuildImage, NULL, NULL);
+  AddTestCase (HashTests, "Section table past the end of the image is rejected", "SectionTable", SectionTablePastEndShouldBeRejected, TestBuildImage, NULL, NULL);
+  AddTestCase (HashTests, "Truncated security directory is rejected", "SecurityDir", TruncatedSecurityDirectoryShouldBeRejected, TestBuildImage, NULL, NULL);
+  AddTestCase (HashTests, "Short or failed read fails the walk", "ShortRead", ShortReadShouldFail, TestBuildImage, NULL, NULL);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  if (mImage != NULL) {
+    FreePool (mImage);
+  }
+
+  if (mRecord.Data != NULL) {
+    FreePool (mRecord.Data);
+  }
+
+  if (mExpected.Data != NULL) {
+    FreePool (mExpected.Data);
+  }
+
+  return Status;
+}
+
+///
+/// Avoid ECC error for function name that starts with lower case letter
+///
+#define AuthenticodeHashLibUnitTestMain  main
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param[in] Argc  Number of arguments
+  @param[in] Argv  Array of pointers to arguments
+
+  @retval 0      Success
+  @retval other  Error
+**/
+INT32
+AuthenticodeHashLibUnitTestMain (
+  IN INT32  Argc,
+  IN CHAR8  *Argv[]
+  )
+{
+  UnitTestingEntry ();
+  return 0;
+}
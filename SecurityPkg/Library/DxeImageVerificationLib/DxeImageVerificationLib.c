@@ -36,6 +36,12 @@ UINT8  *mImageBase = NULL;
 UINT8  mImageDigest[MAX_DIGEST_SIZE];
 UINTN  mImageDigestSize;
 
+//
+// Digests of the current PE/COFF image computed so far, by hash algorithm.
+//
+BOOLEAN  mImageDigestSaved[HASHALG_MAX];
+UINT8    mSavedImageDigest[HASHALG_MAX][MAX_DIGEST_SIZE];
+
 //
 // Notify string for authorization UI.
 //
@@ -71,6 +77,23 @@ HASH_TABLE  mHash[] = {
 
 EFI_STRING  mHashTypeStr;
 
+//
+// Cached copies of db, dbx and dbt. The runtime services offer no notification
+// of variable writes, so the copies are revalidated on each verification.
+//
+SIGNATURE_DATABASE_CACHE  mSignatureDb[SIGNATURE_DB_MAX] = {
+  { EFI_IMAGE_SECURITY_DATABASE  },
+  { EFI_IMAGE_SECURITY_DATABASE1 },
+  { EFI_IMAGE_SECURITY_DATABASE2 }
+};
+
+//
+// Images verified against the cached db/dbx/dbt, flushed when they change.
+//
+VERIFIED_IMAGE_ENTRY  mVerifiedImage[VERIFIED_IMAGE_CACHE_SIZE];
+UINTN                 mVerifiedImageCount = 0;
+UINTN                 mVerifiedImageNext  = 0;
+
 /**
   SecureBoot Hook for processing image verification.
 
@@ -293,22 +316,12 @@ HashPeImage (
   IN  UINT32  HashAlg
   )
 {
-  BOOLEAN                   Status;
-  EFI_IMAGE_SECTION_HEADER  *Section;
-  VOID                      *HashCtx;
-  UINTN                     CtxSize;
-  UINT8                     *HashBase;
-  UINTN                     HashSize;
-  UINTN                     SumOfBytesHashed;
-  EFI_IMAGE_SECTION_HEADER  *SectionHeader;
-  UINTN                     Index;
-  UINTN                     Pos;
-  UINT32                    CertSize;
-  UINT32                    NumberOfRvaAndSizes;
+  BOOLEAN  Status;
+  VOID     *HashCtx;
+  UINTN    CtxSize;
 
-  HashCtx       = NULL;
-  SectionHeader = NULL;
-  Status        = FALSE;
+  HashCtx = NULL;
+  Status  = FALSE;
 
   if ((HashAlg >= HASHALG_MAX)) {
     return FALSE;
@@ -347,261 +360,48 @@ HashPeImage (
   }
 
   mHashTypeStr = mHash[HashAlg].Name;
-  CtxSize      = mHash[HashAlg].GetContextSize ();
+
+  //
+  // An image carrying several signatures with the same digest algorithm is
+  // only hashed once.
+  //
+  if (mImageDigestSaved[HashAlg]) {
+    CopyMem (mImageDigest, mSavedImageDigest[HashAlg], mImageDigestSize);
+    return TRUE;
+  }
+
+  CtxSize = mHash[HashAlg].GetContextSize ();
 
   HashCtx = AllocatePool (CtxSize);
   if (HashCtx == NULL) {
     return FALSE;
   }
 
-  // 1.  Load the image header into memory.
-
-  // 2.  Initialize a SHA hash context.
   Status = mHash[HashAlg].HashInit (HashCtx);
-
   if (!Status) {
     goto Done;
   }
 
   //
-  // Measuring PE/COFF Image Header;
-  // But CheckSum field and SECURITY data directory (certificate) are excluded
+  // Hash the PE/COFF image header and sections in place, excluding the
+  // checksum, the Cert Directory and the attribute certificate table.
   //
-
-  //
-  // 3.  Calculate the distance from the base of the image header to the image checksum address.
-  // 4.  Hash the image header from its base to beginning of the image checksum.
-  //
-  HashBase = mImageBase;
-  if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-    //
-    // Use PE32 offset.
-    //
-    HashSize            = (UINTN)(&mNtHeader.Pe32->OptionalHeader.CheckSum) - (UINTN)HashBase;
-    NumberOfRvaAndSizes = mNtHeader.Pe32->OptionalHeader.NumberOfRvaAndSizes;
-  } else if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
-    //
-    // Use PE32+ offset.
-    //
-    HashSize            = (UINTN)(&mNtHeader.Pe32Plus->OptionalHeader.CheckSum) - (UINTN)HashBase;
-    NumberOfRvaAndSizes = mNtHeader.Pe32Plus->OptionalHeader.NumberOfRvaAndSizes;
-  } else {
-    //
-    // Invalid header magic number.
-    //
+  if (RETURN_ERROR (AuthenticodeHashPeImage (mImageBase, NULL, mImageSize, mHash[HashAlg].HashUpdate, HashCtx))) {
     Status = FALSE;
     goto Done;
   }
 
-  Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-  if (!Status) {
-    goto Done;
-  }
-
-  //
-  // 5.  Skip over the image checksum (it occupies a single ULONG).
-  //
-  if (NumberOfRvaAndSizes <= EFI_IMAGE_DIRECTORY_ENTRY_SECURITY) {
-    //
-    // 6.  Since there is no Cert Directory in optional header, hash everything
-    //     from the end of the checksum to the end of image header.
-    //
-    if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-      //
-      // Use PE32 offset.
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32->OptionalHeader.CheckSum + sizeof (UINT32);
-      HashSize = mNtHeader.Pe32->OptionalHeader.SizeOfHeaders - ((UINTN)HashBase - (UINTN)mImageBase);
-    } else {
-      //
-      // Use PE32+ offset.
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32Plus->OptionalHeader.CheckSum + sizeof (UINT32);
-      HashSize = mNtHeader.Pe32Plus->OptionalHeader.SizeOfHeaders - ((UINTN)HashBase - (UINTN)mImageBase);
-    }
-
-    if (HashSize != 0) {
-      Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-      if (!Status) {
-        goto Done;
-      }
-    }
-  } else {
-    //
-    // 7.  Hash everything from the end of the checksum to the start of the Cert Directory.
-    //
-    if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-      //
-      // Use PE32 offset.
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32->OptionalHeader.CheckSum + sizeof (UINT32);
-      HashSize = (UINTN)(&mNtHeader.Pe32->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY]) - (UINTN)HashBase;
-    } else {
-      //
-      // Use PE32+ offset.
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32Plus->OptionalHeader.CheckSum + sizeof (UINT32);
-      HashSize = (UINTN)(&mNtHeader.Pe32Plus->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY]) - (UINTN)HashBase;
-    }
-
-    if (HashSize != 0) {
-      Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-      if (!Status) {
-        goto Done;
-      }
-    }
-
-    //
-    // 8.  Skip over the Cert Directory. (It is sizeof(IMAGE_DATA_DIRECTORY) bytes.)
-    // 9.  Hash everything from the end of the Cert Directory to the end of image header.
-    //
-    if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-      //
-      // Use PE32 offset
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY + 1];
-      HashSize = mNtHeader.Pe32->OptionalHeader.SizeOfHeaders - ((UINTN)HashBase - (UINTN)mImageBase);
-    } else {
-      //
-      // Use PE32+ offset.
-      //
-      HashBase = (UINT8 *)&mNtHeader.Pe32Plus->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY + 1];
-      HashSize = mNtHeader.Pe32Plus->OptionalHeader.SizeOfHeaders - ((UINTN)HashBase - (UINTN)mImageBase);
-    }
-
-    if (HashSize != 0) {
-      Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-      if (!Status) {
-        goto Done;
-      }
-    }
-  }
-
-  //
-  // 10. Set the SUM_OF_BYTES_HASHED to the size of the header.
-  //
-  if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-    //
-    // Use PE32 offset.
-    //
-    SumOfBytesHashed = mNtHeader.Pe32->OptionalHeader.SizeOfHeaders;
-  } else {
-    //
-    // Use PE32+ offset
-    //
-    SumOfBytesHashed = mNtHeader.Pe32Plus->OptionalHeader.SizeOfHeaders;
-  }
-
-  Section = (EFI_IMAGE_SECTION_HEADER *)(
-                                         mImageBase +
-                                         mPeCoffHeaderOffset +
-                                         sizeof (UINT32) +
-                                         sizeof (EFI_IMAGE_FILE_HEADER) +
-                                         mNtHeader.Pe32->FileHeader.SizeOfOptionalHeader
-                                         );
-
-  //
-  // 11. Build a temporary table of pointers to all the IMAGE_SECTION_HEADER
-  //     structures in the image. The 'NumberOfSections' field of the image
-  //     header indicates how big the table should be. Do not include any
-  //     IMAGE_SECTION_HEADERs in the table whose 'SizeOfRawData' field is zero.
-  //
-  SectionHeader = (EFI_IMAGE_SECTION_HEADER *)AllocateZeroPool (sizeof (EFI_IMAGE_SECTION_HEADER) * mNtHeader.Pe32->FileHeader.NumberOfSections);
-  if (SectionHeader == NULL) {
-    Status = FALSE;
-    goto Done;
-  }
-
-  //
-  // 12.  Using the 'PointerToRawData' in the referenced section headers as
-  //      a key, arrange the elements in the table in ascending order. In other
-  //      words, sort the section headers according to the disk-file offset of
-  //      the section.
-  //
-  for (Index = 0; Index < mNtHeader.Pe32->FileHeader.NumberOfSections; Index++) {
-    Pos = Index;
-    while ((Pos > 0) && (Section->PointerToRawData < SectionHeader[Pos - 1].PointerToRawData)) {
-      CopyMem (&SectionHeader[Pos], &SectionHeader[Pos - 1], sizeof (EFI_IMAGE_SECTION_HEADER));
-      Pos--;
-    }
-
-    CopyMem (&SectionHeader[Pos], Section, sizeof (EFI_IMAGE_SECTION_HEADER));
-    Section += 1;
-  }
-
-  //
-  // 13.  Walk through the sorted table, bring the corresponding section
-  //      into memory, and hash the entire section (using the 'SizeOfRawData'
-  //      field in the section header to determine the amount of data to hash).
-  // 14.  Add the section's 'SizeOfRawData' to SUM_OF_BYTES_HASHED .
-  // 15.  Repeat steps 13 and 14 for all the sections in the sorted table.
-  //
-  for (Index = 0; Index < mNtHeader.Pe32->FileHeader.NumberOfSections; Index++) {
-    Section = &SectionHeader[Index];
-    if (Section->SizeOfRawData == 0) {
-      continue;
-    }
-
-    HashBase = mImageBase + Section->PointerToRawData;
-    HashSize = (UINTN)Section->SizeOfRawData;
-
-    Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-    if (!Status) {
-      goto Done;
-    }
-
-    SumOfBytesHashed += HashSize;
-  }
-
-  //
-  // 16.  If the file size is greater than SUM_OF_BYTES_HASHED, there is extra
-  //      data in the file that needs to be added to the hash. This data begins
-  //      at file offset SUM_OF_BYTES_HASHED and its length is:
-  //             FileSize  -  (CertDirectory->Size)
-  //
-  if (mImageSize > SumOfBytesHashed) {
-    HashBase = mImageBase + SumOfBytesHashed;
-
-    if (NumberOfRvaAndSizes <= EFI_IMAGE_DIRECTORY_ENTRY_SECURITY) {
-      CertSize = 0;
-    } else {
-      if (mNtHeader.Pe32->OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-        //
-        // Use PE32 offset.
-        //
-        CertSize = mNtHeader.Pe32->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY].Size;
-      } else {
-        //
-        // Use PE32+ offset.
-        //
-        CertSize = mNtHeader.Pe32Plus->OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_SECURITY].Size;
-      }
-    }
-
-    if (mImageSize > CertSize + SumOfBytesHashed) {
-      HashSize = (UINTN)(mImageSize - CertSize - SumOfBytesHashed);
-
-      Status = mHash[HashAlg].HashUpdate (HashCtx, HashBase, HashSize);
-      if (!Status) {
-        goto Done;
-      }
-    } else if (mImageSize < CertSize + SumOfBytesHashed) {
-      Status = FALSE;
-      goto Done;
-    }
-  }
-
   Status = mHash[HashAlg].HashFinal (HashCtx, mImageDigest);
+  if (Status) {
+    CopyMem (mSavedImageDigest[HashAlg], mImageDigest, mImageDigestSize);
+    mImageDigestSaved[HashAlg] = TRUE;
+  }
 
 Done:
   if (HashCtx != NULL) {
     FreePool (HashCtx);
   }
 
-  if (SectionHeader != NULL) {
-    FreePool (SectionHeader);
-  }
-
   return Status;
 }
 
@@ -965,6 +765,347 @@ Done:
   return Status;
 }
 
+/**
+  Get the cached copy of a signature database.
+
+  @param[in]  VariableName        Name of the signature database variable.
+
+  @return The cached database, or NULL if VariableName is not db, dbx or dbt.
+
+**/
+SIGNATURE_DATABASE_CACHE *
+GetSignatureDatabase (
+  IN CHAR16  *VariableName
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < SIGNATURE_DB_MAX; Index++) {
+    if (StrCmp (VariableName, mSignatureDb[Index].VariableName) == 0) {
+      return &mSignatureDb[Index];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Hash the content of a signature for the index of a signature database.
+
+  @param[in]  Signature           Pointer to the signature content, after the owner GUID.
+  @param[in]  SignatureSize       Size of the signature content.
+
+  @return The hash of the signature.
+
+**/
+STATIC
+UINT32
+SignatureIndexHash (
+  IN CONST UINT8  *Signature,
+  IN UINTN        SignatureSize
+  )
+{
+  UINT32  Hash;
+  UINTN   Index;
+
+  //
+  // FNV-1a over the size and the leading bytes, which are uniformly
+  // distributed for the digests that make up most of db and dbx.
+  //
+  Hash = 0x811C9DC5 ^ (UINT32)SignatureSize;
+  for (Index = 0; Index < MIN (SignatureSize, 16); Index++) {
+    Hash = (Hash ^ Signature[Index]) * 0x01000193;
+  }
+
+  return Hash;
+}
+
+/**
+  Check whether the signature list at the head of a database buffer is well
+  formed and fits in the buffer.
+
+  @param[in]  CertList            Pointer to the signature list.
+  @param[in]  DataSize            Size of the buffer left, from CertList.
+
+  @retval TRUE                    The signature list is well formed.
+  @retval FALSE                   The signature list is malformed or truncated.
+
+**/
+STATIC
+BOOLEAN
+IsSignatureListValid (
+  IN EFI_SIGNATURE_LIST  *CertList,
+  IN UINTN               DataSize
+  )
+{
+  if (DataSize < sizeof (EFI_SIGNATURE_LIST)) {
+    return FALSE;
+  }
+
+  if ((CertList->SignatureListSize > DataSize) ||
+      (CertList->SignatureListSize < sizeof (EFI_SIGNATURE_LIST)) ||
+      (CertList->SignatureHeaderSize > CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST)) ||
+      (CertList->SignatureSize < sizeof (EFI_SIGNATURE_DATA) - 1))
+  {
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+  Rebuild the hash index of the signatures of a cached signature database.
+
+  @param[in, out]  Db             The cached signature database.
+
+  @retval EFI_SUCCESS             The index was rebuilt.
+  @retval EFI_OUT_OF_RESOURCES    The index could not be allocated.
+
+**/
+STATIC
+EFI_STATUS
+BuildSignatureIndex (
+  IN OUT SIGNATURE_DATABASE_CACHE  *Db
+  )
+{
+  EFI_SIGNATURE_LIST     *CertList;
+  EFI_SIGNATURE_DATA     *Cert;
+  UINTN                  DataSize;
+  UINTN                  CertCount;
+  UINTN                  Count;
+  UINTN                  Index;
+  SIGNATURE_INDEX_ENTRY  *Entry;
+  UINT32                 *Bucket;
+
+  SetMem32 (Db->Buckets, sizeof (Db->Buckets), SIGNATURE_INDEX_END);
+  Db->EntryCount = 0;
+
+  //
+  // Count the signatures, stopping at the first malformed list as the linear
+  // scans of the database do.
+  //
+  Count    = 0;
+  CertList = (EFI_SIGNATURE_LIST *)Db->Data;
+  DataSize = Db->DataSize;
+  while (IsSignatureListValid (CertList, DataSize)) {
+    Count    += (CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST) - CertList->SignatureHeaderSize) / CertList->SignatureSize;
+    DataSize -= CertList->SignatureListSize;
+    CertList  = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
+  }
+
+  if (Count >= SIGNATURE_INDEX_END) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  if (Count > Db->EntryBufferCount) {
+    if (Db->Entries != NULL) {
+      FreePool (Db->Entries);
+    }
+
+    Db->Entries = AllocatePool (Count * sizeof (SIGNATURE_INDEX_ENTRY));
+    if (Db->Entries == NULL) {
+      Db->EntryBufferCount = 0;
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Db->EntryBufferCount = Count;
+  }
+
+  CertList = (EFI_SIGNATURE_LIST *)Db->Data;
+  DataSize = Db->DataSize;
+  while (IsSignatureListValid (CertList, DataSize)) {
+    CertCount = (CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST) - CertList->SignatureHeaderSize) / CertList->SignatureSize;
+    Cert      = (EFI_SIGNATURE_DATA *)((UINT8 *)CertList + sizeof (EFI_SIGNATURE_LIST) + CertList->SignatureHeaderSize);
+    for (Index = 0; Index < CertCount; Index++) {
+      Db->Entries[Db->EntryCount].CertList = CertList;
+      Db->Entries[Db->EntryCount].Cert     = Cert;
+      Db->EntryCount++;
+      Cert = (EFI_SIGNATURE_DATA *)((UINT8 *)Cert + CertList->SignatureSize);
+    }
+
+    DataSize -= CertList->SignatureListSize;
+    CertList  = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
+  }
+
+  //
+  // Link the entries last to first so that each bucket lists its entries in
+  // database order, and a lookup finds the same entry as a linear scan.
+  //
+  for (Index = Db->EntryCount; Index > 0; Index--) {
+    Entry       = &Db->Entries[Index - 1];
+    Bucket      = &Db->Buckets[SignatureIndexHash (Entry->Cert->SignatureData, Entry->CertList->SignatureSize - sizeof (EFI_GUID)) & (SIGNATURE_INDEX_BUCKETS - 1)];
+    Entry->Next = *Bucket;
+    *Bucket     = (UINT32)(Index - 1);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Bring the cached copy of a signature database up to date with its variable.
+
+  @param[in, out]  Db             The cached signature database.
+  @param[out]      Changed        TRUE if the variable changed since the last call.
+
+  @retval EFI_SUCCESS             The cached copy is up to date.
+  @retval Others                  The variable could not be read, the cached
+                                  copy is invalid.
+
+**/
+STATIC
+EFI_STATUS
+RefreshSignatureDatabase (
+  IN OUT SIGNATURE_DATABASE_CACHE  *Db,
+  OUT    BOOLEAN                   *Changed
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       DataSize;
+  UINT8       *Buffer;
+  UINTN       BufferSize;
+
+  *Changed = TRUE;
+
+  DataSize = Db->ReadBufferSize;
+  Status   = gRT->GetVariable (Db->VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, Db->ReadBuffer);
+  if (Status == EFI_BUFFER_TOO_SMALL) {
+    if (Db->ReadBuffer != NULL) {
+      FreePool (Db->ReadBuffer);
+    }
+
+    Db->ReadBufferSize = 0;
+    Db->ReadBuffer     = AllocatePool (DataSize);
+    if (Db->ReadBuffer == NULL) {
+      Db->Valid = FALSE;
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Db->ReadBufferSize = DataSize;
+    Status             = gRT->GetVariable (Db->VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, Db->ReadBuffer);
+  }
+
+  if (Status == EFI_NOT_FOUND) {
+    DataSize = 0;
+  } else if (EFI_ERROR (Status)) {
+    Db->Valid = FALSE;
+    return Status;
+  }
+
+  if (Db->Valid && (DataSize == Db->DataSize) &&
+      ((DataSize == 0) || (CompareMem (Db->ReadBuffer, Db->Data, DataSize) == 0)))
+  {
+    *Changed = FALSE;
+    return EFI_SUCCESS;
+  }
+
+  //
+  // The variable was written, keep what was just read and index it again.
+  //
+  Buffer             = Db->Data;
+  BufferSize         = Db->DataBufferSize;
+  Db->Data           = Db->ReadBuffer;
+  Db->DataBufferSize = Db->ReadBufferSize;
+  Db->DataSize       = DataSize;
+  Db->ReadBuffer     = Buffer;
+  Db->ReadBufferSize = BufferSize;
+
+  Status    = BuildSignatureIndex (Db);
+  Db->Valid = (BOOLEAN)!EFI_ERROR (Status);
+  if (Db->Valid) {
+    DEBUG ((DEBUG_INFO, "DxeImageVerificationLib: %s indexed, %Lu signatures.\n", Db->VariableName, (UINT64)Db->EntryCount));
+  }
+
+  return Status;
+}
+
+/**
+  Bring the cached copies of db, dbx and dbt up to date, and forget the
+  verified images if any of them changed.
+
+  @retval EFI_SUCCESS             The cached copies are up to date.
+  @retval Others                  A database could not be read.
+
+**/
+EFI_STATUS
+RefreshSignatureDatabases (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Index;
+  BOOLEAN     Changed;
+  BOOLEAN     AnyChanged;
+
+  Status     = EFI_SUCCESS;
+  AnyChanged = FALSE;
+  for (Index = 0; Index < SIGNATURE_DB_MAX; Index++) {
+    Status = RefreshSignatureDatabase (&mSignatureDb[Index], &Changed);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    AnyChanged |= Changed;
+  }
+
+  if (AnyChanged || EFI_ERROR (Status)) {
+    mVerifiedImageCount = 0;
+    mVerifiedImageNext  = 0;
+  }
+
+  return Status;
+}
+
+/**
+  Check whether an image passed the verification against the current db,
+  dbx and dbt before.
+
+  @param[in]  Image               The image digest and certificate table digest.
+
+  @retval TRUE                    The image was verified before.
+  @retval FALSE                   The image has to be verified.
+
+**/
+BOOLEAN
+IsImageVerifiedBefore (
+  IN VERIFIED_IMAGE_ENTRY  *Image
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < mVerifiedImageCount; Index++) {
+    if ((mVerifiedImage[Index].DigestSize == Image->DigestSize) &&
+        CompareGuid (&mVerifiedImage[Index].CertType, &Image->CertType) &&
+        (mVerifiedImage[Index].CertTableOffset == Image->CertTableOffset) &&
+        (mVerifiedImage[Index].CertTableSize == Image->CertTableSize) &&
+        (CompareMem (mVerifiedImage[Index].Digest, Image->Digest, Image->DigestSize) == 0) &&
+        (CompareMem (mVerifiedImage[Index].CertTableDigest, Image->CertTableDigest, SHA256_DIGEST_SIZE) == 0))
+    {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Remember an image that passed the verification against the current db, dbx
+  and dbt, replacing the oldest one when the cache is full.
+
+  @param[in]  Image               The image digest and certificate table digest.
+
+**/
+VOID
+AddVerifiedImage (
+  IN VERIFIED_IMAGE_ENTRY  *Image
+  )
+{
+  CopyMem (&mVerifiedImage[mVerifiedImageNext], Image, sizeof (VERIFIED_IMAGE_ENTRY));
+  mVerifiedImageNext = (mVerifiedImageNext + 1) % VERIFIED_IMAGE_CACHE_SIZE;
+  if (mVerifiedImageCount < VERIFIED_IMAGE_CACHE_SIZE) {
+    mVerifiedImageCount++;
+  }
+}
+
 /**
   Check whether signature is in specified database.
 
@@ -987,84 +1128,55 @@ IsSignatureFoundInDatabase (
   OUT BOOLEAN   *IsFound
   )
 {
-  EFI_STATUS          Status;
-  EFI_SIGNATURE_LIST  *CertList;
-  EFI_SIGNATURE_DATA  *Cert;
-  UINTN               DataSize;
-  UINT8               *Data;
-  UINTN               Index;
-  UINTN               CertCount;
+  SIGNATURE_DATABASE_CACHE  *Db;
+  SIGNATURE_INDEX_ENTRY     *Entry;
+  UINT32                    Index;
 
-  //
-  // Read signature database variable.
-  //
   *IsFound = FALSE;
-  Data     = NULL;
-  DataSize = 0;
-  Status   = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    if (Status == EFI_NOT_FOUND) {
-      //
-      // No database, no need to search.
-      //
-      Status = EFI_SUCCESS;
-    }
-
-    return Status;
+  Db       = GetSignatureDatabase (VariableName);
+  if (Db == NULL) {
+    return EFI_INVALID_PARAMETER;
   }
 
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return EFI_OUT_OF_RESOURCES;
+  if (!Db->Valid) {
+    return EFI_NOT_READY;
   }
 
-  Status = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, Data);
-  if (EFI_ERROR (Status)) {
-    goto Done;
+  if (Db->EntryCount == 0) {
+    //
+    // No database, no need to search.
+    //
+    return EFI_SUCCESS;
   }
 
   //
-  // Enumerate all signature data in SigDB to check if signature exists for executable.
+  // Only the entries whose content hashes to the same bucket can match.
   //
-  CertList = (EFI_SIGNATURE_LIST *)Data;
-  while ((DataSize > 0) && (DataSize >= CertList->SignatureListSize)) {
-    CertCount = (CertList->SignatureListSize - sizeof (EFI_SIGNATURE_LIST) - CertList->SignatureHeaderSize) / CertList->SignatureSize;
-    Cert      = (EFI_SIGNATURE_DATA *)((UINT8 *)CertList + sizeof (EFI_SIGNATURE_LIST) + CertList->SignatureHeaderSize);
-    if ((CertList->SignatureSize == sizeof (EFI_SIGNATURE_DATA) - 1 + SignatureSize) && (CompareGuid (&CertList->SignatureType, CertType))) {
-      for (Index = 0; Index < CertCount; Index++) {
-        if (CompareMem (Cert->SignatureData, Signature, SignatureSize) == 0) {
-          //
-          // Find the signature in database.
-          //
-          *IsFound = TRUE;
-          //
-          // Entries in UEFI_IMAGE_SECURITY_DATABASE that are used to validate image should be measured
-          //
-          if (StrCmp (VariableName, EFI_IMAGE_SECURITY_DATABASE) == 0) {
-            SecureBootHook (VariableName, &gEfiImageSecurityDatabaseGuid, CertList->SignatureSize, Cert);
-          }
-
-          break;
-        }
-
-        Cert = (EFI_SIGNATURE_DATA *)((UINT8 *)Cert + CertList->SignatureSize);
+  Index = Db->Buckets[SignatureIndexHash (Signature, SignatureSize) & (SIGNATURE_INDEX_BUCKETS - 1)];
+  while (Index != SIGNATURE_INDEX_END) {
+    Entry = &Db->Entries[Index];
+    if ((Entry->CertList->SignatureSize == sizeof (EFI_SIGNATURE_DATA) - 1 + SignatureSize) &&
+        CompareGuid (&Entry->CertList->SignatureType, CertType) &&
+        (CompareMem (Entry->Cert->SignatureData, Signature, SignatureSize) == 0))
+    {
+      //
+      // Find the signature in database.
+      //
+      *IsFound = TRUE;
+      //
+      // Entries in UEFI_IMAGE_SECURITY_DATABASE that are used to validate image should be measured
+      //
+      if (StrCmp (VariableName, EFI_IMAGE_SECURITY_DATABASE) == 0) {
+        SecureBootHook (VariableName, &gEfiImageSecurityDatabaseGuid, Entry->CertList->SignatureSize, Entry->Cert);
       }
 
-      if (*IsFound) {
-        break;
-      }
+      break;
     }
 
-    DataSize -= CertList->SignatureListSize;
-    CertList  = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
+    Index = Entry->Next;
   }
 
-Done:
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
-  return Status;
+  return EFI_SUCCESS;
 }
 
 /**
@@ -1142,7 +1254,6 @@ PassTimestampCheck (
   IN EFI_TIME  *RevocationTime
   )
 {
-  EFI_STATUS          Status;
   BOOLEAN             VerifyStatus;
   EFI_SIGNATURE_LIST  *CertList;
   EFI_SIGNATURE_DATA  *Cert;
@@ -1175,21 +1286,12 @@ PassTimestampCheck (
   // RevocationTime is non-zero, the certificate should be considered to be revoked from that time and onwards.
   // Using the dbt to get the trusted TSA certificates.
   //
-  DbtDataSize = 0;
-  Status      = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE2, &gEfiImageSecurityDatabaseGuid, NULL, &DbtDataSize, NULL);
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    goto Done;
-  }
-
-  DbtData = (UINT8 *)AllocateZeroPool (DbtDataSize);
-  if (DbtData == NULL) {
-    goto Done;
+  if (!mSignatureDb[SIGNATURE_DB_DBT].Valid || (mSignatureDb[SIGNATURE_DB_DBT].DataSize == 0)) {
+    return FALSE;
   }
 
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE2, &gEfiImageSecurityDatabaseGuid, NULL, &DbtDataSize, (VOID *)DbtData);
-  if (EFI_ERROR (Status)) {
-    goto Done;
-  }
+  DbtData     = mSignatureDb[SIGNATURE_DB_DBT].Data;
+  DbtDataSize = mSignatureDb[SIGNATURE_DB_DBT].DataSize;
 
   CertList = (EFI_SIGNATURE_LIST *)DbtData;
   while ((DbtDataSize > 0) && (DbtDataSize >= CertList->SignatureListSize)) {
@@ -1224,10 +1326,6 @@ PassTimestampCheck (
   }
 
 Done:
-  if (DbtData != NULL) {
-    FreePool (DbtData);
-  }
-
   return VerifyStatus;
 }
 
@@ -1286,31 +1384,21 @@ IsForbiddenByDbx (
   TrustedCertLength = 0;
 
   //
-  // The image will not be forbidden if dbx can't be got.
+  // The image is forbidden if dbx can't be got.
   //
-  DataSize = 0;
-  Status   = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    if (Status == EFI_NOT_FOUND) {
-      //
-      // Evidently not in dbx if the database doesn't exist.
-      //
-      IsForbidden = FALSE;
-    }
-
+  if (!mSignatureDb[SIGNATURE_DB_DBX].Valid) {
     return IsForbidden;
   }
 
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return IsForbidden;
+  if (mSignatureDb[SIGNATURE_DB_DBX].DataSize == 0) {
+    //
+    // Evidently not in dbx if the database doesn't exist.
+    //
+    return FALSE;
   }
 
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, (VOID *)Data);
-  if (EFI_ERROR (Status)) {
-    goto Done;
-  }
+  Data     = mSignatureDb[SIGNATURE_DB_DBX].Data;
+  DataSize = mSignatureDb[SIGNATURE_DB_DBX].DataSize;
 
   //
   // Verify image signature with RAW X509 certificates in DBX database.
@@ -1418,10 +1506,6 @@ IsForbiddenByDbx (
   IsForbidden = FALSE;
 
 Done:
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
   Pkcs7FreeSigners (CertBuffer);
   Pkcs7FreeSigners (TrustedCert);
 
@@ -1464,59 +1548,33 @@ IsAllowedByDb (
   CertData     = NULL;
   RootCert     = NULL;
   DbxData      = NULL;
+  DbxDataSize  = 0;
   RootCertSize = 0;
   VerifyStatus = FALSE;
 
   //
-  // Fetch 'db' content. If 'db' doesn't exist or encounters problem to get the
-  // data, return not-allowed-by-db (FALSE).
+  // Use the cached 'db' content. If 'db' doesn't exist or encounters problem
+  // to get the data, return not-allowed-by-db (FALSE).
   //
-  DataSize = 0;
-  Status   = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
+  if (!mSignatureDb[SIGNATURE_DB_DB].Valid || (mSignatureDb[SIGNATURE_DB_DB].DataSize == 0)) {
     return VerifyStatus;
   }
 
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return VerifyStatus;
-  }
-
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, (VOID *)Data);
-  if (EFI_ERROR (Status)) {
-    goto Done;
-  }
+  Data     = mSignatureDb[SIGNATURE_DB_DB].Data;
+  DataSize = mSignatureDb[SIGNATURE_DB_DB].DataSize;
 
   //
-  // Fetch 'dbx' content. If 'dbx' doesn't exist, continue to check 'db'.
-  // If any other errors occurred, no need to check 'db' but just return
+  // Use the cached 'dbx' content. If 'dbx' doesn't exist, continue to check
+  // 'db'. If any other errors occurred, no need to check 'db' but just return
   // not-allowed-by-db (FALSE) to avoid bypass.
   //
-  DbxDataSize = 0;
-  Status      = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DbxDataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    if (Status != EFI_NOT_FOUND) {
-      goto Done;
-    }
-
-    //
-    // 'dbx' does not exist. Continue to check 'db'.
-    //
-  } else {
-    //
-    // 'dbx' exists. Get its content.
-    //
-    DbxData = (UINT8 *)AllocateZeroPool (DbxDataSize);
-    if (DbxData == NULL) {
-      goto Done;
-    }
+  if (!mSignatureDb[SIGNATURE_DB_DBX].Valid) {
+    return VerifyStatus;
+  }
 
-    Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DbxDataSize, (VOID *)DbxData);
-    if (EFI_ERROR (Status)) {
-      goto Done;
-    }
+  if (mSignatureDb[SIGNATURE_DB_DBX].DataSize != 0) {
+    DbxData     = mSignatureDb[SIGNATURE_DB_DBX].Data;
+    DbxDataSize = mSignatureDb[SIGNATURE_DB_DBX].DataSize;
   }
 
   //
@@ -1595,14 +1653,6 @@ Done:
     SecureBootHook (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, CertList->SignatureSize, CertData);
   }
 
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
-  if (DbxData != NULL) {
-    FreePool (DbxData);
-  }
-
   return VerifyStatus;
 }
 
@@ -1687,6 +1737,9 @@ DxeImageVerificationHandler (
   EFI_STATUS                    HashStatus;
   EFI_STATUS                    DbStatus;
   BOOLEAN                       IsFound;
+  VERIFIED_IMAGE_ENTRY          ImageEntry;
+  BOOLEAN                       UseImageCache;
+  BOOLEAN                       ImageEntrySet;
 
   SignatureList     = NULL;
   SignatureListSize = 0;
@@ -1696,6 +1749,8 @@ DxeImageVerificationHandler (
   Action            = EFI_IMAGE_EXECUTION_AUTH_UNTESTED;
   IsVerified        = FALSE;
   IsFound           = FALSE;
+  UseImageCache     = FALSE;
+  ImageEntrySet     = FALSE;
 
   //
   // Check the image type and get policy setting.
@@ -1769,6 +1824,7 @@ DxeImageVerificationHandler (
 
   mImageBase = (UINT8 *)FileBuffer;
   mImageSize = FileSize;
+  ZeroMem (mImageDigestSaved, sizeof (mImageDigestSaved));
 
   ZeroMem (&ImageContext, sizeof (ImageContext));
   ImageContext.Handle    = (VOID *)FileBuffer;
@@ -1827,6 +1883,14 @@ DxeImageVerificationHandler (
     }
   }
 
+  //
+  // Bring the cached db, dbx and dbt up to date before looking anything up.
+  //
+  if (EFI_ERROR (RefreshSignatureDatabases ())) {
+    DEBUG ((DEBUG_INFO, "DxeImageVerificationLib: Failed to read the signature databases.\n"));
+    goto Failed;
+  }
+
   //
   // Start Image Validation.
   //
@@ -1882,6 +1946,19 @@ DxeImageVerificationHandler (
   // The first certificate starts at offset (SecDataDir->VirtualAddress) from the start of the file.
   //
   SecDataDirEnd = SecDataDir->VirtualAddress + SecDataDir->Size;
+
+  //
+  // An image whose Authenticode digest and attribute certificate table are
+  // the same as those of an image verified against the current db, dbx and
+  // dbt is verified too. Identify the table by its SHA256 digest.
+  //
+  ZeroMem (&ImageEntry, sizeof (ImageEntry));
+  ImageEntry.CertTableOffset = SecDataDir->VirtualAddress;
+  ImageEntry.CertTableSize   = SecDataDir->Size;
+  if ((SecDataDir->VirtualAddress <= mImageSize) && (SecDataDir->Size <= mImageSize - SecDataDir->VirtualAddress)) {
+    UseImageCache = Sha256HashAll (mImageBase + SecDataDir->VirtualAddress, SecDataDir->Size, ImageEntry.CertTableDigest);
+  }
+
   for (OffSet = SecDataDir->VirtualAddress;
        OffSet < SecDataDirEnd;
        OffSet += (WinCertificate->dwLength + ALIGN_SIZE (WinCertificate->dwLength)))
@@ -1942,6 +2019,25 @@ DxeImageVerificationHandler (
       continue;
     }
 
+    //
+    // The first Authenticode digest identifies the image content, as long as
+    // it is not a SHA1 one.
+    //
+    if (UseImageCache && !ImageEntrySet) {
+      ImageEntrySet = TRUE;
+      if (CompareGuid (&mCertType, &gEfiCertSha1Guid)) {
+        UseImageCache = FALSE;
+      } else {
+        CopyGuid (&ImageEntry.CertType, &mCertType);
+        ImageEntry.DigestSize = mImageDigestSize;
+        CopyMem (ImageEntry.Digest, mImageDigest, mImageDigestSize);
+        if (IsImageVerifiedBefore (&ImageEntry)) {
+          DEBUG ((DEBUG_INFO, "DxeImageVerificationLib: Image was verified before, %s hash of image matches.\n", mHashTypeStr));
+          return EFI_SUCCESS;
+        }
+      }
+    }
+
     //
     // Check the digital signature against the revoked certificate in forbidden database (dbx).
     //
@@ -2001,6 +2097,10 @@ DxeImageVerificationHandler (
   }
 
   if (IsVerified) {
+    if (UseImageCache && ImageEntrySet) {
+      AddVerifiedImage (&ImageEntry);
+    }
+
     return EFI_SUCCESS;
   }
 
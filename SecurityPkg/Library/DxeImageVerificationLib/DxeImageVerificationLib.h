@@ -23,6 +23,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/DevicePathLib.h>
 #include <Library/SecurityManagementLib.h>
 #include <Library/PeCoffLib.h>
+#include <Library/AuthenticodeHashLib.h>
 #include <Protocol/FirmwareVolume2.h>
 #include <Protocol/DevicePath.h>
 #include <Protocol/BlockIo.h>
@@ -73,6 +74,70 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 // Set max digest size as SHA512 Output (64 bytes) by far
 //
 #define MAX_DIGEST_SIZE  SHA512_DIGEST_SIZE
+
+//
+// Number of hash buckets of the index of a signature database, a power of 2.
+//
+#define SIGNATURE_INDEX_BUCKETS  256
+#define SIGNATURE_INDEX_END      MAX_UINT32
+
+//
+// Number of images whose successful verification is remembered.
+//
+#define VERIFIED_IMAGE_CACHE_SIZE  64
+
+//
+// Signature database indexes
+//
+#define SIGNATURE_DB_DB   0
+#define SIGNATURE_DB_DBX  1
+#define SIGNATURE_DB_DBT  2
+#define SIGNATURE_DB_MAX  3
+
+//
+// One signature of an indexed signature database.
+//
+typedef struct {
+  EFI_SIGNATURE_LIST    *CertList;
+  EFI_SIGNATURE_DATA    *Cert;
+  //
+  // Index of the next entry in the same bucket, or SIGNATURE_INDEX_END.
+  //
+  UINT32                Next;
+} SIGNATURE_INDEX_ENTRY;
+
+//
+// Cached copy of a signature database variable, with its signatures hashed
+// by content. DataSize is 0 when the variable does not exist; Data then still
+// points to the buffer of an earlier copy, if any. Data and ReadBuffer swap
+// roles each time the variable changes. The copy is only used while Valid.
+//
+typedef struct {
+  CHAR16                   *VariableName;
+  BOOLEAN                  Valid;
+  UINT8                    *Data;
+  UINTN                    DataSize;
+  UINTN                    DataBufferSize;
+  UINT8                    *ReadBuffer;
+  UINTN                    ReadBufferSize;
+  SIGNATURE_INDEX_ENTRY    *Entries;
+  UINTN                    EntryCount;
+  UINTN                    EntryBufferCount;
+  UINT32                   Buckets[SIGNATURE_INDEX_BUCKETS];
+} SIGNATURE_DATABASE_CACHE;
+
+//
+// Image whose signature passed the verification against the current db/dbx.
+//
+typedef struct {
+  EFI_GUID    CertType;
+  UINTN       DigestSize;
+  UINT8       Digest[MAX_DIGEST_SIZE];
+  UINT32      CertTableOffset;
+  UINT32      CertTableSize;
+  UINT8       CertTableDigest[SHA256_DIGEST_SIZE];
+} VERIFIED_IMAGE_ENTRY;
+
 //
 //
 // PKCS7 Certificate definition
@@ -0,0 +1,423 @@
+/** @file
+  FMP Authentication EC-DSA handler.
+  Provide generic FMP authentication functions for DXE/PEI post memory phase.
+
+  The supported certificate blocks are EDKII_CERT_BLOCK_ECDSA_P256_SHA256 and
+  EDKII_CERT_BLOCK_ECDSA_P384_SHA384. The payload is hashed in place, so the
+  verification needs no copy of the image whatever its size.
+
+  Caution: This module requires additional review when modified.
+  This module will have external input - capsule image.
+  This external input must be validated carefully to avoid security issue like
+  buffer overflow, integer overflow.
+
+  FmpAuthenticatedHandlerEcdsa(), AuthenticateFmpImage() will receive
+  untrusted input and do basic validation.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+
+#include <Guid/SystemResourceTable.h>
+#include <Guid/FmpAuthenticationEcdsa.h>
+#include <Guid/WinCertificate.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/BaseCryptLib.h>
+#include <Library/FmpAuthenticationLib.h>
+#include <Protocol/FirmwareManagement.h>
+#include <Protocol/Hash.h>
+
+typedef
+UINTN
+(EFIAPI *FMP_ECDSA_HASH_GET_CONTEXT_SIZE)(
+  VOID
+  );
+
+typedef
+BOOLEAN
+(EFIAPI *FMP_ECDSA_HASH_INIT)(
+  OUT  VOID  *HashContext
+  );
+
+typedef
+BOOLEAN
+(EFIAPI *FMP_ECDSA_HASH_UPDATE)(
+  IN OUT  VOID        *HashContext,
+  IN      CONST VOID  *Data,
+  IN      UINTN       DataSize
+  );
+
+typedef
+BOOLEAN
+(EFIAPI *FMP_ECDSA_HASH_FINAL)(
+  IN OUT  VOID   *HashContext,
+  OUT     UINT8  *HashValue
+  );
+
+///
+/// Curve and hash algorithm of a certificate block, selected by its HashType.
+/// The public key and the signature both have KeySize bytes.
+///
+typedef struct {
+  EFI_GUID                           *HashType;
+  UINTN                              CertBlockSize;
+  UINTN                              KeySize;
+  UINTN                              CurveNid;
+  UINTN                              HashNid;
+  UINTN                              DigestSize;
+  FMP_ECDSA_HASH_GET_CONTEXT_SIZE    GetContextSize;
+  FMP_ECDSA_HASH_INIT                HashInit;
+  FMP_ECDSA_HASH_UPDATE              HashUpdate;
+  FMP_ECDSA_HASH_FINAL               HashFinal;
+} FMP_ECDSA_SUITE;
+
+STATIC CONST FMP_ECDSA_SUITE  mFmpEcdsaSuite[] = {
+  {
+    &gEfiHashAlgorithmSha256Guid,
+    sizeof (EDKII_CERT_BLOCK_ECDSA_P256_SHA256),
+    sizeof (((EDKII_CERT_BLOCK_ECDSA_P256_SHA256 *)0)->PublicKey),
+    CRYPTO_NID_SECP256R1,
+    CRYPTO_NID_SHA256,
+    SHA256_DIGEST_SIZE,
+    Sha256GetContextSize,
+    Sha256Init,
+    Sha256Update,
+    Sha256Final
+  },
+  {
+    &gEfiHashAlgorithmSha384Guid,
+    sizeof (EDKII_CERT_BLOCK_ECDSA_P384_SHA384),
+    sizeof (((EDKII_CERT_BLOCK_ECDSA_P384_SHA384 *)0)->PublicKey),
+    CRYPTO_NID_SECP384R1,
+    CRYPTO_NID_SHA384,
+    SHA384_DIGEST_SIZE,
+    Sha384GetContextSize,
+    Sha384Init,
+    Sha384Update,
+    Sha384Final
+  }
+};
+
+/**
+  The handler is used to do the authentication for FMP capsule based upon
+  EFI_FIRMWARE_IMAGE_AUTHENTICATION.
+
+  Caution: This function may receive untrusted input.
+
+  This function assumes the caller AuthenticateFmpImage()
+  already did basic validation for EFI_FIRMWARE_IMAGE_AUTHENTICATION.
+
+  @param[in]  Image                   Points to an FMP authentication image, started from EFI_FIRMWARE_IMAGE_AUTHENTICATION.
+  @param[in]  ImageSize               Size of the authentication image in bytes.
+  @param[in]  PublicKeyData           The SHA-256 digests of the public keys used to validate the signature.
+  @param[in]  PublicKeyDataLength     The length of the public key data.
+
+  @retval RETURN_SUCCESS            Authentication pass.
+                                    The LastAttemptStatus should be LAST_ATTEMPT_STATUS_SUCCESS.
+  @retval RETURN_SECURITY_VIOLATION Authentication fail.
+                                    The LastAttemptStatus should be LAST_ATTEMPT_STATUS_ERROR_AUTH_ERROR.
+  @retval RETURN_INVALID_PARAMETER  The image is in an invalid format.
+                                    The LastAttemptStatus should be LAST_ATTEMPT_STATUS_ERROR_INVALID_FORMAT.
+  @retval RETURN_OUT_OF_RESOURCES   No Authentication handler associated with CertType.
+                                    The LastAttemptStatus should be LAST_ATTEMPT_STATUS_ERROR_INSUFFICIENT_RESOURCES.
+**/
+RETURN_STATUS
+FmpAuthenticatedHandlerEcdsa (
+  IN EFI_FIRMWARE_IMAGE_AUTHENTICATION  *Image,
+  IN UINTN                              ImageSize,
+  IN CONST UINT8                        *PublicKeyData,
+  IN UINTN                              PublicKeyDataLength
+  )
+{
+  RETURN_STATUS          Status;
+  CONST FMP_ECDSA_SUITE  *Suite;
+  EFI_GUID               *HashType;
+  UINT8                  *PublicKey;
+  UINT8                  *Signature;
+  BOOLEAN                CryptoStatus;
+  UINT8                  Digest[SHA384_DIGEST_SIZE];
+  CONST UINT8            *KeyDigest;
+  UINTN                  KeyDigestBufferSize;
+  UINTN                  Index;
+  VOID                   *HashContext;
+  VOID                   *Ec;
+
+  DEBUG ((DEBUG_INFO, "FmpAuthenticatedHandlerEcdsa - Image: 0x%08x - 0x%08x\n", (UINTN)Image, (UINTN)ImageSize));
+
+  if (Image->AuthInfo.Hdr.dwLength < OFFSET_OF (WIN_CERTIFICATE_UEFI_GUID, CertData) + sizeof (EFI_GUID)) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa - dwLength: 0x%04x too small\n", (UINTN)Image->AuthInfo.Hdr.dwLength));
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  HashType = (EFI_GUID *)Image->AuthInfo.CertData;
+  Suite    = NULL;
+  for (Index = 0; Index < ARRAY_SIZE (mFmpEcdsaSuite); Index++) {
+    if (CompareGuid (HashType, mFmpEcdsaSuite[Index].HashType)) {
+      Suite = &mFmpEcdsaSuite[Index];
+      break;
+    }
+  }
+
+  if (Suite == NULL) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa - HashType: %g is not supported\n", HashType));
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if (Image->AuthInfo.Hdr.dwLength != OFFSET_OF (WIN_CERTIFICATE_UEFI_GUID, CertData) + Suite->CertBlockSize) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa - dwLength: 0x%04x, expect - 0x%04x\n", (UINTN)Image->AuthInfo.Hdr.dwLength, (UINTN)OFFSET_OF (WIN_CERTIFICATE_UEFI_GUID, CertData) + Suite->CertBlockSize));
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  PublicKey = Image->AuthInfo.CertData + sizeof (EFI_GUID);
+  Signature = PublicKey + Suite->KeySize;
+
+  HashContext = NULL;
+  Ec          = NULL;
+
+  //
+  // Fail if the SHA-256 digest of the PublicKey is not one of the digests in
+  // the input PublicKeyData.
+  //
+  CryptoStatus = Sha256HashAll (PublicKey, Suite->KeySize, Digest);
+  if (!CryptoStatus) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa: Sha256HashAll() failed\n"));
+    Status = RETURN_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  KeyDigest           = PublicKeyData;
+  KeyDigestBufferSize = PublicKeyDataLength;
+  CryptoStatus        = FALSE;
+  while (KeyDigestBufferSize != 0) {
+    if (CompareMem (Digest, KeyDigest, SHA256_DIGEST_SIZE) == 0) {
+      CryptoStatus = TRUE;
+      break;
+    }
+
+    KeyDigest           = KeyDigest + SHA256_DIGEST_SIZE;
+    KeyDigestBufferSize = KeyDigestBufferSize - SHA256_DIGEST_SIZE;
+  }
+
+  if (!CryptoStatus) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa: Public key in section is not supported\n"));
+    Status = RETURN_SECURITY_VIOLATION;
+    goto Done;
+  }
+
+  //
+  // Generate & Initialize EC Context. A public key that is not on the curve
+  // is rejected here.
+  //
+  Ec = EcNewByNid (Suite->CurveNid);
+  if (Ec == NULL) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa: EcNewByNid() failed\n"));
+    Status = RETURN_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  CryptoStatus = EcSetPubKey (Ec, PublicKey, Suite->KeySize);
+  if (!CryptoStatus) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa: EcSetPubKey() failed\n"));
+    Status = RETURN_SECURITY_VIOLATION;
+    goto Done;
+  }
+
+  //
+  // Hash data payload in place, without copying it.
+  //
+  HashContext = AllocatePool (Suite->GetContextSize ());
+  if (HashContext == NULL) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa: Can not allocate hash context\n"));
+    Status = RETURN_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  CryptoStatus = Suite->HashInit (HashContext);
+  if (!CryptoStatus) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa: HashInit() failed\n"));
+    Status = RETURN_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  // It is a signature across the variable data and the Monotonic Count value.
+  CryptoStatus = Suite->HashUpdate (
+                          HashContext,
+                          (UINT8 *)Image + sizeof (Image->MonotonicCount) + Image->AuthInfo.Hdr.dwLength,
+                          ImageSize - sizeof (Image->MonotonicCount) - Image->AuthInfo.Hdr.dwLength
+                          );
+  if (!CryptoStatus) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa: HashUpdate() failed\n"));
+    Status = RETURN_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  CryptoStatus = Suite->HashUpdate (
+                          HashContext,
+                          (UINT8 *)&Image->MonotonicCount,
+                          sizeof (Image->MonotonicCount)
+                          );
+  if (!CryptoStatus) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa: HashUpdate() failed\n"));
+    Status = RETURN_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  CryptoStatus = Suite->HashFinal (HashContext, Digest);
+  if (!CryptoStatus) {
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa: HashFinal() failed\n"));
+    Status = RETURN_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  //
+  // Verify the EC-DSA signature.
+  //
+  CryptoStatus = EcDsaVerify (
+                   Ec,
+                   Suite->HashNid,
+                   Digest,
+                   Suite->DigestSize,
+                   Signature,
+                   Suite->KeySize
+                   );
+  if (!CryptoStatus) {
+    //
+    // If EC-DSA signature verification fails, AUTH tested failed bit is set.
+    //
+    DEBUG ((DEBUG_ERROR, "FmpAuthenticatedHandlerEcdsa: EcDsaVerify() failed\n"));
+    Status = RETURN_SECURITY_VIOLATION;
+    goto Done;
+  }
+
+  DEBUG ((DEBUG_INFO, "FmpAuthenticatedHandlerEcdsa: PASS verification\n"));
+
+  Status = RETURN_SUCCESS;
+
+Done:
+  //
+  // Free allocated resources used to perform EC-DSA signature verification
+  //
+  if (Ec != NULL) {
+    EcFree (Ec);
+  }
+
+  if (HashContext != NULL) {
+    FreePool (HashContext);
+  }
+
+  return Status;
+}
+
+/**
+  The function is used to do the authentication for FMP capsule based upon
+  EFI_FIRMWARE_IMAGE_AUTHENTICATION.
+
+  The FMP capsule image should start with EFI_FIRMWARE_IMAGE_AUTHENTICATION,
+  followed by the payload.
+
+  If the return status is RETURN_SUCCESS, the caller may continue the rest
+  FMP update process.
+  If the return status is NOT RETURN_SUCCESS, the caller should stop the FMP
+  update process and convert the return status to LastAttemptStatus
+  to indicate that FMP update fails.
+  The LastAttemptStatus can be got from ESRT table or via
+  EFI_FIRMWARE_MANAGEMENT_PROTOCOL.GetImageInfo().
+
+  Caution: This function may receive untrusted input.
+
+  @param[in]  Image                   Points to an FMP authentication image, started from EFI_FIRMWARE_IMAGE_AUTHENTICATION.
+  @param[in]  ImageSize               Size of the authentication image in bytes.
+  @param[in]  PublicKeyData           The SHA-256 digests of the public keys used to validate the signature.
+  @param[in]  PublicKeyDataLength     The length of the public key data.
+
+  @retval RETURN_SUCCESS            Authentication pass.
+                                    The LastAttemptStatus should be LAST_ATTEMPT_STATUS_SUCCESS.
+  @retval RETURN_SECURITY_VIOLATION Authentication fail.
+                                    The LastAttemptStatus should be LAST_ATTEMPT_STATUS_ERROR_AUTH_ERROR.
+  @retval RETURN_INVALID_PARAMETER  The image is in an invalid format.
+                                    The LastAttemptStatus should be LAST_ATTEMPT_STATUS_ERROR_INVALID_FORMAT.
+  @retval RETURN_UNSUPPORTED        No Authentication handler associated with CertType.
+                                    The LastAttemptStatus should be LAST_ATTEMPT_STATUS_ERROR_INVALID_FORMAT.
+  @retval RETURN_UNSUPPORTED        Image or ImageSize is invalid.
+                                    The LastAttemptStatus should be LAST_ATTEMPT_STATUS_ERROR_INVALID_FORMAT.
+  @retval RETURN_OUT_OF_RESOURCES   No Authentication handler associated with CertType.
+                                    The LastAttemptStatus should be LAST_ATTEMPT_STATUS_ERROR_INSUFFICIENT_RESOURCES.
+**/
+RETURN_STATUS
+EFIAPI
+AuthenticateFmpImage (
+  IN EFI_FIRMWARE_IMAGE_AUTHENTICATION  *Image,
+  IN UINTN                              ImageSize,
+  IN CONST UINT8                        *PublicKeyData,
+  IN UINTN                              PublicKeyDataLength
+  )
+{
+  GUID        *CertType;
+  EFI_STATUS  Status;
+
+  if ((Image == NULL) || (ImageSize == 0)) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  if ((PublicKeyDataLength % SHA256_DIGEST_SIZE) != 0) {
+    DEBUG ((DEBUG_ERROR, "PublicKeyDataLength is not multiple SHA256 size\n"));
+    return RETURN_UNSUPPORTED;
+  }
+
+  if (ImageSize < sizeof (EFI_FIRMWARE_IMAGE_AUTHENTICATION)) {
+    DEBUG ((DEBUG_ERROR, "AuthenticateFmpImage - ImageSize too small\n"));
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if (Image->AuthInfo.Hdr.dwLength <= OFFSET_OF (WIN_CERTIFICATE_UEFI_GUID, CertData)) {
+    DEBUG ((DEBUG_ERROR, "AuthenticateFmpImage - dwLength too small\n"));
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if ((UINTN)Image->AuthInfo.Hdr.dwLength > MAX_UINTN - sizeof (UINT64)) {
+    DEBUG ((DEBUG_ERROR, "AuthenticateFmpImage - dwLength too big\n"));
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if (ImageSize <= sizeof (Image->MonotonicCount) + Image->AuthInfo.Hdr.dwLength) {
+    DEBUG ((DEBUG_ERROR, "AuthenticateFmpImage - ImageSize too small\n"));
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if (Image->AuthInfo.Hdr.wRevision != 0x0200) {
+    DEBUG ((DEBUG_ERROR, "AuthenticateFmpImage - wRevision: 0x%02x, expect - 0x%02x\n", (UINTN)Image->AuthInfo.Hdr.wRevision, (UINTN)0x0200));
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  if (Image->AuthInfo.Hdr.wCertificateType != WIN_CERT_TYPE_EFI_GUID) {
+    DEBUG ((DEBUG_ERROR, "AuthenticateFmpImage - wCertificateType: 0x%02x, expect - 0x%02x\n", (UINTN)Image->AuthInfo.Hdr.wCertificateType, (UINTN)WIN_CERT_TYPE_EFI_GUID));
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  CertType = &Image->AuthInfo.CertType;
+  DEBUG ((DEBUG_INFO, "AuthenticateFmpImage - CertType: %g\n", CertType));
+
+  if (CompareGuid (&gEdkiiCertTypeEcdsaGuid, CertType)) {
+    //
+    // Call the match handler to extract raw data for the input section data.
+    //
+    Status = FmpAuthenticatedHandlerEcdsa (
+               Image,
+               ImageSize,
+               PublicKeyData,
+               PublicKeyDataLength
+               );
+    return Status;
+  }
+
+  //
+  // Not found, the input guided section is not supported.
+  //
+  return RETURN_UNSUPPORTED;
+}
@@ -13,8 +13,11 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/HashLib.h>
+#include <Library/PcdLib.h>
 #include <Protocol/Tcg2Protocol.h>
 
+#include "HashLibBaseCryptoRouterCommon.h"
+
 typedef struct {
   EFI_GUID    Guid;
   UINT32      Mask;
@@ -72,3 +75,61 @@ Tpm2SetHashToDigestList (
     );
   DigestList->count++;
 }
+
+/**
+  Feed the data to all the hash instances enabled by PcdTpm2HashMask.
+
+  When more than one hash instance is enabled, the data is fed one
+  HASH_ROUTER_BLOCK_SIZE block at a time to all of them before moving to the
+  next block, so the data is read from memory once instead of once per hash
+  instance.
+
+  @param HashInterface      Array of registered hash interfaces.
+  @param HashInterfaceCount Number of registered hash interfaces.
+  @param HashCtx            Array of hash contexts, one per hash interface.
+  @param DataToHash         Data to be hashed.
+  @param DataToHashLen      Data size.
+**/
+VOID
+EFIAPI
+HashUpdateAllInterfaces (
+  IN HASH_INTERFACE  *HashInterface,
+  IN UINTN           HashInterfaceCount,
+  IN HASH_HANDLE     *HashCtx,
+  IN VOID            *DataToHash,
+  IN UINTN           DataToHashLen
+  )
+{
+  UINTN   ActiveIndex[HASH_COUNT];
+  UINTN   ActiveCount;
+  UINTN   Index;
+  UINT32  Tpm2HashMask;
+  UINT8   *Data;
+  UINTN   BlockSize;
+
+  ASSERT (HashInterfaceCount <= HASH_COUNT);
+
+  Tpm2HashMask = PcdGet32 (PcdTpm2HashMask);
+  ActiveCount  = 0;
+  for (Index = 0; Index < HashInterfaceCount; Index++) {
+    if ((Tpm2GetHashMaskFromAlgo (&HashInterface[Index].HashGuid) & Tpm2HashMask) != 0) {
+      ActiveIndex[ActiveCount++] = Index;
+    }
+  }
+
+  if (ActiveCount == 1) {
+    HashInterface[ActiveIndex[0]].HashUpdate (HashCtx[ActiveIndex[0]], DataToHash, DataToHashLen);
+    return;
+  }
+
+  Data = DataToHash;
+  while (DataToHashLen != 0) {
+    BlockSize = MIN (DataToHashLen, HASH_ROUTER_BLOCK_SIZE);
+    for (Index = 0; Index < ActiveCount; Index++) {
+      HashInterface[ActiveIndex[Index]].HashUpdate (HashCtx[ActiveIndex[Index]], Data, BlockSize);
+    }
+
+    Data          += BlockSize;
+    DataToHashLen -= BlockSize;
+  }
+}
@@ -9,6 +9,13 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #ifndef _HASH_LIB_BASE_CRYPTO_ROUTER_COMMON_H_
 #define _HASH_LIB_BASE_CRYPTO_ROUTER_COMMON_H_
 
+//
+// Size of the blocks fed to every active hash instance in turn. It is small
+// enough that a block stays in the L1 data cache, together with the hash
+// contexts, while all the hash instances consume it.
+//
+#define HASH_ROUTER_BLOCK_SIZE  SIZE_16KB
+
 /**
   The function get hash mask info from algorithm.
 
@@ -35,4 +42,28 @@ Tpm2SetHashToDigestList (
   IN TPML_DIGEST_VALUES      *Digest
   );
 
+/**
+  Feed the data to all the hash instances enabled by PcdTpm2HashMask.
+
+  When more than one hash instance is enabled, the data is fed one
+  HASH_ROUTER_BLOCK_SIZE block at a time to all of them before moving to the
+  next block, so the data is read from memory once instead of once per hash
+  instance.
+
+  @param HashInterface      Array of registered hash interfaces.
+  @param HashInterfaceCount Number of registered hash interfaces.
+  @param HashCtx            Array of hash contexts, one per hash interface.
+  @param DataToHash         Data to be hashed.
+  @param DataToHashLen      Data size.
+**/
+VOID
+EFIAPI
+HashUpdateAllInterfaces (
+  IN HASH_INTERFACE  *HashInterface,
+  IN UINTN           HashInterfaceCount,
+  IN HASH_HANDLE     *HashCtx,
+  IN VOID            *DataToHash,
+  IN UINTN           DataToHashLen
+  );
+
 #endif
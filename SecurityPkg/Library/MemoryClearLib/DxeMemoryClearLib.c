@@ -0,0 +1,206 @@
+/** @file
+  Memory clear library instance for DXE drivers.
+
+  The APs are started through the MP services protocol, in blocking mode, and
+  the progress is displayed by the DisplayUpdateProgressLib between two
+  rounds.
+
+  The free memory is the conventional memory of the UEFI memory map, that is
+  the free part of the system memory of the GCD memory space map. It is
+  allocated before being cleared, so that neither an allocation nor an event
+  can use it meanwhile, and freed afterwards.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "MemoryClearLibInternal.h"
+
+#include <Protocol/MpService.h>
+#include <Library/DisplayUpdateProgressLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+//
+// Number of times the memory map is read to take the free memory. Taking a
+// free range may allocate memory for the memory map itself, which the next
+// pass takes in turn.
+//
+#define MEMORY_CLEAR_CLAIM_PASSES  4
+
+//
+// Number of descriptors added to the memory map buffer, for the descriptors
+// created while the free memory is taken.
+//
+#define MEMORY_CLEAR_MAP_SLACK  64
+
+/**
+  Run InternalMemoryClearWorker() on the APs and wait for them.
+
+  The caller runs InternalMemoryClearWorker() once more when this function
+  returns, so the chunks left if the APs could not be started are cleared by
+  the calling processor.
+
+  @param[in]  Context   The clearing context.
+
+**/
+VOID
+InternalMemoryClearStartWorkers (
+  IN MEMORY_CLEAR_CONTEXT  *Context
+  )
+{
+  EFI_STATUS                Status;
+  EFI_MP_SERVICES_PROTOCOL  *MpServices;
+
+  Status = gBS->LocateProtocol (&gEfiMpServiceProtocolGuid, NULL, (VOID **)&MpServices);
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  Status = MpServices->StartupAllAPs (
+                         MpServices,
+                         InternalMemoryClearWorker,
+                         FALSE,
+                         NULL,
+                         0,
+                         Context,
+                         NULL
+                         );
+  if (EFI_ERROR (Status) && (Status != EFI_NOT_STARTED)) {
+    DEBUG ((DEBUG_WARN, "MemoryClear: StartupAllAPs - %r\n", Status));
+  }
+}
+
+/**
+  Display the progress of the clearing.
+
+  @param[in]  Completion  Percentage of the memory cleared, from 0 to 100.
+
+**/
+VOID
+InternalMemoryClearDisplayProgress (
+  IN UINTN  Completion
+  )
+{
+  DisplayUpdateProgress (Completion, NULL);
+}
+
+/**
+  Clear the system memory that the firmware does not use.
+
+  The cleared memory is the free system memory in the GCD memory space map,
+  which is allocated for the duration of the clearing so that no other agent
+  uses it meanwhile.
+
+  Only the memory addressable by the processor is cleared, and the first page
+  is skipped, as it may be unmapped to detect NULL pointer accesses.
+
+  @retval EFI_SUCCESS             The memory was cleared.
+  @retval EFI_OUT_OF_RESOURCES    There is not enough memory to list the
+                                  ranges. Nothing was cleared.
+  @retval Others                  The memory map could not be read. Nothing
+                                  was cleared.
+
+**/
+EFI_STATUS
+EFIAPI
+MemoryClearFreeMemory (
+  VOID
+  )
+{
+  EFI_STATUS             Status;
+  EFI_MEMORY_DESCRIPTOR  *MemoryMap;
+  EFI_MEMORY_DESCRIPTOR  *Entry;
+  UINTN                  MapBufferSize;
+  UINTN                  MapSize;
+  UINTN                  MapKey;
+  UINTN                  DescriptorSize;
+  UINT32                 DescriptorVersion;
+  MEMORY_CLEAR_RANGE     *Ranges;
+  UINT64                 *Offsets;
+  UINTN                  RangeCount;
+  UINTN                  Capacity;
+  UINTN                  Count;
+  UINTN                  Pass;
+  UINTN                  Index;
+  EFI_PHYSICAL_ADDRESS   Base;
+  UINT64                 End;
+
+  //
+  // The display allocates its buffers when it is reset, which must happen
+  // before the free memory is taken.
+  //
+  InternalMemoryClearDisplayProgress (0);
+
+  MapSize = 0;
+  Status  = gBS->GetMemoryMap (&MapSize, NULL, &MapKey, &DescriptorSize, &DescriptorVersion);
+  if (Status != EFI_BUFFER_TOO_SMALL) {
+    return EFI_ERROR (Status) ? Status : EFI_NOT_FOUND;
+  }
+
+  //
+  // All the buffers are allocated at once, as no memory is left to allocate
+  // once the free memory is taken.
+  //
+  MapBufferSize = 2 * MapSize + MEMORY_CLEAR_MAP_SLACK * DescriptorSize;
+  Capacity      = MEMORY_CLEAR_CLAIM_PASSES * (MapBufferSize / DescriptorSize);
+  MemoryMap     = AllocatePool (MapBufferSize + Capacity * (sizeof (MEMORY_CLEAR_RANGE) + sizeof (UINT64)));
+  if (MemoryMap == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Ranges  = (MEMORY_CLEAR_RANGE *)((UINT8 *)MemoryMap + MapBufferSize);
+  Offsets = (UINT64 *)(Ranges + Capacity);
+
+  RangeCount = 0;
+  for (Pass = 0; Pass < MEMORY_CLEAR_CLAIM_PASSES; Pass++) {
+    MapSize = MapBufferSize;
+    Status  = gBS->GetMemoryMap (&MapSize, MemoryMap, &MapKey, &DescriptorSize, &DescriptorVersion);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    Count = RangeCount;
+    for (Entry = MemoryMap;
+         ((UINT8 *)Entry < (UINT8 *)MemoryMap + MapSize) && (RangeCount < Capacity);
+         Entry = (EFI_MEMORY_DESCRIPTOR *)((UINT8 *)Entry + DescriptorSize))
+    {
+      if ((Entry->Type != EfiConventionalMemory) || (Entry->NumberOfPages == 0)) {
+        continue;
+      }
+
+      Base = MAX (Entry->PhysicalStart, EFI_PAGE_SIZE);
+      End  = Entry->PhysicalStart + EFI_PAGES_TO_SIZE (Entry->NumberOfPages);
+      if (End - 1 > MAX_ADDRESS) {
+        End = (UINT64)MAX_ADDRESS + 1;
+      }
+
+      if (Base >= End) {
+        continue;
+      }
+
+      //
+      // The range may have been taken by the memory map since it was read.
+      // What is left of it is taken by the next pass.
+      //
+      Status = gBS->AllocatePages (AllocateAddress, EfiBootServicesData, (UINTN)EFI_SIZE_TO_PAGES (End - Base), &Base);
+      if (!EFI_ERROR (Status)) {
+        Ranges[RangeCount].BaseAddress = Base;
+        Ranges[RangeCount].Length      = End - Base;
+        RangeCount++;
+      }
+    }
+
+    if (RangeCount == Count) {
+      break;
+    }
+  }
+
+  InternalMemoryClearRanges (Ranges, RangeCount, Offsets);
+
+  for (Index = 0; Index < RangeCount; Index++) {
+    gBS->FreePages (Ranges[Index].BaseAddress, (UINTN)EFI_SIZE_TO_PAGES (Ranges[Index].Length));
+  }
+
+  FreePool (MemoryMap);
+  return EFI_SUCCESS;
+}
@@ -0,0 +1,257 @@
+/** @file
+  Parallel clearing of memory ranges, common to all phases.
+
+  The ranges are laid end to end and cleared in MEMORY_CLEAR_ROUND_COUNT
+  rounds. In each round, the APs take the MEMORY_CLEAR_CHUNK_SIZE chunks of
+  the round in turn and clear them with ZeroMem(). Between two rounds, the
+  BSP reports the progress.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "MemoryClearLibInternal.h"
+
+/**
+  Clear a span of the ranges laid end to end.
+
+  @param[in]  Context   The clearing context.
+  @param[in]  Start     Offset of the first byte of the span.
+  @param[in]  End       Offset following the last byte of the span.
+
+**/
+STATIC
+VOID
+InternalClearSpan (
+  IN MEMORY_CLEAR_CONTEXT  *Context,
+  IN UINT64                Start,
+  IN UINT64                End
+  )
+{
+  UINTN   Low;
+  UINTN   High;
+  UINTN   Middle;
+  UINTN   Index;
+  UINT64  RangeEnd;
+  UINT64  Size;
+
+  //
+  // Look for the last range starting at or before Start.
+  //
+  Low  = 0;
+  High = Context->RangeCount - 1;
+  while (Low < High) {
+    Middle = (Low + High + 1) / 2;
+    if (Context->Offsets[Middle] <= Start) {
+      Low = Middle;
+    } else {
+      High = Middle - 1;
+    }
+  }
+
+  for (Index = Low; Index < Context->RangeCount && Start < End; Index++) {
+    RangeEnd = Context->Offsets[Index] + Context->Ranges[Index].Length;
+    if (Start >= RangeEnd) {
+      continue;
+    }
+
+    Size = MIN (End, RangeEnd) - Start;
+    ZeroMem (
+      (VOID *)(UINTN)(Context->Ranges[Index].BaseAddress + (Start - Context->Offsets[Index])),
+      (UINTN)Size
+      );
+    Start += Size;
+  }
+}
+
+/**
+  Clear the chunks of the current round until none is left.
+
+  This function runs on every AP. The processors take the chunks in turn.
+
+  @param[in, out]  Buffer   Pointer to the MEMORY_CLEAR_CONTEXT.
+
+**/
+VOID
+EFIAPI
+InternalMemoryClearWorker (
+  IN OUT VOID  *Buffer
+  )
+{
+  MEMORY_CLEAR_CONTEXT  *Context;
+  UINT32                Chunk;
+  UINT64                Start;
+
+  Context = (MEMORY_CLEAR_CONTEXT *)Buffer;
+  while (TRUE) {
+    Chunk = InterlockedIncrement (&Context->NextChunk) - 1;
+    if (Chunk >= Context->RoundChunkCount) {
+      break;
+    }
+
+    Start = Context->RoundStart + MultU64x32 (MEMORY_CLEAR_CHUNK_SIZE, Chunk);
+    InternalClearSpan (Context, Start, MIN (Start + MEMORY_CLEAR_CHUNK_SIZE, Context->RoundEnd));
+  }
+}
+
+/**
+  Return the address of a byte of the ranges laid end to end.
+
+  @param[in]  Context   The clearing context.
+  @param[in]  Offset    Offset of the byte.
+
+  @return The address of the byte.
+
+**/
+STATIC
+EFI_PHYSICAL_ADDRESS
+InternalOffsetToAddress (
+  IN MEMORY_CLEAR_CONTEXT  *Context,
+  IN UINT64                Offset
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Context->RangeCount; Index++) {
+    if (Offset < Context->Offsets[Index] + Context->Ranges[Index].Length) {
+      return Context->Ranges[Index].BaseAddress + (Offset - Context->Offsets[Index]);
+    }
+  }
+
+  return 0;
+}
+
+/**
+  Clear ranges of memory, with the offsets array allocated by the caller.
+
+  @param[in]  Ranges      The ranges to clear.
+  @param[in]  RangeCount  Number of ranges.
+  @param[in]  Offsets     Array of RangeCount entries used to split the ranges.
+
+**/
+VOID
+InternalMemoryClearRanges (
+  IN CONST MEMORY_CLEAR_RANGE  *Ranges,
+  IN UINTN                     RangeCount,
+  IN UINT64                    *Offsets
+  )
+{
+  MEMORY_CLEAR_CONTEXT            Context;
+  EFI_MEMORY_RANGE_EXTENDED_DATA  RangeData;
+  UINT64                          Total;
+  UINT64                          RoundSize;
+  UINTN                           Index;
+
+  Total = 0;
+  for (Index = 0; Index < RangeCount; Index++) {
+    Offsets[Index] = Total;
+    Total         += Ranges[Index].Length;
+  }
+
+  if (Total == 0) {
+    return;
+  }
+
+  DEBUG ((DEBUG_INFO, "MemoryClear: Clearing 0x%lx bytes in %Lu ranges\n", Total, (UINT64)RangeCount));
+
+  Context.Ranges     = Ranges;
+  Context.RangeCount = RangeCount;
+  Context.Offsets    = Offsets;
+
+  //
+  // Every round but the last one is a whole number of chunks.
+  //
+  RoundSize = DivU64x32 (Total, MEMORY_CLEAR_ROUND_COUNT);
+  RoundSize = MultU64x32 (DivU64x32 (RoundSize, MEMORY_CLEAR_CHUNK_SIZE) + 1, MEMORY_CLEAR_CHUNK_SIZE);
+
+  ZeroMem (&RangeData, sizeof (RangeData));
+  RangeData.DataHeader.HeaderSize = (UINT16)sizeof (EFI_STATUS_CODE_DATA);
+  RangeData.DataHeader.Size       = (UINT16)(sizeof (EFI_MEMORY_RANGE_EXTENDED_DATA) - sizeof (EFI_STATUS_CODE_DATA));
+
+  for (Context.RoundStart = 0; Context.RoundStart < Total; Context.RoundStart = Context.RoundEnd) {
+    Context.RoundEnd        = MIN (Context.RoundStart + RoundSize, Total);
+    Context.RoundChunkCount = (UINT32)DivU64x32 (Context.RoundEnd - Context.RoundStart + MEMORY_CLEAR_CHUNK_SIZE - 1, MEMORY_CLEAR_CHUNK_SIZE);
+    Context.NextChunk       = 0;
+
+    //
+    // The range data gives the address of the first byte of the round and the
+    // number of bytes of the round, which may span several ranges.
+    //
+    RangeData.Start  = InternalOffsetToAddress (&Context, Context.RoundStart);
+    RangeData.Length = Context.RoundEnd - Context.RoundStart;
+    REPORT_STATUS_CODE_EX (
+      EFI_PROGRESS_CODE,
+      EFI_COMPUTING_UNIT_MEMORY | EFI_CU_MEMORY_PC_INIT,
+      0,
+      &gEfiMemoryOverwriteControlDataGuid,
+      NULL,
+      (UINT8 *)&RangeData + sizeof (EFI_STATUS_CODE_DATA),
+      RangeData.DataHeader.Size
+      );
+
+    InternalMemoryClearStartWorkers (&Context);
+    InternalMemoryClearWorker (&Context);
+
+    InternalMemoryClearDisplayProgress ((UINTN)DivU64x64Remainder (MultU64x32 (Context.RoundEnd, 100), Total, NULL));
+  }
+
+  DEBUG ((DEBUG_INFO, "MemoryClear: Done\n"));
+}
+
+/**
+  Clear ranges of memory.
+
+  The ranges must not be used by the firmware until the function returns.
+
+  @param[in]  Ranges      The ranges to clear.
+  @param[in]  RangeCount  Number of ranges.
+
+  @retval EFI_SUCCESS             The ranges were cleared.
+  @retval EFI_INVALID_PARAMETER   Ranges is NULL and RangeCount is not 0.
+  @retval EFI_INVALID_PARAMETER   A range is not addressable by the processor.
+  @retval EFI_OUT_OF_RESOURCES    There is not enough memory to split the
+                                  ranges. Nothing was cleared.
+
+**/
+EFI_STATUS
+EFIAPI
+MemoryClearRanges (
+  IN CONST MEMORY_CLEAR_RANGE  *Ranges,
+  IN UINTN                     RangeCount
+  )
+{
+  UINT64  *Offsets;
+  UINTN   Index;
+
+  if ((Ranges == NULL) && (RangeCount != 0)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // ZeroMem() does not take the NULL address.
+  //
+  for (Index = 0; Index < RangeCount; Index++) {
+    if ((Ranges[Index].Length != 0) &&
+        ((Ranges[Index].BaseAddress == 0) ||
+         (Ranges[Index].BaseAddress > MAX_ADDRESS) ||
+         (Ranges[Index].Length - 1 > MAX_ADDRESS - Ranges[Index].BaseAddress)))
+    {
+      return EFI_INVALID_PARAMETER;
+    }
+  }
+
+  if (RangeCount == 0) {
+    return EFI_SUCCESS;
+  }
+
+  Offsets = AllocatePool (RangeCount * sizeof (UINT64));
+  if (Offsets == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  InternalMemoryClearDisplayProgress (0);
+  InternalMemoryClearRanges (Ranges, RangeCount, Offsets);
+
+  FreePool (Offsets);
+  return EFI_SUCCESS;
+}
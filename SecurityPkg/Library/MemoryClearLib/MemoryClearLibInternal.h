@@ -0,0 +1,107 @@
+/** @file
+  Internal definitions of the memory clear library.
+
+  MemoryClearLib.c splits the ranges into chunks and reports the progress.
+  Each instance provides the way to run the chunks on the APs, the list of
+  the free memory of its phase, and an optional progress display.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef MEMORY_CLEAR_LIB_INTERNAL_H_
+#define MEMORY_CLEAR_LIB_INTERNAL_H_
+
+#include <PiPei.h>
+#include <Guid/MemoryOverwriteControl.h>
+#include <Guid/StatusCodeDataTypeId.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/ReportStatusCodeLib.h>
+#include <Library/SynchronizationLib.h>
+#include <Library/MemoryClearLib.h>
+
+//
+// Size of the pieces that the processors take in turn. Large enough to keep
+// the cost of taking a chunk negligible, small enough to balance the load of
+// the last chunks of a round.
+//
+#define MEMORY_CLEAR_CHUNK_SIZE  SIZE_2MB
+
+//
+// Number of rounds of the clearing. The progress is reported between two
+// rounds, since the APs cannot report it.
+//
+#define MEMORY_CLEAR_ROUND_COUNT  100
+
+typedef struct {
+  CONST MEMORY_CLEAR_RANGE    *Ranges;
+  UINTN                       RangeCount;
+  //
+  // Offset of each range when the ranges are laid end to end.
+  //
+  UINT64                      *Offsets;
+  UINT64                      RoundStart;
+  UINT64                      RoundEnd;
+  UINT32                      RoundChunkCount;
+  volatile UINT32             NextChunk;
+} MEMORY_CLEAR_CONTEXT;
+
+/**
+  Clear the chunks of the current round until none is left.
+
+  This function runs on every AP. The processors take the chunks in turn.
+
+  @param[in, out]  Buffer   Pointer to the MEMORY_CLEAR_CONTEXT.
+
+**/
+VOID
+EFIAPI
+InternalMemoryClearWorker (
+  IN OUT VOID  *Buffer
+  );
+
+/**
+  Run InternalMemoryClearWorker() on the APs and wait for them.
+
+  The caller runs InternalMemoryClearWorker() once more when this function
+  returns, so the chunks left if the APs could not be started are cleared by
+  the calling processor.
+
+  @param[in]  Context   The clearing context.
+
+**/
+VOID
+InternalMemoryClearStartWorkers (
+  IN MEMORY_CLEAR_CONTEXT  *Context
+  );
+
+/**
+  Display the progress of the clearing.
+
+  @param[in]  Completion  Percentage of the memory cleared, from 0 to 100.
+
+**/
+VOID
+InternalMemoryClearDisplayProgress (
+  IN UINTN  Completion
+  );
+
+/**
+  Clear ranges of memory, with the offsets array allocated by the caller.
+
+  @param[in]  Ranges      The ranges to clear.
+  @param[in]  RangeCount  Number of ranges.
+  @param[in]  Offsets     Array of RangeCount entries used to split the ranges.
+
+**/
+VOID
+InternalMemoryClearRanges (
+  IN CONST MEMORY_CLEAR_RANGE  *Ranges,
+  IN UINTN                     RangeCount,
+  IN UINT64                    *Offsets
+  );
+
+#endif
@@ -0,0 +1,230 @@
+/** @file
+  Memory clear library instance for PEIMs.
+
+  The APs are started through the PEI MP services PPI, installed by CpuMpPei.
+  The PEI MP services only run the APs in blocking mode, so the BSP waits for
+  the end of each round before reporting the progress.
+
+  The free memory is the system memory of the resource descriptor HOBs, less
+  the PEI memory, the memory allocation HOBs and the firmware volume HOBs. The
+  memory below 1 MB is skipped: the PEI MP services back up the memory of
+  their wake up buffer there and restore it after running the APs. It is left
+  to the DXE instance, along with the PEI memory.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "MemoryClearLibInternal.h"
+
+#include <Ppi/MpServices.h>
+#include <Library/HobLib.h>
+#include <Library/PeiServicesLib.h>
+#include <Library/PeiServicesTablePointerLib.h>
+
+/**
+  Run InternalMemoryClearWorker() on the APs and wait for them.
+
+  The caller runs InternalMemoryClearWorker() once more when this function
+  returns, so the chunks left if the APs could not be started are cleared by
+  the calling processor.
+
+  @param[in]  Context   The clearing context.
+
+**/
+VOID
+InternalMemoryClearStartWorkers (
+  IN MEMORY_CLEAR_CONTEXT  *Context
+  )
+{
+  EFI_STATUS               Status;
+  EFI_PEI_MP_SERVICES_PPI  *MpServices;
+
+  Status = PeiServicesLocatePpi (&gEfiPeiMpServicesPpiGuid, 0, NULL, (VOID **)&MpServices);
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  Status = MpServices->StartupAllAPs (
+                         GetPeiServicesTablePointer (),
+                         MpServices,
+                         InternalMemoryClearWorker,
+                         FALSE,
+                         0,
+                         Context
+                         );
+  if (EFI_ERROR (Status) && (Status != EFI_NOT_STARTED)) {
+    DEBUG ((DEBUG_WARN, "MemoryClear: StartupAllAPs - %r\n", Status));
+  }
+}
+
+/**
+  Display the progress of the clearing.
+
+  PEI has no display, the progress is only reported by status codes.
+
+  @param[in]  Completion  Percentage of the memory cleared, from 0 to 100.
+
+**/
+VOID
+InternalMemoryClearDisplayProgress (
+  IN UINTN  Completion
+  )
+{
+}
+
+/**
+  Remove a range of memory from a list of ranges.
+
+  A range containing the removed range is split in two, the upper part being
+  appended to the list. The ranges that become empty are left in the list.
+
+  @param[in, out]  Ranges       The list of disjoint ranges.
+  @param[in, out]  RangeCount   Number of ranges of the list.
+  @param[in]       Capacity     Number of entries of the list.
+  @param[in]       Base         Base address of the removed range.
+  @param[in]       Length       Length of the removed range.
+
+**/
+STATIC
+VOID
+InternalRemoveRange (
+  IN OUT MEMORY_CLEAR_RANGE  *Ranges,
+  IN OUT UINTN               *RangeCount,
+  IN     UINTN               Capacity,
+  IN     UINT64              Base,
+  IN     UINT64              Length
+  )
+{
+  UINTN   Index;
+  UINTN   Count;
+  UINT64  End;
+  UINT64  RangeEnd;
+
+  End   = Base + Length;
+  Count = *RangeCount;
+  for (Index = 0; Index < Count; Index++) {
+    RangeEnd = Ranges[Index].BaseAddress + Ranges[Index].Length;
+    if ((Length == 0) || (Base >= RangeEnd) || (End <= Ranges[Index].BaseAddress)) {
+      continue;
+    }
+
+    if ((End < RangeEnd) && (Base > Ranges[Index].BaseAddress)) {
+      ASSERT (*RangeCount < Capacity);
+      Ranges[*RangeCount].BaseAddress = End;
+      Ranges[*RangeCount].Length      = RangeEnd - End;
+      (*RangeCount)++;
+    } else if (End < RangeEnd) {
+      Ranges[Index].BaseAddress = End;
+      Ranges[Index].Length      = RangeEnd - End;
+      continue;
+    }
+
+    Ranges[Index].Length = MAX (Base, Ranges[Index].BaseAddress) - Ranges[Index].BaseAddress;
+  }
+}
+
+/**
+  Clear the system memory that the firmware does not use.
+
+  In PEI, the cleared memory is the system memory described by the resource
+  descriptor HOBs above 1 MB, except the memory allocated by HOBs and the PEI
+  memory. In DXE, it is the free system memory in the GCD memory space map,
+  which is allocated for the duration of the clearing so that no other agent
+  uses it meanwhile.
+
+  Only the memory addressable by the processor is cleared, and the first page
+  is skipped, as it may be unmapped to detect NULL pointer accesses.
+
+  @retval EFI_SUCCESS             The memory was cleared.
+  @retval EFI_OUT_OF_RESOURCES    There is not enough memory to list the
+                                  ranges. Nothing was cleared.
+  @retval Others                  The memory map could not be read. Nothing
+                                  was cleared.
+
+**/
+EFI_STATUS
+EFIAPI
+MemoryClearFreeMemory (
+  VOID
+  )
+{
+  EFI_PEI_HOB_POINTERS        Hob;
+  EFI_HOB_HANDOFF_INFO_TABLE  *Phit;
+  MEMORY_CLEAR_RANGE          *Ranges;
+  UINTN                       RangeCount;
+  UINTN                       Capacity;
+  UINTN                       Index;
+  UINTN                       Count;
+  UINT64                      Base;
+  UINT64                      End;
+  EFI_STATUS                  Status;
+
+  //
+  // Every resource HOB gives a range, and every other HOB splits at most one
+  // range in two.
+  //
+  Capacity = 0;
+  for (Hob.Raw = GetHobList (); !END_OF_HOB_LIST (Hob); Hob.Raw = GET_NEXT_HOB (Hob)) {
+    Capacity++;
+  }
+
+  Ranges = AllocatePool (Capacity * sizeof (MEMORY_CLEAR_RANGE));
+  if (Ranges == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  RangeCount = 0;
+  for (Hob.Raw = GetHobList (); !END_OF_HOB_LIST (Hob); Hob.Raw = GET_NEXT_HOB (Hob)) {
+    if ((GET_HOB_TYPE (Hob) != EFI_HOB_TYPE_RESOURCE_DESCRIPTOR) ||
+        (Hob.ResourceDescriptor->ResourceType != EFI_RESOURCE_SYSTEM_MEMORY) ||
+        (Hob.ResourceDescriptor->ResourceLength == 0))
+    {
+      continue;
+    }
+
+    Base = MAX (Hob.ResourceDescriptor->PhysicalStart, BASE_1MB);
+    End  = Hob.ResourceDescriptor->PhysicalStart + Hob.ResourceDescriptor->ResourceLength;
+    if (End - 1 > MAX_ADDRESS) {
+      End = (UINT64)MAX_ADDRESS + 1;
+    }
+
+    if (Base < End) {
+      Ranges[RangeCount].BaseAddress = Base;
+      Ranges[RangeCount].Length      = End - Base;
+      RangeCount++;
+    }
+  }
+
+  Phit = GetHobList ();
+  InternalRemoveRange (Ranges, &RangeCount, Capacity, Phit->EfiMemoryBottom, Phit->EfiMemoryTop - Phit->EfiMemoryBottom);
+
+  for (Hob.Raw = GetHobList (); !END_OF_HOB_LIST (Hob); Hob.Raw = GET_NEXT_HOB (Hob)) {
+    if (GET_HOB_TYPE (Hob) == EFI_HOB_TYPE_MEMORY_ALLOCATION) {
+      InternalRemoveRange (
+        Ranges,
+        &RangeCount,
+        Capacity,
+        Hob.MemoryAllocation->AllocDescriptor.MemoryBaseAddress,
+        Hob.MemoryAllocation->AllocDescriptor.MemoryLength
+        );
+    } else if (GET_HOB_TYPE (Hob) == EFI_HOB_TYPE_FV) {
+      InternalRemoveRange (Ranges, &RangeCount, Capacity, Hob.FirmwareVolume->BaseAddress, Hob.FirmwareVolume->Length);
+    }
+  }
+
+  //
+  // Drop the ranges which became empty.
+  //
+  Count = 0;
+  for (Index = 0; Index < RangeCount; Index++) {
+    if (Ranges[Index].Length != 0) {
+      CopyMem (&Ranges[Count++], &Ranges[Index], sizeof (MEMORY_CLEAR_RANGE));
+    }
+  }
+
+  Status = MemoryClearRanges (Ranges, Count);
+
+  FreePool (Ranges);
+  return Status;
+}
@@ -0,0 +1,44 @@
+/** @file
+  NULL MemoryClearLib instance for the platforms that clear the memory
+  themselves.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/MemoryClearLib.h>
+
+/**
+  Clear ranges of memory.
+
+  @param[in]  Ranges      The ranges to clear.
+  @param[in]  RangeCount  Number of ranges.
+
+  @retval EFI_UNSUPPORTED         Nothing was cleared.
+
+**/
+EFI_STATUS
+EFIAPI
+MemoryClearRanges (
+  IN CONST MEMORY_CLEAR_RANGE  *Ranges,
+  IN UINTN                     RangeCount
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  Clear the system memory that the firmware does not use.
+
+  @retval EFI_UNSUPPORTED         Nothing was cleared.
+
+**/
+EFI_STATUS
+EFIAPI
+MemoryClearFreeMemory (
+  VOID
+  )
+{
+  return EFI_UNSUPPORTED;
+}
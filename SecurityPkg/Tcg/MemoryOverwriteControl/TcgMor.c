@@ -2,7 +2,8 @@
   TCG MOR (Memory Overwrite Request) Control Driver.
 
   This driver initialize MemoryOverwriteRequestControl variable. It
-  will clear MOR_CLEAR_MEMORY_BIT bit if it is set. It will also do TPer Reset for
+  will clear MOR_CLEAR_MEMORY_BIT bit if it is set, after clearing the free memory
+  when PcdMorClearFreeMemory is TRUE. It will also do TPer Reset for
   those encrypted drives through EFI_STORAGE_SECURITY_COMMAND_PROTOCOL at EndOfDxe.
 
 Copyright (c) 2009 - 2018, Intel Corporation. All rights reserved.<BR>
@@ -38,6 +39,20 @@ OnReadyToBoot (
     return;
   }
 
+  if (PcdGetBool (PcdMorClearFreeMemory)) {
+    DEBUG ((DEBUG_INFO, "TcgMor: Clear free memory\n"));
+    Status = MemoryClearFreeMemory ();
+    if (EFI_ERROR (Status) && (Status != EFI_UNSUPPORTED)) {
+      //
+      // Keep MOR_CLEAR_MEMORY_BIT, so that the memory is cleared at the next boot.
+      // EFI_UNSUPPORTED comes from MemoryClearLibNull, which leaves the clearing
+      // to the platform.
+      //
+      DEBUG ((DEBUG_ERROR, "TcgMor: Clear free memory failure, Status = %r\n", Status));
+      return;
+    }
+  }
+
   //
   // Clear MOR_CLEAR_MEMORY_BIT
   //
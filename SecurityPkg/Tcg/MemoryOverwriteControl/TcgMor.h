@@ -19,6 +19,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/DebugLib.h>
 #include <Library/UefiLib.h>
 #include <Library/MemoryAllocationLib.h>
+#include <Library/MemoryClearLib.h>
+#include <Library/PcdLib.h>
 
 #include <Protocol/StorageSecurityCommand.h>
 #include <Protocol/BlockIo.h>
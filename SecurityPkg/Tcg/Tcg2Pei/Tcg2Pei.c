@@ -23,6 +23,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Guid/MeasuredFvHob.h>
 #include <Guid/TpmInstance.h>
 #include <Guid/MigratedFvInfo.h>
+#include <Guid/ExtendedFirmwarePerformance.h>
 
 #include <Library/DebugLib.h>
 #include <Library/BaseMemoryLib.h>
@@ -41,7 +42,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/ResetSystemLib.h>
 #include <Library/PrintLib.h>
 
-#define PERF_ID_TCG2_PEI  0x3080
+#define PERF_ID_TCG2_PEI     0x3080
+#define PERF_ID_TCG2_PEI_FV  0x3090
 
 typedef struct {
   EFI_GUID                     *EventGuid;
@@ -626,6 +628,7 @@ MeasureFvImage (
   EFI_PHYSICAL_ADDRESS                                   FvDataBase;
   EFI_PEI_HOB_POINTERS                                   Hob;
   EDKII_MIGRATED_FV_INFO                                 *MigratedFvInfo;
+  CHAR8                                                  Token[FPDT_STRING_EVENT_RECORD_NAME_LENGTH];
 
   //
   // Check Excluded FV list
@@ -761,6 +764,13 @@ MeasureFvImage (
     EventData             = &FvBlob;
   }
 
+  //
+  // Record the time spent on each FV, which is far shorter for the FVs
+  // pre-hashed by FvReportPei.
+  //
+  AsciiSPrint (Token, sizeof (Token), "FvMeasure:%08lX", FvBase);
+  PERF_START_EX (mFileHandle, Token, "Tcg2Pei", 0, PERF_ID_TCG2_PEI_FV);
+
   if (Tpm2HashMask == 0) {
     //
     // FV pre-hash algos comply with current TPM hash requirement
@@ -792,6 +802,8 @@ MeasureFvImage (
     DEBUG ((DEBUG_INFO, "The FV which is measured by Tcg2Pei has the size: 0x%x\n", FvLength));
   }
 
+  PERF_END_EX (mFileHandle, Token, "Tcg2Pei", 0, PERF_ID_TCG2_PEI_FV + 1);
+
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "The FV which failed to be measured starts at: 0x%x\n", FvBase));
     return Status;
@@ -253,6 +253,18 @@ SetDataSelectors (
   UINT16  Selector
   );
 
+/**
+  Invalidates the TLB entries of the page containing an address (INVLPG).
+
+  @param  Address  The address within the page.
+
+**/
+VOID
+EFIAPI
+InvalidatePage (
+  IN UINTN  Address
+  );
+
 /**
   Update GCD memory space attributes according to current page table setup.
 **/
@@ -57,6 +57,8 @@
 #define PAGING_1G_ADDRESS_MASK_64  0x000FFFFFC0000000ull
 
 #define MAX_PF_ENTRY_COUNT        10
+#define MAX_INVALIDATE_PAGE_COUNT  16
+#define MAX_FREE_PAGE_TABLE_COUNT  64
 #define MAX_DEBUG_MESSAGE_LENGTH  0x100
 #define IA32_PF_EC_ID             BIT4
 
@@ -79,6 +81,15 @@ typedef enum {
   PageActionClear,
 } PAGE_ACTION;
 
+typedef struct {
+  UINTN    PoolPages;      // Pages added to the page table pools
+  UINTN    UsedPages;      // Pool pages holding page tables
+  UINTN    FreePages;      // Pool pages of merged page tables, kept for reuse
+  UINTN    SplitCount;     // Page entries split into smaller pages
+  UINTN    Merge2MCount;   // 4K page tables merged into 2M pages
+  UINTN    Merge1GCount;   // 2M page tables merged into 1G pages
+} PAGE_TABLE_STATISTICS;
+
 PAGE_ATTRIBUTE_TABLE  mPageAttributeTable[] = {
   { Page4K, SIZE_4KB, PAGING_4K_ADDRESS_MASK_64 },
   { Page2M, SIZE_2MB, PAGING_2M_ADDRESS_MASK_64 },
@@ -89,6 +100,17 @@ PAGE_TABLE_POOL                *mPageTablePool    = NULL;
 BOOLEAN                        mPageTablePoolLock = FALSE;
 PAGE_TABLE_LIB_PAGING_CONTEXT  mPagingContext;
 EFI_SMM_BASE2_PROTOCOL         *mSmmBase2 = NULL;
+PAGE_TABLE_STATISTICS          mPageTableStatistics;
+
+//
+// Page tables freed by merging them into large pages. The first
+// mReusablePageTableCount ones can be reused. The others may still be cached
+// by the APs, which only flush their TLBs on request, and are left untouched
+// until all the APs flushed their TLBs.
+//
+VOID   *mFreePageTables[MAX_FREE_PAGE_TABLE_COUNT];
+UINTN  mFreePageTableCount     = 0;
+UINTN  mReusablePageTableCount = 0;
 
 //
 // Record the page fault exception count for one instruction execution.
@@ -268,6 +290,103 @@ PageAttributeToMask (
   return 0;
 }
 
+/**
+  Return the page directory pointer table covering the address.
+
+  @param[in]  PagingContext     The paging context.
+  @param[in]  Address           The address to be checked.
+  @param[in]  AddressEncMask    The memory encryption mask of the page entries.
+
+  @return The page directory pointer table, or NULL if the address is not mapped.
+**/
+UINT64 *
+GetPageDirectoryPointerTable (
+  IN  PAGE_TABLE_LIB_PAGING_CONTEXT  *PagingContext,
+  IN  PHYSICAL_ADDRESS               Address,
+  IN  UINT64                         AddressEncMask
+  )
+{
+  UINTN   Index4;
+  UINTN   Index5;
+  UINT64  *L4PageTable;
+  UINT64  *L5PageTable;
+
+  ASSERT (PagingContext != NULL);
+
+  Index5 = ((UINTN)RShiftU64 (Address, 48)) & PAGING_PAE_INDEX_MASK;
+  Index4 = ((UINTN)RShiftU64 (Address, 39)) & PAGING_PAE_INDEX_MASK;
+
+  if (PagingContext->MachineType != IMAGE_FILE_MACHINE_X64) {
+    ASSERT ((PagingContext->ContextData.Ia32.Attributes & PAGE_TABLE_LIB_PAGING_CONTEXT_IA32_X64_ATTRIBUTES_PAE) != 0);
+    return (UINT64 *)(UINTN)PagingContext->ContextData.Ia32.PageTableBase;
+  }
+
+  if ((PagingContext->ContextData.X64.Attributes & PAGE_TABLE_LIB_PAGING_CONTEXT_IA32_X64_ATTRIBUTES_5_LEVEL) != 0) {
+    L5PageTable = (UINT64 *)(UINTN)PagingContext->ContextData.X64.PageTableBase;
+    if (L5PageTable[Index5] == 0) {
+      return NULL;
+    }
+
+    L4PageTable = (UINT64 *)(UINTN)(L5PageTable[Index5] & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64);
+  } else {
+    L4PageTable = (UINT64 *)(UINTN)PagingContext->ContextData.X64.PageTableBase;
+  }
+
+  if (L4PageTable[Index4] == 0) {
+    return NULL;
+  }
+
+  return (UINT64 *)(UINTN)(L4PageTable[Index4] & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64);
+}
+
+/**
+  Return the page directory entry or the page directory pointer table entry
+  covering the address, whether it maps a large page or points to a page table.
+
+  @param[in]  PagingContext     The paging context.
+  @param[in]  Address           The address to be checked.
+  @param[in]  PageAttribute     Page2M for the page directory entry, Page1G for
+                                the page directory pointer table entry.
+
+  @return The page entry, or NULL if the address is not mapped at this level.
+**/
+UINT64 *
+GetPageDirectoryEntry (
+  IN  PAGE_TABLE_LIB_PAGING_CONTEXT  *PagingContext,
+  IN  PHYSICAL_ADDRESS               Address,
+  IN  PAGE_ATTRIBUTE                 PageAttribute
+  )
+{
+  UINTN   Index2;
+  UINTN   Index3;
+  UINT64  *L2PageTable;
+  UINT64  *L3PageTable;
+  UINT64  AddressEncMask;
+
+  ASSERT (PageAttribute == Page2M || PageAttribute == Page1G);
+
+  Index3 = ((UINTN)RShiftU64 (Address, 30)) & PAGING_PAE_INDEX_MASK;
+  Index2 = ((UINTN)Address >> 21) & PAGING_PAE_INDEX_MASK;
+
+  AddressEncMask = PcdGet64 (PcdPteMemoryEncryptionAddressOrMask) & PAGING_1G_ADDRESS_MASK_64;
+
+  L3PageTable = GetPageDirectoryPointerTable (PagingContext, Address, AddressEncMask);
+  if (L3PageTable == NULL) {
+    return NULL;
+  }
+
+  if (PageAttribute == Page1G) {
+    return &L3PageTable[Index3];
+  }
+
+  if ((L3PageTable[Index3] == 0) || ((L3PageTable[Index3] & IA32_PG_PS) != 0)) {
+    return NULL;
+  }
+
+  L2PageTable = (UINT64 *)(UINTN)(L3PageTable[Index3] & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64);
+  return &L2PageTable[Index2];
+}
+
 /**
   Return page table entry to match the address.
 
@@ -287,19 +406,13 @@ GetPageTableEntry (
   UINTN   Index1;
   UINTN   Index2;
   UINTN   Index3;
-  UINTN   Index4;
-  UINTN   Index5;
   UINT64  *L1PageTable;
   UINT64  *L2PageTable;
   UINT64  *L3PageTable;
-  UINT64  *L4PageTable;
-  UINT64  *L5PageTable;
   UINT64  AddressEncMask;
 
   ASSERT (PagingContext != NULL);
 
-  Index5 = ((UINTN)RShiftU64 (Address, 48)) & PAGING_PAE_INDEX_MASK;
-  Index4 = ((UINTN)RShiftU64 (Address, 39)) & PAGING_PAE_INDEX_MASK;
   Index3 = ((UINTN)Address >> 30) & PAGING_PAE_INDEX_MASK;
   Index2 = ((UINTN)Address >> 21) & PAGING_PAE_INDEX_MASK;
   Index1 = ((UINTN)Address >> 12) & PAGING_PAE_INDEX_MASK;
@@ -308,28 +421,10 @@ GetPageTableEntry (
   //
   AddressEncMask = PcdGet64 (PcdPteMemoryEncryptionAddressOrMask) & PAGING_1G_ADDRESS_MASK_64;
 
-  if (PagingContext->MachineType == IMAGE_FILE_MACHINE_X64) {
-    if ((PagingContext->ContextData.X64.Attributes & PAGE_TABLE_LIB_PAGING_CONTEXT_IA32_X64_ATTRIBUTES_5_LEVEL) != 0) {
-      L5PageTable = (UINT64 *)(UINTN)PagingContext->ContextData.X64.PageTableBase;
-      if (L5PageTable[Index5] == 0) {
-        *PageAttribute = PageNone;
-        return NULL;
-      }
-
-      L4PageTable = (UINT64 *)(UINTN)(L5PageTable[Index5] & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64);
-    } else {
-      L4PageTable = (UINT64 *)(UINTN)PagingContext->ContextData.X64.PageTableBase;
-    }
-
-    if (L4PageTable[Index4] == 0) {
-      *PageAttribute = PageNone;
-      return NULL;
-    }
-
-    L3PageTable = (UINT64 *)(UINTN)(L4PageTable[Index4] & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64);
-  } else {
-    ASSERT ((PagingContext->ContextData.Ia32.Attributes & PAGE_TABLE_LIB_PAGING_CONTEXT_IA32_X64_ATTRIBUTES_PAE) != 0);
-    L3PageTable = (UINT64 *)(UINTN)PagingContext->ContextData.Ia32.PageTableBase;
+  L3PageTable = GetPageDirectoryPointerTable (PagingContext, Address, AddressEncMask);
+  if (L3PageTable == NULL) {
+    *PageAttribute = PageNone;
+    return NULL;
   }
 
   if (L3PageTable[Index3] == 0) {
@@ -848,6 +943,7 @@ ConvertMemoryPageAttributes (
         goto Done;
       }
 
+      mPageTableStatistics.SplitCount++;
       if (IsSplitted != NULL) {
         *IsSplitted = TRUE;
       }
@@ -874,6 +970,263 @@ Done:
   return Status;
 }
 
+/**
+  Keep a page table freed by a merge for reuse, if it was allocated from the
+  page table pools and there is room to track it. The page tables built before
+  this driver started are not reused, as they are not known to be protected as
+  read-only.
+
+  The page table is not written, as the APs may still walk it until they flush
+  their TLBs.
+
+  @param[in]  PageTable   The freed page table.
+**/
+VOID
+FreePageTableMemory (
+  IN VOID  *PageTable
+  )
+{
+  PAGE_TABLE_POOL  *Pool;
+
+  Pool = mPageTablePool;
+  if ((Pool == NULL) || (mFreePageTableCount == MAX_FREE_PAGE_TABLE_COUNT)) {
+    return;
+  }
+
+  do {
+    if (((UINTN)PageTable > (UINTN)Pool) &&
+        ((UINTN)PageTable < (UINTN)Pool + Pool->Offset))
+    {
+      mFreePageTables[mFreePageTableCount++] = PageTable;
+      mPageTableStatistics.UsedPages--;
+      mPageTableStatistics.FreePages++;
+      return;
+    }
+
+    Pool = Pool->NextPool;
+  } while (Pool != mPageTablePool);
+}
+
+/**
+  Flush the TLB of an AP.
+
+  @param[in, out]  Buffer  Unused.
+**/
+VOID
+EFIAPI
+FlushApTlb (
+  IN OUT VOID  *Buffer
+  )
+{
+  CpuFlushTlb ();
+}
+
+/**
+  Make the page tables freed by merges reusable, once no processor can still
+  walk them.
+
+  The BSP flushed its TLB after each merge. The APs are asked to flush theirs,
+  and the page tables stay unused if they cannot run the request, e.g. while
+  they are busy with another StartupAllAPs() call. EFI_NOT_STARTED means that
+  no AP is enabled.
+
+  The caller must be at TPL_NOTIFY or below.
+**/
+VOID
+ReclaimFreePageTables (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+
+  if (mReusablePageTableCount == mFreePageTableCount) {
+    return;
+  }
+
+  if (mNumberOfProcessors > 1) {
+    Status = MpInitLibStartupAllAPs (FlushApTlb, FALSE, NULL, 0, NULL, NULL);
+    if (EFI_ERROR (Status) && (Status != EFI_NOT_STARTED)) {
+      return;
+    }
+  }
+
+  mReusablePageTableCount = mFreePageTableCount;
+}
+
+/**
+  This function merges a page table into one large page entry, if all its
+  entries map contiguous memory with the same attributes.
+
+  @param[in, out] PageEntry       The page entry pointing to the page table.
+  @param[in]      PageAttribute   The page attribute of the entries of the page
+                                  table, Page4K or Page2M.
+  @param[in]      AddressEncMask  The memory encryption mask of the page entries.
+
+  @retval TRUE    The page table is merged and no longer used.
+  @retval FALSE   The page table cannot be merged.
+**/
+BOOLEAN
+MergePageTable (
+  IN OUT UINT64          *PageEntry,
+  IN     PAGE_ATTRIBUTE  PageAttribute,
+  IN     UINT64          AddressEncMask
+  )
+{
+  UINT64  *PageTable;
+  UINT64  AddressMask;
+  UINT64  AllowedBits;
+  UINT64  EntryLength;
+  UINT64  BaseAddress;
+  UINT64  Address;
+  UINT64  Attributes;
+  UINT64  AccessedDirty;
+  UINTN   Index;
+
+  ASSERT (PageAttribute == Page4K || PageAttribute == Page2M);
+
+  //
+  // Only the attributes managed by this driver can be merged: the caching
+  // attributes (PAT, PCD, PWT) and the global bit are left to the page tables
+  // that set them.
+  //
+  if (PageAttribute == Page4K) {
+    AddressMask = PAGING_4K_ADDRESS_MASK_64 & ~AddressEncMask;
+    AllowedBits = PAGE_PROGATE_BITS | AddressEncMask;
+  } else {
+    AddressMask = PAGING_2M_ADDRESS_MASK_64 & ~AddressEncMask;
+    AllowedBits = PAGE_PROGATE_BITS | AddressEncMask | IA32_PG_PS;
+  }
+
+  EntryLength = PageAttributeToLength (PageAttribute);
+  PageTable   = (UINT64 *)(UINTN)(*PageEntry & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64);
+  BaseAddress = PageTable[0] & AddressMask;
+  Attributes  = PageTable[0] & ~AddressMask & ~(UINT64)(IA32_PG_A | IA32_PG_D);
+
+  if (((BaseAddress & (EntryLength * (PAGING_PAE_INDEX_MASK + 1) - 1)) != 0) ||
+      ((Attributes & ~AllowedBits) != 0))
+  {
+    return FALSE;
+  }
+
+  AccessedDirty = 0;
+  Address       = BaseAddress;
+  for (Index = 0; Index <= PAGING_PAE_INDEX_MASK; Index++) {
+    if (((PageTable[Index] & AddressMask) != Address) ||
+        ((PageTable[Index] & ~AddressMask & ~(UINT64)(IA32_PG_A | IA32_PG_D)) != Attributes))
+    {
+      return FALSE;
+    }
+
+    AccessedDirty |= PageTable[Index] & (IA32_PG_A | IA32_PG_D);
+    Address       += EntryLength;
+  }
+
+  //
+  // The attributes of the page entry apply to the whole page table. Do not
+  // merge if they restrict the access to its entries, which would otherwise
+  // gain rights.
+  //
+  if (((*PageEntry & Attributes & (IA32_PG_P | IA32_PG_RW | IA32_PG_U)) !=
+       (Attributes & (IA32_PG_P | IA32_PG_RW | IA32_PG_U))) ||
+      ((*PageEntry & ~Attributes & IA32_PG_NX) != 0))
+  {
+    return FALSE;
+  }
+
+  *PageEntry = BaseAddress | Attributes | AccessedDirty | IA32_PG_PS;
+  return TRUE;
+}
+
+/**
+  This function merges the page tables covering a memory region back into
+  large pages, wherever their entries map contiguous memory with the same
+  attributes. The 2M and 1G regions partially covered by the memory region
+  are checked too.
+
+  The merged page tables are kept for reuse, once the APs flushed their TLBs.
+  The caller must flush the TLB of the BSP.
+
+  @param[in]  PagingContext     The paging context.
+  @param[in]  BaseAddress       The physical address that is the start address of a memory region.
+  @param[in]  Length            The size in bytes of the memory region.
+
+  @retval TRUE    At least one page table was merged.
+  @retval FALSE   No page table was merged.
+**/
+BOOLEAN
+MergePageTables (
+  IN  PAGE_TABLE_LIB_PAGING_CONTEXT  *PagingContext,
+  IN  PHYSICAL_ADDRESS               BaseAddress,
+  IN  UINT64                         Length
+  )
+{
+  PHYSICAL_ADDRESS  Address;
+  PHYSICAL_ADDRESS  EndAddress;
+  UINT64            *PageEntry;
+  VOID              *PageTable;
+  UINT64            AddressEncMask;
+  BOOLEAN           IsMerged;
+  BOOLEAN           IsWpEnabled;
+
+  AddressEncMask = PcdGet64 (PcdPteMemoryEncryptionAddressOrMask) & PAGING_1G_ADDRESS_MASK_64;
+  EndAddress     = BaseAddress + Length;
+  IsMerged       = FALSE;
+
+  //
+  // Make sure that the page table is changeable.
+  //
+  IsWpEnabled = IsReadOnlyPageWriteProtected ();
+  if (IsWpEnabled) {
+    DisableReadOnlyPageWriteProtect ();
+  }
+
+  for (Address = BaseAddress & ~(UINT64)PAGING_2M_MASK; Address < EndAddress; Address += SIZE_2MB) {
+    PageEntry = GetPageDirectoryEntry (PagingContext, Address, Page2M);
+    if ((PageEntry == NULL) || ((*PageEntry & (IA32_PG_P | IA32_PG_PS)) != IA32_PG_P)) {
+      continue;
+    }
+
+    PageTable = (VOID *)(UINTN)(*PageEntry & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64);
+    if (MergePageTable (PageEntry, Page4K, AddressEncMask)) {
+      DEBUG ((DEBUG_VERBOSE, "Paging: merged 4K pages into 2M page at 0x%lx\n", Address));
+      FreePageTableMemory (PageTable);
+      mPageTableStatistics.Merge2MCount++;
+      IsMerged = TRUE;
+    }
+  }
+
+  //
+  // 1G pages are only available in 64-bit mode.
+  //
+  if ((PagingContext->MachineType == IMAGE_FILE_MACHINE_X64) &&
+      ((PagingContext->ContextData.X64.Attributes & PAGE_TABLE_LIB_PAGING_CONTEXT_IA32_X64_ATTRIBUTES_PAGE_1G_SUPPORT) != 0))
+  {
+    for (Address = BaseAddress & ~(UINT64)PAGING_1G_MASK; Address < EndAddress; Address += SIZE_1GB) {
+      PageEntry = GetPageDirectoryEntry (PagingContext, Address, Page1G);
+      if ((PageEntry == NULL) || ((*PageEntry & (IA32_PG_P | IA32_PG_PS)) != IA32_PG_P)) {
+        continue;
+      }
+
+      PageTable = (VOID *)(UINTN)(*PageEntry & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64);
+      if (MergePageTable (PageEntry, Page2M, AddressEncMask)) {
+        DEBUG ((DEBUG_VERBOSE, "Paging: merged 2M pages into 1G page at 0x%lx\n", Address));
+        FreePageTableMemory (PageTable);
+        mPageTableStatistics.Merge1GCount++;
+        IsMerged = TRUE;
+      }
+    }
+  }
+
+  //
+  // Restore page table write protection, if any.
+  //
+  if (IsWpEnabled) {
+    EnableReadOnlyPageWriteProtect ();
+  }
+
+  return IsMerged;
+}
+
 /**
   This function assigns the page attributes for the memory region specified by BaseAddress and
   Length from their current attributes to the attributes specified by Attributes.
@@ -912,22 +1265,41 @@ AssignMemoryPageAttributes (
   IN  PAGE_TABLE_LIB_ALLOCATE_PAGES  AllocatePagesFunc OPTIONAL
   )
 {
-  RETURN_STATUS  Status;
-  BOOLEAN        IsModified;
-  BOOLEAN        IsSplitted;
+  RETURN_STATUS                  Status;
+  BOOLEAN                        IsModified;
+  BOOLEAN                        IsSplitted;
+  BOOLEAN                        IsMerged;
+  PAGE_TABLE_LIB_PAGING_CONTEXT  CurrentPagingContext;
+  PHYSICAL_ADDRESS               Address;
 
   //  DEBUG((DEBUG_INFO, "AssignMemoryPageAttributes: 0x%lx - 0x%lx (0x%lx)\n", BaseAddress, Length, Attributes));
   Status = ConvertMemoryPageAttributes (PagingContext, BaseAddress, Length, Attributes, PageActionAssign, AllocatePagesFunc, &IsSplitted, &IsModified);
   if (!EFI_ERROR (Status)) {
     if ((PagingContext == NULL) && IsModified) {
       //
-      // Flush TLB as last step.
+      // Merge the page tables back into large pages where the new attributes
+      // allow it. The #PF handler passes its own paging context and is left
+      // out, as it keeps pointers to the page entries it changed.
+      //
+      GetCurrentPagingContext (&CurrentPagingContext);
+      IsMerged = MergePageTables (&CurrentPagingContext, BaseAddress, Length);
+
+      //
+      // Flush TLB as last step, once for the whole region. Invalidating the
+      // pages one by one is enough when only a few page entries changed, but
+      // a split or a merge changes the paging structures.
       //
       // Note: Since APs will always init CR3 register in HLT loop mode or do
       // TLB flush in MWAIT loop mode, there's no need to flush TLB for them
       // here.
       //
-      CpuFlushTlb ();
+      if (IsSplitted || IsMerged || (Length > EFI_PAGES_TO_SIZE (MAX_INVALIDATE_PAGE_COUNT))) {
+        CpuFlushTlb ();
+      } else {
+        for (Address = BaseAddress; Address < BaseAddress + Length; Address += SIZE_4KB) {
+          InvalidatePage ((UINTN)Address);
+        }
+      }
     }
   }
 
@@ -1144,6 +1516,7 @@ InitializePageTablePool (
     "Paging: added %lu pages to page table pool\r\n",
     (UINT64)PoolPages
     ));
+  mPageTableStatistics.PoolPages += PoolPages;
 
   //
   // Link all pools into a list for easier track later.
@@ -1212,6 +1585,23 @@ AllocatePageTableMemory (
     return NULL;
   }
 
+  //
+  // Reuse the page tables freed by merges first. The page splits that
+  // allocate page tables run at TPL_NOTIFY or below.
+  //
+  if (Pages == 1) {
+    ReclaimFreePageTables ();
+    if (mReusablePageTableCount > 0) {
+      mReusablePageTableCount--;
+      mFreePageTableCount--;
+      Buffer                                   = mFreePageTables[mReusablePageTableCount];
+      mFreePageTables[mReusablePageTableCount] = mFreePageTables[mFreePageTableCount];
+      mPageTableStatistics.FreePages--;
+      mPageTableStatistics.UsedPages++;
+      return Buffer;
+    }
+  }
+
   //
   // Renew the pool if necessary.
   //
@@ -1228,6 +1618,7 @@ AllocatePageTableMemory (
   mPageTablePool->Offset    += EFI_PAGES_TO_SIZE (Pages);
   mPageTablePool->FreePages -= Pages;
 
+  mPageTableStatistics.UsedPages += Pages;
   return Buffer;
 }
 
@@ -1389,6 +1780,37 @@ PageFaultExceptionHandler (
   }
 }
 
+/**
+  Report the use of the page table pools and the splits and merges of pages.
+
+  @param[in]  Event     Event whose notification function is being invoked.
+  @param[in]  Context   The pointer to the notification function's context.
+**/
+VOID
+EFIAPI
+ReportPageTableStatistics (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  DEBUG ((
+    DEBUG_INFO,
+    "Paging: %lu pages in page table pool, %lu used, %lu free for reuse\r\n",
+    (UINT64)mPageTableStatistics.PoolPages,
+    (UINT64)mPageTableStatistics.UsedPages,
+    (UINT64)mPageTableStatistics.FreePages
+    ));
+  DEBUG ((
+    DEBUG_INFO,
+    "Paging: %lu pages split, %lu merged into 2M pages, %lu merged into 1G pages\r\n",
+    (UINT64)mPageTableStatistics.SplitCount,
+    (UINT64)mPageTableStatistics.Merge2MCount,
+    (UINT64)mPageTableStatistics.Merge1GCount
+    ));
+
+  gBS->CloseEvent (Event);
+}
+
 /**
   Initialize the Page Table lib.
 **/
@@ -1400,6 +1822,8 @@ InitializePageTableLib (
   PAGE_TABLE_LIB_PAGING_CONTEXT  CurrentPagingContext;
   UINT32                         *Attributes;
   UINTN                          *PageTableBase;
+  EFI_EVENT                      Event;
+  EFI_STATUS                     Status;
 
   GetCurrentPagingContext (&CurrentPagingContext);
 
@@ -1414,6 +1838,11 @@ InitializePageTableLib (
     DisableReadOnlyPageWriteProtect ();
     InitializePageTablePool (1);
     EnableReadOnlyPageWriteProtect ();
+
+    DEBUG_CODE_BEGIN ();
+    Status = EfiCreateEventReadyToBootEx (TPL_CALLBACK, ReportPageTableStatistics, NULL, &Event);
+    ASSERT_EFI_ERROR (Status);
+    DEBUG_CODE_END ();
   }
 
   if (HEAP_GUARD_NONSTOP_MODE || NULL_DETECTION_NONSTOP_MODE) {
@@ -0,0 +1,216 @@
+/** @file
+  Parallel task library.
+
+  Runs work on all the enabled processors through the MP services. Two models
+  are provided:
+  - ParallelFor() splits a range of indexes into chunks and calls a procedure
+    on every chunk.
+  - A task queue runs tasks added before it is started, and the tasks that
+    they spawn while it runs.
+
+  Every participating processor owns a deque of tasks. It takes its own tasks
+  from the end it pushes them to, and steals tasks from the other end of the
+  deque of another processor when its own deque is empty, so that the load
+  stays balanced without any central scheduler.
+
+  The procedures run on APs. They must not call PEI services, boot services or
+  any other service that is not MP safe, must not allocate memory and must not
+  call ParallelFor() or ParallelTaskQueueRun(). Nested work is expressed with
+  ParallelTaskSpawn().
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef PARALLEL_TASK_LIB_H_
+#define PARALLEL_TASK_LIB_H_
+
+typedef struct _PARALLEL_TASK_QUEUE   PARALLEL_TASK_QUEUE;
+typedef struct _PARALLEL_TASK_WORKER  PARALLEL_TASK_WORKER;
+
+/**
+  Procedure of a task.
+
+  @param[in]  Worker    The worker running the task. It identifies the worker
+                        in ParallelTaskSpawn() and ParallelTaskGetWorkerIndex().
+  @param[in]  Context   The context given when the task was added or spawned.
+
+**/
+typedef
+VOID
+(EFIAPI *PARALLEL_TASK_PROCEDURE)(
+  IN PARALLEL_TASK_WORKER  *Worker,
+  IN VOID                  *Context OPTIONAL
+  );
+
+/**
+  Procedure called by ParallelFor() on each chunk of the range.
+
+  @param[in]  Context       The context given to ParallelFor().
+  @param[in]  Begin         First index of the chunk.
+  @param[in]  End           Index following the last index of the chunk.
+  @param[in]  WorkerIndex   Index of the worker running the chunk, lower than
+                            ParallelTaskGetWorkerCount(). It may be used to
+                            select a per worker accumulator.
+
+**/
+typedef
+VOID
+(EFIAPI *PARALLEL_FOR_PROCEDURE)(
+  IN VOID   *Context OPTIONAL,
+  IN UINTN  Begin,
+  IN UINTN  End,
+  IN UINTN  WorkerIndex
+  );
+
+/**
+  Return the number of workers that run the tasks.
+
+  This is the number of enabled processors able to run tasks, limited to
+  PcdParallelTaskMaxWorkerCount when it is not zero.
+
+  @return The number of workers, at least 1.
+
+**/
+UINTN
+EFIAPI
+ParallelTaskGetWorkerCount (
+  VOID
+  );
+
+/**
+  Call a procedure on every chunk of a range of indexes, in parallel.
+
+  The range is split into chunks of Grain indexes, except for the last one of
+  each part which may be shorter. The chunks are called in no specific order,
+  and the function returns when all of them have been called.
+
+  @param[in]  Begin       First index of the range.
+  @param[in]  End         Index following the last index of the range.
+  @param[in]  Grain       Maximum number of indexes of a chunk. 0 selects a
+                          size giving a few chunks per worker.
+  @param[in]  Procedure   The procedure called on each chunk.
+  @param[in]  Context     The context passed to Procedure.
+
+  @retval EFI_SUCCESS             Procedure was called on every chunk.
+  @retval EFI_INVALID_PARAMETER   Procedure is NULL or End is lower than Begin.
+  @retval EFI_OUT_OF_RESOURCES    The deques could not be allocated. Nothing
+                                  was called.
+
+**/
+EFI_STATUS
+EFIAPI
+ParallelFor (
+  IN UINTN                   Begin,
+  IN UINTN                   End,
+  IN UINTN                   Grain,
+  IN PARALLEL_FOR_PROCEDURE  Procedure,
+  IN VOID                    *Context OPTIONAL
+  );
+
+/**
+  Create a task queue.
+
+  @param[in]   Capacity   Number of tasks that the deque of each worker holds.
+                          It is rounded up to a power of 2.
+  @param[out]  Queue      The created queue.
+
+  @retval EFI_SUCCESS             The queue was created.
+  @retval EFI_INVALID_PARAMETER   Queue is NULL or Capacity is 0.
+  @retval EFI_OUT_OF_RESOURCES    The queue could not be allocated.
+
+**/
+EFI_STATUS
+EFIAPI
+ParallelTaskQueueCreate (
+  IN  UINTN                Capacity,
+  OUT PARALLEL_TASK_QUEUE  **Queue
+  );
+
+/**
+  Free a task queue.
+
+  @param[in]  Queue   The queue to free. It must not be running.
+
+**/
+VOID
+EFIAPI
+ParallelTaskQueueFree (
+  IN PARALLEL_TASK_QUEUE  *Queue
+  );
+
+/**
+  Add a task to a queue which is not running.
+
+  The tasks are spread over the deques of the workers in turn.
+
+  @param[in]  Queue       The queue.
+  @param[in]  Procedure   The procedure of the task.
+  @param[in]  Context     The context passed to Procedure.
+
+  @retval EFI_SUCCESS             The task was added.
+  @retval EFI_INVALID_PARAMETER   Queue or Procedure is NULL.
+  @retval EFI_OUT_OF_RESOURCES    The deques of all the workers are full.
+
+**/
+EFI_STATUS
+EFIAPI
+ParallelTaskQueueAdd (
+  IN PARALLEL_TASK_QUEUE      *Queue,
+  IN PARALLEL_TASK_PROCEDURE  Procedure,
+  IN VOID                     *Context OPTIONAL
+  );
+
+/**
+  Run the tasks of a queue on all the workers.
+
+  The function returns when all the tasks, including the spawned ones, have
+  run. The queue is then empty and may be used again.
+
+  @param[in]  Queue   The queue.
+
+  @retval EFI_SUCCESS             All the tasks ran.
+  @retval EFI_INVALID_PARAMETER   Queue is NULL.
+
+**/
+EFI_STATUS
+EFIAPI
+ParallelTaskQueueRun (
+  IN PARALLEL_TASK_QUEUE  *Queue
+  );
+
+/**
+  Spawn a task from a running task.
+
+  The task is pushed to the deque of the worker, where it is either taken
+  back by the worker or stolen by another one. If the deque is full, the task
+  runs before the function returns.
+
+  @param[in]  Worker      The worker running the calling task.
+  @param[in]  Procedure   The procedure of the task.
+  @param[in]  Context     The context passed to Procedure.
+
+**/
+VOID
+EFIAPI
+ParallelTaskSpawn (
+  IN PARALLEL_TASK_WORKER     *Worker,
+  IN PARALLEL_TASK_PROCEDURE  Procedure,
+  IN VOID                     *Context OPTIONAL
+  );
+
+/**
+  Return the index of a worker.
+
+  @param[in]  Worker    The worker running the calling task.
+
+  @return The index of the worker, lower than ParallelTaskGetWorkerCount().
+
+**/
+UINTN
+EFIAPI
+ParallelTaskGetWorkerIndex (
+  IN PARALLEL_TASK_WORKER  *Worker
+  );
+
+#endif
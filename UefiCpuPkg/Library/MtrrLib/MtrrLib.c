@@ -2009,6 +2009,180 @@ MtrrLibMergeVariableMtrr (
   }
 }
 
+/**
+  Return the fewest powers of two that add up to a length when each of them
+  is either added or subtracted.
+
+  @param Length  The length.
+
+  @return The count of powers of two.
+**/
+UINT32
+MtrrLibSignedPowerOfTwoCount (
+  IN UINT64  Length
+  )
+{
+  UINT32  Count;
+
+  Count = 0;
+  while (Length != 0) {
+    if ((Length & BIT0) != 0) {
+      //
+      // A run of set bits ending here costs one addition and one subtraction.
+      //
+      if ((Length & (BIT0 | BIT1)) == (BIT0 | BIT1)) {
+        Length++;
+      } else {
+        Length--;
+      }
+
+      Count++;
+    }
+
+    Length = RShiftU64 (Length, 1);
+  }
+
+  return Count;
+}
+
+/**
+  Reuse the previous variable MTRR settings for memory ranges when they still
+  describe the memory ranges exactly, so that the MTRR settings of the memory
+  ranges do not need to be calculated again.
+
+  The previous MTRR settings overlapping the memory ranges are only reused
+  when all of them are contained in the memory ranges, because the memory
+  types of the memory ranges then only depend on them.
+
+  They are also only reused when they are not more than a lower bound of the
+  MTRR settings of the memory ranges, so that MtrrLibCalculateMtrrs() cannot
+  find fewer of them and reusing them never costs variable MTRRs. Each memory
+  type other than the default type needs its own MTRR settings. As the MTRR
+  settings are naturally aligned powers of two, which either nest or do not
+  overlap, the total length of a memory type is also the sum of the lengths
+  of the MTRR settings of this type that are not overridden, minus those of
+  the overriding MTRR settings that they contain.
+
+  @param DefaultType       Default memory type.
+  @param Ranges            Memory range array holding the memory type
+                           settings for a contiguous memory region.
+  @param RangeCount        Count of memory ranges.
+  @param PreviousMtrrs     Array holding the previous MTRR settings.
+  @param PreviousMtrrCount Count of the previous MTRR settings.
+  @param Mtrrs             Array holding all MTRR settings.
+  @param MtrrCapacity      Capacity of the MTRR array.
+  @param MtrrCount         The count of MTRR settings in array.
+
+  @retval TRUE  The previous MTRR settings are appended to the MTRR array.
+  @retval FALSE The previous MTRR settings cannot be reused.
+**/
+BOOLEAN
+MtrrLibReuseVariableMtrrs (
+  IN MTRR_MEMORY_CACHE_TYPE   DefaultType,
+  IN CONST MTRR_MEMORY_RANGE  *Ranges,
+  IN UINTN                    RangeCount,
+  IN CONST MTRR_MEMORY_RANGE  *PreviousMtrrs,
+  IN UINT32                   PreviousMtrrCount,
+  IN OUT MTRR_MEMORY_RANGE    *Mtrrs,
+  IN UINT32                   MtrrCapacity,
+  IN OUT UINT32               *MtrrCount
+  )
+{
+  RETURN_STATUS      Status;
+  UINT64             Base0;
+  UINT64             Base1;
+  UINT32             Index;
+  UINT64             TypeLength[CacheWriteBack + 1];
+  UINT32             MinimumMtrrCount;
+  UINT32             TypeCount;
+  MTRR_MEMORY_RANGE  ReusedMtrrs[ARRAY_SIZE (((MTRR_VARIABLE_SETTINGS *)0)->Mtrr)];
+  UINT32             ReusedMtrrCount;
+  MTRR_MEMORY_RANGE  ReusedRanges[2 * ARRAY_SIZE (((MTRR_VARIABLE_SETTINGS *)0)->Mtrr) + 1];
+  UINTN              ReusedRangeCount;
+
+  ASSERT (PreviousMtrrCount <= ARRAY_SIZE (ReusedMtrrs));
+
+  Base0 = Ranges[0].BaseAddress;
+  Base1 = Ranges[RangeCount - 1].BaseAddress + Ranges[RangeCount - 1].Length;
+
+  ReusedMtrrCount = 0;
+  for (Index = 0; Index < PreviousMtrrCount; Index++) {
+    if ((PreviousMtrrs[Index].Length == 0) ||
+        (PreviousMtrrs[Index].BaseAddress >= Base1) ||
+        (PreviousMtrrs[Index].BaseAddress + PreviousMtrrs[Index].Length <= Base0))
+    {
+      continue;
+    }
+
+    if ((PreviousMtrrs[Index].BaseAddress < Base0) ||
+        (PreviousMtrrs[Index].BaseAddress + PreviousMtrrs[Index].Length > Base1))
+    {
+      return FALSE;
+    }
+
+    CopyMem (&ReusedMtrrs[ReusedMtrrCount], &PreviousMtrrs[Index], sizeof (ReusedMtrrs[0]));
+    ReusedMtrrCount++;
+  }
+
+  if (*MtrrCount + ReusedMtrrCount > MtrrCapacity) {
+    return FALSE;
+  }
+
+  //
+  // Check that the reused MTRR settings are the fewest possible.
+  //
+  ZeroMem (TypeLength, sizeof (TypeLength));
+  for (Index = 0; Index < RangeCount; Index++) {
+    if (Ranges[Index].Type != DefaultType) {
+      TypeLength[Ranges[Index].Type] += Ranges[Index].Length;
+    }
+  }
+
+  MinimumMtrrCount = 0;
+  TypeCount        = 0;
+  for (Index = 0; Index < ARRAY_SIZE (TypeLength); Index++) {
+    if (TypeLength[Index] != 0) {
+      TypeCount++;
+      MinimumMtrrCount = MAX (MinimumMtrrCount, MtrrLibSignedPowerOfTwoCount (TypeLength[Index]));
+    }
+  }
+
+  if (ReusedMtrrCount > MAX (MinimumMtrrCount, TypeCount)) {
+    return FALSE;
+  }
+
+  //
+  // Check that the reused MTRR settings result in the memory ranges.
+  //
+  ReusedRanges[0].BaseAddress = Base0;
+  ReusedRanges[0].Length      = Base1 - Base0;
+  ReusedRanges[0].Type        = DefaultType;
+  ReusedRangeCount            = 1;
+  Status                      = MtrrLibApplyVariableMtrrs (
+                                  ReusedMtrrs,
+                                  ReusedMtrrCount,
+                                  ReusedRanges,
+                                  ARRAY_SIZE (ReusedRanges),
+                                  &ReusedRangeCount
+                                  );
+  if (RETURN_ERROR (Status) || (ReusedRangeCount != RangeCount)) {
+    return FALSE;
+  }
+
+  for (Index = 0; Index < RangeCount; Index++) {
+    if ((ReusedRanges[Index].BaseAddress != Ranges[Index].BaseAddress) ||
+        (ReusedRanges[Index].Length != Ranges[Index].Length) ||
+        (ReusedRanges[Index].Type != Ranges[Index].Type))
+    {
+      return FALSE;
+    }
+  }
+
+  CopyMem (&Mtrrs[*MtrrCount], ReusedMtrrs, ReusedMtrrCount * sizeof (ReusedMtrrs[0]));
+  *MtrrCount += ReusedMtrrCount;
+  return TRUE;
+}
+
 /**
   Calculate the variable MTRR settings for all memory ranges.
 
@@ -2019,6 +2193,10 @@ MtrrLibMergeVariableMtrr (
   @param RangeCount           Count of memory ranges.
   @param Scratch              Scratch buffer to be used in MTRR calculation.
   @param ScratchSize          Pointer to the size of scratch buffer.
+  @param PreviousMtrrs        Array holding the previous MTRR settings, which
+                              are reused where they still describe the memory
+                              ranges. NULL to calculate all the MTRR settings.
+  @param PreviousMtrrCount    Count of the previous MTRR settings.
   @param VariableMtrr         Array holding all MTRR settings.
   @param VariableMtrrCapacity Capacity of the MTRR array.
   @param VariableMtrrCount    The count of MTRR settings in array.
@@ -2030,15 +2208,17 @@ MtrrLibMergeVariableMtrr (
 **/
 RETURN_STATUS
 MtrrLibSetMemoryRanges (
-  IN MTRR_MEMORY_CACHE_TYPE  DefaultType,
-  IN UINT64                  A0,
-  IN MTRR_MEMORY_RANGE       *Ranges,
-  IN UINTN                   RangeCount,
-  IN VOID                    *Scratch,
-  IN OUT UINTN               *ScratchSize,
-  OUT MTRR_MEMORY_RANGE      *VariableMtrr,
-  IN UINT32                  VariableMtrrCapacity,
-  OUT UINT32                 *VariableMtrrCount
+  IN MTRR_MEMORY_CACHE_TYPE   DefaultType,
+  IN UINT64                   A0,
+  IN MTRR_MEMORY_RANGE        *Ranges,
+  IN UINTN                    RangeCount,
+  IN VOID                     *Scratch,
+  IN OUT UINTN                *ScratchSize,
+  IN CONST MTRR_MEMORY_RANGE  *PreviousMtrrs      OPTIONAL,
+  IN UINT32                   PreviousMtrrCount,
+  OUT MTRR_MEMORY_RANGE       *VariableMtrr,
+  IN UINT32                   VariableMtrrCapacity,
+  OUT UINT32                  *VariableMtrrCount
   )
 {
   RETURN_STATUS  Status;
@@ -2143,25 +2323,46 @@ MtrrLibSetMemoryRanges (
 
     Length             = Ranges[End].Length;
     Ranges[End].Length = Base1 - Ranges[End].BaseAddress;
-    ActualScratchSize  = *ScratchSize;
-    Status             = MtrrLibCalculateMtrrs (
-                           DefaultType,
-                           A0,
-                           &Ranges[Index],
-                           End + 1 - Index,
-                           Scratch,
-                           &ActualScratchSize,
-                           VariableMtrr,
-                           VariableMtrrCapacity,
-                           VariableMtrrCount
-                           );
-    if (Status == RETURN_BUFFER_TOO_SMALL) {
-      BiggestScratchSize = MAX (BiggestScratchSize, ActualScratchSize);
-      //
-      // Ignore this error, because we need to calculate the biggest
-      // scratch buffer size.
-      //
+
+    //
+    // The calculation of [Base0, Base1) is skipped when the previous MTRR
+    // settings still describe it with the fewest MTRRs, which is the case of
+    // most unchanged ranges when only a few ranges change.
+    //
+    if ((PreviousMtrrs != NULL) &&
+        MtrrLibReuseVariableMtrrs (
+          DefaultType,
+          &Ranges[Index],
+          End + 1 - Index,
+          PreviousMtrrs,
+          PreviousMtrrCount,
+          VariableMtrr,
+          VariableMtrrCapacity,
+          VariableMtrrCount
+          ))
+    {
       Status = RETURN_SUCCESS;
+    } else {
+      ActualScratchSize = *ScratchSize;
+      Status            = MtrrLibCalculateMtrrs (
+                            DefaultType,
+                            A0,
+                            &Ranges[Index],
+                            End + 1 - Index,
+                            Scratch,
+                            &ActualScratchSize,
+                            VariableMtrr,
+                            VariableMtrrCapacity,
+                            VariableMtrrCount
+                            );
+      if (Status == RETURN_BUFFER_TOO_SMALL) {
+        BiggestScratchSize = MAX (BiggestScratchSize, ActualScratchSize);
+        //
+        // Ignore this error, because we need to calculate the biggest
+        // scratch buffer size.
+        //
+        Status = RETURN_SUCCESS;
+      }
     }
 
     if (RETURN_ERROR (Status)) {
@@ -2185,6 +2386,91 @@ MtrrLibSetMemoryRanges (
   return RETURN_SUCCESS;
 }
 
+/**
+  Calculate the variable MTRR settings for all memory ranges above 1MB.
+
+  @param DefaultType          Default memory type.
+  @param A0                   Alignment to use when base address is 0.
+  @param Ranges               Memory range array holding the memory type
+                              settings for all memory address, with [0, 1MB)
+                              set to UC.
+  @param RangeCount           Count of memory ranges.
+  @param Scratch              Scratch buffer to be used in MTRR calculation.
+  @param ScratchSize          Pointer to the size of scratch buffer.
+  @param PreviousMtrrs        Array holding the previous MTRR settings, which
+                              are reused where they still describe the memory
+                              ranges. NULL to calculate all the MTRR settings.
+  @param PreviousMtrrCount    Count of the previous MTRR settings.
+  @param VariableMtrr         Array holding all MTRR settings.
+  @param VariableMtrrCapacity Capacity of the MTRR array.
+  @param VariableMtrrCount    The count of MTRR settings in array.
+
+  @retval RETURN_SUCCESS          Variable MTRRs are allocated successfully.
+  @retval RETURN_OUT_OF_RESOURCES Count of variable MTRRs exceeds capacity.
+  @retval RETURN_BUFFER_TOO_SMALL The scratch buffer is too small for MTRR calculation.
+                                  The required scratch buffer size is returned through ScratchSize.
+**/
+RETURN_STATUS
+MtrrLibCalculateVariableMtrrs (
+  IN MTRR_MEMORY_CACHE_TYPE   DefaultType,
+  IN UINT64                   A0,
+  IN MTRR_MEMORY_RANGE        *Ranges,
+  IN UINTN                    RangeCount,
+  IN VOID                     *Scratch,
+  IN OUT UINTN                *ScratchSize,
+  IN CONST MTRR_MEMORY_RANGE  *PreviousMtrrs      OPTIONAL,
+  IN UINT32                   PreviousMtrrCount,
+  OUT MTRR_MEMORY_RANGE       *VariableMtrr,
+  IN UINT32                   VariableMtrrCapacity,
+  OUT UINT32                  *VariableMtrrCount
+  )
+{
+  RETURN_STATUS  Status;
+  UINT32         Index;
+
+  //
+  // One more MTRR is allowed for [0, 1MB), which is removed below.
+  //
+  Status = MtrrLibSetMemoryRanges (
+             DefaultType,
+             A0,
+             Ranges,
+             RangeCount,
+             Scratch,
+             ScratchSize,
+             PreviousMtrrs,
+             PreviousMtrrCount,
+             VariableMtrr,
+             VariableMtrrCapacity + 1,
+             VariableMtrrCount
+             );
+  if (RETURN_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Remove the [0, 1MB) MTRR if it still exists (not merged with other range)
+  //
+  for (Index = 0; Index < *VariableMtrrCount; Index++) {
+    if ((VariableMtrr[Index].BaseAddress == 0) && (VariableMtrr[Index].Length == SIZE_1MB)) {
+      ASSERT (VariableMtrr[Index].Type == CacheUncacheable);
+      (*VariableMtrrCount)--;
+      CopyMem (
+        &VariableMtrr[Index],
+        &VariableMtrr[Index + 1],
+        (*VariableMtrrCount - Index) * sizeof (VariableMtrr[0])
+        );
+      break;
+    }
+  }
+
+  if (*VariableMtrrCount > VariableMtrrCapacity) {
+    return RETURN_OUT_OF_RESOURCES;
+  }
+
+  return RETURN_SUCCESS;
+}
+
 /**
   Set the below-1MB memory attribute to fixed MTRR buffer.
   Modified flag array indicates which fixed MTRR is modified.
@@ -2457,17 +2743,23 @@ MtrrSetMemoryAttributesInMtrrSettings (
     if (Modified) {
       //
       // 2.4. Calculate the Variable MTRR settings based on the Ranges.
+      //      The original variable MTRRs are reused for the parts of the Ranges
+      //      they still describe with as few MTRRs as a new calculation, so
+      //      the result never uses more variable MTRRs than calculating all
+      //      the Ranges would.
       //      Buffer Too Small may be returned if the scratch buffer size is insufficient.
       //
-      Status = MtrrLibSetMemoryRanges (
+      Status = MtrrLibCalculateVariableMtrrs (
                  DefaultType,
                  LShiftU64 (1, (UINTN)HighBitSet64 (MtrrValidBitsMask)),
                  WorkingRanges,
                  WorkingRangeCount,
                  Scratch,
                  ScratchSize,
+                 OriginalVariableMtrr,
+                 OriginalVariableMtrrCount,
                  WorkingVariableMtrr,
-                 FirmwareVariableMtrrCount + 1,
+                 FirmwareVariableMtrrCount,
                  &WorkingVariableMtrrCount
                  );
       if (RETURN_ERROR (Status)) {
@@ -2475,28 +2767,7 @@ MtrrSetMemoryAttributesInMtrrSettings (
       }
 
       //
-      // 2.5. Remove the [0, 1MB) MTRR if it still exists (not merged with other range)
-      //
-      for (Index = 0; Index < WorkingVariableMtrrCount; Index++) {
-        if ((WorkingVariableMtrr[Index].BaseAddress == 0) && (WorkingVariableMtrr[Index].Length == SIZE_1MB)) {
-          ASSERT (WorkingVariableMtrr[Index].Type == CacheUncacheable);
-          WorkingVariableMtrrCount--;
-          CopyMem (
-            &WorkingVariableMtrr[Index],
-            &WorkingVariableMtrr[Index + 1],
-            (WorkingVariableMtrrCount - Index) * sizeof (WorkingVariableMtrr[0])
-            );
-          break;
-        }
-      }
-
-      if (WorkingVariableMtrrCount > FirmwareVariableMtrrCount) {
-        Status = RETURN_OUT_OF_RESOURCES;
-        goto Exit;
-      }
-
-      //
-      // 2.6. Merge the WorkingVariableMtrr to OriginalVariableMtrr
+      // 2.5. Merge the WorkingVariableMtrr to OriginalVariableMtrr
       //      Make sure least modification is made to OriginalVariableMtrr.
       //
       MtrrLibMergeVariableMtrr (
@@ -0,0 +1,334 @@
+/** @file
+  Host benchmark of the MTRR calculation of MtrrLib.
+
+  The memory maps of a desktop, of a 2-socket server and of an 8-socket server
+  are set in MTRR settings that start with all the variable MTRRs cleared, as
+  the platform does in PEI. The same settings then go through the single
+  range changes that happen in DXE, the write combining of a frame buffer
+  being set and cleared, which recalculate the variable MTRRs of the whole
+  memory map. The output is comma separated, in microseconds per call:
+
+    MtrrLibBenchHost [milliseconds per measurement]
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "MtrrLibUnitTest.h"
+
+#define BENCH_DEFAULT_MILLISECONDS  200
+#define BENCH_RUNS                  3
+
+//
+// Fixed MTRRs emulated by Support.c.
+//
+UINT32  mFixedMtrrsIndex[] = {
+  MSR_IA32_MTRR_FIX64K_00000,
+  MSR_IA32_MTRR_FIX16K_80000,
+  MSR_IA32_MTRR_FIX16K_A0000,
+  MSR_IA32_MTRR_FIX4K_C0000,
+  MSR_IA32_MTRR_FIX4K_C8000,
+  MSR_IA32_MTRR_FIX4K_D0000,
+  MSR_IA32_MTRR_FIX4K_D8000,
+  MSR_IA32_MTRR_FIX4K_E0000,
+  MSR_IA32_MTRR_FIX4K_E8000,
+  MSR_IA32_MTRR_FIX4K_F0000,
+  MSR_IA32_MTRR_FIX4K_F8000
+};
+
+typedef struct {
+  CONST CHAR8                  *Name;
+  MTRR_LIB_SYSTEM_PARAMETER    SystemParameter;
+  CONST MTRR_MEMORY_RANGE      *Ranges;
+  UINTN                        RangeCount;
+  //
+  // Range of which the cache type is toggled between write combining and
+  // uncacheable.
+  //
+  MTRR_MEMORY_RANGE            FrameBuffer;
+} BENCH_MEMORY_MAP;
+
+//
+// 16 GB desktop with the MMIO hole below 4 GB.
+//
+STATIC CONST MTRR_MEMORY_RANGE  mDesktopRanges[] = {
+  { 0,           0xA0000,           CacheWriteBack      },
+  { 0xA0000,     0x20000,           CacheUncacheable    },
+  { 0xC0000,     0x40000,           CacheWriteProtected },
+  { SIZE_1MB,    0x7FF00000ULL,     CacheWriteBack      },
+  { SIZE_4GB,    0x3A0000000ULL,    CacheWriteBack      },
+  { 0xD0000000,  SIZE_256MB,        CacheWriteCombining },
+};
+
+//
+// 2-socket server with 256 GB per socket.
+//
+STATIC CONST MTRR_MEMORY_RANGE  mTwoSocketRanges[] = {
+  { 0,                 0xA0000,            CacheWriteBack      },
+  { 0xA0000,           0x20000,            CacheUncacheable    },
+  { 0xC0000,           0x40000,            CacheWriteProtected },
+  { SIZE_1MB,          0x7FF00000ULL,      CacheWriteBack      },
+  { SIZE_4GB,          256ULL * SIZE_1GB,  CacheWriteBack      },
+  { 260ULL * SIZE_1GB, 256ULL * SIZE_1GB,  CacheWriteBack      },
+  { 0x90000000,        SIZE_16MB,          CacheWriteCombining },
+  { 0x10000000000ULL,  SIZE_32GB,          CacheWriteCombining },
+};
+
+//
+// 8-socket server: memory of each socket interleaved with reserved regions,
+// and a write combining aperture per socket.
+//
+STATIC CONST MTRR_MEMORY_RANGE  mEightSocketRanges[] = {
+  { 0,                  0xA0000,                         CacheWriteBack      },
+  { 0xA0000,            0x20000,                         CacheUncacheable    },
+  { 0xC0000,            0x40000,                         CacheWriteProtected },
+  { SIZE_1MB,           0x5FF00000ULL,                   CacheWriteBack      },
+  { 0x70000000,         SIZE_16MB,                       CacheWriteCombining },
+  { SIZE_4GB,           0x3000000000ULL,                 CacheWriteBack      },
+  { 0x3100000000ULL,    0x3000000000ULL,                 CacheWriteBack      },
+  { 0x6100000000ULL,    0x3000000000ULL,                 CacheWriteBack      },
+  { 0x9100000000ULL,    0x3000000000ULL,                 CacheWriteBack      },
+  { 0xC100000000ULL,    0x3000000000ULL,                 CacheWriteBack      },
+  { 0xF100000000ULL,    0x3000000000ULL,                 CacheWriteBack      },
+  { 0x12100000000ULL,   0x3000000000ULL,                 CacheWriteBack      },
+  { 0x15100000000ULL,   0x2F80000000ULL,                 CacheWriteBack      },
+  { 0x20000000000ULL,   SIZE_4GB,                        CacheWriteCombining },
+  { 0x20100000000ULL,   SIZE_4GB,                        CacheWriteCombining },
+  { 0x20200000000ULL,   SIZE_4GB,                        CacheWriteCombining },
+  { 0x20300000000ULL,   SIZE_4GB,                        CacheWriteCombining },
+};
+
+STATIC CONST BENCH_MEMORY_MAP  mMemoryMaps[] = {
+  {
+    "Desktop",
+    { 39, TRUE, TRUE, CacheUncacheable, 10 },
+    mDesktopRanges,
+    ARRAY_SIZE (mDesktopRanges),
+    { 0xC0000000,      SIZE_64MB,        CacheWriteCombining }
+  },
+  {
+    "2-socket",
+    { 46, TRUE, TRUE, CacheUncacheable, 12 },
+    mTwoSocketRanges,
+    ARRAY_SIZE (mTwoSocketRanges),
+    { 0x91000000,      SIZE_16MB,        CacheWriteCombining }
+  },
+  {
+    "8-socket",
+    { 46, TRUE, TRUE, CacheUncacheable, 20 },
+    mEightSocketRanges,
+    ARRAY_SIZE (mEightSocketRanges),
+    { 0x20400000000ULL, SIZE_4GB,        CacheWriteCombining }
+  },
+};
+
+/**
+  Return a monotonic time stamp.
+
+  @return The time stamp in nanoseconds.
+
+**/
+UINT64
+BenchGetTimeNs (
+  VOID
+  )
+{
+  struct timespec  Now;
+
+  clock_gettime (CLOCK_MONOTONIC, &Now);
+  return (UINT64)Now.tv_sec * 1000000000ULL + (UINT64)Now.tv_nsec;
+}
+
+/**
+  Set the memory map in MTRR settings that start with no variable MTRR.
+
+  @param[in]  MemoryMap     The memory map.
+  @param[out] MtrrSettings  Return the MTRR settings.
+
+  @return The status returned by MtrrSetMemoryAttributesInMtrrSettings().
+
+**/
+RETURN_STATUS
+BenchSetMemoryMap (
+  IN  CONST BENCH_MEMORY_MAP  *MemoryMap,
+  OUT MTRR_SETTINGS           *MtrrSettings
+  )
+{
+  UINT8                            Scratch[SCRATCH_BUFFER_SIZE];
+  UINTN                            ScratchSize;
+  MSR_IA32_MTRR_DEF_TYPE_REGISTER  Default;
+
+  Default.Uint64    = 0;
+  Default.Bits.E    = 1;
+  Default.Bits.FE   = 1;
+  Default.Bits.Type = MemoryMap->SystemParameter.DefaultCacheType;
+
+  ZeroMem (MtrrSettings, sizeof (*MtrrSettings));
+  MtrrSettings->MtrrDefType = Default.Uint64;
+
+  ScratchSize = sizeof (Scratch);
+  return MtrrSetMemoryAttributesInMtrrSettings (
+           MtrrSettings,
+           Scratch,
+           &ScratchSize,
+           MemoryMap->Ranges,
+           MemoryMap->RangeCount
+           );
+}
+
+/**
+  Toggle the frame buffer of the memory map between write combining and
+  uncacheable.
+
+  @param[in]      MemoryMap     The memory map.
+  @param[in, out] MtrrSettings  The MTRR settings of the memory map.
+  @param[in]      Iteration     The iteration, of which the parity selects
+                                the cache type.
+
+  @return The status returned by MtrrSetMemoryAttributeInMtrrSettings().
+
+**/
+RETURN_STATUS
+BenchToggleFrameBuffer (
+  IN     CONST BENCH_MEMORY_MAP  *MemoryMap,
+  IN OUT MTRR_SETTINGS           *MtrrSettings,
+  IN     UINTN                   Iteration
+  )
+{
+  return MtrrSetMemoryAttributeInMtrrSettings (
+           MtrrSettings,
+           MemoryMap->FrameBuffer.BaseAddress,
+           MemoryMap->FrameBuffer.Length,
+           ((Iteration & 1) == 0) ? MemoryMap->FrameBuffer.Type : CacheUncacheable
+           );
+}
+
+/**
+  Measure the time of setting the memory map, or of changing a single range.
+
+  @param[in]  MemoryMap     The memory map.
+  @param[in]  SingleRange   TRUE to measure the toggling of the frame buffer.
+  @param[in]  Milliseconds  Duration of each measurement.
+
+  @return The time of one call in microseconds, or a negative value if the
+          MTRR calculation fails.
+
+**/
+double
+BenchRun (
+  IN CONST BENCH_MEMORY_MAP  *MemoryMap,
+  IN BOOLEAN                 SingleRange,
+  IN UINTN                   Milliseconds
+  )
+{
+  MTRR_SETTINGS  MtrrSettings;
+  RETURN_STATUS  Status;
+  UINTN          Iterations;
+  UINTN          Run;
+  UINT64         Start;
+  UINT64         Elapsed;
+  double         Best;
+
+  Status = BenchSetMemoryMap (MemoryMap, &MtrrSettings);
+  if (RETURN_ERROR (Status)) {
+    return -1;
+  }
+
+  Best = 1e30;
+  for (Run = 0; Run < BENCH_RUNS; Run++) {
+    Iterations = 0;
+    Start      = BenchGetTimeNs ();
+    do {
+      if (SingleRange) {
+        Status = BenchToggleFrameBuffer (MemoryMap, &MtrrSettings, Iterations);
+      } else {
+        Status = BenchSetMemoryMap (MemoryMap, &MtrrSettings);
+      }
+
+      if (RETURN_ERROR (Status)) {
+        return -1;
+      }
+
+      Iterations++;
+      Elapsed = BenchGetTimeNs () - Start;
+    } while (Elapsed < Milliseconds * 1000000ULL);
+
+    Best = MIN (Best, (double)Elapsed / Iterations / 1000);
+  }
+
+  return Best;
+}
+
+/**
+  Standard POSIX C entry point of the benchmark.
+
+  @param[in]  argc  Number of arguments.
+  @param[in]  argv  Arguments: duration of each measurement in milliseconds.
+
+  @retval 0  The benchmark ran.
+  @retval 1  The MTRR calculation failed for a memory map.
+
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  UINTN                   Milliseconds;
+  UINTN                   Index;
+  CONST BENCH_MEMORY_MAP  *MemoryMap;
+  MTRR_SETTINGS           MtrrSettings;
+  MTRR_MEMORY_RANGE       Ranges[2 * ARRAY_SIZE (MtrrSettings.Variables.Mtrr) + 1];
+  UINTN                   RangeCount;
+  UINT32                  MtrrCount;
+  double                  FullTime;
+  double                  SingleRangeTime;
+  int                     Result;
+
+  Milliseconds = (argc > 1) ? strtoul (argv[1], NULL, 0) : BENCH_DEFAULT_MILLISECONDS;
+  if (Milliseconds == 0) {
+    Milliseconds = BENCH_DEFAULT_MILLISECONDS;
+  }
+
+  Result = 0;
+  printf ("Memory map,Ranges,Variable MTRRs,Full us,Single range us\n");
+  for (Index = 0; Index < ARRAY_SIZE (mMemoryMaps); Index++) {
+    MemoryMap = &mMemoryMaps[Index];
+    InitializeMtrrRegs ((MTRR_LIB_SYSTEM_PARAMETER *)&MemoryMap->SystemParameter);
+
+    if (RETURN_ERROR (BenchSetMemoryMap (MemoryMap, &MtrrSettings))) {
+      printf ("%s,%lu,failed\n", MemoryMap->Name, (unsigned long)MemoryMap->RangeCount);
+      Result = 1;
+      continue;
+    }
+
+    RangeCount = ARRAY_SIZE (Ranges);
+    CollectTestResult (
+      MemoryMap->SystemParameter.DefaultCacheType,
+      MemoryMap->SystemParameter.PhysicalAddressBits,
+      MemoryMap->SystemParameter.VariableMtrrCount,
+      &MtrrSettings,
+      Ranges,
+      &RangeCount,
+      &MtrrCount
+      );
+
+    FullTime        = BenchRun (MemoryMap, FALSE, Milliseconds);
+    SingleRangeTime = BenchRun (MemoryMap, TRUE, Milliseconds);
+    printf (
+      "%s,%lu,%u,%.2f,%.2f\n",
+      MemoryMap->Name,
+      (unsigned long)MemoryMap->RangeCount,
+      MtrrCount,
+      FullTime,
+      SingleRangeTime
+      );
+    fflush (stdout);
+    if ((FullTime < 0) || (SingleRangeTime < 0)) {
+      Result = 1;
+    }
+  }
+
+  return Result;
+}
@@ -65,6 +65,11 @@ typedef struct {
   CONST MTRR_LIB_SYSTEM_PARAMETER    *SystemParameter;
 } MTRR_LIB_GET_FIRMWARE_VARIABLE_MTRR_COUNT_CONTEXT;
 
+//
+// Count of the ranges changed one at a time by the incremental update test.
+//
+#define INCREMENTAL_CHANGE_COUNT  8
+
 STATIC CHAR8  *mCacheDescription[] = { "UC", "WC", "N/A", "N/A", "WT", "WP", "WB" };
 
 /**
@@ -1037,6 +1042,154 @@ UnitTestMtrrSetMemoryAttributeInMtrrSettings (
   return UNIT_TEST_PASSED;
 }
 
+/**
+  Unit test of updating MTRR settings one range at a time with
+  MtrrSetMemoryAttributeInMtrrSettings().
+
+  The previous variable MTRRs are partly reused by the update, which must give
+  the same memory ranges as calculating the settings from scratch, with no more
+  variable MTRRs.
+
+  @param[in]  Context    Ignored
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+UnitTestMtrrSetMemoryAttributeIncrementally (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CONST MTRR_LIB_SYSTEM_PARAMETER  *SystemParameter;
+  RETURN_STATUS                    Status;
+  RETURN_STATUS                    IncrementalStatus;
+
+  UINTN          ChangeIndex;
+  UINT32         SizeShift;
+  UINT8          *Scratch;
+  UINTN          ScratchSize;
+  MTRR_SETTINGS  IncrementalMtrrs;
+  MTRR_SETTINGS  FullMtrrs;
+
+  MTRR_MEMORY_RANGE  Ranges[2 + INCREMENTAL_CHANGE_COUNT];
+  UINTN              RangeCount;
+
+  MTRR_MEMORY_RANGE  ExpectedMemoryRanges[MTRR_NUMBER_OF_FIXED_MTRR * sizeof (UINT64) + 2 * MTRR_NUMBER_OF_VARIABLE_MTRR + 1];
+  UINT32             ExpectedVariableMtrrUsage;
+  UINTN              ExpectedMemoryRangesCount;
+
+  MTRR_MEMORY_RANGE  ActualMemoryRanges[MTRR_NUMBER_OF_FIXED_MTRR * sizeof (UINT64) + 2 * MTRR_NUMBER_OF_VARIABLE_MTRR + 1];
+  UINT32             ActualVariableMtrrUsage;
+  UINTN              ActualMemoryRangesCount;
+
+  SystemParameter = (MTRR_LIB_SYSTEM_PARAMETER *)Context;
+
+  //
+  // Memory map of a platform: write back memory from 1MB to the MMIO hole,
+  // which starts between 16MB and 3.75GB, and from 4GB.
+  //
+  Ranges[0].BaseAddress = SIZE_1MB;
+  Ranges[0].Length      = MultU64x32 (SIZE_1MB, Random32 (16, 3840)) - SIZE_1MB;
+  Ranges[0].Type        = CacheWriteBack;
+  Ranges[1].BaseAddress = SIZE_4GB;
+  Ranges[1].Length      = MultU64x32 (SIZE_1GB, Random32 (1, 64));
+  Ranges[1].Type        = CacheWriteBack;
+  RangeCount            = 2;
+
+  //
+  // Calculate the initial MTRR settings from scratch.
+  //
+  ZeroMem (&IncrementalMtrrs, sizeof (IncrementalMtrrs));
+  IncrementalMtrrs.MtrrDefType = MtrrGetDefaultMemoryType ();
+  ScratchSize                  = SCRATCH_BUFFER_SIZE;
+  Scratch                      = calloc (ScratchSize, sizeof (UINT8));
+  Status                       = MtrrSetMemoryAttributesInMtrrSettings (&IncrementalMtrrs, Scratch, &ScratchSize, Ranges, RangeCount);
+  if (Status == RETURN_BUFFER_TOO_SMALL) {
+    Scratch = realloc (Scratch, ScratchSize);
+    Status  = MtrrSetMemoryAttributesInMtrrSettings (&IncrementalMtrrs, Scratch, &ScratchSize, Ranges, RangeCount);
+  }
+
+  UT_ASSERT_STATUS_EQUAL (Status, RETURN_SUCCESS);
+
+  //
+  // Change the cache type of random ranges one at a time, reusing the
+  // previous settings, and compare each result with a calculation of all the
+  // ranges from scratch.
+  //
+  for (ChangeIndex = 0; ChangeIndex < INCREMENTAL_CHANGE_COUNT; ChangeIndex++) {
+    SizeShift                      = Random32 (12, 28);
+    Ranges[RangeCount].BaseAddress = LShiftU64 (Random64 (RShiftU64 (SIZE_1MB, SizeShift) + 1, RShiftU64 (SIZE_8GB, SizeShift) - 1), SizeShift);
+    Ranges[RangeCount].Length      = LShiftU64 (1, SizeShift);
+    Ranges[RangeCount].Type        = GenerateRandomCacheType ();
+    UT_LOG_INFO ("--- Changed Memory Range ---\n");
+    DumpMemoryRanges (&Ranges[RangeCount], 1);
+    IncrementalStatus = MtrrSetMemoryAttributeInMtrrSettings (
+                          &IncrementalMtrrs,
+                          Ranges[RangeCount].BaseAddress,
+                          Ranges[RangeCount].Length,
+                          Ranges[RangeCount].Type
+                          );
+    UT_ASSERT_TRUE (IncrementalStatus == RETURN_SUCCESS || IncrementalStatus == RETURN_OUT_OF_RESOURCES || IncrementalStatus == RETURN_BUFFER_TOO_SMALL);
+    if (IncrementalStatus == RETURN_BUFFER_TOO_SMALL) {
+      break;
+    }
+
+    RangeCount++;
+    ZeroMem (&FullMtrrs, sizeof (FullMtrrs));
+    FullMtrrs.MtrrDefType = MtrrGetDefaultMemoryType ();
+    Status                = MtrrSetMemoryAttributesInMtrrSettings (&FullMtrrs, Scratch, &ScratchSize, Ranges, RangeCount);
+    if (Status == RETURN_BUFFER_TOO_SMALL) {
+      Scratch = realloc (Scratch, ScratchSize);
+      Status  = MtrrSetMemoryAttributesInMtrrSettings (&FullMtrrs, Scratch, &ScratchSize, Ranges, RangeCount);
+    }
+
+    UT_ASSERT_TRUE (Status == RETURN_SUCCESS || Status == RETURN_OUT_OF_RESOURCES);
+    if (Status == RETURN_OUT_OF_RESOURCES) {
+      break;
+    }
+
+    //
+    // The incremental update must fit whenever the full calculation does.
+    //
+    UT_ASSERT_STATUS_EQUAL (IncrementalStatus, RETURN_SUCCESS);
+
+    ExpectedMemoryRangesCount = ARRAY_SIZE (ExpectedMemoryRanges);
+    CollectTestResult (
+      SystemParameter->DefaultCacheType,
+      SystemParameter->PhysicalAddressBits,
+      SystemParameter->VariableMtrrCount,
+      &FullMtrrs,
+      ExpectedMemoryRanges,
+      &ExpectedMemoryRangesCount,
+      &ExpectedVariableMtrrUsage
+      );
+    UT_LOG_INFO ("--- Expected Memory Ranges [%d] ---\n", ExpectedMemoryRangesCount);
+    DumpMemoryRanges (ExpectedMemoryRanges, ExpectedMemoryRangesCount);
+
+    ActualMemoryRangesCount = ARRAY_SIZE (ActualMemoryRanges);
+    CollectTestResult (
+      SystemParameter->DefaultCacheType,
+      SystemParameter->PhysicalAddressBits,
+      SystemParameter->VariableMtrrCount,
+      &IncrementalMtrrs,
+      ActualMemoryRanges,
+      &ActualMemoryRangesCount,
+      &ActualVariableMtrrUsage
+      );
+    UT_LOG_INFO ("--- Actual Memory Ranges [%d] ---\n", ActualMemoryRangesCount);
+    DumpMemoryRanges (ActualMemoryRanges, ActualMemoryRangesCount);
+    VerifyMemoryRanges (ExpectedMemoryRanges, ExpectedMemoryRangesCount, ActualMemoryRanges, ActualMemoryRangesCount);
+    UT_ASSERT_TRUE (ExpectedVariableMtrrUsage >= ActualVariableMtrrUsage);
+  }
+
+  free (Scratch);
+
+  return UNIT_TEST_PASSED;
+}
+
 /**
   Prep routine for UnitTestGetFirmwareVariableMtrrCount().
 
@@ -1141,6 +1294,7 @@ UnitTestingEntry (
       AddTestCase (MtrrApiTests, "Test InvalidMemoryLayouts", "InvalidMemoryLayouts", UnitTestInvalidMemoryLayouts, InitializeSystem, NULL, &mSystemParameters[SystemIndex]);
       AddTestCase (MtrrApiTests, "Test MtrrSetMemoryAttributeInMtrrSettings", "MtrrSetMemoryAttributeInMtrrSettings", UnitTestMtrrSetMemoryAttributeInMtrrSettings, InitializeSystem, NULL, &mSystemParameters[SystemIndex]);
       AddTestCase (MtrrApiTests, "Test MtrrSetMemoryAttributesInMtrrSettings", "MtrrSetMemoryAttributesInMtrrSettings", UnitTestMtrrSetMemoryAttributesInMtrrSettings, InitializeSystem, NULL, &mSystemParameters[SystemIndex]);
+      AddTestCase (MtrrApiTests, "Test MtrrSetMemoryAttributeInMtrrSettings incrementally", "MtrrSetMemoryAttributeIncrementally", UnitTestMtrrSetMemoryAttributeIncrementally, InitializeSystem, NULL, &mSystemParameters[SystemIndex]);
     }
   }
 
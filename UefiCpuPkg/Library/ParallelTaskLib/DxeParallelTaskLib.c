@@ -0,0 +1,100 @@
+/** @file
+  Parallel task library instance for DXE drivers and UEFI applications.
+
+  The workers run on the enabled APs through EFI_MP_SERVICES_PROTOCOL, in
+  blocking mode: a non-blocking run would only be seen complete by the BSP
+  at the next AP status check of the MP services, which would delay every
+  run. The tasks run on the BSP alone if the protocol is not installed or if
+  there is no enabled AP.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "ParallelTaskLibInternal.h"
+
+#include <Protocol/MpService.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+/**
+  Locate the MP services protocol.
+
+  @return The protocol, or NULL if it is not installed.
+
+**/
+STATIC
+EFI_MP_SERVICES_PROTOCOL *
+InternalGetMpServices (
+  VOID
+  )
+{
+  EFI_STATUS                Status;
+  EFI_MP_SERVICES_PROTOCOL  *MpServices;
+
+  Status = gBS->LocateProtocol (&gEfiMpServiceProtocolGuid, NULL, (VOID **)&MpServices);
+  if (EFI_ERROR (Status)) {
+    return NULL;
+  }
+
+  return MpServices;
+}
+
+/**
+  Return the number of processors able to run workers.
+
+  The BSP waits for the APs, so only the APs run workers.
+
+  @return The number of enabled APs, 0 if unknown.
+
+**/
+UINTN
+InternalParallelTaskGetProcessorCount (
+  VOID
+  )
+{
+  EFI_STATUS                Status;
+  EFI_MP_SERVICES_PROTOCOL  *MpServices;
+  UINTN                     NumberOfProcessors;
+  UINTN                     NumberOfEnabledProcessors;
+
+  MpServices = InternalGetMpServices ();
+  if (MpServices == NULL) {
+    return 0;
+  }
+
+  Status = MpServices->GetNumberOfProcessors (MpServices, &NumberOfProcessors, &NumberOfEnabledProcessors);
+  if (EFI_ERROR (Status)) {
+    return 0;
+  }
+
+  return NumberOfEnabledProcessors - 1;
+}
+
+/**
+  Run InternalParallelTaskWorker() on the processors and wait for them.
+
+  The caller runs InternalParallelTaskWorker() once more when this function
+  returns, so the tasks left if the processors could not be started still
+  run, on the calling processor.
+
+  @param[in]  Queue   The queue to run.
+
+**/
+VOID
+InternalParallelTaskStartWorkers (
+  IN PARALLEL_TASK_QUEUE  *Queue
+  )
+{
+  EFI_STATUS                Status;
+  EFI_MP_SERVICES_PROTOCOL  *MpServices;
+
+  MpServices = InternalGetMpServices ();
+  if (MpServices == NULL) {
+    return;
+  }
+
+  Status = MpServices->StartupAllAPs (MpServices, InternalParallelTaskWorker, FALSE, NULL, 0, Queue, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "%a: StartupAllAPs - %r\n", __FUNCTION__, Status));
+  }
+}
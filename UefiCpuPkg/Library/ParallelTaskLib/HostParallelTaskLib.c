@@ -0,0 +1,95 @@
+/** @file
+  Parallel task library instance for host based unit tests.
+
+  The workers are POSIX threads. Unless PcdParallelTaskMaxWorkerCount is
+  set, there is one worker per online processor of the host. When it is set,
+  it gives the number of workers, which may then exceed the number of
+  processors of the host.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "ParallelTaskLibInternal.h"
+
+/**
+  Return the number of processors able to run workers.
+
+  @return The number of workers to create.
+
+**/
+UINTN
+InternalParallelTaskGetProcessorCount (
+  VOID
+  )
+{
+  long  Count;
+
+  if (PcdGet32 (PcdParallelTaskMaxWorkerCount) != 0) {
+    return PcdGet32 (PcdParallelTaskMaxWorkerCount);
+  }
+
+  Count = sysconf (_SC_NPROCESSORS_ONLN);
+  return (Count > 0) ? (UINTN)Count : 0;
+}
+
+/**
+  Entry point of the worker threads.
+
+  @param[in]  Queue   The queue to run.
+
+  @return NULL.
+
+**/
+STATIC
+void *
+InternalWorkerThread (
+  void  *Queue
+  )
+{
+  InternalParallelTaskWorker (Queue);
+  return NULL;
+}
+
+/**
+  Run InternalParallelTaskWorker() on the processors and wait for them.
+
+  The caller runs InternalParallelTaskWorker() once more when this function
+  returns, so the tasks left if the processors could not be started still
+  run, on the calling processor.
+
+  @param[in]  Queue   The queue to run.
+
+**/
+VOID
+InternalParallelTaskStartWorkers (
+  IN PARALLEL_TASK_QUEUE  *Queue
+  )
+{
+  pthread_t  *Threads;
+  UINTN      Count;
+  UINTN      Index;
+
+  Threads = malloc ((Queue->WorkerCount - 1) * sizeof (pthread_t));
+  if (Threads == NULL) {
+    return;
+  }
+
+  for (Count = 0; Count < Queue->WorkerCount - 1; Count++) {
+    if (pthread_create (&Threads[Count], NULL, InternalWorkerThread, Queue) != 0) {
+      break;
+    }
+  }
+
+  InternalParallelTaskWorker (Queue);
+
+  for (Index = 0; Index < Count; Index++) {
+    pthread_join (Threads[Index], NULL);
+  }
+
+  free (Threads);
+}
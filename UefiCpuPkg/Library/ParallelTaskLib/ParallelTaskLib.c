@@ -0,0 +1,637 @@
+/** @file
+  Work-stealing scheduler of the parallel task library.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "ParallelTaskLibInternal.h"
+
+/**
+  Acquire the lock of a deque.
+
+  AcquireSpinLock() is not used as it depends on a timer, which may not be
+  available on the APs.
+
+  @param[in, out]  Lock   The lock.
+
+**/
+STATIC
+VOID
+InternalAcquireLock (
+  IN OUT SPIN_LOCK  *Lock
+  )
+{
+  while (!AcquireSpinLockOrFail (Lock)) {
+    CpuPause ();
+  }
+}
+
+/**
+  Return a pseudo random number.
+
+  @param[in, out]  Seed   The state of the generator, never 0.
+
+  @return The next number of the sequence.
+
+**/
+STATIC
+UINT32
+InternalRandom (
+  IN OUT UINT32  *Seed
+  )
+{
+  UINT32  Value;
+
+  Value  = *Seed;
+  Value ^= Value << 13;
+  Value ^= Value >> 17;
+  Value ^= Value << 5;
+  *Seed  = Value;
+  return Value;
+}
+
+/**
+  Push a task to the deque of a worker.
+
+  @param[in, out]  Worker   The worker.
+  @param[in]       Task     The task.
+
+  @retval TRUE   The task was pushed.
+  @retval FALSE  The deque is full.
+
+**/
+STATIC
+BOOLEAN
+InternalPushTask (
+  IN OUT PARALLEL_TASK_WORKER  *Worker,
+  IN     CONST PARALLEL_TASK   *Task
+  )
+{
+  PARALLEL_TASK_QUEUE  *Queue;
+  BOOLEAN              Pushed;
+
+  Queue = Worker->Queue;
+
+  //
+  // Count the task before any other worker can see it, so that the workers
+  // never see no pending task while a task is in a deque.
+  //
+  InterlockedIncrement (&Queue->PendingTasks);
+
+  InternalAcquireLock (&Worker->Lock);
+  Pushed = (BOOLEAN)(Worker->Tail - Worker->Head <= Queue->CapacityMask);
+  if (Pushed) {
+    CopyMem (&Worker->Tasks[Worker->Tail & Queue->CapacityMask], Task, sizeof (*Task));
+    Worker->Tail++;
+  }
+
+  ReleaseSpinLock (&Worker->Lock);
+
+  if (!Pushed) {
+    InterlockedDecrement (&Queue->PendingTasks);
+  }
+
+  return Pushed;
+}
+
+/**
+  Take back the last task pushed by a worker to its deque.
+
+  @param[in, out]  Worker   The worker.
+  @param[out]      Task     The task.
+
+  @retval TRUE   A task was taken.
+  @retval FALSE  The deque is empty.
+
+**/
+STATIC
+BOOLEAN
+InternalPopTask (
+  IN OUT PARALLEL_TASK_WORKER  *Worker,
+  OUT    PARALLEL_TASK         *Task
+  )
+{
+  BOOLEAN  Popped;
+
+  if (Worker->Tail == Worker->Head) {
+    return FALSE;
+  }
+
+  InternalAcquireLock (&Worker->Lock);
+  Popped = (BOOLEAN)(Worker->Tail != Worker->Head);
+  if (Popped) {
+    Worker->Tail--;
+    CopyMem (Task, &Worker->Tasks[Worker->Tail & Worker->Queue->CapacityMask], sizeof (*Task));
+  }
+
+  ReleaseSpinLock (&Worker->Lock);
+  return Popped;
+}
+
+/**
+  Steal the oldest task of the deque of another worker.
+
+  The victims are tried in turn, starting from a random one. A victim whose
+  deque is locked is skipped rather than waited for.
+
+  @param[in, out]  Thief    The worker looking for a task.
+  @param[out]      Task     The task.
+
+  @retval TRUE   A task was stolen.
+  @retval FALSE  No task was found.
+
+**/
+STATIC
+BOOLEAN
+InternalStealTask (
+  IN OUT PARALLEL_TASK_WORKER  *Thief,
+  OUT    PARALLEL_TASK         *Task
+  )
+{
+  PARALLEL_TASK_QUEUE   *Queue;
+  PARALLEL_TASK_WORKER  *Victim;
+  UINTN                 Start;
+  UINTN                 Offset;
+  BOOLEAN               Stolen;
+
+  Queue = Thief->Queue;
+  Start = InternalRandom (&Thief->Seed) % Queue->WorkerCount;
+
+  for (Offset = 0; Offset < Queue->WorkerCount; Offset++) {
+    Victim = Queue->Workers[(Start + Offset) % Queue->WorkerCount];
+    if ((Victim == Thief) || (Victim->Tail == Victim->Head)) {
+      continue;
+    }
+
+    if (!AcquireSpinLockOrFail (&Victim->Lock)) {
+      continue;
+    }
+
+    Stolen = (BOOLEAN)(Victim->Tail != Victim->Head);
+    if (Stolen) {
+      CopyMem (Task, &Victim->Tasks[Victim->Head & Queue->CapacityMask], sizeof (*Task));
+      Victim->Head++;
+    }
+
+    ReleaseSpinLock (&Victim->Lock);
+    if (Stolen) {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Call the procedure of ParallelFor() on the chunks of a range.
+
+  The range is split in halves until it is a single chunk. The upper halves
+  are pushed to the deque of the worker, where the largest ones are the first
+  to be stolen, and the worker continues with the lower half.
+
+  @param[in]  Procedure   The procedure of ParallelFor().
+  @param[in]  Context     The context of Procedure.
+  @param[in]  Begin       First index of the range.
+  @param[in]  End         Index following the last index of the range.
+  @param[in]  Grain       Size of a chunk.
+  @param[in]  Worker      The worker, or NULL to run the whole range on the
+                          calling processor as worker 0.
+
+**/
+STATIC
+VOID
+InternalRunRange (
+  IN PARALLEL_FOR_PROCEDURE  Procedure,
+  IN VOID                    *Context,
+  IN UINTN                   Begin,
+  IN UINTN                   End,
+  IN UINTN                   Grain,
+  IN PARALLEL_TASK_WORKER    *Worker OPTIONAL
+  )
+{
+  PARALLEL_TASK  Split;
+  UINTN          Chunks;
+  UINTN          Size;
+
+  if (Worker != NULL) {
+    Split.Procedure = NULL;
+    Split.Context   = NULL;
+    while (End - Begin > Grain) {
+      Chunks      = (End - Begin - 1) / Grain + 1;
+      Split.Begin = Begin + (Chunks / 2) * Grain;
+      Split.End   = End;
+      if (!InternalPushTask (Worker, &Split)) {
+        break;
+      }
+
+      End = Split.Begin;
+    }
+  }
+
+  for ( ; Begin < End; Begin += Size) {
+    Size = MIN (End - Begin, Grain);
+    Procedure (Context, Begin, Begin + Size, (Worker != NULL) ? Worker->Index : 0);
+  }
+}
+
+/**
+  Run the tasks of a queue until none is left.
+
+  This function runs on every processor taking part in the run. The first
+  WorkerCount processors to call it each take a worker; the other ones
+  return at once.
+
+  @param[in, out]  Buffer   Pointer to the PARALLEL_TASK_QUEUE.
+
+**/
+VOID
+EFIAPI
+InternalParallelTaskWorker (
+  IN OUT VOID  *Buffer
+  )
+{
+  PARALLEL_TASK_QUEUE   *Queue;
+  PARALLEL_TASK_WORKER  *Worker;
+  PARALLEL_TASK         Task;
+  UINTN                 Index;
+
+  Queue = (PARALLEL_TASK_QUEUE *)Buffer;
+  Index = InterlockedIncrement (&Queue->JoinedWorkers) - 1;
+  if (Index >= Queue->WorkerCount) {
+    return;
+  }
+
+  Worker = Queue->Workers[Index];
+  while (Queue->PendingTasks != 0) {
+    if (InternalPopTask (Worker, &Task) || InternalStealTask (Worker, &Task)) {
+      if (Task.Procedure != NULL) {
+        Task.Procedure (Worker, Task.Context);
+      } else {
+        InternalRunRange (Queue->ForProcedure, Queue->ForContext, Task.Begin, Task.End, Queue->Grain, Worker);
+      }
+
+      InterlockedDecrement (&Queue->PendingTasks);
+    } else {
+      CpuPause ();
+    }
+  }
+}
+
+/**
+  Create a queue for a number of workers.
+
+  @param[in]   WorkerCount  Number of workers.
+  @param[in]   Capacity     Number of tasks that the deque of each worker
+                            holds.
+  @param[out]  Queue        The created queue.
+
+  @retval EFI_SUCCESS             The queue was created.
+  @retval EFI_INVALID_PARAMETER   Capacity is 0 or too large.
+  @retval EFI_OUT_OF_RESOURCES    The queue could not be allocated.
+
+**/
+STATIC
+EFI_STATUS
+InternalCreateQueue (
+  IN  UINTN                WorkerCount,
+  IN  UINTN                Capacity,
+  OUT PARALLEL_TASK_QUEUE  **Queue
+  )
+{
+  PARALLEL_TASK_QUEUE   *NewQueue;
+  PARALLEL_TASK_WORKER  *Worker;
+  UINTN                 Index;
+
+  if ((Capacity == 0) || (Capacity > SIZE_1MB)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if ((Capacity & (Capacity - 1)) != 0) {
+    Capacity = (UINTN)GetPowerOfTwo32 ((UINT32)Capacity) << 1;
+  }
+
+  NewQueue = AllocateZeroPool (sizeof (PARALLEL_TASK_QUEUE) + WorkerCount * sizeof (PARALLEL_TASK_WORKER *));
+  if (NewQueue == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  NewQueue->WorkerCount  = WorkerCount;
+  NewQueue->CapacityMask = Capacity - 1;
+  NewQueue->Workers      = (PARALLEL_TASK_WORKER **)(NewQueue + 1);
+
+  for (Index = 0; Index < WorkerCount; Index++) {
+    Worker = AllocateZeroPool (sizeof (PARALLEL_TASK_WORKER) + Capacity * sizeof (PARALLEL_TASK));
+    if (Worker == NULL) {
+      ParallelTaskQueueFree (NewQueue);
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Worker->Queue = NewQueue;
+    Worker->Index = Index;
+    Worker->Seed  = (UINT32)Index * 2654435761U + 1;
+    Worker->Tasks = (PARALLEL_TASK *)(Worker + 1);
+    InitializeSpinLock (&Worker->Lock);
+
+    NewQueue->Workers[Index] = Worker;
+  }
+
+  *Queue = NewQueue;
+  return EFI_SUCCESS;
+}
+
+/**
+  Return the number of workers that run the tasks.
+
+  This is the number of enabled processors able to run tasks, limited to
+  PcdParallelTaskMaxWorkerCount when it is not zero.
+
+  @return The number of workers, at least 1.
+
+**/
+UINTN
+EFIAPI
+ParallelTaskGetWorkerCount (
+  VOID
+  )
+{
+  UINTN  Count;
+  UINTN  MaxCount;
+
+  Count    = InternalParallelTaskGetProcessorCount ();
+  MaxCount = PcdGet32 (PcdParallelTaskMaxWorkerCount);
+  if ((MaxCount != 0) && (Count > MaxCount)) {
+    Count = MaxCount;
+  }
+
+  return MAX (Count, 1);
+}
+
+/**
+  Call a procedure on every chunk of a range of indexes, in parallel.
+
+  The range is split into chunks of Grain indexes, except for the last one of
+  each part which may be shorter. The chunks are called in no specific order,
+  and the function returns when all of them have been called.
+
+  @param[in]  Begin       First index of the range.
+  @param[in]  End         Index following the last index of the range.
+  @param[in]  Grain       Maximum number of indexes of a chunk. 0 selects a
+                          size giving a few chunks per worker.
+  @param[in]  Procedure   The procedure called on each chunk.
+  @param[in]  Context     The context passed to Procedure.
+
+  @retval EFI_SUCCESS             Procedure was called on every chunk.
+  @retval EFI_INVALID_PARAMETER   Procedure is NULL or End is lower than Begin.
+  @retval EFI_OUT_OF_RESOURCES    The deques could not be allocated. Nothing
+                                  was called.
+
+**/
+EFI_STATUS
+EFIAPI
+ParallelFor (
+  IN UINTN                   Begin,
+  IN UINTN                   End,
+  IN UINTN                   Grain,
+  IN PARALLEL_FOR_PROCEDURE  Procedure,
+  IN VOID                    *Context OPTIONAL
+  )
+{
+  EFI_STATUS           Status;
+  PARALLEL_TASK_QUEUE  *Queue;
+  PARALLEL_TASK        Task;
+  UINTN                WorkerCount;
+  UINTN                Chunks;
+  UINTN                Parts;
+  UINTN                Size;
+  UINTN                Index;
+
+  if ((Procedure == NULL) || (End < Begin)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  WorkerCount = ParallelTaskGetWorkerCount ();
+  if (Grain == 0) {
+    Grain = MAX ((End - Begin) / (WorkerCount * PARALLEL_FOR_CHUNKS_PER_WORKER), 1);
+  }
+
+  if ((WorkerCount == 1) || (End - Begin <= Grain)) {
+    InternalRunRange (Procedure, Context, Begin, End, Grain, NULL);
+    return EFI_SUCCESS;
+  }
+
+  Status = InternalCreateQueue (WorkerCount, PARALLEL_FOR_DEQUE_CAPACITY, &Queue);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Queue->ForProcedure = Procedure;
+  Queue->ForContext   = Context;
+  Queue->Grain        = Grain;
+
+  //
+  // Give each worker a part of the range to start with, so that the workers
+  // only steal to balance the load.
+  //
+  Chunks         = (End - Begin - 1) / Grain + 1;
+  Parts          = MIN (Chunks, WorkerCount);
+  Task.Procedure = NULL;
+  Task.Context   = NULL;
+  Task.End       = Begin;
+  for (Index = 0; Index < Parts; Index++) {
+    Task.Begin = Task.End;
+    Size       = (Chunks / Parts + ((Index < Chunks % Parts) ? 1 : 0)) * Grain;
+    Task.End   = ((Index == Parts - 1) || (End - Task.Begin <= Size)) ? End : Task.Begin + Size;
+
+    InternalPushTask (Queue->Workers[Index], &Task);
+  }
+
+  Status = ParallelTaskQueueRun (Queue);
+  ParallelTaskQueueFree (Queue);
+  return Status;
+}
+
+/**
+  Create a task queue.
+
+  @param[in]   Capacity   Number of tasks that the deque of each worker holds.
+                          It is rounded up to a power of 2.
+  @param[out]  Queue      The created queue.
+
+  @retval EFI_SUCCESS             The queue was created.
+  @retval EFI_INVALID_PARAMETER   Queue is NULL or Capacity is 0.
+  @retval EFI_OUT_OF_RESOURCES    The queue could not be allocated.
+
+**/
+EFI_STATUS
+EFIAPI
+ParallelTaskQueueCreate (
+  IN  UINTN                Capacity,
+  OUT PARALLEL_TASK_QUEUE  **Queue
+  )
+{
+  if (Queue == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  return InternalCreateQueue (ParallelTaskGetWorkerCount (), Capacity, Queue);
+}
+
+/**
+  Free a task queue.
+
+  @param[in]  Queue   The queue to free. It must not be running.
+
+**/
+VOID
+EFIAPI
+ParallelTaskQueueFree (
+  IN PARALLEL_TASK_QUEUE  *Queue
+  )
+{
+  UINTN  Index;
+
+  if (Queue == NULL) {
+    return;
+  }
+
+  for (Index = 0; Index < Queue->WorkerCount; Index++) {
+    if (Queue->Workers[Index] != NULL) {
+      FreePool (Queue->Workers[Index]);
+    }
+  }
+
+  FreePool (Queue);
+}
+
+/**
+  Add a task to a queue which is not running.
+
+  The tasks are spread over the deques of the workers in turn.
+
+  @param[in]  Queue       The queue.
+  @param[in]  Procedure   The procedure of the task.
+  @param[in]  Context     The context passed to Procedure.
+
+  @retval EFI_SUCCESS             The task was added.
+  @retval EFI_INVALID_PARAMETER   Queue or Procedure is NULL.
+  @retval EFI_OUT_OF_RESOURCES    The deques of all the workers are full.
+
+**/
+EFI_STATUS
+EFIAPI
+ParallelTaskQueueAdd (
+  IN PARALLEL_TASK_QUEUE      *Queue,
+  IN PARALLEL_TASK_PROCEDURE  Procedure,
+  IN VOID                     *Context OPTIONAL
+  )
+{
+  PARALLEL_TASK  Task;
+  UINTN          Tries;
+
+  if ((Queue == NULL) || (Procedure == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Task.Procedure = Procedure;
+  Task.Context   = Context;
+  Task.Begin     = 0;
+  Task.End       = 0;
+
+  for (Tries = 0; Tries < Queue->WorkerCount; Tries++) {
+    Queue->NextWorker = (Queue->NextWorker + 1) % Queue->WorkerCount;
+    if (InternalPushTask (Queue->Workers[Queue->NextWorker], &Task)) {
+      return EFI_SUCCESS;
+    }
+  }
+
+  return EFI_OUT_OF_RESOURCES;
+}
+
+/**
+  Run the tasks of a queue on all the workers.
+
+  The function returns when all the tasks, including the spawned ones, have
+  run. The queue is then empty and may be used again.
+
+  @param[in]  Queue   The queue.
+
+  @retval EFI_SUCCESS             All the tasks ran.
+  @retval EFI_INVALID_PARAMETER   Queue is NULL.
+
+**/
+EFI_STATUS
+EFIAPI
+ParallelTaskQueueRun (
+  IN PARALLEL_TASK_QUEUE  *Queue
+  )
+{
+  if (Queue == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (Queue->PendingTasks != 0) {
+    Queue->JoinedWorkers = 0;
+    if (Queue->WorkerCount > 1) {
+      InternalParallelTaskStartWorkers (Queue);
+    }
+
+    InternalParallelTaskWorker (Queue);
+  }
+
+  ASSERT (Queue->PendingTasks == 0);
+  return EFI_SUCCESS;
+}
+
+/**
+  Spawn a task from a running task.
+
+  The task is pushed to the deque of the worker, where it is either taken
+  back by the worker or stolen by another one. If the deque is full, the task
+  runs before the function returns.
+
+  @param[in]  Worker      The worker running the calling task.
+  @param[in]  Procedure   The procedure of the task.
+  @param[in]  Context     The context passed to Procedure.
+
+**/
+VOID
+EFIAPI
+ParallelTaskSpawn (
+  IN PARALLEL_TASK_WORKER     *Worker,
+  IN PARALLEL_TASK_PROCEDURE  Procedure,
+  IN VOID                     *Context OPTIONAL
+  )
+{
+  PARALLEL_TASK  Task;
+
+  ASSERT (Worker != NULL);
+  ASSERT (Procedure != NULL);
+
+  Task.Procedure = Procedure;
+  Task.Context   = Context;
+  Task.Begin     = 0;
+  Task.End       = 0;
+
+  if (!InternalPushTask (Worker, &Task)) {
+    Procedure (Worker, Context);
+  }
+}
+
+/**
+  Return the index of a worker.
+
+  @param[in]  Worker    The worker running the calling task.
+
+  @return The index of the worker, lower than ParallelTaskGetWorkerCount().
+
+**/
+UINTN
+EFIAPI
+ParallelTaskGetWorkerIndex (
+  IN PARALLEL_TASK_WORKER  *Worker
+  )
+{
+  ASSERT (Worker != NULL);
+  return Worker->Index;
+}
@@ -0,0 +1,122 @@
+/** @file
+  Internal definitions of the parallel task library.
+
+  ParallelTaskLib.c holds the scheduler, which does not depend on the phase.
+  Each instance provides the processor count and the way to start the
+  workers on the processors.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef PARALLEL_TASK_LIB_INTERNAL_H_
+#define PARALLEL_TASK_LIB_INTERNAL_H_
+
+#include <PiPei.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
+#include <Library/SynchronizationLib.h>
+#include <Library/ParallelTaskLib.h>
+
+//
+// Number of chunks given to each worker by ParallelFor() when the caller
+// does not select the grain.
+//
+#define PARALLEL_FOR_CHUNKS_PER_WORKER  8
+
+//
+// Capacity of the deques of ParallelFor(). A range is split in halves, so a
+// deque never holds more ranges than the number of bits of an index.
+//
+#define PARALLEL_FOR_DEQUE_CAPACITY  64
+
+//
+// A task, or a range of a ParallelFor() when Procedure is NULL.
+//
+typedef struct {
+  PARALLEL_TASK_PROCEDURE    Procedure;
+  VOID                       *Context;
+  UINTN                      Begin;
+  UINTN                      End;
+} PARALLEL_TASK;
+
+//
+// A worker and its deque. The owner pushes and pops tasks at Tail, the other
+// workers steal them at Head. The tasks follow the structure, so that the
+// hot fields of two workers are never in the same cache line.
+//
+struct _PARALLEL_TASK_WORKER {
+  PARALLEL_TASK_QUEUE    *Queue;
+  UINTN                  Index;
+  UINT32                 Seed;
+  SPIN_LOCK              Lock;
+  volatile UINTN         Head;
+  volatile UINTN         Tail;
+  PARALLEL_TASK          *Tasks;
+};
+
+struct _PARALLEL_TASK_QUEUE {
+  UINTN                     WorkerCount;
+  UINTN                     CapacityMask;
+  PARALLEL_TASK_WORKER      **Workers;
+  //
+  // Number of tasks added or spawned which have not completed yet. The
+  // workers leave when it drops to 0.
+  //
+  volatile UINT32           PendingTasks;
+  //
+  // Number of processors which have joined the run, giving their index.
+  //
+  volatile UINT32           JoinedWorkers;
+  UINTN                     NextWorker;
+  PARALLEL_FOR_PROCEDURE    ForProcedure;
+  VOID                      *ForContext;
+  UINTN                     Grain;
+};
+
+/**
+  Run the tasks of a queue until none is left.
+
+  This function runs on every processor taking part in the run. The first
+  WorkerCount processors to call it each take a worker; the other ones
+  return at once.
+
+  @param[in, out]  Buffer   Pointer to the PARALLEL_TASK_QUEUE.
+
+**/
+VOID
+EFIAPI
+InternalParallelTaskWorker (
+  IN OUT VOID  *Buffer
+  );
+
+/**
+  Return the number of processors able to run workers.
+
+  @return The number of enabled processors, 0 if unknown.
+
+**/
+UINTN
+InternalParallelTaskGetProcessorCount (
+  VOID
+  );
+
+/**
+  Run InternalParallelTaskWorker() on the processors and wait for them.
+
+  The caller runs InternalParallelTaskWorker() once more when this function
+  returns, so the tasks left if the processors could not be started still
+  run, on the calling processor.
+
+  @param[in]  Queue   The queue to run.
+
+**/
+VOID
+InternalParallelTaskStartWorkers (
+  IN PARALLEL_TASK_QUEUE  *Queue
+  );
+
+#endif
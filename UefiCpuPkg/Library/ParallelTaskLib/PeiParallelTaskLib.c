@@ -0,0 +1,96 @@
+/** @file
+  Parallel task library instance for PEI modules.
+
+  The workers run on all the enabled processors, the BSP included, through
+  EDKII_PEI_MP_SERVICES2_PPI. The tasks run on the BSP alone if the PPI is
+  not installed.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "ParallelTaskLibInternal.h"
+
+#include <Ppi/MpServices2.h>
+#include <Library/PeiServicesLib.h>
+
+/**
+  Locate the MP services PPI.
+
+  @return The PPI, or NULL if it is not installed.
+
+**/
+STATIC
+EDKII_PEI_MP_SERVICES2_PPI *
+InternalGetMpServices (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  EDKII_PEI_MP_SERVICES2_PPI  *MpServices;
+
+  Status = PeiServicesLocatePpi (&gEdkiiPeiMpServices2PpiGuid, 0, NULL, (VOID **)&MpServices);
+  if (EFI_ERROR (Status)) {
+    return NULL;
+  }
+
+  return MpServices;
+}
+
+/**
+  Return the number of processors able to run workers.
+
+  @return The number of enabled processors, 0 if unknown.
+
+**/
+UINTN
+InternalParallelTaskGetProcessorCount (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  EDKII_PEI_MP_SERVICES2_PPI  *MpServices;
+  UINTN                       NumberOfProcessors;
+  UINTN                       NumberOfEnabledProcessors;
+
+  MpServices = InternalGetMpServices ();
+  if (MpServices == NULL) {
+    return 0;
+  }
+
+  Status = MpServices->GetNumberOfProcessors (MpServices, &NumberOfProcessors, &NumberOfEnabledProcessors);
+  if (EFI_ERROR (Status)) {
+    return 0;
+  }
+
+  return NumberOfEnabledProcessors;
+}
+
+/**
+  Run InternalParallelTaskWorker() on the processors and wait for them.
+
+  The caller runs InternalParallelTaskWorker() once more when this function
+  returns, so the tasks left if the processors could not be started still
+  run, on the calling processor.
+
+  @param[in]  Queue   The queue to run.
+
+**/
+VOID
+InternalParallelTaskStartWorkers (
+  IN PARALLEL_TASK_QUEUE  *Queue
+  )
+{
+  EFI_STATUS                  Status;
+  EDKII_PEI_MP_SERVICES2_PPI  *MpServices;
+
+  MpServices = InternalGetMpServices ();
+  if (MpServices == NULL) {
+    return;
+  }
+
+  Status = MpServices->StartupAllCPUs (MpServices, InternalParallelTaskWorker, 0, Queue);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "%a: StartupAllCPUs - %r\n", __FUNCTION__, Status));
+  }
+}
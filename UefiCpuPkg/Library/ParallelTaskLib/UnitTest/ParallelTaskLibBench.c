@@ -0,0 +1,306 @@
+/** @file
+  Host benchmark of the ParallelTaskLib scaling.
+
+  Two workloads run with 1, 2, 4... workers, up to the maximum given on the
+  command line (256 by default):
+  - a ParallelFor() over a range of independent, compute bound indexes;
+  - a task queue running a binary tree of spawned tasks, which exercises the
+    stealing of tasks.
+
+  The number of workers is set through PcdParallelTaskMaxWorkerCount, so it
+  may exceed the number of processors of the host. The speedup then stops
+  growing at the number of processors, and the rest of the curve shows the
+  cost of the extra workers. The output is comma separated:
+
+    ParallelTaskLibBenchHost [max workers] [ParallelFor size]
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
+#include <Library/SynchronizationLib.h>
+#include <Library/ParallelTaskLib.h>
+
+#define BENCH_DEFAULT_MAX_WORKERS  256
+#define BENCH_DEFAULT_FOR_SIZE     SIZE_1MB
+
+//
+// Rounds of mixing done for each index of the ParallelFor() workload.
+//
+#define BENCH_ROUNDS_PER_INDEX  64
+
+//
+// Depth of the tree of the task workload, and rounds of mixing of a node.
+//
+#define BENCH_TREE_DEPTH        16
+#define BENCH_ROUNDS_PER_NODE   2048
+
+//
+// Per worker accumulator, alone in its cache line.
+//
+typedef struct {
+  UINT64    Sum;
+  UINT8     Pad[56];
+} BENCH_ACCUMULATOR;
+
+typedef struct {
+  UINTN               Depth;
+  volatile UINT32     *Count;
+} BENCH_NODE;
+
+BENCH_ACCUMULATOR  *mAccumulators;
+
+/**
+  Return a monotonic time stamp.
+
+  @return The time stamp in nanoseconds.
+
+**/
+UINT64
+BenchGetTimeNs (
+  VOID
+  )
+{
+  struct timespec  Now;
+
+  clock_gettime (CLOCK_MONOTONIC, &Now);
+  return (UINT64)Now.tv_sec * 1000000000ULL + (UINT64)Now.tv_nsec;
+}
+
+/**
+  Compute bound work on a value.
+
+  @param[in]  Value   The value to mix.
+  @param[in]  Rounds  Number of rounds.
+
+  @return The mixed value.
+
+**/
+UINT64
+BenchMix (
+  IN UINT64  Value,
+  IN UINTN   Rounds
+  )
+{
+  while (Rounds-- != 0) {
+    Value ^= Value >> 33;
+    Value *= 0xFF51AFD7ED558CCDULL;
+    Value ^= Value >> 29;
+  }
+
+  return Value;
+}
+
+/**
+  Procedure of the ParallelFor() workload.
+
+  @param[in]  Context       Unused.
+  @param[in]  Begin         First index of the chunk.
+  @param[in]  End           Index following the last index of the chunk.
+  @param[in]  WorkerIndex   Index of the worker.
+
+**/
+VOID
+EFIAPI
+BenchForProcedure (
+  IN VOID   *Context,
+  IN UINTN  Begin,
+  IN UINTN  End,
+  IN UINTN  WorkerIndex
+  )
+{
+  UINT64  Sum;
+
+  Sum = 0;
+  for ( ; Begin < End; Begin++) {
+    Sum += BenchMix (Begin, BENCH_ROUNDS_PER_INDEX);
+  }
+
+  mAccumulators[WorkerIndex].Sum += Sum;
+}
+
+/**
+  Task of the tree workload, spawning its two children.
+
+  @param[in]  Worker    The worker running the task.
+  @param[in]  Context   Pointer to the BENCH_NODE.
+
+**/
+VOID
+EFIAPI
+BenchTreeTask (
+  IN PARALLEL_TASK_WORKER  *Worker,
+  IN VOID                  *Context
+  )
+{
+  BENCH_NODE  *Node;
+
+  Node = (BENCH_NODE *)Context;
+  mAccumulators[ParallelTaskGetWorkerIndex (Worker)].Sum += BenchMix ((UINTN)Node, BENCH_ROUNDS_PER_NODE);
+  InterlockedIncrement (Node->Count);
+
+  //
+  // The nodes are read only, so all the tasks of a level share one node.
+  //
+  if (Node->Depth < BENCH_TREE_DEPTH) {
+    ParallelTaskSpawn (Worker, BenchTreeTask, Node + 1);
+    ParallelTaskSpawn (Worker, BenchTreeTask, Node + 1);
+  }
+}
+
+/**
+  Run the ParallelFor() workload once.
+
+  @param[in]  Size   Number of indexes.
+
+  @return The elapsed time in nanoseconds, 0 on error.
+
+**/
+UINT64
+BenchRunFor (
+  IN UINTN  Size
+  )
+{
+  UINT64  Start;
+
+  Start = BenchGetTimeNs ();
+  if (EFI_ERROR (ParallelFor (0, Size, 0, BenchForProcedure, NULL))) {
+    return 0;
+  }
+
+  return BenchGetTimeNs () - Start;
+}
+
+/**
+  Run the tree workload once.
+
+  @param[in]  Nodes   One node per level of the tree.
+
+  @return The elapsed time in nanoseconds, 0 on error.
+
+**/
+UINT64
+BenchRunTree (
+  IN BENCH_NODE  *Nodes
+  )
+{
+  PARALLEL_TASK_QUEUE  *Queue;
+  UINT64               Start;
+  UINT64               Elapsed;
+
+  *Nodes[0].Count = 0;
+  if (EFI_ERROR (ParallelTaskQueueCreate (64, &Queue))) {
+    return 0;
+  }
+
+  Start = BenchGetTimeNs ();
+  if (EFI_ERROR (ParallelTaskQueueAdd (Queue, BenchTreeTask, &Nodes[0])) ||
+      EFI_ERROR (ParallelTaskQueueRun (Queue)))
+  {
+    ParallelTaskQueueFree (Queue);
+    return 0;
+  }
+
+  Elapsed = BenchGetTimeNs () - Start;
+  ParallelTaskQueueFree (Queue);
+
+  return (*Nodes[0].Count == (1U << (BENCH_TREE_DEPTH + 1)) - 1) ? Elapsed : 0;
+}
+
+/**
+  Standard POSIX C entry point of the benchmark.
+
+  @param[in]  argc  Number of arguments.
+  @param[in]  argv  Arguments: maximum number of workers and ParallelFor()
+                    size.
+
+  @retval 0  All the runs succeeded.
+  @retval 1  A run failed.
+
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  UINTN            MaxWorkers;
+  UINTN            ForSize;
+  UINTN            Workers;
+  UINTN            Next;
+  UINTN            Index;
+  UINT64           ForTime;
+  UINT64           TreeTime;
+  UINT64           ForBase;
+  UINT64           TreeBase;
+  volatile UINT32  Count;
+  BENCH_NODE       Nodes[BENCH_TREE_DEPTH + 1];
+
+  MaxWorkers = (argc > 1) ? strtoul (argv[1], NULL, 0) : BENCH_DEFAULT_MAX_WORKERS;
+  ForSize    = (argc > 2) ? strtoul (argv[2], NULL, 0) : BENCH_DEFAULT_FOR_SIZE;
+  if (MaxWorkers == 0) {
+    MaxWorkers = BENCH_DEFAULT_MAX_WORKERS;
+  }
+
+  mAccumulators = AllocateZeroPool (MaxWorkers * sizeof (BENCH_ACCUMULATOR));
+  if (mAccumulators == NULL) {
+    return 1;
+  }
+
+  for (Index = 0; Index <= BENCH_TREE_DEPTH; Index++) {
+    Nodes[Index].Depth = Index;
+    Nodes[Index].Count = &Count;
+  }
+
+  printf ("Workers,ParallelFor ms,ParallelFor speedup,Tree ms,Tree speedup\n");
+  ForBase  = 0;
+  TreeBase = 0;
+  for (Workers = 1; Workers != 0; Workers = Next) {
+    PatchPcdSet32 (PcdParallelTaskMaxWorkerCount, (UINT32)Workers);
+
+    //
+    // Warm up the threads and the caches once before measuring.
+    //
+    BenchRunFor (ForSize / 16);
+    ForTime  = BenchRunFor (ForSize);
+    TreeTime = BenchRunTree (Nodes);
+    if ((ForTime == 0) || (TreeTime == 0)) {
+      printf ("%u,failed\n", (UINT32)Workers);
+      FreePool (mAccumulators);
+      return 1;
+    }
+
+    if (Workers == 1) {
+      ForBase  = ForTime;
+      TreeBase = TreeTime;
+    }
+
+    printf (
+      "%u,%.3f,%.2f,%.3f,%.2f\n",
+      (UINT32)Workers,
+      ForTime / 1e6,
+      (double)ForBase / ForTime,
+      TreeTime / 1e6,
+      (double)TreeBase / TreeTime
+      );
+    fflush (stdout);
+
+    //
+    // Double the workers, ending with a run with the maximum number of them.
+    //
+    Next = (Workers == MaxWorkers) ? 0 : MIN (Workers * 2, MaxWorkers);
+  }
+
+  FreePool (mAccumulators);
+  return 0;
+}
@@ -0,0 +1,492 @@
+/** @file
+  Unit tests of the ParallelTaskLib, run on the host instance of the library.
+
+  Every test runs with several numbers of workers, set through
+  PcdParallelTaskMaxWorkerCount, including more workers than chunks or tasks.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
+#include <Library/SynchronizationLib.h>
+#include <Library/UnitTestLib.h>
+#include <Library/ParallelTaskLib.h>
+
+#define UNIT_TEST_APP_NAME     "ParallelTaskLib Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// Numbers of workers the tests run with.
+//
+UINT32  mWorkerCounts[] = { 1, 2, 4, 16, 64 };
+
+//
+// Number of nodes of the tree of spawned tasks, a complete binary tree of
+// depth 12.
+//
+#define TREE_NODE_COUNT  ((1 << 13) - 1)
+
+typedef struct {
+  volatile UINT32    *Hits;
+  UINTN              Base;
+  UINTN              WorkerCount;
+  volatile UINT32    BadWorkerIndex;
+  volatile UINT32    BadChunk;
+  UINTN              Grain;
+} PARALLEL_FOR_TEST_CONTEXT;
+
+typedef struct {
+  volatile UINT32    Count;
+  UINTN              WorkerCount;
+  volatile UINT32    BadWorkerIndex;
+} TASK_TEST_CONTEXT;
+
+typedef struct _TREE_NODE TREE_NODE;
+
+struct _TREE_NODE {
+  TASK_TEST_CONTEXT    *Test;
+  TREE_NODE            *Nodes;
+  UINTN                Index;
+};
+
+/**
+  Set the number of workers of the test.
+
+  @param[in]  Context   Pointer to the number of workers.
+
+  @retval UNIT_TEST_PASSED  The number of workers was set.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+SetWorkerCount (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  PatchPcdSet32 (PcdParallelTaskMaxWorkerCount, *(UINT32 *)Context);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Restore the default number of workers.
+
+  @param[in]  Context   Pointer to the number of workers.
+**/
+VOID
+EFIAPI
+RestoreWorkerCount (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  PatchPcdSet32 (PcdParallelTaskMaxWorkerCount, 0);
+}
+
+/**
+  Procedure of ParallelFor() counting the calls of each index.
+
+  @param[in]  Context       Pointer to the PARALLEL_FOR_TEST_CONTEXT.
+  @param[in]  Begin         First index of the chunk.
+  @param[in]  End           Index following the last index of the chunk.
+  @param[in]  WorkerIndex   Index of the worker.
+**/
+VOID
+EFIAPI
+CountIndexes (
+  IN VOID   *Context,
+  IN UINTN  Begin,
+  IN UINTN  End,
+  IN UINTN  WorkerIndex
+  )
+{
+  PARALLEL_FOR_TEST_CONTEXT  *Test;
+  UINTN                      Index;
+
+  Test = (PARALLEL_FOR_TEST_CONTEXT *)Context;
+  if (WorkerIndex >= Test->WorkerCount) {
+    InterlockedIncrement (&Test->BadWorkerIndex);
+  }
+
+  if ((End <= Begin) || (End - Begin > Test->Grain)) {
+    InterlockedIncrement (&Test->BadChunk);
+  }
+
+  for (Index = Begin; Index < End; Index++) {
+    InterlockedIncrement (&Test->Hits[Index - Test->Base]);
+  }
+}
+
+/**
+  Check that ParallelFor() calls every index of a range exactly once.
+
+  @param[in]  Base    First index of the range.
+  @param[in]  Count   Number of indexes of the range.
+  @param[in]  Grain   Grain passed to ParallelFor().
+
+  @retval UNIT_TEST_PASSED             Every index was called once.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+CheckParallelFor (
+  IN UINTN  Base,
+  IN UINTN  Count,
+  IN UINTN  Grain
+  )
+{
+  PARALLEL_FOR_TEST_CONTEXT  Test;
+  EFI_STATUS                 Status;
+  UINTN                      Index;
+
+  Test.Hits           = AllocateZeroPool (MAX (Count, 1) * sizeof (UINT32));
+  Test.Base           = Base;
+  Test.WorkerCount    = ParallelTaskGetWorkerCount ();
+  Test.BadWorkerIndex = 0;
+  Test.BadChunk       = 0;
+  Test.Grain          = (Grain != 0) ? Grain : MAX_UINTN;
+  UT_ASSERT_NOT_NULL ((VOID *)Test.Hits);
+
+  Status = ParallelFor (Base, Base + Count, Grain, CountIndexes, &Test);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (Test.BadWorkerIndex, 0);
+  UT_ASSERT_EQUAL (Test.BadChunk, 0);
+  for (Index = 0; Index < Count; Index++) {
+    UT_ASSERT_EQUAL (Test.Hits[Index], 1);
+  }
+
+  FreePool ((VOID *)Test.Hits);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Test ParallelFor() on ranges of various sizes and grains.
+
+  @param[in]  Context   Pointer to the number of workers.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestParallelFor (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UT_ASSERT_EQUAL (ParallelTaskGetWorkerCount (), *(UINT32 *)Context);
+
+  UT_ASSERT_EQUAL (CheckParallelFor (0, 0, 1), UNIT_TEST_PASSED);
+  UT_ASSERT_EQUAL (CheckParallelFor (0, 1, 1), UNIT_TEST_PASSED);
+  UT_ASSERT_EQUAL (CheckParallelFor (5, 3, 16), UNIT_TEST_PASSED);
+  UT_ASSERT_EQUAL (CheckParallelFor (0, 100, 1), UNIT_TEST_PASSED);
+  UT_ASSERT_EQUAL (CheckParallelFor (17, 1000, 7), UNIT_TEST_PASSED);
+  UT_ASSERT_EQUAL (CheckParallelFor (0, 100000, 0), UNIT_TEST_PASSED);
+  UT_ASSERT_EQUAL (CheckParallelFor (MAX_UINTN - 5000, 5000, 3), UNIT_TEST_PASSED);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Test the parameter checks of ParallelFor().
+
+  @param[in]  Context   Pointer to the number of workers.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestParallelForInvalid (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UT_ASSERT_STATUS_EQUAL (ParallelFor (0, 10, 1, NULL, NULL), EFI_INVALID_PARAMETER);
+  UT_ASSERT_STATUS_EQUAL (ParallelFor (10, 0, 1, CountIndexes, NULL), EFI_INVALID_PARAMETER);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Task counting its runs.
+
+  @param[in]  Worker    The worker running the task.
+  @param[in]  Context   Pointer to the TASK_TEST_CONTEXT.
+**/
+VOID
+EFIAPI
+CountTask (
+  IN PARALLEL_TASK_WORKER  *Worker,
+  IN VOID                  *Context
+  )
+{
+  TASK_TEST_CONTEXT  *Test;
+
+  Test = (TASK_TEST_CONTEXT *)Context;
+  if (ParallelTaskGetWorkerIndex (Worker) >= Test->WorkerCount) {
+    InterlockedIncrement (&Test->BadWorkerIndex);
+  }
+
+  InterlockedIncrement (&Test->Count);
+}
+
+/**
+  Test a task queue without spawned tasks, run twice.
+
+  @param[in]  Context   Pointer to the number of workers.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestTaskQueue (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  PARALLEL_TASK_QUEUE  *Queue;
+  TASK_TEST_CONTEXT    Test;
+  EFI_STATUS           Status;
+  UINTN                Run;
+  UINTN                Index;
+
+  Test.Count          = 0;
+  Test.WorkerCount    = ParallelTaskGetWorkerCount ();
+  Test.BadWorkerIndex = 0;
+
+  Status = ParallelTaskQueueCreate (1000, &Queue);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+
+  for (Run = 1; Run <= 2; Run++) {
+    for (Index = 0; Index < 1000; Index++) {
+      Status = ParallelTaskQueueAdd (Queue, CountTask, &Test);
+      UT_ASSERT_NOT_EFI_ERROR (Status);
+    }
+
+    Status = ParallelTaskQueueRun (Queue);
+    UT_ASSERT_NOT_EFI_ERROR (Status);
+    UT_ASSERT_EQUAL (Test.Count, Run * 1000);
+  }
+
+  UT_ASSERT_EQUAL (Test.BadWorkerIndex, 0);
+
+  //
+  // Running an empty queue does nothing.
+  //
+  Status = ParallelTaskQueueRun (Queue);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (Test.Count, 2000);
+
+  ParallelTaskQueueFree (Queue);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Test that adding tasks fails once all the deques are full.
+
+  @param[in]  Context   Pointer to the number of workers.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestTaskQueueFull (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  PARALLEL_TASK_QUEUE  *Queue;
+  TASK_TEST_CONTEXT    Test;
+  EFI_STATUS           Status;
+  UINTN                Index;
+
+  Test.Count          = 0;
+  Test.WorkerCount    = ParallelTaskGetWorkerCount ();
+  Test.BadWorkerIndex = 0;
+
+  UT_ASSERT_STATUS_EQUAL (ParallelTaskQueueCreate (0, &Queue), EFI_INVALID_PARAMETER);
+
+  //
+  // A capacity of 3 is rounded up to 4.
+  //
+  Status = ParallelTaskQueueCreate (3, &Queue);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+
+  for (Index = 0; Index < 4 * Test.WorkerCount; Index++) {
+    Status = ParallelTaskQueueAdd (Queue, CountTask, &Test);
+    UT_ASSERT_NOT_EFI_ERROR (Status);
+  }
+
+  UT_ASSERT_STATUS_EQUAL (ParallelTaskQueueAdd (Queue, CountTask, &Test), EFI_OUT_OF_RESOURCES);
+  UT_ASSERT_STATUS_EQUAL (ParallelTaskQueueAdd (Queue, NULL, &Test), EFI_INVALID_PARAMETER);
+
+  Status = ParallelTaskQueueRun (Queue);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (Test.Count, 4 * Test.WorkerCount);
+
+  ParallelTaskQueueFree (Queue);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Task of a node of a binary tree, spawning the tasks of its children.
+
+  @param[in]  Worker    The worker running the task.
+  @param[in]  Context   Pointer to the TREE_NODE.
+**/
+VOID
+EFIAPI
+TreeTask (
+  IN PARALLEL_TASK_WORKER  *Worker,
+  IN VOID                  *Context
+  )
+{
+  TREE_NODE  *Node;
+
+  Node = (TREE_NODE *)Context;
+  CountTask (Worker, Node->Test);
+
+  //
+  // The children of node N are nodes 2N+1 and 2N+2.
+  //
+  if (2 * Node->Index + 2 < TREE_NODE_COUNT) {
+    ParallelTaskSpawn (Worker, TreeTask, &Node->Nodes[2 * Node->Index + 1]);
+    ParallelTaskSpawn (Worker, TreeTask, &Node->Nodes[2 * Node->Index + 2]);
+  }
+}
+
+/**
+  Test tasks spawning other tasks, with deques small enough to overflow.
+
+  @param[in]  Context   Pointer to the number of workers.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestSpawn (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  PARALLEL_TASK_QUEUE  *Queue;
+  TASK_TEST_CONTEXT    Test;
+  TREE_NODE            *Nodes;
+  EFI_STATUS           Status;
+  UINTN                Index;
+
+  Test.Count          = 0;
+  Test.WorkerCount    = ParallelTaskGetWorkerCount ();
+  Test.BadWorkerIndex = 0;
+
+  Nodes = AllocatePool (TREE_NODE_COUNT * sizeof (TREE_NODE));
+  UT_ASSERT_NOT_NULL (Nodes);
+  for (Index = 0; Index < TREE_NODE_COUNT; Index++) {
+    Nodes[Index].Test  = &Test;
+    Nodes[Index].Nodes = Nodes;
+    Nodes[Index].Index = Index;
+  }
+
+  //
+  // Deques of 4 tasks fill up quickly, so some of the spawned tasks run at
+  // once in ParallelTaskSpawn().
+  //
+  Status = ParallelTaskQueueCreate (4, &Queue);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+
+  Status = ParallelTaskQueueAdd (Queue, TreeTask, &Nodes[0]);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  Status = ParallelTaskQueueRun (Queue);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (Test.Count, TREE_NODE_COUNT);
+  UT_ASSERT_EQUAL (Test.BadWorkerIndex, 0);
+
+  ParallelTaskQueueFree (Queue);
+  FreePool (Nodes);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  ParallelTaskLib and run them.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      ParallelTaskTests;
+  UINTN                       Index;
+
+  Framework = NULL;
+
+  //
+  // Setup the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&ParallelTaskTests, Framework, "ParallelTaskLib API Tests", "ParallelTaskLib.ParallelTaskLib", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for ParallelTaskLib API Tests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  for (Index = 0; Index < ARRAY_SIZE (mWorkerCounts); Index++) {
+    AddTestCase (ParallelTaskTests, "Test ParallelFor", "ParallelFor", TestParallelFor, SetWorkerCount, RestoreWorkerCount, &mWorkerCounts[Index]);
+    AddTestCase (ParallelTaskTests, "Test ParallelFor invalid parameters", "ParallelForInvalid", TestParallelForInvalid, SetWorkerCount, RestoreWorkerCount, &mWorkerCounts[Index]);
+    AddTestCase (ParallelTaskTests, "Test task queue", "TaskQueue", TestTaskQueue, SetWorkerCount, RestoreWorkerCount, &mWorkerCounts[Index]);
+    AddTestCase (ParallelTaskTests, "Test full task queue", "TaskQueueFull", TestTaskQueueFull, SetWorkerCount, RestoreWorkerCount, &mWorkerCounts[Index]);
+    AddTestCase (ParallelTaskTests, "Test spawned tasks", "Spawn", TestSpawn, SetWorkerCount, RestoreWorkerCount, &mWorkerCounts[Index]);
+  }
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework != NULL) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param Argc  Number of arguments.
+  @param Argv  Array of arguments.
+
+  @return Test application exit code.
+**/
+INT32
+main (
+  INT32  Argc,
+  CHAR8  *Argv[]
+  )
+{
+  return UnitTestingEntry ();
+}